@@ -0,0 +1,8 @@
+import os
+import subprocess
+import sys
+
+# Regenerate lib/CustomDRC/CustomDRCWebAssetsData.h from WebDesign/Mockup. It is only rewritten when a file changed
+WEB_ASSETS_SCRIPT = os.path.join("..", "..", "WebDesign", "Mockup", "convert_to_headers.py")
+
+subprocess.check_call([sys.executable, WEB_ASSETS_SCRIPT])
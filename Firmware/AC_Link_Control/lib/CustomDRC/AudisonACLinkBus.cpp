@@ -3,424 +3,446 @@
  */
 
 #include "AudisonACLinkBus.hpp"
+#include "AudisonACLinkRmtSymbols.hpp"
 #include <Arduino.h>
 #include <SoftwareSerial.h> // https: //github.com/plerup/espsoftwareserial/tree/main
 
 #include <driver/rmt.h>
+#include <esp_timer.h>
+#include <freertos/ringbuf.h>
 #include "esp_check.h"
 #include "esp_log.h"
 static const char* TAG = "rmt-uart";
 
 /**
- * RMT payload uses "items". Each item can portray 2 bits on serial. We require a
- * START bit, 9 bits of data and STOP bit. We require 11 bits but use 12
- * (1 extra idle bit) which means we require 6 items to send 1 byte on the bus
+ * TX frames are encoded into a statically allocated item buffer with table copies (see AudisonACLinkRmtSymbols.hpp).
+ * rmt_write_items() waits for the frame to finish before it returns, so a single buffer is never written while the RMT
+ * is still reading it
  */
-#define RMT_ITEMS_REQUIRED_FOR_9_BIT_DATA 6
+#define TX_ITEM_BUFFER_LENGTH (AC_LINK_RMT_ITEMS_PER_CHARACTER * AC_LINK_TX_MAX_FRAME_SIZE_BYTES)
 
-/* Macros for the AC Link Bus data packets */
-#define HEADER_SIZE_BYTES   4
-#define CHECKSUM_SIZE_BYTES 1
+static DRAM_ATTR rmt_item32_t tx_items[TX_ITEM_BUFFER_LENGTH] __attribute__((aligned(4)));
+
+/* Build with -DAC_LINK_RX_HEX_DUMP=1 to print every frame on the bus (including our echoes) to Serial */
+#ifndef AC_LINK_RX_HEX_DUMP
+#define AC_LINK_RX_HEX_DUMP 0
+#endif
+
+/* RX framing */
+#define RX_FRAME_RING_CAPACITY       32  // Frames buffered between the RX task and the task parsing them
+#define RX_SERIAL_BUFFER_SIZE_BYTES  256 // Software serial byte buffer
+#define RX_TASK_POLL_PERIOD_MS       2   // ~7 bytes on the wire at 38400 baud
+
+/**
+ * RX is captured by a second RMT channel and decoded a burst at a time. This avoids the software serial GPIO interrupt
+ * on every edge. Build with -DAC_LINK_RMT_RX_ENABLED=0 to force the software serial RX path. We also fall back to it
+ * if the RMT RX channel fails to start. Note: the ESP32 RMT cannot ping-pong RX memory, a single burst (frames with
+ * no idle gap between them) must fit in RMT_RX_MEM_BLOCKS * 64 items
+ */
+#ifndef AC_LINK_RMT_RX_ENABLED
+#define AC_LINK_RMT_RX_ENABLED 1
+#endif
+#define RMT_RX_CHANNEL               RMT_CHANNEL_1
+#define RMT_RX_CLK_DIV               80                             // 1us per tick
+#define RMT_RX_TICKS_PER_SECOND      (APB_CLK_FREQ / RMT_RX_CLK_DIV)
+#define RMT_RX_MEM_BLOCKS            7                              // Every block after the TX channel, 448 items
+#define RMT_RX_RINGBUFFER_SIZE_BYTES 4096
+#define RMT_RX_FILTER_TICKS          80                             // APB ticks, ignore glitches shorter than 1us
+#define RMT_RX_IDLE_THRESHOLD_BITS   (AC_LINK_UART_BITS_PER_CHARACTER + 1) // Capture ends after > 1 character of idle
+
+/**
+ * Build with -DAC_LINK_SIMULATED_BUS=1 to run against the simulated bus (AudisonACLinkSimulator.hpp) instead of the
+ * transceiver. TX frames go to the node models and their answers are fed through the normal RX path, so everything
+ * from the frame assembler up is the real code. The PC plugs in and out forever for soak testing
+ */
+#ifndef AC_LINK_SIMULATED_BUS
+#define AC_LINK_SIMULATED_BUS 0
+#endif
+#if AC_LINK_SIMULATED_BUS
+#include "AudisonACLinkSimulator.hpp"
+
+#define SIM_TASK_PERIOD_MS           1
+#define SIM_REPORT_PERIOD_MS         10000
+#define SIM_RESPONSE_LATENCY_US      2000
+#define SIM_BIT_ERROR_RATE_PPM       100
+#define SIM_USB_CONNECTED_TIME_MS    3000
+#define SIM_USB_DISCONNECTED_TIME_MS 5000
+
+static struct AC_Link_Simulator_Config simulated_bus_config(void) {
+    struct AC_Link_Simulator_Config config;
+    config.response_latency_us = SIM_RESPONSE_LATENCY_US;
+    config.bit_error_rate_ppm = SIM_BIT_ERROR_RATE_PPM;
+    config.usb_connected_time_us = SIM_USB_CONNECTED_TIME_MS * 1000;
+    config.usb_disconnected_time_us = SIM_USB_DISCONNECTED_TIME_MS * 1000;
+    config.seed = esp_random();
+    return config;
+}
+
+AC_Link_Bus_Simulator simulated_bus(simulated_bus_config());
+SemaphoreHandle_t simulated_bus_mutex; // Bus task transmits, simulated RX task receives
+#endif
 
 /* Software Serial object handle */
 EspSoftwareSerial::UART rs485_serial_port;
 
+/* Frames are assembled byte by byte in the RX task and handed over through a lock-free ring */
+AC_Link_Frame_Assembler rx_frame_assembler;
+AC_Link_Frame_Ring<RX_FRAME_RING_CAPACITY> rx_frame_ring;
+
+/* Every RX and TX frame, for debugging the protocol in the field */
+AC_Link_Capture_Ring<AC_LINK_CAPTURE_RING_CAPACITY> ac_link_capture_ring;
+
+/* Guards the bus core's TX queues and coalescing table, which any task may write */
+static portMUX_TYPE bus_core_mux = portMUX_INITIALIZER_UNLOCKED;
+
 /* FreeRTOS task handles */
-TaskHandle_t rs485_bus_device_polling_task_handle, usb_connected_task_handle;
+TaskHandle_t rs485_bus_device_polling_task_handle, rs485_bus_task_handle, rs485_rx_task_handle;
 
 /* Task prioritites */
-#define TX_TASK_PRIORITY            tskIDLE_PRIORITY + 1
-#define USB_CONNECTED_TASK_PRIORITY tskIDLE_PRIORITY + 1
+#define TX_TASK_PRIORITY  tskIDLE_PRIORITY + 1
+#define BUS_TASK_PRIORITY tskIDLE_PRIORITY + 2
+#define RX_TASK_PRIORITY  tskIDLE_PRIORITY + 2
 
-bool master_mcu_is_on_bus = false; // Flag set to false by default, set to true when MCU acks on bus
+#define BUS_LOG_BUFFER_SIZE_BYTES 160
 
 /* DSP settings struct ptr */
 struct DSP_Settings* dsp_settings_rs485;
 
-void Audison_AC_Link_Bus::parse_rx_message(uint8_t* message, uint8_t message_len) {
-    if (message_len > 5) {
-        uint8_t receiver = message[0];
-        uint8_t transmitter = message[1];
-        uint8_t message_length = message[3];
-        uint8_t command = message[4];
+/**
+ * Connects the bus core to the transceiver, the RX ring and the rest of the DRC
+ */
+class Audison_AC_Link_Bus_Port : public AC_Link_Bus_Port {
+  public:
+    uint32_t now_us(void) override {
+        return micros();
+    }
+
+    void transmit(const struct AC_Link_Frame* frame) override {
+        ac_link_capture_ring.record(AC_LINK_CAPTURE_DIRECTION_TX, esp_timer_get_time(), frame->bytes, frame->length);
+#if AC_LINK_SIMULATED_BUS
+        xSemaphoreTake(simulated_bus_mutex, portMAX_DELAY);
+        simulated_bus.transmit(frame->bytes, frame->length, esp_timer_get_time());
+        xSemaphoreGive(simulated_bus_mutex);
+#else
+        size_t item_count = ac_link_frame_to_rmt_items(frame->bytes, frame->length, &tx_items[0].val);
+        // Now we write it to the bus. Blocks the bus task for the frame time only (~290us per byte)
+        digitalWrite(RS485_TX_EN_PIN, HIGH); // TX output enable
+        rmt_write_items(RMT_CHANNEL_0, tx_items, item_count, true);
+        digitalWrite(RS485_TX_EN_PIN, LOW); // TX output disable
+#endif
+    }
 
-        // Print all messages on serial
-        for (uint8_t i = 0; i < message_len; i++) {
-            Serial.print(message[i], HEX);
+    bool receive(struct AC_Link_Frame* frame) override {
+        if (!rx_frame_ring.pop(frame)) {
+            return false;
+        }
+#if AC_LINK_RX_HEX_DUMP
+        for (uint8_t i = 0; i < frame->length; i++) {
+            Serial.print(frame->bytes[i], HEX);
             Serial.print(" ");
         }
         Serial.println();
+#endif
+        return true;
+    }
 
-        if (receiver == AC_LINK_ADDRESS_DRC) // Filter only DRC addressed messages
-        {
-            if (transmitter == AC_LINK_ADDRESS_COMPUTER) {
-                switch (command) {
-                    case AC_LINK_COMMAND_DEVICE_IS_PRESENT:
-                        log_i("USB connected. RS485 bus inactive");
-                        change_led_mode(LED_MODE_USB_CONNECTED);
-                        this->send_fw_version_to_usb();
-                        update_web_server_parameter(DSP_SETTING_INDEX_USB_CONNECTED, 1);
-                        disable_encoders();
-                        vTaskResume(usb_connected_task_handle);   // Enable the USB connected task
-                        dsp_settings_rs485->usb_connected = true; // We set this flag last to avoid being unable to
-                                                                  // write to bus
-                        vTaskSuspend(rs485_bus_device_polling_task_handle); // Suspend the TX task last to avoid hanging
-                                                                            // ourselves without completing
-                        break;
-                    case AC_LINK_COMMAND_DEVICE_IS_DISCONNECTED:
-                        log_i("USB disconnected. RS485 bus active");
-                        change_led_mode(LED_MODE_DEVICE_RUNNING);
-                        dsp_settings_rs485->usb_connected = false;
-                        enable_encoders();
-                        this->update_device_with_latest_settngs(dsp_settings_rs485, AC_LINK_ADDRESS_MASTER_MCU);
-                        vTaskDelay(pdMS_TO_TICKS(500));
-                        this->update_device_with_latest_settngs(dsp_settings_rs485, AC_LINK_ADDRESS_DSP_PROCESSOR);
-                        update_web_server_parameter(DSP_SETTING_INDEX_USB_CONNECTED, 0);
-                        vTaskResume(rs485_bus_device_polling_task_handle); // Enable the TX task that pings devices on
-                                                                           // bus
-                        vTaskSuspend(usb_connected_task_handle); // Disable the USB connected task last to avoid hanging
-                                                                 // ourselves without completing
-                        break;
-                    default:
-                        log_i("RS485->USB->DRC, unknown command received: %02x", command);
-                        break;
-                }
-            } else if (transmitter == AC_LINK_ADDRESS_MASTER_MCU) {
-                switch (command) {
-                    case AC_LINK_COMMAND_DEVICE_IS_PRESENT:
-                        if (!master_mcu_is_on_bus) {
-                            log_i("Master MCU has joined the bus");
-                            master_mcu_is_on_bus = true;
-                        }
-                        break;
-                    default:
-                        log_i("RS485->MASTER_MCU->DRC, unknown command received from Master MCU "
-                              "processor: %02x",
-                              command);
-                        break;
-                }
-            } else if (transmitter == AC_LINK_ADDRESS_DSP_PROCESSOR) {
-                switch (command) {
-                    case AC_LINK_COMMAND_DEVICE_IS_PRESENT:
-                        this->dsp_on_bus = true;
-                        this->dsp_ping_count = 0;
-                        break;
-                    case AC_LINK_COMMAND_INPUT_SOURCE_NAME:
-                        if (message_length == 0x16) {
-                            // Copy the source name to the internal buffer
-                            memcpy(dsp_settings_rs485->current_source, &message[5], 16);
-                            update_web_server_parameter_string(DSP_SETTINGS_CURRENT_INPUT_SOURCE,
-                                                               dsp_settings_rs485->current_source);
-                            log_i("Current input source: %s", dsp_settings_rs485->current_source);
-                        }
-                        break;
-                    default:
-                        log_i("RS485->DSP_Pros->DRC, unknown command received by DSP processor");
-                        break;
-                }
-            } else {
-                log_e("RS485 unknown sender: %02x", transmitter);
-            }
-        } else if (receiver == AC_LINK_ADDRESS_MASTER_MCU) {
-            if (transmitter == AC_LINK_ADDRESS_COMPUTER) {
-                // Computer is communuicating to master MCU via Bit Tune software
-                switch (command) {
-                    case AC_LINK_COMMAND_CHANGE_DSP_MEMORY:
-                        dsp_settings_rs485->memory_select = message[5] - 1; // Offset for DSP index 1
-                        update_web_server_parameter(DSP_SETTING_INDEX_MEMORY_SELECT, message[5] - 1);
-                        break;
-                    case AC_LINK_COMMAND_MASTER_VOLUME:
-                        dsp_settings_rs485->master_volume = message[5];
-                        update_web_server_parameter(DSP_SETTING_INDEX_MASTER_VOLUME, message[5]);
-                        break;
-                    case AC_LINK_COMMAND_SUB_VOLUME_ADJUST:
-                        dsp_settings_rs485->sub_volume = message[5];
-                        update_web_server_parameter(DSP_SETTING_INDEX_SUB_VOLUME, message[5]);
-                        break;
-                    default:
-                        log_e("RS485->Master->USB: Unknown command received");
-                        break;
-                }
-            }
-        }
+    /**
+     * Dropped by the assembler (bit errors) or with the ring full. Written by the RX task
+     */
+    uint32_t rx_frames_lost(void) override {
+        return rx_frame_assembler.frames_dropped + rx_frame_ring.overflow_count;
     }
-}
 
-/**
- * void usb_connected_task(void* pvParameters)
- *
- * Task to monitor the RS485 bus when a PC is connected to the DSP via USB.
- * The PC acts as the master, we are now the slave. We listen to messages between the
- * PC and DSP / MCU. The PC also tells us when it is done via a disconnected packet
- */
-void usb_connected_task(void* pvParameters) {
-    Audison_AC_Link_Bus* ac_link_bus_ptr = (Audison_AC_Link_Bus*)pvParameters;
-    while (1) {
-        uint8_t received_message[50];
-        uint8_t bytes_to_read = ac_link_bus_ptr->read_rx_message(received_message, sizeof(received_message));
-        while (bytes_to_read > 5) {
-            ac_link_bus_ptr->parse_rx_message(received_message, bytes_to_read);
-            memset(received_message, 0x00, sizeof(bytes_to_read));
-            bytes_to_read = ac_link_bus_ptr->read_rx_message(received_message, sizeof(received_message));
-            vTaskDelay(pdMS_TO_TICKS(10)); // Let other stuff happen
-        }
-        vTaskDelay(pdMS_TO_TICKS(500)); // We can idle for a while since this is not too important
+    void lock(void) override {
+        portENTER_CRITICAL(&bus_core_mux);
     }
-}
 
-void rs485_bus_device_polling_task(void* pvParameters) {
-    bool boot_up_completed = false;
-    Audison_AC_Link_Bus* ac_link_bus_ptr = (Audison_AC_Link_Bus*)pvParameters;
-    while (1) {
-        if (!boot_up_completed) {
-            while (!ac_link_bus_ptr->is_dsp_on_bus()) {
-                ac_link_bus_ptr->check_dsp_processor_on_bus();
-                vTaskDelay(pdMS_TO_TICKS(1000));
-            }
-            ac_link_bus_ptr->update_device_with_latest_settngs(dsp_settings_rs485, AC_LINK_ADDRESS_MASTER_MCU);
-            vTaskDelay(pdMS_TO_TICKS(500));
-            ac_link_bus_ptr->update_device_with_latest_settngs(dsp_settings_rs485, AC_LINK_ADDRESS_DSP_PROCESSOR);
-            update_web_server_parameter_string(DSP_SETTINGS_CURRENT_INPUT_SOURCE, dsp_settings_rs485->current_source);
-            change_led_mode(LED_MODE_DEVICE_RUNNING);
-            boot_up_completed = true;
-        }
-        if (!dsp_settings_rs485->usb_connected) {
-            ac_link_bus_ptr->check_usb_on_bus();
-            vTaskDelay(pdMS_TO_TICKS(500));
-            ac_link_bus_ptr->check_dsp_processor_on_bus();
-            vTaskDelay(pdMS_TO_TICKS(500));
-        }
-        vTaskDelay(pdMS_TO_TICKS(250));
+    void unlock(void) override {
+        portEXIT_CRITICAL(&bus_core_mux);
     }
-}
 
-void Audison_AC_Link_Bus::set_volume(uint8_t volume, uint8_t receiver_address /*AC_LINK_ADDRESS_DSP_MASTER*/) {
-    if (volume <= MAX_VOLUME_VALUE) {
-        uint8_t volume_adjust_packet[2] = {AC_LINK_COMMAND_MASTER_VOLUME, volume};
-        this->write_to_audison_bus(receiver_address, AC_LINK_ADDRESS_DRC, (uint8_t*)volume_adjust_packet,
-                                   sizeof(volume_adjust_packet));
+    void wake(void) override {
+        xTaskNotifyGive(rs485_bus_task_handle);
     }
-}
 
-void Audison_AC_Link_Bus::set_balance(uint8_t balance_level, uint8_t receiver_address /*AC_LINK_ADDRESS_DSP_MASTER*/) {
-    if (balance_level <= MAX_BALANCE_VALUE) {
-        uint8_t balance_adjust_packet[2] = {AC_LINK_COMMAND_BALANCE_ADJUST, balance_level};
-        this->write_to_audison_bus(receiver_address, AC_LINK_ADDRESS_DRC, (uint8_t*)balance_adjust_packet,
-                                   sizeof(balance_adjust_packet));
+    void read_settings(uint8_t* values) override {
+        values[AC_LINK_SHADOW_MASTER_VOLUME] = dsp_settings_rs485->master_volume;
+        values[AC_LINK_SHADOW_SUB_VOLUME] = dsp_settings_rs485->sub_volume;
+        values[AC_LINK_SHADOW_BALANCE] = dsp_settings_rs485->balance;
+        values[AC_LINK_SHADOW_FADER] = dsp_settings_rs485->fader;
     }
-}
 
-void Audison_AC_Link_Bus::set_fader(uint8_t fade_level, uint8_t receiver_address /*AC_LINK_ADDRESS_DSP_MASTER*/) {
-    if (fade_level <= MAX_FADER_VALUE) {
-        uint8_t fader_adjust_packet[2] = {AC_LINK_COMMAND_FADER_ADJUST, fade_level};
-        this->write_to_audison_bus(receiver_address, AC_LINK_ADDRESS_DRC, (uint8_t*)fader_adjust_packet,
-                                   sizeof(fader_adjust_packet));
+    /**
+     * Copy a setting the PC changed into our own settings and the webapp
+     */
+    void on_setting_followed(uint8_t parameter, uint8_t value) override {
+        switch (parameter) {
+            case AC_LINK_SHADOW_MASTER_VOLUME:
+                dsp_settings_rs485->master_volume = value;
+                update_web_server_parameter(DSP_SETTING_INDEX_MASTER_VOLUME, value);
+                break;
+            case AC_LINK_SHADOW_SUB_VOLUME:
+                dsp_settings_rs485->sub_volume = value;
+                update_web_server_parameter(DSP_SETTING_INDEX_SUB_VOLUME, value);
+                break;
+            case AC_LINK_SHADOW_BALANCE:
+                dsp_settings_rs485->balance = value;
+                update_web_server_parameter(DSP_SETTING_INDEX_BALANCE, value);
+                break;
+            case AC_LINK_SHADOW_FADER:
+                dsp_settings_rs485->fader = value;
+                update_web_server_parameter(DSP_SETTING_INDEX_FADER, value);
+                break;
+            case AC_LINK_SHADOW_MEMORY:
+                dsp_settings_rs485->memory_select = value - 1; // Offset for DSP index 1
+                update_web_server_parameter(DSP_SETTING_INDEX_MEMORY_SELECT, value - 1);
+                break;
+            default:
+                break;
+        }
     }
-}
 
-void Audison_AC_Link_Bus::set_sub_volume(uint8_t sub_volume, uint8_t receiver_address /*AC_LINK_ADDRESS_DSP_MASTER*/) {
-    if (sub_volume <= MAX_SUB_VOLUME_VALUE) {
-        uint8_t sub_volume_adjust_packet[2] = {AC_LINK_COMMAND_SUB_VOLUME_ADJUST, sub_volume};
-        this->write_to_audison_bus(receiver_address, AC_LINK_ADDRESS_DRC, (uint8_t*)sub_volume_adjust_packet,
-                                   sizeof(sub_volume_adjust_packet));
+    void on_source_name(const char* name) override {
+        memcpy(dsp_settings_rs485->current_source, name, AC_LINK_SHADOW_SOURCE_NAME_LENGTH);
+        update_web_server_parameter_string(DSP_SETTINGS_CURRENT_INPUT_SOURCE, dsp_settings_rs485->current_source);
     }
-}
 
-void Audison_AC_Link_Bus::check_usb_on_bus(void) {
-    uint8_t packet[] = {AC_LINK_COMMAND_CHECK_DEVICE_PRESENT};
-    this->write_to_audison_bus(AC_LINK_ADDRESS_COMPUTER, AC_LINK_ADDRESS_DRC, packet, sizeof(packet), true);
-}
+    void on_usb_connected(void) override {
+        change_led_mode(LED_MODE_USB_CONNECTED);
+        update_web_server_parameter(DSP_SETTING_INDEX_USB_CONNECTED, 1);
+        disable_encoders();
+        dsp_settings_rs485->usb_connected = true;
+    }
 
-void Audison_AC_Link_Bus::check_master_mcu_on_bus(void) {
-    uint8_t packet[] = {AC_LINK_COMMAND_CHECK_DEVICE_PRESENT};
-    this->write_to_audison_bus(AC_LINK_ADDRESS_MASTER_MCU, AC_LINK_ADDRESS_DRC, packet, sizeof(packet), true);
-}
+    void on_usb_disconnected(void) override {
+        change_led_mode(LED_MODE_DEVICE_RUNNING);
+        dsp_settings_rs485->usb_connected = false;
+        enable_encoders();
+        update_web_server_parameter(DSP_SETTING_INDEX_USB_CONNECTED, 0);
+    }
 
-void Audison_AC_Link_Bus::check_dsp_processor_on_bus(void) {
-    this->dsp_ping_count++;
-    uint8_t packet[] = {AC_LINK_COMMAND_CHECK_DEVICE_PRESENT};
-    this->write_to_audison_bus(AC_LINK_ADDRESS_DSP_PROCESSOR, AC_LINK_ADDRESS_DRC, packet, sizeof(packet), true);
-    if (this->dsp_ping_count >= 5) {
-        log_e("Tried to ping the DSP too many times. Shutting down now");
-        shut_down_dsp();
+    void on_dsp_ready(void) override {
+        mark_boot_phase(BOOT_PHASE_DSP_READY);
     }
-}
 
-bool Audison_AC_Link_Bus::is_dsp_on_bus(void) {
-    return this->dsp_on_bus;
-}
+    void on_devices_synced(void) override {
+        mark_boot_phase(BOOT_PHASE_DEVICES_SYNCED); // Only the first one after boot is logged
+    }
 
-void Audison_AC_Link_Bus::send_fw_version_to_usb(void) {
-    uint8_t packet[] = {AC_LINK_COMMAND_DRC_FW_VERSION, DRC_FIRMWARE_VERSION[0], DRC_FIRMWARE_VERSION[1]};
-    this->write_to_audison_bus(AC_LINK_ADDRESS_COMPUTER, AC_LINK_ADDRESS_DRC, packet, sizeof(packet), false);
-}
+    void on_boot_complete(void) override {
+        update_web_server_parameter_string(DSP_SETTINGS_CURRENT_INPUT_SOURCE, dsp_settings_rs485->current_source);
+        change_led_mode(LED_MODE_DEVICE_RUNNING);
+    }
 
-void Audison_AC_Link_Bus::set_dsp_memory(uint8_t memory) {
-    /* We index the DSP memory at 0 but Audison have it indexed at 1. Apply the offset here */
-    uint8_t memory_corrected = memory + 1;
-    uint8_t packet[] = {AC_LINK_COMMAND_CHANGE_DSP_MEMORY, memory_corrected};
-    this->write_to_audison_bus(AC_LINK_ADDRESS_DSP_PROCESSOR, AC_LINK_ADDRESS_DRC, packet, sizeof(packet), false);
-}
+    void on_dsp_lost(void) override {
+        shut_down_dsp();
+    }
 
-void Audison_AC_Link_Bus::get_current_input_source(void) {
-    uint8_t packet[] = {AC_LINK_COMMAND_GET_CURRENT_SOURCE_NAME};
-    this->write_to_audison_bus(AC_LINK_ADDRESS_DSP_PROCESSOR, AC_LINK_ADDRESS_DRC, packet, sizeof(packet), true);
-}
+    void write_log(AC_Link_Bus_Log_Level level, const char* format, va_list args) override {
+        char message[BUS_LOG_BUFFER_SIZE_BYTES];
+        vsnprintf(message, sizeof(message), format, args);
+        switch (level) {
+            case AC_LINK_BUS_LOG_ERROR:
+                log_e("%s", message);
+                break;
+            case AC_LINK_BUS_LOG_WARNING:
+                log_w("%s", message);
+                break;
+            case AC_LINK_BUS_LOG_INFO:
+                log_i("%s", message);
+                break;
+            default:
+                log_d("%s", message);
+                break;
+        }
+    }
+};
 
-void Audison_AC_Link_Bus::change_source(void) {
-    /**Request the unit to change the source. Unit responds with the source that it has
-     * changed to -> we need to wait for response
-     * */
-    uint8_t packet[] = {AC_LINK_COMMAND_CHANGE_SOURCE, 0x00};
-    this->write_to_audison_bus(AC_LINK_ADDRESS_DSP_PROCESSOR, AC_LINK_ADDRESS_DRC, packet, sizeof(packet), true);
-    vTaskDelay(pdMS_TO_TICKS(500));
-    this->update_device_with_latest_settngs(dsp_settings_rs485, AC_LINK_ADDRESS_DSP_PROCESSOR);
-    vTaskDelay(pdMS_TO_TICKS(100));
-    this->update_device_with_latest_settngs(dsp_settings_rs485, AC_LINK_ADDRESS_MASTER_MCU);
-}
+static Audison_AC_Link_Bus_Port bus_port;
 
-void Audison_AC_Link_Bus::update_device_with_latest_settngs(struct DSP_Settings* settings,
-                                                            uint8_t receiver_address /*AC_LINK_ADDRESS_DSP_MASTER*/) {
-    this->set_volume(settings->master_volume, receiver_address);
-    vTaskDelay(pdMS_TO_TICKS(50));
-    this->set_sub_volume(settings->sub_volume, receiver_address);
-    vTaskDelay(pdMS_TO_TICKS(50));
-    this->set_balance(settings->balance, receiver_address);
-    vTaskDelay(pdMS_TO_TICKS(50));
-    this->set_fader(settings->fader, receiver_address);
+Audison_AC_Link_Bus::Audison_AC_Link_Bus(void) : AC_Link_Bus_Core(&bus_port, DRC_FIRMWARE_VERSION) {
 }
 
-void Audison_AC_Link_Bus::turn_off_main_unit(void) {
-    uint8_t data_packet[] = {AC_LINK_COMMAND_TURN_OFF_MAIN_UNIT};
-    this->write_to_audison_bus(AC_LINK_ADDRESS_MASTER_MCU, AC_LINK_ADDRESS_DRC, data_packet, sizeof(data_packet));
+/**
+ * Feed a received byte (and its 9th bit) into the frame assembler. Completed frames are pushed into the RX ring. Frame
+ * state is kept across calls so nothing is lost between bursts
+ */
+static void push_rx_byte(uint8_t data, bool is_address) {
+    if (rx_frame_assembler.push_byte(data, is_address) == AC_LINK_ASSEMBLER_FRAME_COMPLETE) {
+        const struct AC_Link_Frame* frame = rx_frame_assembler.frame();
+        ac_link_capture_ring.record(AC_LINK_CAPTURE_DIRECTION_RX, esp_timer_get_time(), frame->bytes, frame->length);
+        rx_frame_ring.push(frame);
+        xTaskNotifyGive(rs485_bus_task_handle); // Wake the bus task to dispatch it
+    }
 }
 
-uint8_t Audison_AC_Link_Bus::calculate_checksum(uint8_t* data_buffer, uint8_t data_length_bytes) {
-    uint32_t byte_sum = 0;
-    for (uint8_t i = 0; i < data_length_bytes; i++) {
-        byte_sum += data_buffer[i];
+static void log_rx_errors(void) {
+    static uint32_t last_overflow_count = 0;
+    static uint32_t last_dropped_count = 0;
+    if (rx_frame_ring.overflow_count != last_overflow_count) {
+        log_e("RS485 ERROR: RX frame ring full, %u frames lost",
+              (unsigned)(rx_frame_ring.overflow_count - last_overflow_count));
+        last_overflow_count = rx_frame_ring.overflow_count;
+    }
+    if (rx_frame_assembler.frames_dropped != last_dropped_count) {
+        log_e("RS485 ERROR: Dropped %u malformed frames",
+              (unsigned)(rx_frame_assembler.frames_dropped - last_dropped_count));
+        last_dropped_count = rx_frame_assembler.frames_dropped;
     }
-    uint8_t checksum = byte_sum % 256;
-    return checksum;
 }
 
-void Audison_AC_Link_Bus::enable_transmission(void) {
-    digitalWrite(this->tx_en_pin, HIGH);
+/**
+ * void rs485_serial_rx_task(void* pvParameters)
+ *
+ * Fallback RX path. Sole reader of the software serial port
+ */
+void rs485_serial_rx_task(void* pvParameters) {
+    while (1) {
+        while (rs485_serial_port.available()) {
+            uint8_t data = rs485_serial_port.read();
+            push_rx_byte(data, rs485_serial_port.readParity());
+        }
+        if (rs485_serial_port.overflow()) {
+            log_e("RS485 ERROR: Software serial buffer overflowed");
+        }
+        log_rx_errors();
+        vTaskDelay(pdMS_TO_TICKS(RX_TASK_POLL_PERIOD_MS));
+    }
 }
 
-void Audison_AC_Link_Bus::disable_transmission(void) {
-    digitalWrite(this->tx_en_pin, LOW);
+/**
+ * Convert an RMT RX duration (ticks) into a whole number of bit periods
+ */
+static inline uint16_t rmt_rx_ticks_to_bits(uint32_t duration_ticks) {
+    return (duration_ticks * RS485_BAUDRATE + (RMT_RX_TICKS_PER_SECOND / 2)) / RMT_RX_TICKS_PER_SECOND;
 }
 
-void Audison_AC_Link_Bus::purge_bus_rx_buffer(void) {
-    uint8_t bytes_to_read = 0xFF;
-    while (bytes_to_read) {
-        vTaskDelay(pdMS_TO_TICKS(100));
-        uint8_t received_message[50];
-        bytes_to_read = this->read_rx_message(received_message, sizeof(received_message));
-        if (bytes_to_read > 5) {
-            this->parse_rx_message(received_message, bytes_to_read);
+/**
+ * void rs485_rmt_rx_task(void* pvParameters)
+ *
+ * Default RX path. The RMT hands us a complete pulse train once the line has been idle for RMT_RX_IDLE_THRESHOLD_BITS.
+ * We decode the whole burst here, in task context, rather than per edge in an ISR
+ */
+void rs485_rmt_rx_task(void* pvParameters) {
+    RingbufHandle_t rx_ringbuffer = NULL;
+    rmt_get_ringbuf_handle(RMT_RX_CHANNEL, &rx_ringbuffer);
+    AC_Link_9bit_Uart_Decoder uart_decoder;
+    uint32_t last_framing_errors = 0;
+    while (1) {
+        size_t rx_size = 0;
+        rmt_item32_t* items = (rmt_item32_t*)xRingbufferReceive(rx_ringbuffer, &rx_size, pdMS_TO_TICKS(1000));
+        if (items) {
+            uint8_t data;
+            bool is_address;
+            size_t item_count = rx_size / sizeof(rmt_item32_t);
+            for (size_t i = 0; i < item_count; i++) {
+                if (items[i].duration0 == 0) {
+                    break; // End of capture marker
+                }
+                if (uart_decoder.push_run(items[i].level0, rmt_rx_ticks_to_bits(items[i].duration0), &data,
+                                          &is_address)) {
+                    push_rx_byte(data, is_address);
+                }
+                if (items[i].duration1 == 0) {
+                    break;
+                }
+                if (uart_decoder.push_run(items[i].level1, rmt_rx_ticks_to_bits(items[i].duration1), &data,
+                                          &is_address)) {
+                    push_rx_byte(data, is_address);
+                }
+            }
+            if (uart_decoder.end_of_burst(&data, &is_address)) {
+                push_rx_byte(data, is_address);
+            }
+            vRingbufferReturnItem(rx_ringbuffer, (void*)items);
+        }
+        if (uart_decoder.framing_errors != last_framing_errors) {
+            log_e("RS485 ERROR: %u RX framing errors", (unsigned)(uart_decoder.framing_errors - last_framing_errors));
+            last_framing_errors = uart_decoder.framing_errors;
         }
+        log_rx_errors();
     }
 }
 
-void Audison_AC_Link_Bus::write_to_audison_bus(uint8_t receiver_address, uint8_t transmitter_address, uint8_t* data,
-                                               uint8_t data_length, bool wait_for_response /*default=false*/) {
-    if (!dsp_settings_rs485->usb_connected) {
-        uint8_t message_length = HEADER_SIZE_BYTES + data_length + CHECKSUM_SIZE_BYTES;
-        uint8_t message_buffer[message_length];
-        message_buffer[0] = receiver_address;
-        message_buffer[1] = transmitter_address;
-        message_buffer[2] = 0x00;
-        message_buffer[3] = message_length;
-        for (uint8_t i = 0; i < data_length; i++) {
-            message_buffer[i + 4] = data[i];
-        }
-        /* Now we append the checksum - CheckSum8 Modulo 256 */
-        uint8_t checksum = this->calculate_checksum(message_buffer,
-                                                    sizeof(message_buffer) - 1); // Last byte is the checksum
-        message_buffer[message_length - 1] = checksum;
-
-        rmt_item32_t packet_rmt_items[RMT_ITEMS_REQUIRED_FOR_9_BIT_DATA * message_length];
-        this->convert_packet_to_rmt_items(message_buffer, message_length, packet_rmt_items);
-
-        while (xSemaphoreTake(this->rs485_bus_mutex, (TickType_t)10) != pdTRUE) {
-            vTaskDelay(pdMS_TO_TICKS(10));
-        }
-
-        // Now we write it to the bus
-        this->enable_transmission(); // TX output enable
-        rmt_write_items(RMT_CHANNEL_0, packet_rmt_items, sizeof(packet_rmt_items) / sizeof(packet_rmt_items[0]), true);
-        this->disable_transmission(); // TX output disable
-
-        // We can read what we just sent first
-        uint8_t transmitted_message[message_length];
-        uint8_t bytes_to_read = this->read_rx_message(transmitted_message, sizeof(transmitted_message));
-        if (bytes_to_read != message_length) {
-            log_e("RS485 ERROR: TX did not send the correct amount of bytes, sent %d bytes but expected to "
-                  "send %d bytes",
-                  bytes_to_read, message_length);
-            for (uint8_t i = 0; i < bytes_to_read; i++) {
-                Serial.print(transmitted_message[i], HEX);
-                Serial.print(" ");
-            }
-            Serial.println();
-
-            this->purge_bus_rx_buffer();
-
-        } else if (memcmp(message_buffer, transmitted_message, message_length) != 0) {
-            log_e("RS485 ERROR: Bytes sent not matching");
-            bytes_to_read = 0xFF;
-            this->purge_bus_rx_buffer();
-        } else {
-            for (uint8_t i = 0; i < sizeof(transmitted_message); i++) {
-                Serial.print(transmitted_message[i], HEX);
-                Serial.print(" ");
+#if AC_LINK_SIMULATED_BUS
+/**
+ * void rs485_simulated_rx_task(void* pvParameters)
+ *
+ * Stands in for the RX task. Runs the node models and feeds whatever they put on the bus into the frame assembler
+ */
+void rs485_simulated_rx_task(void* pvParameters) {
+    TickType_t last_report_tick = xTaskGetTickCount();
+    struct AC_Link_Frame frame;
+    while (1) {
+        xSemaphoreTake(simulated_bus_mutex, portMAX_DELAY);
+        uint64_t now_us = esp_timer_get_time();
+        simulated_bus.advance(now_us);
+        while (simulated_bus.receive(now_us, &frame)) {
+            for (uint8_t i = 0; i < frame.length; i++) {
+                push_rx_byte(frame.bytes[i], i == 0); // Only the receiver address has the 9th bit set
             }
-            Serial.println();
         }
-        if (wait_for_response) {
-            this->purge_bus_rx_buffer();
+        xSemaphoreGive(simulated_bus_mutex);
+        log_rx_errors();
+
+        if ((xTaskGetTickCount() - last_report_tick) >= pdMS_TO_TICKS(SIM_REPORT_PERIOD_MS)) {
+            last_report_tick = xTaskGetTickCount();
+            log_i("SIM: %u USB cycles, %u frames from DRC, %u to DRC, %u pings answered, %u corrupted, %u dropped",
+                  (unsigned)simulated_bus.usb_cycles, (unsigned)simulated_bus.frames_from_drc,
+                  (unsigned)simulated_bus.frames_to_drc, (unsigned)simulated_bus.presence_pings_answered,
+                  (unsigned)simulated_bus.frames_corrupted, (unsigned)simulated_bus.frames_dropped);
+            log_i("SIM: master volume DRC %d, MCU %d, DSP %d", dsp_settings_rs485->master_volume,
+                  simulated_bus.master_mcu.master_volume, simulated_bus.dsp.master_volume);
         }
-        xSemaphoreGive(this->rs485_bus_mutex);
-    } else {
-        log_e("Can't use the RS485 bus when USB is connected to the DSP!");
+        vTaskDelay(pdMS_TO_TICKS(SIM_TASK_PERIOD_MS));
     }
 }
+#endif
 
-uint8_t Audison_AC_Link_Bus::read_rx_message(uint8_t* data_buffer, uint8_t buffer_length) {
-    uint8_t bytes_to_read = rs485_serial_port.available();
-    if (bytes_to_read) {
-        uint8_t message_index = 0;
-        bool message_completed = false;
-        bool transmitter_address_found = false;
-        bool message_length_found = false;
-        uint8_t total_message_length = 0;
+/**
+ * Round a bus core wait up to whole ticks, so a short wait never turns into a busy loop
+ */
+static TickType_t bus_wait_ticks(uint32_t wait_us) {
+    if (wait_us == AC_LINK_BUS_WAIT_FOREVER) {
+        return portMAX_DELAY;
+    }
+    const uint32_t tick_period_us = portTICK_PERIOD_MS * 1000;
+    return (TickType_t)((wait_us + tick_period_us - 1) / tick_period_us);
+}
 
-        while (rs485_serial_port.available() && !message_completed) {
-            uint8_t data = rs485_serial_port.read();
-            if (!transmitter_address_found && rs485_serial_port.readParity() == true) {
-                data_buffer[message_index] = data; // We have the transmitter address
-                transmitter_address_found = true;
-            } else if (transmitter_address_found) // We are receiving a message
-            {
-                message_index++;
-                data_buffer[message_index] = data;
-                if (!message_length_found && message_index == 3) // The total length of message
-                {
-                    message_length_found = true;
-                    total_message_length = data;
-                } else if (message_length_found && message_index == (total_message_length - 1)) // Message
-                                                                                                // complete
-                {
-                    message_completed = true;
-                    return total_message_length;
-                }
-            }
+/**
+ * void rs485_bus_task(void* pvParameters)
+ *
+ * Owns the RS485 bus. It is the only task that transmits and the only consumer of the RX ring, so the bus needs no
+ * lock. Other tasks queue requests and carry on. When a PC is connected over USB it acts as the master and we only
+ * listen (and answer the PC) until it tells us it is done via a disconnected packet
+ */
+void rs485_bus_task(void* pvParameters) {
+    Audison_AC_Link_Bus* ac_link_bus_ptr = (Audison_AC_Link_Bus*)pvParameters;
+    uint32_t wait_us = 0;
+    while (1) {
+        // Woken early by new RX frames and newly queued requests
+        ulTaskNotifyTake(pdTRUE, bus_wait_ticks(wait_us));
+        wait_us = ac_link_bus_ptr->service_bus();
+    }
+}
+
+/**
+ * void rs485_bus_device_polling_task(void* pvParameters)
+ *
+ * Presence polling and the DSP boot wait, see AC_Link_Bus_Core::poll(). Runs outside the bus task because shutting
+ * down on a lost DSP waits for the bus task to send the power off
+ */
+void rs485_bus_device_polling_task(void* pvParameters) {
+    Audison_AC_Link_Bus* ac_link_bus_ptr = (Audison_AC_Link_Bus*)pvParameters;
+    while (1) {
+        ac_link_bus_ptr->poll();
+        if (!ac_link_bus_ptr->is_boot_completed()) {
+            // Woken as soon as the DSP is heard so the settings go out straight away
+            wait_for_boot_phases(1 << BOOT_PHASE_DSP_READY, pdMS_TO_TICKS(AC_LINK_POLL_PERIOD_US / 1000));
+        } else {
+            vTaskDelay(pdMS_TO_TICKS(AC_LINK_POLL_PERIOD_US / 1000));
         }
-        return total_message_length;
-    } else {
-        return 0;
     }
 }
 
@@ -428,52 +450,38 @@ void Audison_AC_Link_Bus::init_ac_link_bus(struct DSP_Settings* settings) {
     dsp_settings_rs485 = settings;
     this->tx_pin = RS485_TX_PIN;
     this->rx_pin = RS485_RX_PIN;
-    this->tx_en_pin = RS485_TX_EN_PIN;
 
-    pinMode(this->tx_en_pin, OUTPUT);
-    this->disable_transmission();
-
-    this->rs485_bus_mutex = xSemaphoreCreateMutex();
-    xSemaphoreGive(this->rs485_bus_mutex);
+    pinMode(RS485_TX_EN_PIN, OUTPUT);
+    digitalWrite(RS485_TX_EN_PIN, LOW); // TX output disable
 
     this->init_rmt(); // Enable RMT for TX
 
-    rs485_serial_port.begin(RS485_BAUDRATE, SWSERIAL_8S1, this->rx_pin, -1); // Use software serial only for RX
+    // The bus task has to exist before the RX task starts notifying it
+    xTaskCreatePinnedToCore(rs485_bus_task, "RS485_bus", 8 * 1024, this, BUS_TASK_PRIORITY, &rs485_bus_task_handle,
+                            1);
+
+#if AC_LINK_SIMULATED_BUS
+    log_w("Running on the simulated AC Link bus");
+    simulated_bus_mutex = xSemaphoreCreateMutex();
+    xTaskCreatePinnedToCore(rs485_simulated_rx_task, "RS485_sim", 4 * 1024, this, RX_TASK_PRIORITY,
+                            &rs485_rx_task_handle, 1);
+#else
+    bool rmt_rx_started = false;
+#if AC_LINK_RMT_RX_ENABLED
+    rmt_rx_started = (this->init_rmt_rx() == ESP_OK);
+#endif
+    if (rmt_rx_started) {
+        xTaskCreatePinnedToCore(rs485_rmt_rx_task, "RS485_rx", 4 * 1024, this, RX_TASK_PRIORITY,
+                                &rs485_rx_task_handle, 1);
+    } else {
+        log_w("RMT RX not available, using software serial for RX");
+        rs485_serial_port.begin(RS485_BAUDRATE, SWSERIAL_8S1, this->rx_pin, -1, false, RX_SERIAL_BUFFER_SIZE_BYTES);
+        xTaskCreatePinnedToCore(rs485_serial_rx_task, "RS485_rx", 4 * 1024, this, RX_TASK_PRIORITY,
+                                &rs485_rx_task_handle, 1);
+    }
+#endif
     xTaskCreatePinnedToCore(rs485_bus_device_polling_task, "RS485_tx", 8 * 1024, this, TX_TASK_PRIORITY,
                             &rs485_bus_device_polling_task_handle, 1);
-    xTaskCreatePinnedToCore(usb_connected_task, "USBConnRXTask", 8 * 1024, this, USB_CONNECTED_TASK_PRIORITY,
-                            &usb_connected_task_handle, 1);
-    vTaskSuspend(usb_connected_task_handle);
-}
-
-void Audison_AC_Link_Bus::convert_byte_to_rmt_item_9bit(uint8_t byte_to_convert, bool is_address,
-                                                        rmt_item32_t* item_buffer) {
-    /** NOTE: UART protocol requires LSB format. We start by adding the extra idle
-     * bit and STOP bit to the data packet. We add the address flag (9th bit), the 8 bits
-     * of data and then the STOP bit (LOW for UART). The STOP bit is achieved by left shifting
-     * everything - you are left with 0 as the STOP bit
-     */
-    uint16_t data = (0b11 << 10) | (is_address << 9) | (byte_to_convert << 1);
-
-    uint8_t item_index = 0;
-    for (uint8_t i = 0; i < 11; i += 2) {
-        item_buffer[item_index].duration0 = 50;
-        item_buffer[item_index].level0 = (data >> i) & 1;
-        item_buffer[item_index].duration1 = 50;
-        item_buffer[item_index].level1 = (data >> (i + 1)) & 1;
-        item_index++;
-    }
-}
-
-void Audison_AC_Link_Bus::convert_packet_to_rmt_items(uint8_t* packet, uint8_t packet_length,
-                                                      rmt_item32_t* item_buffer_ptr) {
-    uint8_t packet_byte = 0;
-    convert_byte_to_rmt_item_9bit(packet[packet_byte], true, item_buffer_ptr); // Convert the address first
-    item_buffer_ptr += RMT_ITEMS_REQUIRED_FOR_9_BIT_DATA; // Offset item pointer by size of packet and index
-    for (packet_byte = 1; packet_byte < packet_length; packet_byte++) {
-        convert_byte_to_rmt_item_9bit(packet[packet_byte], false, item_buffer_ptr);
-        item_buffer_ptr += RMT_ITEMS_REQUIRED_FOR_9_BIT_DATA; // Offset item pointer by size of packet and index
-    }
 }
 
 int Audison_AC_Link_Bus::init_rmt(void) {
@@ -495,4 +503,20 @@ int Audison_AC_Link_Bus::init_rmt(void) {
     ESP_ERROR_CHECK(rmt_driver_install(config.channel, 0, 0));
 
     return ESP_OK;
-}
\ No newline at end of file
+}
+int Audison_AC_Link_Bus::init_rmt_rx(void) {
+    rmt_config_t config = RMT_DEFAULT_CONFIG_RX(RS485_RX_PIN, RMT_RX_CHANNEL);
+    config.clk_div = RMT_RX_CLK_DIV;
+    config.mem_block_num = RMT_RX_MEM_BLOCKS;
+    config.rx_config.filter_en = true;
+    config.rx_config.filter_ticks_thresh = RMT_RX_FILTER_TICKS;
+    config.rx_config.idle_threshold = (RMT_RX_IDLE_THRESHOLD_BITS * RMT_RX_TICKS_PER_SECOND) / RS485_BAUDRATE;
+
+    ESP_RETURN_ON_ERROR(rmt_config(&config), TAG, "rmt rx config failed");
+    ESP_RETURN_ON_ERROR(rmt_driver_install(config.channel, RMT_RX_RINGBUFFER_SIZE_BYTES, 0), TAG,
+                        "rmt rx driver install failed");
+    ESP_RETURN_ON_ERROR(rmt_rx_start(config.channel, true), TAG, "rmt rx start failed");
+    log_i("RMT RX started, idle_threshold=%d ticks", config.rx_config.idle_threshold);
+
+    return ESP_OK;
+}
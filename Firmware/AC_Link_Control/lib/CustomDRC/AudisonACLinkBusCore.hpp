@@ -0,0 +1,1116 @@
+/**
+ * Author: Jaime Sequeira
+ *
+ * The AC Link bus owner: TX scheduling, echo and reply tracking, RX dispatch, presence polling and the settings resync.
+ * The clock, the wire and everything the rest of the DRC does about bus events come in through AC_Link_Bus_Port, so
+ * the firmware tasks and the host soak test run this same code. Like the codec, this file has no Arduino, FreeRTOS or
+ * ESP-IDF dependencies
+ */
+
+#pragma once
+
+#include "AudisonACLinkCodec.hpp"
+#include "AudisonACLinkDispatch.hpp"
+#include "AudisonACLinkShadow.hpp"
+
+// C includes
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+constexpr uint8_t MIN_VOLUME_VALUE = 0x00;
+constexpr uint8_t MAX_VOLUME_VALUE = 0x78;
+constexpr uint8_t MIN_SUB_VOLUME_VALUE = 0x00;
+constexpr uint8_t MAX_SUB_VOLUME_VALUE = 0x18;
+constexpr uint8_t MIN_FADER_VALUE = 0x00;
+constexpr uint8_t MAX_FADER_VALUE = 0x24;
+constexpr uint8_t MIN_BALANCE_VALUE = 0x00;
+constexpr uint8_t MAX_BALANCE_VALUE = 0x24;
+
+/* Frames we send are short, 32 bytes covers every command we know of */
+constexpr uint8_t AC_LINK_TX_MAX_FRAME_SIZE_BYTES = 32;
+constexpr uint8_t AC_LINK_TX_MAX_DATA_SIZE_BYTES =
+    AC_LINK_TX_MAX_FRAME_SIZE_BYTES - AC_LINK_HEADER_SIZE_BYTES - AC_LINK_CHECKSUM_SIZE_BYTES;
+
+/* TX scheduling */
+constexpr uint32_t AC_LINK_TX_ECHO_TIMEOUT_US = 20000;     // Time allowed for our own frame to come back
+constexpr uint32_t AC_LINK_TX_RESPONSE_TIMEOUT_US = 50000; // Time the bus is kept free for a device to answer us
+constexpr uint32_t AC_LINK_TX_INTER_FRAME_GAP_US = 10000;  // Minimum time from the end of our frame to the next one
+constexpr uint8_t AC_LINK_TX_QUEUE_LENGTH = 16;            // Requests per priority level
+constexpr uint8_t AC_LINK_TX_SETTING_SLOT_COUNT = 8;       // 4 continuous commands x (Master MCU, DSP)
+constexpr uint8_t AC_LINK_TX_LATENCY_LOG_SAMPLES = 16;     // Samples between latency / round trip reports
+constexpr uint32_t AC_LINK_BUS_WAIT_FOREVER = UINT32_MAX;  // Nothing to do until a frame arrives or a request is queued
+constexpr uint32_t AC_LINK_SOURCE_RELOAD_US = 500000;      // Time the DSP takes to reload its settings on a new source
+
+/**
+ * Presence polling backs off while a device keeps answering and drops back to the fastest rate as soon as a ping goes
+ * unanswered. Any frame from the device counts as an answer, so devices that are already talking are not pinged. The
+ * PC only answers once it is plugged in, so its ping backs off while nobody answers and goes out straight away when
+ * the PC is heard talking to the other devices
+ */
+constexpr uint32_t AC_LINK_POLL_PERIOD_US = 250000;               // poll() is called this often
+constexpr uint32_t AC_LINK_POLL_REPLY_WINDOW_US = 250000;         // Time a device has to answer a ping
+constexpr uint32_t AC_LINK_DSP_POLL_MIN_INTERVAL_US = 1000000;
+constexpr uint32_t AC_LINK_DSP_POLL_MAX_INTERVAL_US = 8000000;
+constexpr uint32_t AC_LINK_USB_POLL_MIN_INTERVAL_US = 1250000;
+constexpr uint32_t AC_LINK_USB_POLL_MAX_INTERVAL_US = 10000000;   // Longest a silent PC waits to be found
+constexpr uint8_t AC_LINK_DSP_MISSED_PING_LIMIT = 5;              // Unanswered pings at the fastest rate to shut down
+constexpr uint32_t AC_LINK_DSP_BOOT_TIMEOUT_US = 10000000;        // Boot pings do not count towards the limit
+constexpr uint32_t AC_LINK_POLL_STATS_LOG_INTERVAL_US = 60000000;
+
+/**
+ * The bus task always sends the highest priority request first. Requests with the same priority go out in the order
+ * they were queued. Continuous settings (see queue_setting_message) are sent ahead of every queue
+ */
+enum AC_Link_Tx_Priority {
+    AC_LINK_TX_PRIORITY_SETTING = 0, // User-facing setting changes (memory select)
+    AC_LINK_TX_PRIORITY_COMMAND,     // Source requests, firmware version, power off
+    AC_LINK_TX_PRIORITY_PRESENCE,    // Device presence pings
+    AC_LINK_TX_PRIORITY_COUNT,
+};
+
+enum AC_Link_Tx_Result {
+    AC_LINK_TX_OK = 0,
+    AC_LINK_TX_ERROR_NO_ECHO,         // Our frame never came back through the transceiver
+    AC_LINK_TX_ERROR_NO_RESPONSE,     // The receiver did not send the expected reply in time
+    AC_LINK_TX_ERROR_BUS_UNAVAILABLE, // The PC owns the bus over USB
+};
+
+/**
+ * Devices we keep track of. Indexes frames_heard
+ */
+enum AC_Link_Device {
+    AC_LINK_DEVICE_MASTER_MCU = 0,
+    AC_LINK_DEVICE_DSP_PROCESSOR,
+    AC_LINK_DEVICE_COMPUTER,
+    AC_LINK_DEVICE_COUNT,
+};
+
+/**
+ * @returns Index into frames_heard, AC_LINK_DEVICE_COUNT for addresses we do not track
+ */
+constexpr uint8_t ac_link_device_index(uint8_t device_address) {
+    return (device_address == AC_LINK_ADDRESS_MASTER_MCU)      ? AC_LINK_DEVICE_MASTER_MCU
+           : (device_address == AC_LINK_ADDRESS_DSP_PROCESSOR) ? AC_LINK_DEVICE_DSP_PROCESSOR
+           : (device_address == AC_LINK_ADDRESS_COMPUTER)      ? AC_LINK_DEVICE_COMPUTER
+                                                                : AC_LINK_DEVICE_COUNT;
+}
+
+/**
+ * Called by the bus task once a request has completed. Runs in the bus task so it must not block
+ */
+typedef void (*AC_Link_Tx_Callback)(AC_Link_Tx_Result result, void* context);
+
+struct AC_Link_Tx_Request {
+    uint8_t receiver_address;
+    uint8_t data_length;
+    uint8_t data[AC_LINK_TX_MAX_DATA_SIZE_BYTES];
+    bool wait_for_response;
+    AC_Link_Tx_Callback callback;
+    void* context;
+};
+
+/**
+ * Running min / max / average of a latency
+ */
+struct AC_Link_Latency_Stats {
+    uint32_t samples = 0;
+    uint32_t min_us = UINT32_MAX;
+    uint32_t max_us = 0;
+    uint64_t total_us = 0;
+
+    void add(uint32_t latency_us) {
+        this->samples++;
+        this->total_us += latency_us;
+        if (latency_us < this->min_us) {
+            this->min_us = latency_us;
+        }
+        if (latency_us > this->max_us) {
+            this->max_us = latency_us;
+        }
+    }
+
+    uint32_t average_us(void) const {
+        return this->samples ? (uint32_t)(this->total_us / this->samples) : 0;
+    }
+
+    void reset(void) {
+        *this = AC_Link_Latency_Stats();
+    }
+};
+
+/**
+ * FIFO of requests for one priority level. Not thread safe, the owner locks around it
+ *
+ * @tparam LENGTH Number of requests it can hold
+ */
+template <size_t LENGTH>
+class AC_Link_Tx_Queue {
+  public:
+    /**
+     * @returns false if the queue is full
+     */
+    bool push(const struct AC_Link_Tx_Request* request) {
+        if (this->count == LENGTH) {
+            return false;
+        }
+        this->requests[(this->head + this->count) % LENGTH] = *request;
+        this->count++;
+        return true;
+    }
+
+    /**
+     * @returns false if the queue is empty
+     */
+    bool pop(struct AC_Link_Tx_Request* request) {
+        if (this->count == 0) {
+            return false;
+        }
+        *request = this->requests[this->head];
+        this->head = (this->head + 1) % LENGTH;
+        this->count--;
+        return true;
+    }
+
+    bool empty(void) const {
+        return this->count == 0;
+    }
+
+  private:
+    struct AC_Link_Tx_Request requests[LENGTH];
+    size_t head = 0;
+    size_t count = 0;
+};
+
+enum AC_Link_Bus_Log_Level {
+    AC_LINK_BUS_LOG_ERROR = 0,
+    AC_LINK_BUS_LOG_WARNING,
+    AC_LINK_BUS_LOG_INFO,
+    AC_LINK_BUS_LOG_DEBUG,
+};
+
+/**
+ * Everything the bus owner needs from the platform it runs on. The firmware implements it with the RMT, the RX tasks
+ * and FreeRTOS, the host tests with the simulated bus and a virtual clock. Unless noted otherwise the calls are made
+ * from service_bus() in the bus task and must not block
+ */
+class AC_Link_Bus_Port {
+  public:
+    /**
+     * @returns Free running microsecond clock. Only differences are used so it may wrap
+     */
+    virtual uint32_t now_us(void) = 0;
+
+    /**
+     * Put a frame on the wire. May return before or after the frame has gone out, its echo comes back through
+     * receive() either way
+     */
+    virtual void transmit(const struct AC_Link_Frame* frame) = 0;
+
+    /**
+     * Take the next complete, valid frame read off the bus. Our own frames come back here too
+     * @returns false if there is none
+     */
+    virtual bool receive(struct AC_Link_Frame* frame) = 0;
+
+    /**
+     * @returns RX frames lost so far, dropped for bit errors or for lack of room. A stale count is fine
+     */
+    virtual uint32_t rx_frames_lost(void) = 0;
+
+    /**
+     * Guard the TX queues and the coalescing table, which any task may write. Held for a copy at most. Called from
+     * any task
+     */
+    virtual void lock(void) = 0;
+    virtual void unlock(void) = 0;
+
+    /**
+     * A request has been queued, call service_bus() soon. Called from any task
+     */
+    virtual void wake(void) = 0;
+
+    /**
+     * @param values Populated with the DRC's settings, indexed by AC_Link_Shadow_Parameter up to AC_LINK_SHADOW_MEMORY
+     */
+    virtual void read_settings(uint8_t* values) = 0;
+
+    /**
+     * The PC has changed a setting while it owns the bus
+     * @param parameter AC_Link_Shadow_Parameter
+     * @param value As sent on the bus
+     */
+    virtual void on_setting_followed(uint8_t parameter, uint8_t value) = 0;
+
+    /**
+     * @param name AC_LINK_SHADOW_SOURCE_NAME_LENGTH characters, not terminated
+     */
+    virtual void on_source_name(const char* name) = 0;
+
+    virtual void on_usb_connected(void) = 0;
+    virtual void on_usb_disconnected(void) = 0;
+
+    /**
+     * First frame received from the DSP
+     */
+    virtual void on_dsp_ready(void) = 0;
+
+    /**
+     * Every setting queued by a settings update is on the wire and the DSP is on the bus
+     */
+    virtual void on_devices_synced(void) = 0;
+
+    /**
+     * The DSP answered while it booted and both devices have been sent our settings. Called from poll()
+     */
+    virtual void on_boot_complete(void) = 0;
+
+    /**
+     * The DSP never came up or has stopped answering. Called from poll(), may block
+     */
+    virtual void on_dsp_lost(void) = 0;
+
+    virtual void write_log(AC_Link_Bus_Log_Level level, const char* format, va_list args) = 0;
+};
+
+class AC_Link_Bus_Core {
+  public:
+    /**
+     * @param port
+     * @param firmware_version Major, minor. Sent to the PC when it plugs in
+     */
+    AC_Link_Bus_Core(AC_Link_Bus_Port* port, const uint8_t (&firmware_version)[2])
+        : port(port), firmware_version{firmware_version[0], firmware_version[1]} {
+    }
+
+    /**
+     * @param volume Value between mute (0x00) and max volume (0x78)
+     * @param request_time_us Port now_us() when the change was requested, used to measure latency to the wire. 0 to
+     * skip
+     */
+    void set_volume(uint8_t volume, uint8_t receiver_address = AC_LINK_ADDRESS_MASTER_MCU,
+                    uint32_t request_time_us = 0) {
+        if (volume <= MAX_VOLUME_VALUE) {
+            this->queue_setting_message(receiver_address, AC_LINK_COMMAND_MASTER_VOLUME, volume, request_time_us);
+        }
+    }
+
+    /**
+     * @param balance_level Balance between left (0x00) and right (0x24)
+     * @param request_time_us Port now_us() when the change was requested. 0 to skip
+     */
+    void set_balance(uint8_t balance_level, uint8_t receiver_address = AC_LINK_ADDRESS_MASTER_MCU,
+                     uint32_t request_time_us = 0) {
+        if (balance_level <= MAX_BALANCE_VALUE) {
+            this->queue_setting_message(receiver_address, AC_LINK_COMMAND_BALANCE_ADJUST, balance_level,
+                                        request_time_us);
+        }
+    }
+
+    /**
+     * @param fade_level Fade between front (0x00) and rear (0x24)
+     * @param request_time_us Port now_us() when the change was requested. 0 to skip
+     */
+    void set_fader(uint8_t fade_level, uint8_t receiver_address = AC_LINK_ADDRESS_MASTER_MCU,
+                   uint32_t request_time_us = 0) {
+        if (fade_level <= MAX_FADER_VALUE) {
+            this->queue_setting_message(receiver_address, AC_LINK_COMMAND_FADER_ADJUST, fade_level, request_time_us);
+        }
+    }
+
+    /**
+     * @param sub_volume Value between 0x00 (mute) and 0x18 (-12dB)
+     * @param request_time_us Port now_us() when the change was requested. 0 to skip
+     */
+    void set_sub_volume(uint8_t sub_volume, uint8_t receiver_address = AC_LINK_ADDRESS_MASTER_MCU,
+                        uint32_t request_time_us = 0) {
+        if (sub_volume <= MAX_SUB_VOLUME_VALUE) {
+            this->queue_setting_message(receiver_address, AC_LINK_COMMAND_SUB_VOLUME_ADJUST, sub_volume,
+                                        request_time_us);
+        }
+    }
+
+    /**
+     * @param memory DSP_Memory_Select, 0 (A) or 1 (B)
+     */
+    void set_dsp_memory(uint8_t memory) {
+        /* We index the DSP memory at 0 but Audison have it indexed at 1. Apply the offset here */
+        uint8_t packet[] = {AC_LINK_COMMAND_CHANGE_DSP_MEMORY, (uint8_t)(memory + 1)};
+        this->queue_tx_message(AC_LINK_ADDRESS_DSP_PROCESSOR, packet, sizeof(packet), AC_LINK_TX_PRIORITY_SETTING);
+    }
+
+    /**
+     * Request the current source from the DSP
+     */
+    void get_current_input_source(void) {
+        uint8_t packet[] = {AC_LINK_COMMAND_GET_CURRENT_SOURCE_NAME};
+        this->queue_tx_message(AC_LINK_ADDRESS_DSP_PROCESSOR, packet, sizeof(packet), AC_LINK_TX_PRIORITY_COMMAND,
+                               true);
+    }
+
+    /**
+     * Request the DSP to change source. Note: we cannot dictate the requested source, the DSP just moves to the next
+     * one it decides. It answers with the name of the new source
+     */
+    void change_source(void) {
+        uint8_t packet[] = {AC_LINK_COMMAND_CHANGE_SOURCE, 0x00};
+        this->queue_tx_message(AC_LINK_ADDRESS_DSP_PROCESSOR, packet, sizeof(packet), AC_LINK_TX_PRIORITY_COMMAND,
+                               true, on_source_changed, this);
+    }
+
+    /**
+     * Turn off the main unit from the remote
+     * @param callback Optional, called once the command has been sent
+     * @param context Passed to the callback
+     */
+    void turn_off_main_unit(AC_Link_Tx_Callback callback = nullptr, void* context = nullptr) {
+        uint8_t packet[] = {AC_LINK_COMMAND_TURN_OFF_MAIN_UNIT};
+        this->queue_tx_message(AC_LINK_ADDRESS_MASTER_MCU, packet, sizeof(packet), AC_LINK_TX_PRIORITY_COMMAND, false,
+                               callback, context);
+    }
+
+    /**
+     * Checks to see if USB device is plugged in and bus is inaccessible
+     */
+    void check_usb_on_bus(void) {
+        this->ping(AC_LINK_ADDRESS_COMPUTER);
+    }
+
+    /**
+     * Request check if the master MCU (PIC) (0x00) is on the bus
+     */
+    void check_master_mcu_on_bus(void) {
+        this->ping(AC_LINK_ADDRESS_MASTER_MCU);
+    }
+
+    /**
+     * Request check to see if DSP processor (0x46) is on the bus
+     */
+    void ping_dsp_processor(void) {
+        this->ping(AC_LINK_ADDRESS_DSP_PROCESSOR);
+    }
+
+    /**
+     * Send the DRC firmware version (2 byte array) on the bus
+     */
+    void send_fw_version_to_usb(void) {
+        uint8_t packet[] = {AC_LINK_COMMAND_DRC_FW_VERSION, this->firmware_version[0], this->firmware_version[1]};
+        this->queue_tx_message(AC_LINK_ADDRESS_COMPUTER, packet, sizeof(packet), AC_LINK_TX_PRIORITY_COMMAND);
+    }
+
+    /**
+     * Send both devices the DRC's settings. Only the settings a device is not known to have already go out. The
+     * update itself runs in the bus task, which owns what each device was given. May be called from any task
+     */
+    void request_settings_update(void) {
+        this->port->lock();
+        this->settings_update_requested = true;
+        this->port->unlock();
+        this->port->wake();
+    }
+
+    /**
+     * Queue a frame for the bus task. Never blocks, the frame is sent once every higher priority request queued ahead
+     * of it has gone out. May be called from any task
+     * @param receiver_address Used for transmission. Parity bit will be marked to indicate address
+     * @param data Command followed by its values. Copied into the request
+     * @param data_length Length of the data buffer
+     * @param priority
+     * @param wait_for_response Keep the bus free until the receiver answers with the reply to this command (see
+     * ac_link_expected_response) or times out
+     * @param callback Optional, called by the bus task when the request completes
+     * @param context Passed to the callback
+     * @returns false if the request could not be queued. The callback is not called in that case
+     */
+    bool queue_tx_message(uint8_t receiver_address, const uint8_t* data, uint8_t data_length,
+                          AC_Link_Tx_Priority priority, bool wait_for_response = false,
+                          AC_Link_Tx_Callback callback = nullptr, void* context = nullptr) {
+        if (data_length == 0 || data_length > AC_LINK_TX_MAX_DATA_SIZE_BYTES) {
+            this->log(AC_LINK_BUS_LOG_ERROR, "RS485 ERROR: Frame with %d data bytes is too long to transmit",
+                      data_length);
+            return false;
+        }
+
+        struct AC_Link_Tx_Request request;
+        request.receiver_address = receiver_address;
+        request.data_length = data_length;
+        memcpy(request.data, data, data_length);
+        request.wait_for_response = wait_for_response;
+        request.callback = callback;
+        request.context = context;
+
+        this->port->lock();
+        bool queued = this->tx_queues[priority].push(&request);
+        this->port->unlock();
+        if (!queued) {
+            this->requests_dropped++;
+            this->log(AC_LINK_BUS_LOG_ERROR, "RS485 ERROR: TX queue %d full, dropping command %02x", priority, data[0]);
+            return false;
+        }
+        this->port->wake();
+        return true;
+    }
+
+    /**
+     * Queue a continuous setting (volume, balance, fader, sub volume). If the same setting for the same receiver is
+     * still waiting to be sent its value is replaced instead, only the latest value goes out. May be called from any
+     * task
+     * @param receiver_address
+     * @param command
+     * @param value
+     * @param request_time_us Port now_us() when the change was requested. 0 to skip latency tracking
+     * @returns false if the setting could not be queued
+     */
+    bool queue_setting_message(uint8_t receiver_address, uint8_t command, uint8_t value, uint32_t request_time_us = 0) {
+        bool written = false;
+        if (ac_link_command_is_continuous(command)) {
+            this->port->lock();
+            written = this->tx_setting_table.write(receiver_address, command, value, request_time_us);
+            this->port->unlock();
+        }
+        if (!written) {
+            // Not a continuous command or every slot is pending, send it like any other setting
+            uint8_t packet[] = {command, value};
+            return this->queue_tx_message(receiver_address, packet, sizeof(packet), AC_LINK_TX_PRIORITY_SETTING);
+        }
+        this->port->wake();
+        return true;
+    }
+
+    /**
+     * Bus task body. Dispatches received frames and sends the next queued request once the bus is free. Only the bus
+     * task may call this
+     * @returns Microseconds until the bus needs servicing again if nothing wakes the task before then, or
+     * AC_LINK_BUS_WAIT_FOREVER
+     */
+    uint32_t service_bus(void) {
+        struct AC_Link_Frame received_frame;
+        while (this->port->receive(&received_frame)) {
+            this->handle_rx_frame(&received_frame);
+        }
+
+        this->port->lock();
+        bool settings_update_requested = this->settings_update_requested;
+        this->settings_update_requested = false;
+        this->port->unlock();
+        if (settings_update_requested) {
+            // Queued back to back, paced out below
+            this->update_device_with_latest_settngs(AC_LINK_ADDRESS_MASTER_MCU);
+            this->update_device_with_latest_settngs(AC_LINK_ADDRESS_DSP_PROCESSOR);
+        }
+        uint32_t source_reload_wait_us = this->resync_after_source_reload();
+
+        uint32_t elapsed = this->port->now_us() - this->wait_start_us;
+        if (this->echo_pending) {
+            if (elapsed < AC_LINK_TX_ECHO_TIMEOUT_US) {
+                return AC_LINK_TX_ECHO_TIMEOUT_US - elapsed;
+            }
+            this->echo_timeouts++;
+            this->log(AC_LINK_BUS_LOG_ERROR, "RS485 ERROR: TX echo not received, expected %d bytes",
+                      this->active_frame.length);
+            this->finish_echo(AC_LINK_TX_ERROR_NO_ECHO);
+        }
+        if (this->pending_response.active) {
+            elapsed = this->port->now_us() - this->wait_start_us;
+            if (elapsed < AC_LINK_TX_RESPONSE_TIMEOUT_US) {
+                return AC_LINK_TX_RESPONSE_TIMEOUT_US - elapsed;
+            }
+            this->log(AC_LINK_BUS_LOG_DEBUG, "No reply from %02x to command %02x",
+                      this->active_request.receiver_address, this->active_request.data[0]);
+            this->pending_response.clear();
+            this->complete_request(AC_LINK_TX_ERROR_NO_RESPONSE);
+        }
+
+        // The bus is free. Leave a gap after our last frame before sending the next one
+        elapsed = this->port->now_us() - this->last_tx_us;
+        if (elapsed < AC_LINK_TX_INTER_FRAME_GAP_US) {
+            return AC_LINK_TX_INTER_FRAME_GAP_US - elapsed;
+        }
+
+        // Continuous settings go first, they are what the user is waiting on
+        uint8_t setting[2];
+        uint8_t receiver_address;
+        uint32_t request_time_us;
+        this->port->lock();
+        bool setting_pending =
+            this->tx_setting_table.take(&receiver_address, &setting[0], &setting[1], &request_time_us);
+        this->port->unlock();
+        if (setting_pending) {
+            this->active_request.receiver_address = receiver_address;
+            this->active_request.data_length = sizeof(setting);
+            memcpy(this->active_request.data, setting, sizeof(setting));
+            this->active_request.wait_for_response = false;
+            this->active_request.callback = nullptr;
+            this->active_request.context = nullptr;
+            this->transmit_request();
+            if (request_time_us && this->echo_pending) {
+                // The frame has just left the transceiver
+                this->setting_latency.add(this->port->now_us() - request_time_us);
+                if (this->setting_latency.samples >= AC_LINK_TX_LATENCY_LOG_SAMPLES) {
+                    this->log(AC_LINK_BUS_LOG_INFO, "Setting request to wire latency: avg %uus, min %uus, max %uus",
+                              (unsigned)this->setting_latency.average_us(), (unsigned)this->setting_latency.min_us,
+                              (unsigned)this->setting_latency.max_us);
+                    this->setting_latency.reset();
+                }
+            }
+            return 0;
+        }
+        if (this->resync_start_us) {
+            // Every queued setting is on the wire and echoed
+            this->log(AC_LINK_BUS_LOG_INFO, "Settings update: %u values sent, %u already up to date, %uus",
+                      this->resync_values_sent, this->resync_values_skipped,
+                      (unsigned)(this->port->now_us() - this->resync_start_us));
+            if (this->is_dsp_on_bus()) {
+                this->port->on_devices_synced();
+            }
+            this->resync_start_us = 0;
+            this->resync_values_sent = 0;
+            this->resync_values_skipped = 0;
+        }
+        for (uint8_t priority = 0; priority < AC_LINK_TX_PRIORITY_COUNT; priority++) {
+            this->port->lock();
+            bool request_pending = this->tx_queues[priority].pop(&this->active_request);
+            this->port->unlock();
+            if (request_pending) {
+                this->transmit_request();
+                return 0; // Check straight away in case the echo is already in
+            }
+        }
+        return source_reload_wait_us ? source_reload_wait_us : AC_LINK_BUS_WAIT_FOREVER;
+    }
+
+    /**
+     * Presence polling, and pinging the DSP until it answers after power up. Call every AC_LINK_POLL_PERIOD_US from
+     * one task (not the bus task, the port may block in on_dsp_lost())
+     */
+    void poll(void) {
+        uint32_t now = this->port->now_us();
+        if (!this->boot_up_completed) {
+            // The DSP was powered up with the bus. Any frame from it (answer or not) marks it as ready
+            if (!this->polling_started) {
+                this->boot_start_us = now;
+                this->last_stats_us = now;
+                this->polling_started = true;
+            }
+            if (!this->is_dsp_on_bus()) {
+                if ((now - this->boot_start_us) >= AC_LINK_DSP_BOOT_TIMEOUT_US) {
+                    this->log(AC_LINK_BUS_LOG_ERROR, "DSP did not come up. Shutting down now");
+                    this->port->on_dsp_lost();
+                }
+                this->ping_dsp_processor();
+                return;
+            }
+            this->request_settings_update();
+            this->port->on_boot_complete();
+            this->boot_up_completed = true;
+            this->dsp_poll.frames_heard = this->frames_heard[AC_LINK_DEVICE_DSP_PROCESSOR];
+            this->dsp_poll.last_heard_us = now;
+            this->dsp_poll.last_ping_us = now;
+        }
+        if (!this->usb_connected) {
+            // A PC talking to the other devices has been plugged in, ask it straight away
+            uint32_t pc_frames_heard = this->frames_heard[AC_LINK_DEVICE_COMPUTER];
+            bool pc_heard = pc_frames_heard != this->usb_poll.frames_heard;
+            this->usb_poll.frames_heard = pc_frames_heard;
+            if (pc_heard) {
+                this->usb_poll.interval_us = AC_LINK_USB_POLL_MIN_INTERVAL_US;
+            }
+            if (pc_heard || (now - this->usb_poll.last_ping_us) >= this->usb_poll.interval_us) {
+                this->check_usb_on_bus();
+                this->usb_poll.last_ping_us = now;
+                this->pings_sent++;
+                if (!pc_heard) {
+                    // Nobody has answered so far. Bit Tune talks to the devices as soon as it is plugged in, which
+                    // pc_heard picks up, so the timed ping is only for a PC that stays silent
+                    this->usb_poll.interval_us = (this->usb_poll.interval_us < AC_LINK_USB_POLL_MAX_INTERVAL_US / 2)
+                                                     ? this->usb_poll.interval_us * 2
+                                                     : AC_LINK_USB_POLL_MAX_INTERVAL_US;
+                }
+            }
+            if (this->dsp_poll_due(now)) {
+                this->ping_dsp_processor();
+                this->dsp_poll.last_ping_us = now;
+                this->dsp_poll.ping_outstanding = true;
+                this->pings_sent++;
+                if (++this->dsp_pings_unanswered >= AC_LINK_DSP_MISSED_PING_LIMIT) {
+                    this->log(AC_LINK_BUS_LOG_ERROR, "Tried to ping the DSP too many times. Shutting down now");
+                    this->port->on_dsp_lost();
+                }
+            }
+        }
+        if ((now - this->last_stats_us) >= AC_LINK_POLL_STATS_LOG_INTERVAL_US) {
+            this->log(AC_LINK_BUS_LOG_INFO, "Presence pings in the last %us: %u, DSP poll interval %ums, USB %ums",
+                      (unsigned)(AC_LINK_POLL_STATS_LOG_INTERVAL_US / 1000000), (unsigned)this->pings_sent,
+                      (unsigned)(this->dsp_poll.interval_us / 1000), (unsigned)(this->usb_poll.interval_us / 1000));
+            this->pings_sent = 0;
+            this->last_stats_us = now;
+        }
+    }
+
+    /**
+     * Check if the main DSP is on the bus
+     * @returns true if DSP is active on the bus
+     */
+    bool is_dsp_on_bus(void) const {
+        return this->dsp_on_bus;
+    }
+
+    /**
+     * @returns true while the PC owns the bus
+     */
+    bool is_usb_connected(void) const {
+        return this->usb_connected;
+    }
+
+    /**
+     * @returns true once the DSP has answered after power up and the devices have been sent our settings
+     */
+    bool is_boot_completed(void) const {
+        return this->boot_up_completed;
+    }
+
+    /**
+     * @returns true once nothing is queued, on the wire or waiting for a reply. Only the bus task may call this
+     */
+    bool is_idle(void) {
+        bool idle = !this->echo_pending && !this->pending_response.active && !this->source_reload_pending;
+        this->port->lock();
+        idle = idle && !this->settings_update_requested && this->tx_setting_table.empty();
+        for (uint8_t priority = 0; priority < AC_LINK_TX_PRIORITY_COUNT; priority++) {
+            idle = idle && this->tx_queues[priority].empty();
+        }
+        this->port->unlock();
+        return idle;
+    }
+
+    /**
+     * @returns Continuous setting values that never went on the bus because a newer one arrived first
+     */
+    uint32_t setting_values_replaced(void) const {
+        return this->tx_setting_table.values_replaced;
+    }
+
+    /* Counters */
+    uint32_t requests_dropped = 0; // TX queue full
+    uint32_t requests_refused = 0; // Not for the PC while it owned the bus
+    uint32_t echo_timeouts = 0;
+    uint32_t usb_sessions = 0;
+    uint32_t values_resent = 0; // By resyncs after a USB session
+    uint32_t values_skipped = 0;
+
+  private:
+    typedef void (AC_Link_Bus_Core::*Rx_Handler)(const struct AC_Link_Frame* frame);
+
+    struct Presence_Poll {
+        uint32_t interval_us;
+        uint32_t last_ping_us;
+        uint32_t last_heard_us; // When poll() first saw a frame from the device it had not seen before
+        uint32_t frames_heard;  // frames_heard from the device when poll() last looked
+        bool ping_outstanding;
+    };
+
+    void log(AC_Link_Bus_Log_Level level, const char* format, ...) __attribute__((format(printf, 3, 4))) {
+        va_list args;
+        va_start(args, format);
+        this->port->write_log(level, format, args);
+        va_end(args);
+    }
+
+    void ping(uint8_t receiver_address) {
+        uint8_t packet[] = {AC_LINK_COMMAND_CHECK_DEVICE_PRESENT};
+        this->queue_tx_message(receiver_address, packet, sizeof(packet), AC_LINK_TX_PRIORITY_PRESENCE, true);
+    }
+
+    /**
+     * Updates a device with the latest DRC settings. Only the settings the device is not known to have already are
+     * queued, see invalidate_device_settings. Bus task only, other tasks use request_settings_update()
+     * @param receiver_address Address of device that needs to be updated
+     * @returns Number of settings queued
+     */
+    uint8_t update_device_with_latest_settngs(uint8_t receiver_address) {
+        // Memory select is not part of the update, the DSP keeps it
+        uint8_t values[AC_LINK_SHADOW_MEMORY];
+        this->port->read_settings(values);
+        uint8_t device = ac_link_shadow_device(receiver_address);
+        uint8_t values_sent = 0;
+        uint8_t values_skipped = 0;
+        for (uint8_t parameter = 0; parameter < AC_LINK_SHADOW_MEMORY; parameter++) {
+            if (device < AC_LINK_SHADOW_DEVICE_COUNT && this->device_settings.devices[device].is_known(parameter) &&
+                this->device_settings.devices[device].values[parameter] == values[parameter]) {
+                values_skipped++;
+                continue;
+            }
+            // Coalesced settings go out in the order they were queued, paced by the bus task
+            this->queue_setting_message(receiver_address, ac_link_shadow_command(parameter), values[parameter]);
+            values_sent++;
+        }
+        if (values_sent && this->resync_start_us == 0) {
+            this->resync_start_us = this->port->now_us() | 1; // 0 means no update in progress
+        }
+        this->resync_values_sent += values_sent;
+        this->resync_values_skipped += values_skipped;
+        return values_sent;
+    }
+
+    /**
+     * Forget what a device was last sent, for when it may have reloaded its settings. The next update sends every
+     * setting. Bus task only
+     * @param device_address
+     */
+    void invalidate_device_settings(uint8_t device_address) {
+        uint8_t device = ac_link_shadow_device(device_address);
+        if (device < AC_LINK_SHADOW_DEVICE_COUNT) {
+            this->device_settings.devices[device].forget_all();
+        }
+    }
+
+    /**
+     * Decide whether the DSP needs a ping. Grows the interval after each answer, resets it after a missed one
+     */
+    bool dsp_poll_due(uint32_t now) {
+        uint32_t dsp_frames_heard = this->frames_heard[AC_LINK_DEVICE_DSP_PROCESSOR];
+        bool dsp_heard = dsp_frames_heard != this->dsp_poll.frames_heard;
+        this->dsp_poll.frames_heard = dsp_frames_heard;
+        if (dsp_heard) {
+            this->dsp_poll.last_heard_us = now;
+            this->dsp_pings_unanswered = 0;
+        }
+        if (this->dsp_poll.ping_outstanding) {
+            if (dsp_heard) {
+                this->dsp_poll.ping_outstanding = false;
+                this->dsp_poll.interval_us = (this->dsp_poll.interval_us < AC_LINK_DSP_POLL_MAX_INTERVAL_US / 2)
+                                                 ? this->dsp_poll.interval_us * 2
+                                                 : AC_LINK_DSP_POLL_MAX_INTERVAL_US;
+            } else if ((now - this->dsp_poll.last_ping_us) >= AC_LINK_POLL_REPLY_WINDOW_US) {
+                this->dsp_poll.ping_outstanding = false;
+                this->dsp_poll.interval_us = AC_LINK_DSP_POLL_MIN_INTERVAL_US; // Gone quiet, chase it
+                return (now - this->dsp_poll.last_ping_us) >= this->dsp_poll.interval_us;
+            } else {
+                return false;
+            }
+        }
+        // Recent traffic from the DSP is as good as an answer
+        return (now - this->dsp_poll.last_heard_us) >= this->dsp_poll.interval_us &&
+               (now - this->dsp_poll.last_ping_us) >= this->dsp_poll.interval_us;
+    }
+
+    /**
+     * Called for every frame the DSP sends, a presence reply or not
+     */
+    void set_dsp_on_bus(void) {
+        if (!this->dsp_on_bus) {
+            this->dsp_on_bus = true; // Set first, on_dsp_ready() may wake the poller
+            this->port->on_dsp_ready();
+        }
+    }
+
+    /**
+     * Computer is communicating to the master MCU / DSP via Bit Tune software. We follow along, every frame to or from
+     * the PC goes through the shadow model
+     */
+    void follow_usb_session(const struct AC_Link_Frame* frame) {
+        if (frame->transmitter() != AC_LINK_ADDRESS_COMPUTER && frame->receiver() != AC_LINK_ADDRESS_COMPUTER) {
+            return;
+        }
+        uint8_t changed = this->usb_session_shadow.observe(frame);
+        for (uint8_t parameter = 0; parameter < AC_LINK_SHADOW_PARAMETER_COUNT; parameter++) {
+            if (changed & (1 << parameter)) {
+                this->port->on_setting_followed(parameter, this->usb_session_shadow.latest.values[parameter]);
+            }
+        }
+        if (changed & AC_LINK_SHADOW_SOURCE_NAME_CHANGED) {
+            this->port->on_source_name(this->usb_session_shadow.source_name);
+        }
+    }
+
+    /**
+     * The PC has handed the bus back. Our settings already follow everything it sent and the bus tracks what each
+     * device was given, so only the values a device does not have yet go out. If any frame was lost since the last
+     * resync it may have been a setting the PC sent, so every value goes out
+     */
+    void resync_from_usb_session(void) {
+        uint32_t frames_lost = this->port->rx_frames_lost();
+        if (frames_lost != this->rx_frames_lost_at_last_resync) {
+            this->log(AC_LINK_BUS_LOG_WARNING, "USB session: %u RX frames lost, resending every value",
+                      (unsigned)(frames_lost - this->rx_frames_lost_at_last_resync));
+            this->invalidate_device_settings(AC_LINK_ADDRESS_MASTER_MCU);
+            this->invalidate_device_settings(AC_LINK_ADDRESS_DSP_PROCESSOR);
+            this->rx_frames_lost_at_last_resync = frames_lost;
+        }
+        uint8_t values_sent = this->update_device_with_latest_settngs(AC_LINK_ADDRESS_MASTER_MCU);
+        values_sent += this->update_device_with_latest_settngs(AC_LINK_ADDRESS_DSP_PROCESSOR);
+        this->values_resent += values_sent;
+        this->values_skipped += 2 * AC_LINK_SHADOW_MEMORY - values_sent;
+        this->log(AC_LINK_BUS_LOG_INFO, "USB session: followed %u frames (%u settings), resent %u values",
+                  (unsigned)this->usb_session_shadow.frames_observed,
+                  (unsigned)this->usb_session_shadow.settings_observed, values_sent);
+        this->usb_session_shadow.reset();
+    }
+
+    /**
+     * Runs in the bus task once the DSP has answered the change source request (or timed out). The DSP reloads its
+     * settings on a source change, once it has we push ours back to both devices (see service_bus)
+     */
+    static void on_source_changed(AC_Link_Tx_Result result, void* context) {
+        AC_Link_Bus_Core* bus = (AC_Link_Bus_Core*)context;
+        if (result != AC_LINK_TX_OK) {
+            // No answer, the source may not have changed. Nothing was reloaded that we know of
+            bus->log(AC_LINK_BUS_LOG_WARNING, "Source change not confirmed by the DSP, settings not resent");
+            return;
+        }
+        bus->source_reload_pending = true;
+        bus->source_changed_us = bus->port->now_us();
+    }
+
+    /**
+     * Resend every setting to both devices once the DSP has had time to reload after a source change
+     * @returns Microseconds until the reload is due, 0 if none is pending or it has just been queued
+     */
+    uint32_t resync_after_source_reload(void) {
+        if (!this->source_reload_pending) {
+            return 0;
+        }
+        uint32_t elapsed = this->port->now_us() - this->source_changed_us;
+        if (elapsed < AC_LINK_SOURCE_RELOAD_US) {
+            return AC_LINK_SOURCE_RELOAD_US - elapsed;
+        }
+        this->source_reload_pending = false;
+        this->invalidate_device_settings(AC_LINK_ADDRESS_DSP_PROCESSOR);
+        this->invalidate_device_settings(AC_LINK_ADDRESS_MASTER_MCU);
+        this->update_device_with_latest_settngs(AC_LINK_ADDRESS_DSP_PROCESSOR);
+        this->update_device_with_latest_settngs(AC_LINK_ADDRESS_MASTER_MCU);
+        return 0;
+    }
+
+    /* RX frame handlers, only run for frames with the payload length listed in parse_rx_message() */
+
+    void on_usb_connected(const struct AC_Link_Frame*) {
+        this->log(AC_LINK_BUS_LOG_INFO, "USB connected. RS485 bus inactive");
+        this->send_fw_version_to_usb();
+        if (!this->usb_connected) {
+            this->usb_sessions++;
+        }
+        this->usb_connected = true; // From here on we only answer the PC, and stop pinging devices
+        this->port->on_usb_connected();
+    }
+
+    void on_usb_disconnected(const struct AC_Link_Frame*) {
+        this->log(AC_LINK_BUS_LOG_INFO, "USB disconnected. RS485 bus active");
+        this->usb_connected = false;
+        this->port->on_usb_disconnected();
+        this->resync_from_usb_session();
+    }
+
+    void on_master_mcu_present(const struct AC_Link_Frame*) {
+        if (!this->master_mcu_on_bus) {
+            this->log(AC_LINK_BUS_LOG_INFO, "Master MCU has joined the bus");
+            this->master_mcu_on_bus = true;
+        }
+    }
+
+    void on_dsp_present(const struct AC_Link_Frame*) {
+        this->set_dsp_on_bus();
+    }
+
+    void on_input_source_name(const struct AC_Link_Frame* frame) {
+        char name[AC_LINK_SHADOW_SOURCE_NAME_LENGTH + 1] = {};
+        memcpy(name, frame->payload(), AC_LINK_SHADOW_SOURCE_NAME_LENGTH);
+        this->port->on_source_name(name);
+        this->log(AC_LINK_BUS_LOG_INFO, "Current input source: %s", name);
+    }
+
+    void parse_rx_message(const struct AC_Link_Frame* frame) {
+        /**
+         * Every frame we act on. Adding a command is one entry here: receiver, transmitter, command, payload length
+         * (bytes after the command) and handler
+         */
+        static constexpr AC_Link_Dispatch_Entry<Rx_Handler> rx_dispatch_entries[] = {
+            {AC_LINK_ADDRESS_DRC, AC_LINK_ADDRESS_COMPUTER, AC_LINK_COMMAND_DEVICE_IS_PRESENT,
+             AC_LINK_PAYLOAD_LENGTH_ANY, &AC_Link_Bus_Core::on_usb_connected},
+            {AC_LINK_ADDRESS_DRC, AC_LINK_ADDRESS_COMPUTER, AC_LINK_COMMAND_DEVICE_IS_DISCONNECTED,
+             AC_LINK_PAYLOAD_LENGTH_ANY, &AC_Link_Bus_Core::on_usb_disconnected},
+            {AC_LINK_ADDRESS_DRC, AC_LINK_ADDRESS_MASTER_MCU, AC_LINK_COMMAND_DEVICE_IS_PRESENT,
+             AC_LINK_PAYLOAD_LENGTH_ANY, &AC_Link_Bus_Core::on_master_mcu_present},
+            {AC_LINK_ADDRESS_DRC, AC_LINK_ADDRESS_DSP_PROCESSOR, AC_LINK_COMMAND_DEVICE_IS_PRESENT,
+             AC_LINK_PAYLOAD_LENGTH_ANY, &AC_Link_Bus_Core::on_dsp_present},
+            {AC_LINK_ADDRESS_DRC, AC_LINK_ADDRESS_DSP_PROCESSOR, AC_LINK_COMMAND_INPUT_SOURCE_NAME,
+             AC_LINK_SHADOW_SOURCE_NAME_LENGTH, &AC_Link_Bus_Core::on_input_source_name},
+        };
+        constexpr size_t RX_DISPATCH_ENTRY_COUNT = sizeof(rx_dispatch_entries) / sizeof(rx_dispatch_entries[0]);
+        constexpr size_t RX_DISPATCH_SLOT_COUNT = 32; // Power of 2, keep it at least 2x the entry count
+        static constexpr AC_Link_Dispatch_Table<Rx_Handler, RX_DISPATCH_ENTRY_COUNT, RX_DISPATCH_SLOT_COUNT>
+            rx_dispatch_table(rx_dispatch_entries);
+        static_assert(!rx_dispatch_table.has_duplicates(),
+                      "Each (receiver, transmitter, command) may only be handled once");
+
+        if (frame->length < AC_LINK_MIN_FRAME_SIZE_BYTES) {
+            return;
+        }
+        const AC_Link_Dispatch_Entry<Rx_Handler>* entry =
+            rx_dispatch_table.find(frame->receiver(), frame->transmitter(), frame->command());
+        if (entry == nullptr) {
+            // Traffic between other devices is expected, only report what was meant for us
+            if (frame->receiver() == AC_LINK_ADDRESS_DRC) {
+                this->log(AC_LINK_BUS_LOG_INFO, "RS485->%02x->DRC, unknown command received: %02x",
+                          frame->transmitter(), frame->command());
+            }
+            return;
+        }
+        if (!ac_link_dispatch_payload_ok(entry, frame)) {
+            this->log(AC_LINK_BUS_LOG_ERROR, "RS485 ERROR: Command %02x from %02x has %d payload bytes, expected %d",
+                      frame->command(), frame->transmitter(), frame->payload_length(), entry->payload_length);
+            return;
+        }
+        (this->*(entry->handler))(frame);
+    }
+
+    /**
+     * Check a received frame against the echo / response we are waiting for, then parse it
+     */
+    void handle_rx_frame(const struct AC_Link_Frame* frame) {
+        // The transceiver echoes everything we send. Frames from other devices may be queued ahead of our echo so
+        // we parse those instead of throwing them away
+        if (this->echo_pending && frame->length == this->active_frame.length &&
+            memcmp(frame->bytes, this->active_frame.bytes, frame->length) == 0) {
+            this->finish_echo(AC_LINK_TX_OK);
+            return;
+        }
+
+        // Every valid frame is a heartbeat from its sender, whoever it was meant for
+        uint8_t device = ac_link_device_index(frame->transmitter());
+        if (device < AC_LINK_DEVICE_COUNT) {
+            this->frames_heard[device]++;
+        }
+        if (device == AC_LINK_DEVICE_DSP_PROCESSOR) {
+            this->set_dsp_on_bus();
+        }
+
+        this->device_settings.observe(frame); // Settings other devices (the PC) send
+        this->follow_usb_session(frame);
+        bool is_response = this->pending_response.matches(frame);
+        this->parse_rx_message(frame);
+        if (is_response) {
+            uint32_t round_trip_us = this->port->now_us() - this->tx_end_us;
+            this->log(AC_LINK_BUS_LOG_DEBUG, "Reply from %02x to command %02x in %uus", frame->transmitter(),
+                      this->active_request.data[0], (unsigned)round_trip_us);
+            this->response_round_trip.add(round_trip_us);
+            if (this->response_round_trip.samples >= AC_LINK_TX_LATENCY_LOG_SAMPLES) {
+                this->log(AC_LINK_BUS_LOG_INFO, "Request to reply round trip: avg %uus, min %uus, max %uus",
+                          (unsigned)this->response_round_trip.average_us(),
+                          (unsigned)this->response_round_trip.min_us, (unsigned)this->response_round_trip.max_us);
+                this->response_round_trip.reset();
+            }
+            // Parsed first so the requester sees the updated state
+            this->pending_response.clear();
+            this->complete_request(AC_LINK_TX_OK);
+        }
+    }
+
+    /**
+     * Our frame has come back (or never will). Moves on to waiting for the response if the request needs one
+     */
+    void finish_echo(AC_Link_Tx_Result result) {
+        this->echo_pending = false;
+        if (result == AC_LINK_TX_OK) {
+            this->device_settings.observe(&this->active_frame);
+        } else if (this->active_request.data_length == 2) {
+            // It may or may not have reached the device, send it again next update
+            uint8_t device = ac_link_shadow_device(this->active_request.receiver_address);
+            uint8_t parameter = ac_link_shadow_parameter(this->active_request.data[0]);
+            if (device < AC_LINK_SHADOW_DEVICE_COUNT && parameter < AC_LINK_SHADOW_PARAMETER_COUNT) {
+                this->device_settings.devices[device].forget(parameter);
+            }
+        }
+        if (this->active_request.wait_for_response) {
+            this->pending_response.expect(this->active_request.receiver_address, this->active_request.data[0]);
+            this->wait_start_us = this->port->now_us();
+        } else {
+            this->complete_request(result);
+        }
+    }
+
+    /**
+     * Free the bus for the next request and report the result to the requester
+     */
+    void complete_request(AC_Link_Tx_Result result) {
+        if (this->active_request.callback) {
+            this->active_request.callback(result, this->active_request.context);
+        }
+    }
+
+    /**
+     * Encode and send the active request on the bus. Does not wait for the echo
+     */
+    void transmit_request(void) {
+        struct AC_Link_Tx_Request* request = &this->active_request;
+        // While the PC owns the bus we only answer it
+        if (this->usb_connected && request->receiver_address != AC_LINK_ADDRESS_COMPUTER) {
+            this->requests_refused++;
+            this->log(AC_LINK_BUS_LOG_ERROR, "Can't use the RS485 bus when USB is connected to the DSP!");
+            this->complete_request(AC_LINK_TX_ERROR_BUS_UNAVAILABLE);
+            return;
+        }
+
+        if (!ac_link_encode_frame(request->receiver_address, AC_LINK_ADDRESS_DRC, request->data, request->data_length,
+                                  &this->active_frame)) {
+            this->log(AC_LINK_BUS_LOG_ERROR, "RS485 ERROR: Unable to encode a frame with %d data bytes",
+                      request->data_length);
+            this->complete_request(AC_LINK_TX_ERROR_NO_ECHO);
+            return;
+        }
+
+        this->port->transmit(&this->active_frame);
+
+        this->tx_end_us = this->port->now_us();
+        this->last_tx_us = this->tx_end_us;
+        this->wait_start_us = this->tx_end_us;
+        this->echo_pending = true;
+    }
+
+    AC_Link_Bus_Port* port;
+    uint8_t firmware_version[2];
+
+    /* Written by the bus task, read by the poller */
+    volatile bool dsp_on_bus = false;
+    volatile bool usb_connected = false;
+    volatile uint32_t frames_heard[AC_LINK_DEVICE_COUNT] = {}; // Valid frames received from each device
+    bool master_mcu_on_bus = false;
+
+    /* Written by any task under the port lock, taken by the bus task */
+    AC_Link_Tx_Queue<AC_LINK_TX_QUEUE_LENGTH> tx_queues[AC_LINK_TX_PRIORITY_COUNT];
+    AC_Link_Coalescing_Table<AC_LINK_TX_SETTING_SLOT_COUNT> tx_setting_table;
+    bool settings_update_requested = false;
+
+    /* Bus task state. Only touched from the bus task */
+    struct AC_Link_Tx_Request active_request = {};
+    struct AC_Link_Frame active_frame;
+    bool echo_pending = false;
+    struct AC_Link_Pending_Response pending_response;
+    bool source_reload_pending = false; // The DSP confirmed a source change and is reloading its settings
+    uint32_t source_changed_us = 0;
+    uint32_t wait_start_us = 0;
+    uint32_t last_tx_us = 0;
+    uint32_t tx_end_us = 0;                           // When our last frame finished transmitting
+    struct AC_Link_Latency_Stats response_round_trip; // End of request to reply
+    struct AC_Link_Latency_Stats setting_latency;     // Request to wire time of settings that carry a request time
+    AC_Link_Shadow_Model usb_session_shadow;          // Everything the PC says while it owns the bus
+    uint32_t rx_frames_lost_at_last_resync = 0;
+
+    /* What each device was last given (by us once the echo is back, or by the PC) and the update in progress. Bus
+     * task only */
+    AC_Link_Shadow_Model device_settings;
+    uint32_t resync_start_us = 0; // When the current settings update was queued, 0 if none in progress
+    uint8_t resync_values_sent = 0;
+    uint8_t resync_values_skipped = 0;
+
+    /* Poller state. Only touched from the task calling poll() */
+    bool polling_started = false;
+    bool boot_up_completed = false;
+    uint32_t boot_start_us = 0;
+    struct Presence_Poll dsp_poll = {AC_LINK_DSP_POLL_MIN_INTERVAL_US, 0, 0, 0, false};
+    struct Presence_Poll usb_poll = {AC_LINK_USB_POLL_MIN_INTERVAL_US, 0, 0, 0, false};
+    uint8_t dsp_pings_unanswered = 0;
+    uint32_t pings_sent = 0;
+    uint32_t last_stats_us = 0;
+};
@@ -0,0 +1,214 @@
+/**
+ * Author: Jaime Sequeira
+ *
+ * In-RAM capture of the frames on the AC Link bus and a PCAP stream to read it back out. Like the codec, this file has
+ * no Arduino, FreeRTOS or ESP-IDF dependencies
+ */
+
+#pragma once
+
+// C++ includes
+#include <atomic>
+
+// C includes
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+enum AC_Link_Capture_Direction {
+    AC_LINK_CAPTURE_DIRECTION_RX = 0, // Frame read off the bus (includes the echo of our own frames)
+    AC_LINK_CAPTURE_DIRECTION_TX = 1, // Frame we put on the bus
+};
+
+constexpr uint8_t AC_LINK_CAPTURE_MAX_FRAME_SIZE_BYTES = 32; // Longer frames are truncated, the real length is kept
+
+/**
+ * PCAP (libpcap) file format, see https://www.tcpdump.org/manpages/pcap-savefile.5.html. Each packet is one direction
+ * byte (AC_Link_Capture_Direction) followed by the frame as it appears on the wire
+ */
+constexpr uint32_t AC_LINK_PCAP_MAGIC = 0xA1B2C3D4; // Microsecond timestamps
+constexpr uint16_t AC_LINK_PCAP_VERSION_MAJOR = 2;
+constexpr uint16_t AC_LINK_PCAP_VERSION_MINOR = 4;
+constexpr uint32_t AC_LINK_PCAP_LINKTYPE_USER0 = 147; // Reserved for private use
+constexpr uint8_t AC_LINK_PCAP_FILE_HEADER_SIZE_BYTES = 24;
+constexpr uint8_t AC_LINK_PCAP_RECORD_HEADER_SIZE_BYTES = 16;
+constexpr uint8_t AC_LINK_PCAP_DIRECTION_SIZE_BYTES = 1;
+
+/**
+ * A captured frame copied out of the ring
+ */
+struct AC_Link_Capture_Entry {
+    uint64_t timestamp_us;
+    uint8_t direction;    // AC_Link_Capture_Direction
+    uint8_t frame_length; // Length on the wire, only the first AC_LINK_CAPTURE_MAX_FRAME_SIZE_BYTES are kept
+    uint8_t bytes[AC_LINK_CAPTURE_MAX_FRAME_SIZE_BYTES];
+
+    uint8_t captured_length(void) const {
+        return (frame_length < AC_LINK_CAPTURE_MAX_FRAME_SIZE_BYTES) ? frame_length
+                                                                      : AC_LINK_CAPTURE_MAX_FRAME_SIZE_BYTES;
+    }
+};
+
+/**
+ * Fixed size ring of the latest frames. Recording never allocates or blocks and may be done from several tasks; the
+ * oldest frame is overwritten once the ring is full. Each slot carries the sequence number of the frame in it so a
+ * reader can tell when a slot was overwritten while it was copying
+ *
+ * @tparam CAPACITY Number of frames kept. Must be a power of 2
+ */
+template <size_t CAPACITY>
+class AC_Link_Capture_Ring {
+    static_assert(CAPACITY && ((CAPACITY & (CAPACITY - 1)) == 0), "Capture capacity must be a power of 2");
+
+  public:
+    /**
+     * @param direction AC_Link_Capture_Direction
+     * @param timestamp_us
+     * @param frame_bytes
+     * @param frame_length
+     */
+    void record(uint8_t direction, uint64_t timestamp_us, const uint8_t* frame_bytes, uint8_t frame_length) {
+        uint32_t sequence = this->next_sequence.fetch_add(1, std::memory_order_relaxed);
+        struct Slot* slot = &this->slots[sequence & (CAPACITY - 1)];
+        slot->sequence.store(0, std::memory_order_relaxed); // Mark the slot as being written
+        std::atomic_thread_fence(std::memory_order_release);
+        slot->entry.timestamp_us = timestamp_us;
+        slot->entry.direction = direction;
+        slot->entry.frame_length = frame_length;
+        memcpy(slot->entry.bytes, frame_bytes, slot->entry.captured_length());
+        slot->sequence.store(sequence + 1, std::memory_order_release);
+    }
+
+    /**
+     * Copy a frame out of the ring
+     * @param sequence Sequence number of the frame, between oldest_sequence() and end_sequence()
+     * @param entry
+     * @returns false if the frame has been overwritten (or is still being written)
+     */
+    bool read(uint32_t sequence, struct AC_Link_Capture_Entry* entry) const {
+        const struct Slot* slot = &this->slots[sequence & (CAPACITY - 1)];
+        if (slot->sequence.load(std::memory_order_acquire) != sequence + 1) {
+            return false;
+        }
+        memcpy(entry, &slot->entry, sizeof(struct AC_Link_Capture_Entry));
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return slot->sequence.load(std::memory_order_relaxed) == sequence + 1;
+    }
+
+    /**
+     * @returns Sequence number the next frame will get, one past the newest frame
+     */
+    uint32_t end_sequence(void) const {
+        return this->next_sequence.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @returns Sequence number of the oldest frame still in the ring
+     */
+    uint32_t oldest_sequence(void) const {
+        uint32_t end = this->end_sequence();
+        return (end > CAPACITY) ? end - CAPACITY : 0;
+    }
+
+  private:
+    struct Slot {
+        std::atomic<uint32_t> sequence{0}; // Frame sequence + 1, 0 while empty or being written
+        struct AC_Link_Capture_Entry entry;
+    };
+    struct Slot slots[CAPACITY];
+    std::atomic<uint32_t> next_sequence{0};
+};
+
+/**
+ * Turns a snapshot of a capture ring into a PCAP byte stream, a buffer at a time. Only the frames in the ring when the
+ * stream was created are included. Frames overwritten before they are reached are skipped
+ *
+ * @tparam CAPACITY Capacity of the ring being read
+ */
+template <size_t CAPACITY>
+class AC_Link_Pcap_Stream {
+  public:
+    explicit AC_Link_Pcap_Stream(const AC_Link_Capture_Ring<CAPACITY>* ring)
+        : ring(ring), next_sequence(ring->oldest_sequence()), end_sequence(ring->end_sequence()) {
+        uint8_t* header = this->staging;
+        header = put_u32(header, AC_LINK_PCAP_MAGIC);
+        header = put_u16(header, AC_LINK_PCAP_VERSION_MAJOR);
+        header = put_u16(header, AC_LINK_PCAP_VERSION_MINOR);
+        header = put_u32(header, 0); // Timezone offset (GMT)
+        header = put_u32(header, 0); // Timestamp accuracy
+        header = put_u32(header, AC_LINK_PCAP_DIRECTION_SIZE_BYTES + AC_LINK_CAPTURE_MAX_FRAME_SIZE_BYTES); // Snaplen
+        header = put_u32(header, AC_LINK_PCAP_LINKTYPE_USER0);
+        this->staged_length = header - this->staging;
+    }
+
+    /**
+     * Fill a buffer with the next part of the stream
+     * @param buffer
+     * @param max_length
+     * @returns Bytes written, 0 once the stream is complete
+     */
+    size_t read(uint8_t* buffer, size_t max_length) {
+        size_t written = 0;
+        while (written < max_length) {
+            if (this->staged_offset == this->staged_length && !this->stage_next_record()) {
+                break;
+            }
+            size_t chunk = this->staged_length - this->staged_offset;
+            if (chunk > max_length - written) {
+                chunk = max_length - written;
+            }
+            memcpy(&buffer[written], &this->staging[this->staged_offset], chunk);
+            this->staged_offset += chunk;
+            written += chunk;
+        }
+        return written;
+    }
+
+    uint32_t records_skipped = 0; // Overwritten by new frames before they were streamed
+
+  private:
+    static uint8_t* put_u16(uint8_t* buffer, uint16_t value) {
+        buffer[0] = value & 0xFF;
+        buffer[1] = value >> 8;
+        return buffer + 2;
+    }
+
+    static uint8_t* put_u32(uint8_t* buffer, uint32_t value) {
+        buffer = put_u16(buffer, value & 0xFFFF);
+        return put_u16(buffer, value >> 16);
+    }
+
+    /**
+     * Serialise the next readable frame into the staging buffer
+     * @returns false once every frame in the snapshot has been staged
+     */
+    bool stage_next_record(void) {
+        struct AC_Link_Capture_Entry entry;
+        while (this->next_sequence != this->end_sequence) {
+            if (!this->ring->read(this->next_sequence++, &entry)) {
+                this->records_skipped++;
+                continue;
+            }
+            uint8_t captured_length = entry.captured_length();
+            uint8_t* record = this->staging;
+            record = put_u32(record, (uint32_t)(entry.timestamp_us / 1000000));
+            record = put_u32(record, (uint32_t)(entry.timestamp_us % 1000000));
+            record = put_u32(record, AC_LINK_PCAP_DIRECTION_SIZE_BYTES + captured_length);
+            record = put_u32(record, AC_LINK_PCAP_DIRECTION_SIZE_BYTES + entry.frame_length);
+            *record++ = entry.direction;
+            memcpy(record, entry.bytes, captured_length);
+            this->staged_length = (record - this->staging) + captured_length;
+            this->staged_offset = 0;
+            return true;
+        }
+        return false;
+    }
+
+    const AC_Link_Capture_Ring<CAPACITY>* ring;
+    uint32_t next_sequence;
+    uint32_t end_sequence;
+    uint8_t staging[AC_LINK_PCAP_RECORD_HEADER_SIZE_BYTES + AC_LINK_PCAP_DIRECTION_SIZE_BYTES +
+                    AC_LINK_CAPTURE_MAX_FRAME_SIZE_BYTES];
+    size_t staged_length = 0;
+    size_t staged_offset = 0;
+};
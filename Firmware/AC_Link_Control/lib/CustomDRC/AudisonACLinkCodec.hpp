@@ -0,0 +1,557 @@
+/**
+ * Author: Jaime Sequeira
+ *
+ * AC Link frame codec. This file must not include any Arduino, FreeRTOS or ESP-IDF headers so that the frame layout
+ * can be built and exercised on a host machine as well as on the ESP32
+ */
+
+#pragma once
+
+// C++ includes
+#include <atomic>
+
+// C includes
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+enum AC_Link_Address {
+    AC_LINK_ADDRESS_MASTER_MCU = 0x00,
+    AC_LINK_ADDRESS_DSP_PROCESSOR = 0x46,
+    AC_LINK_ADDRESS_COMPUTER = 0x5A,
+    AC_LINK_ADDRESS_DRC = 0x80,
+};
+
+enum AC_Link_Command {
+    AC_LINK_COMMAND_INPUT_SOURCE_NAME = 0x09,
+    AC_LINK_COMMAND_MASTER_VOLUME = 0x0A,
+    AC_LINK_COMMAND_BALANCE_ADJUST = 0x0B,
+    AC_LINK_COMMAND_FADER_ADJUST = 0x0C,
+    AC_LINK_COMMAND_SUB_VOLUME_ADJUST = 0x0D,
+    AC_LINK_COMMAND_CHANGE_DSP_MEMORY = 0x0F,
+    AC_LINK_COMMAND_CHANGE_SOURCE = 0x10,
+    AC_LINK_COMMAND_CHECK_DEVICE_PRESENT = 0x11,
+    AC_LINK_COMMAND_DEVICE_IS_PRESENT = 0x12,
+    AC_LINK_COMMAND_USB_CONNECTED = 0x13,
+    AC_LINK_COMMAND_DRC_FW_VERSION = 0x14,
+    AC_LINK_COMMAND_DEVICE_IS_DISCONNECTED = 0x35,
+    AC_LINK_COMMAND_GET_CURRENT_SOURCE_NAME = 0x6D,
+    AC_LINK_COMMAND_TURN_OFF_MAIN_UNIT = 0x6E, // Unknown yet
+};
+
+/**
+ * Byte positions within a frame
+ *
+ * | Receiver | Transmitter | Delimiter (0x00) | Length | Command | Values (n bytes) | Checksum |
+ *
+ * The receiver address is the only byte sent with the 9th (address) bit set. The length byte counts every byte in the
+ * frame, including the receiver address and the checksum
+ */
+enum AC_Link_Frame_Index {
+    AC_LINK_FRAME_INDEX_RECEIVER = 0,
+    AC_LINK_FRAME_INDEX_TRANSMITTER = 1,
+    AC_LINK_FRAME_INDEX_DELIMITER = 2,
+    AC_LINK_FRAME_INDEX_LENGTH = 3,
+    AC_LINK_FRAME_INDEX_COMMAND = 4,
+    AC_LINK_FRAME_INDEX_PAYLOAD = 5,
+};
+
+enum AC_Link_Frame_Status {
+    AC_LINK_FRAME_OK = 0,
+    AC_LINK_FRAME_ERROR_TOO_SHORT,
+    AC_LINK_FRAME_ERROR_LENGTH_MISMATCH,
+    AC_LINK_FRAME_ERROR_CHECKSUM,
+    AC_LINK_FRAME_ERROR_BUFFER_TOO_SMALL,
+};
+
+constexpr uint8_t AC_LINK_FRAME_DELIMITER = 0x00;
+constexpr uint8_t AC_LINK_HEADER_SIZE_BYTES = 4;
+constexpr uint8_t AC_LINK_COMMAND_SIZE_BYTES = 1;
+constexpr uint8_t AC_LINK_CHECKSUM_SIZE_BYTES = 1;
+constexpr uint8_t AC_LINK_MIN_FRAME_SIZE_BYTES =
+    AC_LINK_HEADER_SIZE_BYTES + AC_LINK_COMMAND_SIZE_BYTES + AC_LINK_CHECKSUM_SIZE_BYTES;
+constexpr uint8_t AC_LINK_MAX_FRAME_SIZE_BYTES = 0xFF; // The length field is a single byte
+
+/**
+ * A single, complete frame as it appears on the wire
+ */
+struct AC_Link_Frame {
+    uint8_t length = 0;
+    uint8_t bytes[AC_LINK_MAX_FRAME_SIZE_BYTES];
+
+    uint8_t receiver(void) const {
+        return bytes[AC_LINK_FRAME_INDEX_RECEIVER];
+    }
+
+    uint8_t transmitter(void) const {
+        return bytes[AC_LINK_FRAME_INDEX_TRANSMITTER];
+    }
+
+    uint8_t command(void) const {
+        return bytes[AC_LINK_FRAME_INDEX_COMMAND];
+    }
+
+    const uint8_t* payload(void) const {
+        return &bytes[AC_LINK_FRAME_INDEX_PAYLOAD];
+    }
+
+    uint8_t payload_length(void) const {
+        return (length > AC_LINK_MIN_FRAME_SIZE_BYTES) ? length - AC_LINK_MIN_FRAME_SIZE_BYTES : 0;
+    }
+
+    uint8_t checksum(void) const {
+        return bytes[length - 1];
+    }
+};
+
+/**
+ * @param data_buffer Buffer of data to be checksummed
+ * @param data_length_bytes
+ *
+ * @returns Checksum byte (8-bit modulo 256)
+ */
+inline uint8_t ac_link_calculate_checksum(const uint8_t* data_buffer, size_t data_length_bytes) {
+    uint8_t checksum = 0;
+    for (size_t i = 0; i < data_length_bytes; i++) {
+        checksum += data_buffer[i]; // Unsigned overflow gives us the modulo 256 for free
+    }
+    return checksum;
+}
+
+/**
+ * Build a complete frame (header, data and checksum) into a caller provided buffer
+ * @param receiver_address
+ * @param transmitter_address
+ * @param data Command byte followed by the command values
+ * @param data_length Length of the data buffer
+ * @param frame_buffer Buffer the frame is written into
+ * @param frame_buffer_size Size of frame_buffer (bytes)
+ * @returns Length of the encoded frame, 0 if the frame does not fit
+ */
+inline uint8_t ac_link_encode_frame(uint8_t receiver_address, uint8_t transmitter_address, const uint8_t* data,
+                                    uint8_t data_length, uint8_t* frame_buffer, size_t frame_buffer_size) {
+    size_t frame_length = AC_LINK_HEADER_SIZE_BYTES + data_length + AC_LINK_CHECKSUM_SIZE_BYTES;
+    if (data_length < AC_LINK_COMMAND_SIZE_BYTES || frame_length > AC_LINK_MAX_FRAME_SIZE_BYTES ||
+        frame_length > frame_buffer_size) {
+        return 0;
+    }
+    frame_buffer[AC_LINK_FRAME_INDEX_RECEIVER] = receiver_address;
+    frame_buffer[AC_LINK_FRAME_INDEX_TRANSMITTER] = transmitter_address;
+    frame_buffer[AC_LINK_FRAME_INDEX_DELIMITER] = AC_LINK_FRAME_DELIMITER;
+    frame_buffer[AC_LINK_FRAME_INDEX_LENGTH] = (uint8_t)frame_length;
+    memcpy(&frame_buffer[AC_LINK_FRAME_INDEX_COMMAND], data, data_length);
+    frame_buffer[frame_length - 1] = ac_link_calculate_checksum(frame_buffer, frame_length - 1);
+    return (uint8_t)frame_length;
+}
+
+/**
+ * Build a complete frame into an AC_Link_Frame
+ * @returns true if the frame was encoded
+ */
+inline bool ac_link_encode_frame(uint8_t receiver_address, uint8_t transmitter_address, const uint8_t* data,
+                                 uint8_t data_length, struct AC_Link_Frame* frame) {
+    frame->length = ac_link_encode_frame(receiver_address, transmitter_address, data, data_length, frame->bytes,
+                                         sizeof(frame->bytes));
+    return frame->length != 0;
+}
+
+/**
+ * Check that a received buffer holds exactly one well formed frame
+ * @param frame_buffer
+ * @param frame_length Amount of bytes in frame_buffer
+ */
+inline AC_Link_Frame_Status ac_link_validate_frame(const uint8_t* frame_buffer, size_t frame_length) {
+    if (frame_length < AC_LINK_MIN_FRAME_SIZE_BYTES) {
+        return AC_LINK_FRAME_ERROR_TOO_SHORT;
+    }
+    if (frame_buffer[AC_LINK_FRAME_INDEX_LENGTH] != frame_length) {
+        return AC_LINK_FRAME_ERROR_LENGTH_MISMATCH;
+    }
+    if (ac_link_calculate_checksum(frame_buffer, frame_length - 1) != frame_buffer[frame_length - 1]) {
+        return AC_LINK_FRAME_ERROR_CHECKSUM;
+    }
+    return AC_LINK_FRAME_OK;
+}
+
+/**
+ * Validate a received buffer and copy it into an AC_Link_Frame
+ */
+inline AC_Link_Frame_Status ac_link_decode_frame(const uint8_t* frame_buffer, size_t frame_length,
+                                                 struct AC_Link_Frame* frame) {
+    if (frame_length > sizeof(frame->bytes)) {
+        return AC_LINK_FRAME_ERROR_BUFFER_TOO_SMALL;
+    }
+    AC_Link_Frame_Status status = ac_link_validate_frame(frame_buffer, frame_length);
+    if (status == AC_LINK_FRAME_OK) {
+        memcpy(frame->bytes, frame_buffer, frame_length);
+        frame->length = (uint8_t)frame_length;
+    }
+    return status;
+}
+
+constexpr uint8_t AC_LINK_COMMAND_ANY = 0xFF; // Wildcard for replies we do not know the command of
+
+/**
+ * @returns The command a device answers the given command with, AC_LINK_COMMAND_ANY if we have not seen the reply
+ */
+inline uint8_t ac_link_expected_response(uint8_t command) {
+    switch (command) {
+        case AC_LINK_COMMAND_CHECK_DEVICE_PRESENT:
+            return AC_LINK_COMMAND_DEVICE_IS_PRESENT;
+        case AC_LINK_COMMAND_GET_CURRENT_SOURCE_NAME:
+        case AC_LINK_COMMAND_CHANGE_SOURCE:
+            // The DSP answers with the name of the (new) source
+            return AC_LINK_COMMAND_INPUT_SOURCE_NAME;
+        default:
+            return AC_LINK_COMMAND_ANY;
+    }
+}
+
+/**
+ * A reply we are waiting on. Only a frame addressed to the DRC, from the device we asked and carrying the expected
+ * command completes it
+ */
+struct AC_Link_Pending_Response {
+    bool active = false;
+    uint8_t transmitter_address = 0;
+    uint8_t command = AC_LINK_COMMAND_ANY;
+
+    /**
+     * @param receiver_address Device the request was sent to, it will be the transmitter of the reply
+     * @param request_command Command of the request
+     */
+    void expect(uint8_t receiver_address, uint8_t request_command) {
+        this->transmitter_address = receiver_address;
+        this->command = ac_link_expected_response(request_command);
+        this->active = true;
+    }
+
+    bool matches(const struct AC_Link_Frame* frame) const {
+        return this->active && frame->length >= AC_LINK_MIN_FRAME_SIZE_BYTES &&
+               frame->receiver() == AC_LINK_ADDRESS_DRC && frame->transmitter() == this->transmitter_address &&
+               (this->command == AC_LINK_COMMAND_ANY || frame->command() == this->command);
+    }
+
+    void clear(void) {
+        this->active = false;
+    }
+};
+
+enum AC_Link_Assembler_Result {
+    AC_LINK_ASSEMBLER_IN_PROGRESS = 0, // Byte consumed, frame not complete yet (or waiting for an address byte)
+    AC_LINK_ASSEMBLER_FRAME_COMPLETE,  // A valid frame is available through frame()
+    AC_LINK_ASSEMBLER_FRAME_DROPPED,   // The frame in progress was invalid and has been thrown away
+};
+
+/**
+ * Incremental, byte-fed frame assembler. State is kept between calls so bytes can be fed in as they trickle off the
+ * bus. A byte with the 9th (address) bit set always starts a new frame, which lets us resync on the next frame after
+ * a dropped or garbled byte instead of losing the rest of the burst
+ */
+class AC_Link_Frame_Assembler {
+  public:
+    /**
+     * Feed a single byte received on the bus
+     * @param data
+     * @param is_address State of the 9th bit received with the byte
+     */
+    AC_Link_Assembler_Result push_byte(uint8_t data, bool is_address) {
+        AC_Link_Assembler_Result result = AC_LINK_ASSEMBLER_IN_PROGRESS;
+        if (is_address) {
+            if (this->receiving) {
+                this->frames_dropped++; // The previous frame never completed
+                result = AC_LINK_ASSEMBLER_FRAME_DROPPED;
+            }
+            this->receiving = true;
+            this->frame_in_progress.length = 0;
+        } else if (!this->receiving) {
+            this->bytes_discarded++; // Data without a receiver address, wait for the next frame
+            return AC_LINK_ASSEMBLER_IN_PROGRESS;
+        }
+
+        uint8_t index = this->frame_in_progress.length;
+        this->frame_in_progress.bytes[index] = data;
+        this->frame_in_progress.length++;
+
+        if (index == AC_LINK_FRAME_INDEX_LENGTH && data < AC_LINK_MIN_FRAME_SIZE_BYTES) {
+            return this->drop_frame();
+        }
+        if (index >= AC_LINK_FRAME_INDEX_LENGTH &&
+            this->frame_in_progress.length == this->frame_in_progress.bytes[AC_LINK_FRAME_INDEX_LENGTH]) {
+            this->receiving = false;
+            if (ac_link_validate_frame(this->frame_in_progress.bytes, this->frame_in_progress.length) !=
+                AC_LINK_FRAME_OK) {
+                this->frames_dropped++;
+                return AC_LINK_ASSEMBLER_FRAME_DROPPED;
+            }
+            this->frames_completed++;
+            return AC_LINK_ASSEMBLER_FRAME_COMPLETE;
+        }
+        return result;
+    }
+
+    /**
+     * @returns The last completed frame. Only valid straight after push_byte() returns AC_LINK_ASSEMBLER_FRAME_COMPLETE
+     */
+    const struct AC_Link_Frame* frame(void) const {
+        return &this->frame_in_progress;
+    }
+
+    /**
+     * Throw away any partially received frame
+     */
+    void reset(void) {
+        this->receiving = false;
+        this->frame_in_progress.length = 0;
+    }
+
+    uint32_t frames_completed = 0;
+    uint32_t frames_dropped = 0;
+    uint32_t bytes_discarded = 0;
+
+  private:
+    AC_Link_Assembler_Result drop_frame(void) {
+        this->reset();
+        this->frames_dropped++;
+        return AC_LINK_ASSEMBLER_FRAME_DROPPED;
+    }
+
+    bool receiving = false;
+    struct AC_Link_Frame frame_in_progress;
+};
+
+/**
+ * Lock-free single producer / single consumer ring of frames. One task (or ISR) may push while one other task pops
+ * without either of them taking a lock
+ *
+ * @tparam CAPACITY Number of frames the ring can hold. Must be a power of 2
+ */
+template <size_t CAPACITY>
+class AC_Link_Frame_Ring {
+    static_assert(CAPACITY && ((CAPACITY & (CAPACITY - 1)) == 0), "Ring capacity must be a power of 2");
+
+  public:
+    /**
+     * Producer side. Copy a frame into the ring
+     * @returns false if the ring is full (the frame is counted as an overflow)
+     */
+    bool push(const struct AC_Link_Frame* frame) {
+        size_t head = this->head_index.load(std::memory_order_relaxed);
+        size_t tail = this->tail_index.load(std::memory_order_acquire);
+        if ((head - tail) >= CAPACITY) {
+            this->overflow_count++;
+            return false;
+        }
+        struct AC_Link_Frame* slot = &this->frames[head & (CAPACITY - 1)];
+        slot->length = frame->length;
+        memcpy(slot->bytes, frame->bytes, frame->length);
+        this->head_index.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Consumer side. Copy the oldest frame out of the ring
+     * @returns false if the ring is empty
+     */
+    bool pop(struct AC_Link_Frame* frame) {
+        size_t tail = this->tail_index.load(std::memory_order_relaxed);
+        size_t head = this->head_index.load(std::memory_order_acquire);
+        if (head == tail) {
+            return false;
+        }
+        const struct AC_Link_Frame* slot = &this->frames[tail & (CAPACITY - 1)];
+        frame->length = slot->length;
+        memcpy(frame->bytes, slot->bytes, slot->length);
+        this->tail_index.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    size_t size(void) const {
+        return this->head_index.load(std::memory_order_acquire) - this->tail_index.load(std::memory_order_acquire);
+    }
+
+    bool empty(void) const {
+        return this->size() == 0;
+    }
+
+    uint32_t overflow_count = 0;
+
+  private:
+    struct AC_Link_Frame frames[CAPACITY];
+    std::atomic<size_t> head_index{0};
+    std::atomic<size_t> tail_index{0};
+};
+
+/**
+ * Continuous controls only ever need their latest value on the bus
+ * @returns true for commands whose newest value replaces any value not yet sent
+ */
+inline bool ac_link_command_is_continuous(uint8_t command) {
+    switch (command) {
+        case AC_LINK_COMMAND_MASTER_VOLUME:
+        case AC_LINK_COMMAND_BALANCE_ADJUST:
+        case AC_LINK_COMMAND_FADER_ADJUST:
+        case AC_LINK_COMMAND_SUB_VOLUME_ADJUST:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/**
+ * Pending values for continuous commands, at most one per (receiver, command) key. Writing a key that is already
+ * pending replaces its value in place and keeps its place in the send order, so a knob turned faster than the bus can
+ * send only costs one frame per key while the last value is always delivered. Not thread safe, the owner locks around
+ * it
+ *
+ * @tparam SLOT_COUNT Number of keys that can be pending at once
+ */
+template <size_t SLOT_COUNT>
+class AC_Link_Coalescing_Table {
+  public:
+    /**
+     * @param timestamp_us When the value was requested, handed back by take(). 0 if not tracked
+     * @returns false if the key is not pending and every slot is in use
+     */
+    bool write(uint8_t receiver_address, uint8_t command, uint8_t value, uint32_t timestamp_us = 0) {
+        struct Slot* free_slot = nullptr;
+        for (size_t i = 0; i < SLOT_COUNT; i++) {
+            struct Slot* slot = &this->slots[i];
+            if (slot->pending && slot->receiver_address == receiver_address && slot->command == command) {
+                slot->value = value;
+                slot->timestamp_us = timestamp_us;
+                this->values_replaced++;
+                return true;
+            }
+            if (!slot->pending && free_slot == nullptr) {
+                free_slot = slot;
+            }
+        }
+        if (free_slot == nullptr) {
+            return false;
+        }
+        free_slot->receiver_address = receiver_address;
+        free_slot->command = command;
+        free_slot->value = value;
+        free_slot->timestamp_us = timestamp_us;
+        free_slot->order = this->next_order++;
+        free_slot->pending = true;
+        return true;
+    }
+
+    /**
+     * Take the key that has been pending the longest. The slot is free for new values straight away
+     * @returns false if nothing is pending
+     */
+    bool take(uint8_t* receiver_address, uint8_t* command, uint8_t* value, uint32_t* timestamp_us = nullptr) {
+        struct Slot* oldest_slot = nullptr;
+        for (size_t i = 0; i < SLOT_COUNT; i++) {
+            struct Slot* slot = &this->slots[i];
+            // Compare by difference so the order counter can wrap
+            if (slot->pending && (oldest_slot == nullptr || (int32_t)(slot->order - oldest_slot->order) < 0)) {
+                oldest_slot = slot;
+            }
+        }
+        if (oldest_slot == nullptr) {
+            return false;
+        }
+        *receiver_address = oldest_slot->receiver_address;
+        *command = oldest_slot->command;
+        *value = oldest_slot->value;
+        if (timestamp_us) {
+            *timestamp_us = oldest_slot->timestamp_us;
+        }
+        oldest_slot->pending = false;
+        return true;
+    }
+
+    bool empty(void) const {
+        for (size_t i = 0; i < SLOT_COUNT; i++) {
+            if (this->slots[i].pending) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    uint32_t values_replaced = 0; // Values that never went on the bus because a newer one arrived first
+
+  private:
+    struct Slot {
+        uint8_t receiver_address;
+        uint8_t command;
+        uint8_t value;
+        bool pending;
+        uint32_t timestamp_us;
+        uint32_t order;
+    };
+    struct Slot slots[SLOT_COUNT] = {};
+    uint32_t next_order = 0;
+};
+
+constexpr uint8_t AC_LINK_UART_DATA_BITS = 9; // 8 data bits + address (mark / space) bit
+constexpr uint8_t AC_LINK_UART_BITS_PER_CHARACTER = 1 + AC_LINK_UART_DATA_BITS + 1; // START + data + STOP
+
+/**
+ * Decodes 9-bit UART characters (LSB first, idle high) from a captured pulse train. The capture is fed in as runs of
+ * a constant line level, measured in bit periods. This lets us decode a whole burst in one go (e.g. from the RMT RX
+ * ring buffer) instead of taking an interrupt on every edge
+ */
+class AC_Link_9bit_Uart_Decoder {
+  public:
+    /**
+     * Feed a run of a constant line level. A run can complete at most one character since a character always ends
+     * with a high STOP bit
+     * @param level Line level of the run
+     * @param bit_count Length of the run in bit periods
+     * @param data Populated with the received byte when a character completes
+     * @param is_address Populated with the 9th bit when a character completes
+     * @returns true if a character was completed
+     */
+    bool push_run(bool level, uint16_t bit_count, uint8_t* data, bool* is_address) {
+        while (bit_count) {
+            if (!this->in_character) {
+                if (level) {
+                    return false; // Idle line, wait for the next START bit
+                }
+                this->in_character = true;
+                this->bit_index = 0;
+                this->shift_register = 0;
+                bit_count--;
+            } else if (this->bit_index < AC_LINK_UART_DATA_BITS) {
+                this->shift_register |= ((uint16_t)level << this->bit_index);
+                this->bit_index++;
+                bit_count--;
+            } else {
+                this->in_character = false;
+                if (!level) {
+                    this->framing_errors++; // Missing STOP bit, resync on the next idle to START edge
+                    return false;
+                }
+                *data = (uint8_t)(this->shift_register & 0xFF);
+                *is_address = (this->shift_register >> 8) & 1;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * The capture ends once the line has idled (high). Any trailing high bits are not part of the capture so we pad
+     * the character in progress with high bits to complete it
+     * @returns true if a character was completed
+     */
+    bool end_of_burst(uint8_t* data, bool* is_address) {
+        if (!this->in_character) {
+            return false;
+        }
+        return this->push_run(true, AC_LINK_UART_BITS_PER_CHARACTER, data, is_address);
+    }
+
+    uint32_t framing_errors = 0;
+
+  private:
+    bool in_character = false;
+    uint8_t bit_index = 0;
+    uint16_t shift_register = 0;
+};
@@ -0,0 +1,106 @@
+/**
+ * Author: Jaime Sequeira
+ *
+ * Compile-time dispatch table for received frames. Entries are keyed by (receiver, transmitter, command) and hashed
+ * into an open addressed table by the compiler, so finding a handler is a hash and (usually) a single compare. Like the
+ * codec, this file has no Arduino, FreeRTOS or ESP-IDF dependencies
+ */
+
+#pragma once
+
+#include "AudisonACLinkCodec.hpp"
+
+// C includes
+#include <stddef.h>
+#include <stdint.h>
+
+constexpr uint8_t AC_LINK_PAYLOAD_LENGTH_ANY = 0xFF; // Skip the payload length check
+
+/**
+ * @tparam HANDLER Handler function pointer type
+ */
+template <typename HANDLER>
+struct AC_Link_Dispatch_Entry {
+    uint8_t receiver_address;
+    uint8_t transmitter_address;
+    uint8_t command;
+    uint8_t payload_length; // Values after the command byte, AC_LINK_PAYLOAD_LENGTH_ANY if it varies
+    HANDLER handler;
+};
+
+constexpr uint32_t ac_link_dispatch_key(uint8_t receiver_address, uint8_t transmitter_address, uint8_t command) {
+    return ((uint32_t)receiver_address << 16) | ((uint32_t)transmitter_address << 8) | command;
+}
+
+/**
+ * @tparam HANDLER Handler function pointer type
+ * @tparam ENTRY_COUNT Number of entries
+ * @tparam SLOT_COUNT Hash table size. Must be a power of 2 and larger than ENTRY_COUNT, 2x keeps probes short
+ */
+template <typename HANDLER, size_t ENTRY_COUNT, size_t SLOT_COUNT>
+class AC_Link_Dispatch_Table {
+    static_assert(SLOT_COUNT && ((SLOT_COUNT & (SLOT_COUNT - 1)) == 0), "Slot count must be a power of 2");
+    static_assert(SLOT_COUNT > ENTRY_COUNT, "Dispatch table needs at least one empty slot");
+
+  public:
+    /**
+     * Build the table. Declare the result constexpr and static_assert on has_duplicates() so a repeated key fails the
+     * build instead of hiding an entry
+     */
+    constexpr AC_Link_Dispatch_Table(const AC_Link_Dispatch_Entry<HANDLER> (&entry_list)[ENTRY_COUNT])
+        : entries(), slots() {
+        for (size_t i = 0; i < ENTRY_COUNT; i++) {
+            this->entries[i] = entry_list[i];
+            uint32_t key = ac_link_dispatch_key(entry_list[i].receiver_address, entry_list[i].transmitter_address,
+                                                entry_list[i].command);
+            size_t slot = hash(key);
+            while (this->slots[slot] != 0) {
+                const AC_Link_Dispatch_Entry<HANDLER>& other = this->entries[this->slots[slot] - 1];
+                if (ac_link_dispatch_key(other.receiver_address, other.transmitter_address, other.command) == key) {
+                    this->duplicate_found = true;
+                }
+                slot = (slot + 1) & (SLOT_COUNT - 1);
+            }
+            this->slots[slot] = (uint8_t)(i + 1);
+        }
+    }
+
+    /**
+     * @returns The entry for this frame type, nullptr if we do not handle it
+     */
+    constexpr const AC_Link_Dispatch_Entry<HANDLER>* find(uint8_t receiver_address, uint8_t transmitter_address,
+                                                          uint8_t command) const {
+        uint32_t key = ac_link_dispatch_key(receiver_address, transmitter_address, command);
+        for (size_t slot = hash(key); this->slots[slot] != 0; slot = (slot + 1) & (SLOT_COUNT - 1)) {
+            const AC_Link_Dispatch_Entry<HANDLER>* entry = &this->entries[this->slots[slot] - 1];
+            if (ac_link_dispatch_key(entry->receiver_address, entry->transmitter_address, entry->command) == key) {
+                return entry;
+            }
+        }
+        return nullptr;
+    }
+
+    constexpr bool has_duplicates(void) const {
+        return this->duplicate_found;
+    }
+
+  private:
+    static_assert(ENTRY_COUNT < 0xFF, "Slots store entry indexes in a byte");
+
+    static constexpr size_t hash(uint32_t key) {
+        // Multiplicative (Fibonacci) hash, the middle bits of the product depend on every byte of the key
+        return (size_t)(((key * 2654435769u) >> 16) & (SLOT_COUNT - 1));
+    }
+
+    AC_Link_Dispatch_Entry<HANDLER> entries[ENTRY_COUNT];
+    uint8_t slots[SLOT_COUNT]; // Entry index + 1, 0 is empty
+    bool duplicate_found = false;
+};
+
+/**
+ * Check a frame's payload against the declared length
+ */
+template <typename HANDLER>
+bool ac_link_dispatch_payload_ok(const AC_Link_Dispatch_Entry<HANDLER>* entry, const struct AC_Link_Frame* frame) {
+    return entry->payload_length == AC_LINK_PAYLOAD_LENGTH_ANY || entry->payload_length == frame->payload_length();
+}
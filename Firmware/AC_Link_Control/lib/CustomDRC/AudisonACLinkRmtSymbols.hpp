@@ -0,0 +1,96 @@
+/**
+ * Author: Jaime Sequeira
+ *
+ * Compile-time table of the RMT items needed to send every 9-bit character on the AC Link bus. Like the codec, this
+ * file has no ESP-IDF dependencies. Items are stored as raw 32-bit words which map onto rmt_item32_t::val
+ */
+
+#pragma once
+
+// C includes
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * RMT payload uses "items". Each item can portray 2 bits on serial. We require a
+ * START bit, 9 bits of data and STOP bit. We require 11 bits but use 12
+ * (1 extra idle bit) which means we require 6 items to send 1 byte on the bus
+ */
+constexpr uint8_t AC_LINK_RMT_ITEMS_PER_CHARACTER = 6;
+constexpr uint16_t AC_LINK_RMT_TICKS_PER_BIT = 50;
+constexpr uint16_t AC_LINK_RMT_SYMBOL_COUNT = 512; // 256 byte values x address bit
+
+/**
+ * Ready-made RMT items for one 9-bit character
+ */
+struct AC_Link_Rmt_Symbol {
+    uint32_t items[AC_LINK_RMT_ITEMS_PER_CHARACTER];
+};
+
+/**
+ * Pack one RMT item. Layout matches rmt_item32_t: duration0[14:0], level0[15], duration1[30:16], level1[31]
+ */
+constexpr uint32_t ac_link_rmt_item(uint16_t duration0, bool level0, uint16_t duration1, bool level1) {
+    return (uint32_t)(duration0 & 0x7FFF) | ((uint32_t)level0 << 15) | ((uint32_t)(duration1 & 0x7FFF) << 16) |
+           ((uint32_t)level1 << 31);
+}
+
+/**
+ * @param symbol_index (is_address << 8) | byte
+ */
+constexpr AC_Link_Rmt_Symbol ac_link_build_rmt_symbol(uint16_t symbol_index) {
+    /** NOTE: UART protocol requires LSB format. Bit 0 is the START bit (low), bits 1-8 are the data, bit 9 is the
+     * address flag (9th bit) and bits 10-11 are the STOP bit and one extra idle bit (both high)
+     */
+    uint16_t data = (0b11 << 10) | ((symbol_index & 0x1FF) << 1);
+    AC_Link_Rmt_Symbol symbol = {};
+    for (uint8_t i = 0; i < AC_LINK_RMT_ITEMS_PER_CHARACTER; i++) {
+        symbol.items[i] = ac_link_rmt_item(AC_LINK_RMT_TICKS_PER_BIT, (data >> (2 * i)) & 1, AC_LINK_RMT_TICKS_PER_BIT,
+                                           (data >> (2 * i + 1)) & 1);
+    }
+    return symbol;
+}
+
+struct AC_Link_Rmt_Symbol_Table {
+    AC_Link_Rmt_Symbol symbols[AC_LINK_RMT_SYMBOL_COUNT];
+
+    constexpr AC_Link_Rmt_Symbol_Table() : symbols() {
+        for (uint16_t i = 0; i < AC_LINK_RMT_SYMBOL_COUNT; i++) {
+            symbols[i] = ac_link_build_rmt_symbol(i);
+        }
+    }
+
+    constexpr const AC_Link_Rmt_Symbol& lookup(uint8_t byte, bool is_address) const {
+        return symbols[((uint16_t)is_address << 8) | byte];
+    }
+};
+
+/* Built by the compiler and placed in flash (.rodata), nothing is computed at runtime */
+inline constexpr AC_Link_Rmt_Symbol_Table AC_LINK_RMT_SYMBOL_TABLE{};
+
+static_assert(AC_LINK_RMT_SYMBOL_TABLE.lookup(0x00, true).items[0] == ac_link_rmt_item(50, 0, 50, 0),
+              "START bit must be low");
+static_assert(AC_LINK_RMT_SYMBOL_TABLE.lookup(0xFF, false).items[AC_LINK_RMT_ITEMS_PER_CHARACTER - 1] ==
+                  ac_link_rmt_item(50, 1, 50, 1),
+              "STOP and idle bits must be high");
+static_assert(AC_LINK_RMT_SYMBOL_TABLE.lookup(0x00, true).items[4] == ac_link_rmt_item(50, 0, 50, 1),
+              "Address bit is bit 9");
+
+/**
+ * Convert a complete frame into RMT item words using the symbol table. Only the first byte (receiver address) is sent
+ * with the address bit set
+ * @param frame_bytes
+ * @param frame_length
+ * @param item_words Must hold AC_LINK_RMT_ITEMS_PER_CHARACTER * frame_length words
+ * @returns Amount of item words written
+ */
+inline size_t ac_link_frame_to_rmt_items(const uint8_t* frame_bytes, uint8_t frame_length, uint32_t* item_words) {
+    for (uint8_t i = 0; i < frame_length; i++) {
+        const AC_Link_Rmt_Symbol& symbol = AC_LINK_RMT_SYMBOL_TABLE.lookup(frame_bytes[i], i == 0);
+        for (uint8_t item = 0; item < AC_LINK_RMT_ITEMS_PER_CHARACTER; item++) {
+            item_words[item] = symbol.items[item];
+        }
+        item_words += AC_LINK_RMT_ITEMS_PER_CHARACTER;
+    }
+    return (size_t)frame_length * AC_LINK_RMT_ITEMS_PER_CHARACTER;
+}
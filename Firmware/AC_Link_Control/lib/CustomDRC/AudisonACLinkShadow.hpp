@@ -0,0 +1,162 @@
+/**
+ * Author: Jaime Sequeira
+ *
+ * Shadow model of the settings each device on the AC Link bus has been given, built by watching the frames other
+ * devices exchange. Like the codec, this file has no Arduino, FreeRTOS or ESP-IDF dependencies
+ */
+
+#pragma once
+
+#include "AudisonACLinkCodec.hpp"
+
+// C includes
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/**
+ * Single value settings we follow, in the order they are resent in
+ */
+enum AC_Link_Shadow_Parameter {
+    AC_LINK_SHADOW_MASTER_VOLUME = 0,
+    AC_LINK_SHADOW_SUB_VOLUME,
+    AC_LINK_SHADOW_BALANCE,
+    AC_LINK_SHADOW_FADER,
+    AC_LINK_SHADOW_MEMORY, // As sent on the bus, Audison index memories from 1
+    AC_LINK_SHADOW_PARAMETER_COUNT,
+};
+
+/**
+ * Device slots, the MCU and the DSP are the only devices that take settings
+ */
+enum AC_Link_Shadow_Device {
+    AC_LINK_SHADOW_DEVICE_MASTER_MCU = 0,
+    AC_LINK_SHADOW_DEVICE_DSP_PROCESSOR,
+    AC_LINK_SHADOW_DEVICE_COUNT,
+};
+
+constexpr uint8_t AC_LINK_SHADOW_SOURCE_NAME_LENGTH = 16;
+constexpr uint8_t AC_LINK_SHADOW_SOURCE_NAME_CHANGED = 1 << AC_LINK_SHADOW_PARAMETER_COUNT; // See observe()
+
+/**
+ * @returns The setting the command changes, AC_LINK_SHADOW_PARAMETER_COUNT if it does not change one we follow
+ */
+constexpr uint8_t ac_link_shadow_parameter(uint8_t command) {
+    switch (command) {
+        case AC_LINK_COMMAND_MASTER_VOLUME:
+            return AC_LINK_SHADOW_MASTER_VOLUME;
+        case AC_LINK_COMMAND_SUB_VOLUME_ADJUST:
+            return AC_LINK_SHADOW_SUB_VOLUME;
+        case AC_LINK_COMMAND_BALANCE_ADJUST:
+            return AC_LINK_SHADOW_BALANCE;
+        case AC_LINK_COMMAND_FADER_ADJUST:
+            return AC_LINK_SHADOW_FADER;
+        case AC_LINK_COMMAND_CHANGE_DSP_MEMORY:
+            return AC_LINK_SHADOW_MEMORY;
+        default:
+            return AC_LINK_SHADOW_PARAMETER_COUNT;
+    }
+}
+
+/**
+ * @returns The command that changes the setting
+ */
+constexpr uint8_t ac_link_shadow_command(uint8_t parameter) {
+    switch (parameter) {
+        case AC_LINK_SHADOW_MASTER_VOLUME:
+            return AC_LINK_COMMAND_MASTER_VOLUME;
+        case AC_LINK_SHADOW_SUB_VOLUME:
+            return AC_LINK_COMMAND_SUB_VOLUME_ADJUST;
+        case AC_LINK_SHADOW_BALANCE:
+            return AC_LINK_COMMAND_BALANCE_ADJUST;
+        case AC_LINK_SHADOW_FADER:
+            return AC_LINK_COMMAND_FADER_ADJUST;
+        default:
+            return AC_LINK_COMMAND_CHANGE_DSP_MEMORY;
+    }
+}
+
+/**
+ * @returns The shadow slot for the address, AC_LINK_SHADOW_DEVICE_COUNT for devices that do not take settings
+ */
+constexpr uint8_t ac_link_shadow_device(uint8_t device_address) {
+    return (device_address == AC_LINK_ADDRESS_MASTER_MCU)      ? AC_LINK_SHADOW_DEVICE_MASTER_MCU
+           : (device_address == AC_LINK_ADDRESS_DSP_PROCESSOR) ? AC_LINK_SHADOW_DEVICE_DSP_PROCESSOR
+                                                                : AC_LINK_SHADOW_DEVICE_COUNT;
+}
+
+/**
+ * Values a device has been given. A value is only valid while its known bit is set
+ */
+struct AC_Link_Device_Shadow {
+    uint8_t values[AC_LINK_SHADOW_PARAMETER_COUNT] = {};
+    uint8_t known_mask = 0;
+
+    bool is_known(uint8_t parameter) const {
+        return this->known_mask & (1 << parameter);
+    }
+
+    void set(uint8_t parameter, uint8_t value) {
+        this->values[parameter] = value;
+        this->known_mask |= (1 << parameter);
+    }
+
+    void forget(uint8_t parameter) {
+        this->known_mask &= ~(1 << parameter);
+    }
+
+    void forget_all(void) {
+        this->known_mask = 0;
+    }
+};
+
+class AC_Link_Shadow_Model {
+  public:
+    /**
+     * Follow a frame seen on the bus. Settings are recorded against the device they were sent to, and as the latest
+     * value of that setting on the bus. Source names are taken from the DSP whoever asked for them
+     * @param frame Valid frame
+     * @returns Bit mask of the latest values (1 << AC_Link_Shadow_Parameter) the frame changed, or
+     * AC_LINK_SHADOW_SOURCE_NAME_CHANGED
+     */
+    uint8_t observe(const struct AC_Link_Frame* frame) {
+        this->frames_observed++;
+        if (frame->command() == AC_LINK_COMMAND_INPUT_SOURCE_NAME &&
+            frame->transmitter() == AC_LINK_ADDRESS_DSP_PROCESSOR &&
+            frame->payload_length() == AC_LINK_SHADOW_SOURCE_NAME_LENGTH) {
+            bool changed = !this->source_name_known ||
+                           memcmp(this->source_name, frame->payload(), AC_LINK_SHADOW_SOURCE_NAME_LENGTH) != 0;
+            memcpy(this->source_name, frame->payload(), AC_LINK_SHADOW_SOURCE_NAME_LENGTH);
+            this->source_name_known = true;
+            return changed ? AC_LINK_SHADOW_SOURCE_NAME_CHANGED : 0;
+        }
+        uint8_t parameter = ac_link_shadow_parameter(frame->command());
+        uint8_t device = ac_link_shadow_device(frame->receiver());
+        if (parameter == AC_LINK_SHADOW_PARAMETER_COUNT || device == AC_LINK_SHADOW_DEVICE_COUNT ||
+            frame->payload_length() != 1) {
+            return 0;
+        }
+        uint8_t value = frame->payload()[0];
+        this->devices[device].set(parameter, value);
+        bool changed = !this->latest.is_known(parameter) || this->latest.values[parameter] != value;
+        this->latest.set(parameter, value);
+        this->settings_observed++;
+        return changed ? (1 << parameter) : 0;
+    }
+
+    /**
+     * Forget everything, for the start of a new session
+     */
+    void reset(void) {
+        *this = AC_Link_Shadow_Model();
+    }
+
+    struct AC_Link_Device_Shadow devices[AC_LINK_SHADOW_DEVICE_COUNT];
+    struct AC_Link_Device_Shadow latest; // Newest value of each setting, whichever device it went to
+    char source_name[AC_LINK_SHADOW_SOURCE_NAME_LENGTH + 1] = {};
+    bool source_name_known = false;
+
+    /* Counters */
+    uint32_t frames_observed = 0;
+    uint32_t settings_observed = 0;
+};
@@ -0,0 +1,276 @@
+/**
+ * Author: Jaime Sequeira
+ *
+ * Simulated AC Link bus with models of the master MCU (PIC), the DSP and a PC running Bit Tune. Frames the DRC sends
+ * go in, the echo and the answers come back out after a configurable latency, optionally with bit errors. The PC can
+ * be scripted to plug in and out of USB forever for soak testing. Like the codec, this file has no Arduino, FreeRTOS
+ * or ESP-IDF dependencies. Time is passed in by the caller
+ */
+
+#pragma once
+
+#include "AudisonACLinkCodec.hpp"
+
+// C includes
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+struct AC_Link_Simulator_Config {
+    uint32_t response_latency_us = 2000;    // Time a node takes to answer
+    uint32_t bit_error_rate_ppm = 0;        // Chance per byte (parts per million) of a flipped bit
+    uint32_t usb_connected_time_us = 0;     // How long the PC stays plugged in. 0 disables USB cycling
+    uint32_t usb_disconnected_time_us = 0;  // How long the PC stays unplugged
+    uint32_t pc_traffic_period_us = 250000; // Bit Tune sends a setting this often while plugged in
+    uint32_t seed = 1;                      // Random seed (bit errors and PC traffic)
+};
+
+constexpr uint8_t AC_LINK_SIMULATOR_QUEUE_LENGTH = 16;
+constexpr uint8_t AC_LINK_SIMULATOR_SOURCE_NAME_LENGTH = 16;
+constexpr uint8_t AC_LINK_SIMULATOR_SOURCE_COUNT = 4;
+
+/**
+ * Settings a device has been told about
+ */
+struct AC_Link_Simulated_Settings {
+    uint8_t master_volume = 0;
+    uint8_t sub_volume = 0;
+    uint8_t balance = 0;
+    uint8_t fader = 0;
+    uint8_t memory = 0;
+};
+
+class AC_Link_Bus_Simulator {
+  public:
+    explicit AC_Link_Bus_Simulator(const struct AC_Link_Simulator_Config& config)
+        : config(config), random_state(config.seed ? config.seed : 1) {
+        this->next_usb_event_us = config.usb_disconnected_time_us;
+    }
+
+    /**
+     * A frame the DRC has put on the bus. Its echo and any answers are queued
+     * @param frame_bytes
+     * @param frame_length
+     * @param now_us
+     */
+    void transmit(const uint8_t* frame_bytes, uint8_t frame_length, uint64_t now_us) {
+        this->frames_from_drc++;
+        this->schedule_bytes(frame_bytes, frame_length, now_us); // The transceiver echoes everything
+        if (ac_link_validate_frame(frame_bytes, frame_length) != AC_LINK_FRAME_OK) {
+            return;
+        }
+        struct AC_Link_Frame frame;
+        ac_link_decode_frame(frame_bytes, frame_length, &frame);
+        this->deliver(&frame, now_us);
+    }
+
+    /**
+     * Run the scripted nodes up to now_us (USB plug events and Bit Tune traffic)
+     */
+    void advance(uint64_t now_us) {
+        if (this->config.usb_connected_time_us && now_us >= this->next_usb_event_us) {
+            if (!this->pc_plugged_in) {
+                // The DRC finds the PC with its next presence ping
+                this->pc_plugged_in = true;
+                this->next_usb_event_us = now_us + this->config.usb_connected_time_us;
+                this->next_pc_traffic_us = now_us + this->config.pc_traffic_period_us;
+            } else {
+                this->pc_plugged_in = false;
+                this->usb_cycles++;
+                uint8_t packet[] = {AC_LINK_COMMAND_DEVICE_IS_DISCONNECTED};
+                this->schedule(AC_LINK_ADDRESS_DRC, AC_LINK_ADDRESS_COMPUTER, packet, sizeof(packet), now_us);
+                this->next_usb_event_us = now_us + this->config.usb_disconnected_time_us;
+            }
+        }
+        if (this->pc_plugged_in && this->config.pc_traffic_period_us && now_us >= this->next_pc_traffic_us) {
+            this->send_bit_tune_traffic(now_us);
+            this->next_pc_traffic_us = now_us + this->config.pc_traffic_period_us;
+        }
+    }
+
+    /**
+     * Take the next frame due on the bus
+     * @param now_us
+     * @param frame Raw bytes as they would be read off the wire, bit errors included
+     * @returns false if nothing is due yet
+     */
+    bool receive(uint64_t now_us, struct AC_Link_Frame* frame) {
+        if (this->queue_length == 0 || this->queue[0].due_us > now_us) {
+            return false;
+        }
+        *frame = this->queue[0].frame;
+        this->queue_length--;
+        memmove(&this->queue[0], &this->queue[1], this->queue_length * sizeof(this->queue[0]));
+        this->frames_to_drc++;
+        this->inject_bit_errors(frame);
+        return true;
+    }
+
+    /* Node state, for checking the DRC kept the devices in sync */
+    struct AC_Link_Simulated_Settings master_mcu;
+    struct AC_Link_Simulated_Settings dsp;
+    uint8_t dsp_source = 0;
+    bool pc_plugged_in = false;
+
+    /* Counters */
+    uint32_t frames_from_drc = 0;
+    uint32_t frames_to_drc = 0;
+    uint32_t presence_pings_answered = 0;
+    uint32_t frames_corrupted = 0;
+    uint32_t frames_dropped = 0; // Queue full
+    uint32_t usb_cycles = 0;
+
+  private:
+    /**
+     * Hand a frame to the node it is addressed to
+     */
+    void deliver(const struct AC_Link_Frame* frame, uint64_t now_us) {
+        uint64_t answer_us = now_us + this->config.response_latency_us;
+        uint8_t receiver = frame->receiver();
+        uint8_t transmitter = frame->transmitter();
+        uint8_t command = frame->command();
+        if (command == AC_LINK_COMMAND_CHECK_DEVICE_PRESENT) {
+            bool present = receiver == AC_LINK_ADDRESS_MASTER_MCU || receiver == AC_LINK_ADDRESS_DSP_PROCESSOR ||
+                           (receiver == AC_LINK_ADDRESS_COMPUTER && this->pc_plugged_in);
+            if (present) {
+                uint8_t packet[] = {AC_LINK_COMMAND_DEVICE_IS_PRESENT};
+                this->schedule(transmitter, receiver, packet, sizeof(packet), answer_us);
+                this->presence_pings_answered++;
+            }
+            return;
+        }
+        if (receiver == AC_LINK_ADDRESS_MASTER_MCU) {
+            this->apply_setting(&this->master_mcu, frame);
+        } else if (receiver == AC_LINK_ADDRESS_DSP_PROCESSOR) {
+            this->apply_setting(&this->dsp, frame);
+            if (command == AC_LINK_COMMAND_CHANGE_SOURCE) {
+                this->dsp_source = (this->dsp_source + 1) % AC_LINK_SIMULATOR_SOURCE_COUNT;
+                this->send_source_name(transmitter, answer_us);
+            } else if (command == AC_LINK_COMMAND_GET_CURRENT_SOURCE_NAME) {
+                this->send_source_name(transmitter, answer_us);
+            }
+        }
+    }
+
+    void apply_setting(struct AC_Link_Simulated_Settings* settings, const struct AC_Link_Frame* frame) {
+        if (frame->payload_length() < 1) {
+            return;
+        }
+        uint8_t value = frame->payload()[0];
+        switch (frame->command()) {
+            case AC_LINK_COMMAND_MASTER_VOLUME:
+                settings->master_volume = value;
+                break;
+            case AC_LINK_COMMAND_SUB_VOLUME_ADJUST:
+                settings->sub_volume = value;
+                break;
+            case AC_LINK_COMMAND_BALANCE_ADJUST:
+                settings->balance = value;
+                break;
+            case AC_LINK_COMMAND_FADER_ADJUST:
+                settings->fader = value;
+                break;
+            case AC_LINK_COMMAND_CHANGE_DSP_MEMORY:
+                settings->memory = value;
+                break;
+            default:
+                break;
+        }
+    }
+
+    void send_source_name(uint8_t receiver_address, uint64_t due_us) {
+        static const char source_names[AC_LINK_SIMULATOR_SOURCE_COUNT][AC_LINK_SIMULATOR_SOURCE_NAME_LENGTH + 1] = {
+            "     Master     ", "     AUX In     ", "   Optical In   ", "   Bluetooth    "};
+        uint8_t packet[1 + AC_LINK_SIMULATOR_SOURCE_NAME_LENGTH] = {AC_LINK_COMMAND_INPUT_SOURCE_NAME};
+        memcpy(&packet[1], source_names[this->dsp_source], AC_LINK_SIMULATOR_SOURCE_NAME_LENGTH);
+        this->schedule(receiver_address, AC_LINK_ADDRESS_DSP_PROCESSOR, packet, sizeof(packet), due_us);
+    }
+
+    /**
+     * Bit Tune talking to the master MCU while it owns the bus. The DRC should follow along
+     */
+    void send_bit_tune_traffic(uint64_t now_us) {
+        uint32_t random = this->next_random();
+        uint8_t packet[2];
+        if ((random & 0x7) == 0) {
+            packet[0] = AC_LINK_COMMAND_CHANGE_DSP_MEMORY;
+            packet[1] = 1 + ((random >> 8) & 1); // Audison index memories from 1
+        } else if (random & 0x8) {
+            packet[0] = AC_LINK_COMMAND_MASTER_VOLUME;
+            packet[1] = (random >> 8) % (0x78 + 1);
+        } else {
+            packet[0] = AC_LINK_COMMAND_SUB_VOLUME_ADJUST;
+            packet[1] = (random >> 8) % (0x18 + 1);
+        }
+        struct AC_Link_Frame frame;
+        ac_link_encode_frame(AC_LINK_ADDRESS_MASTER_MCU, AC_LINK_ADDRESS_COMPUTER, packet, sizeof(packet), &frame);
+        this->schedule_bytes(frame.bytes, frame.length, now_us);
+        this->apply_setting(&this->master_mcu, &frame);
+    }
+
+    void schedule(uint8_t receiver_address, uint8_t transmitter_address, const uint8_t* data, uint8_t data_length,
+                  uint64_t due_us) {
+        struct AC_Link_Frame frame;
+        if (ac_link_encode_frame(receiver_address, transmitter_address, data, data_length, &frame)) {
+            this->schedule_bytes(frame.bytes, frame.length, due_us);
+        }
+    }
+
+    /**
+     * Insert in due time order. Frames due at the same time keep the order they were scheduled in
+     */
+    void schedule_bytes(const uint8_t* frame_bytes, uint8_t frame_length, uint64_t due_us) {
+        if (this->queue_length == AC_LINK_SIMULATOR_QUEUE_LENGTH) {
+            this->frames_dropped++;
+            return;
+        }
+        uint8_t position = this->queue_length;
+        while (position > 0 && this->queue[position - 1].due_us > due_us) {
+            this->queue[position] = this->queue[position - 1];
+            position--;
+        }
+        this->queue[position].due_us = due_us;
+        this->queue[position].frame.length = frame_length;
+        memcpy(this->queue[position].frame.bytes, frame_bytes, frame_length);
+        this->queue_length++;
+    }
+
+    void inject_bit_errors(struct AC_Link_Frame* frame) {
+        if (this->config.bit_error_rate_ppm == 0) {
+            return;
+        }
+        bool corrupted = false;
+        for (uint8_t i = 0; i < frame->length; i++) {
+            uint32_t random = this->next_random();
+            if ((random % 1000000) < this->config.bit_error_rate_ppm) {
+                frame->bytes[i] ^= 1 << ((random >> 20) & 0x7);
+                corrupted = true;
+            }
+        }
+        if (corrupted) {
+            this->frames_corrupted++;
+        }
+    }
+
+    /**
+     * xorshift32, plenty for test traffic
+     */
+    uint32_t next_random(void) {
+        this->random_state ^= this->random_state << 13;
+        this->random_state ^= this->random_state >> 17;
+        this->random_state ^= this->random_state << 5;
+        return this->random_state;
+    }
+
+    struct Scheduled_Frame {
+        uint64_t due_us;
+        struct AC_Link_Frame frame;
+    };
+
+    struct AC_Link_Simulator_Config config;
+    uint32_t random_state;
+    struct Scheduled_Frame queue[AC_LINK_SIMULATOR_QUEUE_LENGTH];
+    uint8_t queue_length = 0;
+    uint64_t next_usb_event_us = 0;
+    uint64_t next_pc_traffic_us = 0;
+};
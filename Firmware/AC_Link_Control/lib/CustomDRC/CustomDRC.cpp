@@ -9,17 +9,30 @@
 #include <Arduino.h>
 #include <ArduinoNvs.h>
 #include <esp_ota_ops.h>
+#include <esp_timer.h>
+#include <freertos/event_groups.h>
 #include "driver/rtc_io.h"
+#include "rom/crc.h"
 
 #define ENCODER_1_WAKEUP_PIN_MASK (((uint64_t)1) << ((uint64_t)ENCODER_1_SW))
 #define RS485_RX_PIN_WAKEUP_MASK  (((uint64_t)1) << ((uint64_t)RS485_RX_PIN))
 
 #define DSP_WAKEUP_PIN_MASK (ENCODER_1_WAKEUP_PIN_MASK | ENCODER_1_WAKEUP_PIN_MASK)
 
+#define TURN_OFF_TX_TIMEOUT_MS 500 // Longest we wait for the bus task to send the turn off command
+
 // #define TRIAL_TRANSMIT
 #define TRIAL_RECEIVE
 
-TaskHandle_t blinky_task_handle;
+TaskHandle_t blinky_task_handle, boot_web_server_task_handle;
+
+/* Boot phase bits (1 << Boot_Phase) and when each one completed */
+EventGroupHandle_t boot_event_group;
+static int64_t boot_phase_times_us[BOOT_PHASE_COUNT];
+static bool warm_resume = false; // Woken from deep sleep by the bus with a valid RTC snapshot
+static const char* const boot_phase_names[BOOT_PHASE_COUNT] = {
+    "settings loaded", "DSP powered", "bus live", "encoders ready", "web server up", "DSP ready", "devices synced",
+};
 
 Audison_AC_Link_Bus Audison_AC_Link;
 struct DSP_Settings dsp_settings;
@@ -35,6 +48,70 @@ const uint8_t master_source_name[] = {0x20, 0x20, 0x20, 0x20, 0x20, 0x4D, 0x61,
 
 LED_Mode_t led_mode = LED_MODE_BOOTUP;
 
+/**
+ * Settings kept in RTC slow memory through deep sleep. Waking from the bus with a valid snapshot skips NVS and the
+ * boot banner. The CRC covers everything before it, anything else (power loss, new firmware layout) is a cold boot
+ */
+#define RTC_SNAPSHOT_MAGIC 0x44524353 // "DRCS"
+
+struct RTC_Snapshot {
+    uint32_t magic;
+    uint32_t warm_resume_count;
+    uint8_t memory_select;
+    uint8_t master_volume;
+    uint8_t sub_volume;
+    uint8_t balance;
+    uint8_t fader;
+    char current_source[17];
+    uint32_t crc;
+};
+
+RTC_NOINIT_ATTR struct RTC_Snapshot rtc_snapshot;
+
+static uint32_t rtc_snapshot_crc(const struct RTC_Snapshot* snapshot) {
+    return crc32_le(0, (const uint8_t*)snapshot, offsetof(struct RTC_Snapshot, crc));
+}
+
+static void save_rtc_snapshot(const struct DSP_Settings* settings) {
+    rtc_snapshot.magic = RTC_SNAPSHOT_MAGIC;
+    rtc_snapshot.memory_select = settings->memory_select;
+    rtc_snapshot.master_volume = settings->master_volume;
+    rtc_snapshot.sub_volume = settings->sub_volume;
+    rtc_snapshot.balance = settings->balance;
+    rtc_snapshot.fader = settings->fader;
+    memcpy(rtc_snapshot.current_source, settings->current_source, sizeof(rtc_snapshot.current_source));
+    rtc_snapshot.crc = rtc_snapshot_crc(&rtc_snapshot);
+}
+
+/**
+ * @returns true if the snapshot was valid and has been loaded into settings
+ */
+static bool load_rtc_snapshot(struct DSP_Settings* settings) {
+    if (rtc_snapshot.magic != RTC_SNAPSHOT_MAGIC || rtc_snapshot.crc != rtc_snapshot_crc(&rtc_snapshot)) {
+        return false;
+    }
+    settings->memory_select = rtc_snapshot.memory_select;
+    settings->master_volume = rtc_snapshot.master_volume;
+    settings->sub_volume = rtc_snapshot.sub_volume;
+    settings->balance = rtc_snapshot.balance;
+    settings->fader = rtc_snapshot.fader;
+    memcpy(settings->current_source, rtc_snapshot.current_source, sizeof(rtc_snapshot.current_source));
+    settings->current_source[sizeof(settings->current_source) - 1] = '\0';
+    rtc_snapshot.warm_resume_count++;
+    rtc_snapshot.crc = rtc_snapshot_crc(&rtc_snapshot);
+    return true;
+}
+
+/* NVS is only opened when it is needed, a warm resume does not touch it until we shut down */
+static bool nvs_started = false;
+
+static void start_nvs(void) {
+    if (!nvs_started) {
+        NVS.begin();
+        nvs_started = true;
+    }
+}
+
 void blinky(void* pvParameters) {
     pinMode(LED_PIN, OUTPUT);
     digitalWrite(LED_PIN, LOW);
@@ -131,6 +208,7 @@ void load_dsp_settings_from_nvs(struct DSP_Settings* settings) {
 }
 
 void write_dsp_settings_to_nvs(struct DSP_Settings* settings) {
+    start_nvs();
     nvs_dsp_settings[DSP_SETTING_INDEX_MEMORY_SELECT] = settings->memory_select;
     nvs_dsp_settings[DSP_SETTING_INDEX_MASTER_VOLUME] = settings->master_volume;
     nvs_dsp_settings[DSP_SETTING_INDEX_SUB_VOLUME] = settings->sub_volume;
@@ -147,14 +225,39 @@ void write_dsp_settings_to_nvs(struct DSP_Settings* settings) {
     }
 }
 
-void init_custom_drc(void) {
-    Serial.begin(115200);
-    rtc_gpio_deinit(RS485_RX_PIN); // De-init the RTC GPIO and re-init to regular GPIO
-    pinMode(DSP_PWR_EN_PIN, OUTPUT);
-    digitalWrite(DSP_PWR_EN_PIN, LOW); // Make sure the DSP stays powered down on bootup
+void mark_boot_phase(Boot_Phase phase) {
+    EventBits_t phase_bit = (EventBits_t)1 << phase;
+    if (xEventGroupGetBits(boot_event_group) & phase_bit) {
+        return;
+    }
+    boot_phase_times_us[phase] = esp_timer_get_time();
+    xEventGroupSetBits(boot_event_group, phase_bit);
+    log_i("Boot: %s at %ums", boot_phase_names[phase], (unsigned)(boot_phase_times_us[phase] / 1000));
+    if (phase == BOOT_PHASE_DEVICES_SYNCED) {
+        // The timer restarts on wake so this is also wake to first command
+        log_i("%s to settings on the bus: %ums", warm_resume ? "Warm resume" : "Cold boot",
+              (unsigned)(boot_phase_times_us[phase] / 1000));
+    }
+}
 
-    xTaskCreatePinnedToCore(blinky, "blinky", 8000, NULL, tskIDLE_PRIORITY + 1, &blinky_task_handle, 1);
+bool wait_for_boot_phases(uint32_t phases, TickType_t ticks_to_wait) {
+    EventBits_t bits = xEventGroupWaitBits(boot_event_group, phases, pdFALSE, pdTRUE, ticks_to_wait);
+    return (bits & phases) == phases;
+}
 
+/**
+ * Bringing up the AP and HTTP server takes a while, do it alongside the bus
+ */
+static void boot_web_server_task(void* pvParameters) {
+    web_server_init((struct DSP_Settings*)pvParameters);
+    mark_boot_phase(BOOT_PHASE_WEB_SERVER_UP);
+    vTaskDelete(NULL);
+}
+
+/**
+ * Everything a cold boot needs that a warm resume can skip: flash logging and the settings in NVS
+ */
+static void load_settings_cold(void) {
     // Get the OTA partitions that are running and the next one that it will point to
     const esp_partition_t* running = esp_ota_get_running_partition();
     const esp_partition_t* otaPartition = esp_ota_get_next_update_partition(NULL);
@@ -168,9 +271,7 @@ void init_custom_drc(void) {
     Serial.printf("******  J SEQUEIRA   ******\n");
 
     // We will eventually load the DSP settings from NVS
-    NVS.begin();
-
-    strcpy(dsp_settings.current_source, "Master"); // Make sure there is something in here
+    start_nvs();
 
     uint8_t nvs_header_in_flash[4];
     bool ok = NVS.getBlob(NVS_HEADER_KEY, nvs_header_in_flash, sizeof(nvs_header_in_flash));
@@ -182,27 +283,59 @@ void init_custom_drc(void) {
     } else {
         load_dsp_settings_from_nvs(&dsp_settings);
     }
+}
 
-    // We can now enable the DSP system
-    digitalWrite(DSP_PWR_EN_PIN, HIGH);
+void init_custom_drc(void) {
+    boot_event_group = xEventGroupCreate();
+    Serial.begin(115200);
+    rtc_gpio_deinit(RS485_RX_PIN); // De-init the RTC GPIO and re-init to regular GPIO
+    pinMode(DSP_PWR_EN_PIN, OUTPUT);
+    digitalWrite(DSP_PWR_EN_PIN, LOW); // Make sure the DSP stays powered down on bootup
 
-    Serial.println("Waiting for DSP to boot ... ");
+    xTaskCreatePinnedToCore(blinky, "blinky", 8000, NULL, tskIDLE_PRIORITY + 1, &blinky_task_handle, 1);
 
-    // Wait for it to boot up
-    delay(5000);
+    strcpy(dsp_settings.current_source, "Master"); // Make sure there is something in here
+
+    warm_resume = (esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_EXT1) && load_rtc_snapshot(&dsp_settings);
+    if (warm_resume) {
+        log_i("Warm resume %u from RTC memory", (unsigned)rtc_snapshot.warm_resume_count);
+    } else {
+        rtc_snapshot.warm_resume_count = 0; // RTC memory holds garbage after power loss, start counting again
+        load_settings_cold();
+    }
+    mark_boot_phase(BOOT_PHASE_SETTINGS_LOADED);
+
+    // We can now enable the DSP system. The bus notices when it is up from its first frame
+    digitalWrite(DSP_PWR_EN_PIN, HIGH);
+    mark_boot_phase(BOOT_PHASE_DSP_POWERED);
 
     Serial.println("Starting Custom DRC");
 
+    xTaskCreatePinnedToCore(boot_web_server_task, "BOOT-WEB", 8 * 1024, &dsp_settings, tskIDLE_PRIORITY + 1,
+                            &boot_web_server_task_handle, 1);
+
     Audison_AC_Link.init_ac_link_bus(&dsp_settings);
+    mark_boot_phase(BOOT_PHASE_BUS_LIVE);
 
     init_drc_encoders(&dsp_settings);
-    web_server_init(&dsp_settings);
+    mark_boot_phase(BOOT_PHASE_ENCODERS_READY);
+}
+
+/**
+ * Called from the bus task once the turn off command has left the bus
+ */
+static void on_turn_off_sent(AC_Link_Tx_Result result, void* context) {
+    xSemaphoreGive((SemaphoreHandle_t)context);
 }
 
 void shut_down_dsp(void) {
+    static SemaphoreHandle_t turn_off_sent = xSemaphoreCreateBinary();
     change_led_mode(LED_MODE_SHUT_DOWN_MODE);
     write_dsp_settings_to_nvs(&dsp_settings); // We need to save the DSP settings to NVS before shutting down
-    Audison_AC_Link.turn_off_main_unit();
+    save_rtc_snapshot(&dsp_settings);          // And keep them at hand for when the bus wakes us up
+    // TX is asynchronous, make sure the command is on the wire before we cut the DSP power
+    Audison_AC_Link.turn_off_main_unit(on_turn_off_sent, turn_off_sent);
+    xSemaphoreTake(turn_off_sent, pdMS_TO_TICKS(TURN_OFF_TX_TIMEOUT_MS));
     digitalWrite(DSP_PWR_EN_PIN, LOW);
     rtc_gpio_pullup_en(RS485_RX_PIN);
     log_i("DSP shut down. We are going to sleep in 5 seconds");
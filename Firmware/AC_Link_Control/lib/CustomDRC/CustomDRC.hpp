@@ -62,6 +62,21 @@ enum DSP_Settings_Indexes {
     FIRMWARE_VERSION_NUMBER_STRING_PARAMETER,
 };
 
+/**
+ * Boot is a dependency graph rather than a sequence. Each phase is marked once when it completes, waiters block on
+ * the phases they need
+ */
+enum Boot_Phase {
+    BOOT_PHASE_SETTINGS_LOADED = 0, // Settings read from NVS
+    BOOT_PHASE_DSP_POWERED,         // DSP power enabled, it boots in parallel with everything below
+    BOOT_PHASE_BUS_LIVE,            // Bus task and RX running, settings can be queued
+    BOOT_PHASE_ENCODERS_READY,      // Encoders turning
+    BOOT_PHASE_WEB_SERVER_UP,       // WiFi AP and HTTP server up
+    BOOT_PHASE_DSP_READY,           // First frame received from the DSP
+    BOOT_PHASE_DEVICES_SYNCED,      // Settings sent to the MCU and DSP and echoed
+    BOOT_PHASE_COUNT,
+};
+
 typedef enum {
     LED_MODE_DISABLED = 0,
     LED_MODE_BOOTUP,
@@ -76,6 +91,22 @@ typedef enum {
  */
 void init_custom_drc(void);
 
+/**
+ * Mark a boot phase as complete and log when it happened. Later calls for the same phase do nothing
+ *
+ * @param phase
+ */
+void mark_boot_phase(Boot_Phase phase);
+
+/**
+ * Block until every phase in the list has completed
+ *
+ * @param phases Bit mask of (1 << Boot_Phase)
+ * @param ticks_to_wait
+ * @returns true if every phase completed in time
+ */
+bool wait_for_boot_phases(uint32_t phases, TickType_t ticks_to_wait);
+
 /**
  * Shut down the main DSP unit. Also enter hibernation mode - wake on acitivity on the bus
  */
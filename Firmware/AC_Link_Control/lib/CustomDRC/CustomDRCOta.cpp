@@ -0,0 +1,290 @@
+/**
+ * Author: Jaime Sequeira
+ */
+
+#include "CustomDRCOta.hpp"
+
+#include <Arduino.h>
+#include <Update.h>
+#include <mbedtls/sha256.h>
+
+// C++ includes
+#include <atomic>
+
+#define OTA_BUFFER_COUNT         2
+#define OTA_BUFFER_SIZE_BYTES    4096 // One flash sector, what Update erases and writes at a time
+#define OTA_NO_BUFFER            0xFF
+#define OTA_CHUNK_QUEUE_LENGTH   (OTA_BUFFER_COUNT + 2) // Every buffer, plus the begin and end (or abort) markers
+#define OTA_QUEUE_WAIT_MS        5000 // Longest the upload waits for the writer before giving up
+#define OTA_REBOOT_DELAY_MS      1000 // Lets the HTTP response and the last progress message go out
+#define OTA_SHA256_LENGTH_BYTES  32
+
+enum Ota_Chunk_Type {
+    OTA_CHUNK_BEGIN = 0, // A new image starts, drop anything left of the last one
+    OTA_CHUNK_DATA,
+    OTA_CHUNK_END,
+    OTA_CHUNK_ABORT,
+};
+
+/* Handed from the upload to the writer task. The buffer goes back through ota_free_queue once written */
+struct Ota_Chunk {
+    uint8_t type; // Ota_Chunk_Type
+    uint8_t buffer;
+    uint16_t length;
+};
+
+/**
+ * Buffers are passed between the upload and the writer, never shared: the upload fills one while the writer hashes
+ * and writes the other
+ */
+static uint8_t ota_buffers[OTA_BUFFER_COUNT][OTA_BUFFER_SIZE_BYTES];
+static QueueHandle_t ota_chunk_queue; // Ota_Chunk, upload to writer
+static QueueHandle_t ota_free_queue;  // Buffer indexes, writer to upload
+static TaskHandle_t ota_writer_task_handle;
+
+/* Upload side, only touched from the async TCP task */
+static bool ota_receiving; // Between ota_begin and the end or abort of that upload
+static uint8_t ota_filling_buffer = OTA_NO_BUFFER;
+static size_t ota_filling_length;
+
+static size_t ota_image_size; // 0 if unknown
+static uint8_t ota_expected_sha256[OTA_SHA256_LENGTH_BYTES];
+static std::atomic<uint8_t> ota_current_state(OTA_STATE_IDLE);
+static Ota_Progress_Callback ota_progress_callback;
+
+/* Where an update spends its time, logged once it is verified */
+struct Ota_Stats {
+    uint32_t start_ms;
+    uint32_t upload_us; // In ota_write, on the async TCP task
+    uint32_t stall_us;  // Of which waiting for the writer to free a buffer
+    uint32_t hash_us;
+    uint32_t flash_us;
+};
+
+static struct Ota_Stats ota_stats;
+
+static void set_ota_state(enum Ota_State state, uint8_t percent) {
+    ota_current_state = state;
+    if (ota_progress_callback != nullptr) {
+        ota_progress_callback(state, percent);
+    }
+}
+
+static bool parse_sha256(const char* hex, uint8_t* sha256) {
+    if (hex == nullptr || strlen(hex) != OTA_SHA256_HEX_LENGTH) {
+        return false;
+    }
+    for (uint8_t i = 0; i < OTA_SHA256_LENGTH_BYTES; i++) {
+        char byte_string[3] = {hex[i * 2], hex[i * 2 + 1], '\0'};
+        char* end;
+        sha256[i] = (uint8_t)strtoul(byte_string, &end, 16);
+        if (end != byte_string + 2) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool send_ota_chunk(uint8_t type, uint8_t buffer, uint16_t length) {
+    struct Ota_Chunk chunk = {type, buffer, length};
+    return xQueueSend(ota_chunk_queue, &chunk, pdMS_TO_TICKS(OTA_QUEUE_WAIT_MS)) == pdTRUE;
+}
+
+/**
+ * Give the filled buffer to the writer and take the other one, waiting only if the writer has not finished with it
+ */
+static bool hand_over_filling_buffer(void) {
+    if (!send_ota_chunk(OTA_CHUNK_DATA, ota_filling_buffer, ota_filling_length)) {
+        return false;
+    }
+    ota_filling_buffer = OTA_NO_BUFFER;
+    ota_filling_length = 0;
+    uint32_t start_us = micros();
+    bool taken = xQueueReceive(ota_free_queue, &ota_filling_buffer, pdMS_TO_TICKS(OTA_QUEUE_WAIT_MS)) == pdTRUE;
+    ota_stats.stall_us += micros() - start_us;
+    return taken;
+}
+
+bool ota_begin(size_t image_size, const char* expected_sha256) {
+    uint8_t state = ota_current_state;
+    if (ota_receiving || (state != OTA_STATE_IDLE && state != OTA_STATE_FAILED)) {
+        log_e("OTA: an update is already running");
+        return false;
+    }
+    if (!parse_sha256(expected_sha256, ota_expected_sha256)) {
+        log_e("OTA: expected SHA-256 missing or malformed");
+        return false;
+    }
+    // A failed upload can leave the buffer with the writer, it is back by the time the next one starts
+    if (ota_filling_buffer == OTA_NO_BUFFER &&
+        xQueueReceive(ota_free_queue, &ota_filling_buffer, pdMS_TO_TICKS(OTA_QUEUE_WAIT_MS)) != pdTRUE) {
+        log_e("OTA: writer still busy with the last update");
+        return false;
+    }
+    if (!Update.begin(image_size ? image_size : UPDATE_SIZE_UNKNOWN, U_FLASH)) {
+        log_e("OTA: %s", Update.errorString());
+        return false;
+    }
+    ota_image_size = image_size;
+    ota_filling_length = 0;
+    ota_stats = {};
+    ota_stats.start_ms = millis();
+    ota_current_state = OTA_STATE_RECEIVING;
+    if (!send_ota_chunk(OTA_CHUNK_BEGIN, OTA_NO_BUFFER, 0)) {
+        Update.abort();
+        ota_current_state = OTA_STATE_FAILED;
+        return false;
+    }
+    ota_receiving = true;
+    log_i("OTA: receiving %u bytes", (unsigned)image_size);
+    return true;
+}
+
+bool ota_write(const uint8_t* data, size_t length) {
+    if (!ota_receiving || ota_current_state != OTA_STATE_RECEIVING) {
+        return false; // The writer failed the update, the rest of the upload is dropped
+    }
+    uint32_t start_us = micros();
+    while (length > 0) {
+        size_t copy = min(length, (size_t)(OTA_BUFFER_SIZE_BYTES - ota_filling_length));
+        memcpy(ota_buffers[ota_filling_buffer] + ota_filling_length, data, copy);
+        ota_filling_length += copy;
+        data += copy;
+        length -= copy;
+        if (ota_filling_length == OTA_BUFFER_SIZE_BYTES && !hand_over_filling_buffer()) {
+            log_e("OTA: writer stopped taking data");
+            ota_abort();
+            return false;
+        }
+    }
+    ota_stats.upload_us += micros() - start_us;
+    return ota_current_state == OTA_STATE_RECEIVING;
+}
+
+void ota_end(void) {
+    if (!ota_receiving) {
+        return;
+    }
+    if ((ota_filling_length > 0 && !hand_over_filling_buffer()) || !send_ota_chunk(OTA_CHUNK_END, OTA_NO_BUFFER, 0)) {
+        log_e("OTA: writer stopped taking data");
+        ota_abort();
+        return;
+    }
+    ota_receiving = false;
+}
+
+void ota_abort(void) {
+    if (!ota_receiving) {
+        return;
+    }
+    ota_receiving = false;
+    ota_filling_length = 0;
+    if (!send_ota_chunk(OTA_CHUNK_ABORT, OTA_NO_BUFFER, 0)) {
+        log_e("OTA: could not reach the writer to abort");
+    }
+}
+
+enum Ota_State ota_state(void) {
+    return (enum Ota_State)ota_current_state.load();
+}
+
+/**
+ * Hashes and writes each buffer, then verifies the image once the upload ends. Reboots from here so the network keeps
+ * running while the last messages go out
+ */
+static void ota_writer_task(void* pvParameters) {
+    mbedtls_sha256_context sha256_context;
+    mbedtls_sha256_init(&sha256_context);
+    bool writing = false; // Cleared when the update fails, the rest of it is dropped
+    size_t bytes_written = 0;
+    uint8_t percent = 0;
+    struct Ota_Chunk chunk;
+    for (;;) {
+        xQueueReceive(ota_chunk_queue, &chunk, portMAX_DELAY);
+        switch (chunk.type) {
+            case OTA_CHUNK_BEGIN:
+                mbedtls_sha256_starts_ret(&sha256_context, 0);
+                writing = true;
+                bytes_written = 0;
+                percent = 0;
+                set_ota_state(OTA_STATE_RECEIVING, percent);
+                break;
+            case OTA_CHUNK_DATA: {
+                if (writing) {
+                    uint32_t start_us = micros();
+                    mbedtls_sha256_update_ret(&sha256_context, ota_buffers[chunk.buffer], chunk.length);
+                    ota_stats.hash_us += micros() - start_us;
+                    start_us = micros();
+                    size_t written = Update.write(ota_buffers[chunk.buffer], chunk.length);
+                    ota_stats.flash_us += micros() - start_us;
+                    if (written != chunk.length) {
+                        log_e("OTA: %s", Update.errorString());
+                        Update.abort();
+                        writing = false;
+                        set_ota_state(OTA_STATE_FAILED, percent);
+                    }
+                    bytes_written += written;
+                }
+                xQueueSend(ota_free_queue, &chunk.buffer, portMAX_DELAY);
+                uint8_t new_percent = ota_image_size ? (uint8_t)(bytes_written * 100 / ota_image_size) : 0;
+                if (writing && new_percent != percent) {
+                    percent = new_percent;
+                    set_ota_state(OTA_STATE_RECEIVING, percent);
+                }
+                break;
+            }
+            case OTA_CHUNK_END: {
+                if (!writing) {
+                    break;
+                }
+                writing = false;
+                set_ota_state(OTA_STATE_VERIFYING, percent);
+                uint8_t sha256[OTA_SHA256_LENGTH_BYTES];
+                mbedtls_sha256_finish_ret(&sha256_context, sha256);
+                if (memcmp(sha256, ota_expected_sha256, sizeof(sha256)) != 0) {
+                    log_e("OTA: SHA-256 mismatch after %u bytes, image discarded", (unsigned)bytes_written);
+                    Update.abort();
+                    set_ota_state(OTA_STATE_FAILED, percent);
+                    break;
+                }
+                if (!Update.end(true)) {
+                    log_e("OTA: %s", Update.errorString());
+                    set_ota_state(OTA_STATE_FAILED, percent);
+                    break;
+                }
+                uint32_t elapsed_ms = millis() - ota_stats.start_ms;
+                log_i("OTA: %u bytes verified in %u ms (%u KB/s)", (unsigned)bytes_written, (unsigned)elapsed_ms,
+                      (unsigned)(elapsed_ms ? bytes_written / elapsed_ms : 0));
+                log_i("OTA: %u ms on the TCP task (%u ms waiting for a buffer), %u ms hashing, %u ms writing flash",
+                      (unsigned)(ota_stats.upload_us / 1000), (unsigned)(ota_stats.stall_us / 1000),
+                      (unsigned)(ota_stats.hash_us / 1000), (unsigned)(ota_stats.flash_us / 1000));
+                set_ota_state(OTA_STATE_REBOOTING, 100);
+                vTaskDelay(pdMS_TO_TICKS(OTA_REBOOT_DELAY_MS));
+                ESP.restart();
+                break;
+            }
+            case OTA_CHUNK_ABORT:
+                if (writing) {
+                    log_e("OTA: upload stopped after %u bytes", (unsigned)bytes_written);
+                    Update.abort();
+                    writing = false;
+                    set_ota_state(OTA_STATE_FAILED, percent);
+                }
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+void ota_init(Ota_Progress_Callback progress_callback) {
+    ota_progress_callback = progress_callback;
+    ota_chunk_queue = xQueueCreate(OTA_CHUNK_QUEUE_LENGTH, sizeof(struct Ota_Chunk));
+    ota_free_queue = xQueueCreate(OTA_BUFFER_COUNT, sizeof(uint8_t));
+    ota_filling_buffer = 0; // The upload starts with the first buffer, the rest wait for it
+    for (uint8_t buffer = 1; buffer < OTA_BUFFER_COUNT; buffer++) {
+        xQueueSend(ota_free_queue, &buffer, 0);
+    }
+    xTaskCreatePinnedToCore(ota_writer_task, "OTA-WRITE", 4000, NULL, tskIDLE_PRIORITY + 1, &ota_writer_task_handle,
+                            1);
+}
@@ -0,0 +1,57 @@
+/**
+ * Author: Jaime Sequeira
+ *
+ * Firmware updates uploaded through the webapp. The upload callback only copies chunks into one of two sector sized
+ * buffers, a writer task hashes them (SHA-256) and writes them to flash. The image is only marked bootable once its
+ * hash matches the one the webapp sent
+ */
+
+#pragma once
+
+#include <Arduino.h>
+
+enum Ota_State {
+    OTA_STATE_IDLE = 0,
+    OTA_STATE_RECEIVING,
+    OTA_STATE_VERIFYING,
+    OTA_STATE_REBOOTING,
+    OTA_STATE_FAILED,
+};
+
+#define OTA_SHA256_HEX_LENGTH 64
+
+/**
+ * Called from the writer task when the state changes or another percent has been written
+ */
+typedef void (*Ota_Progress_Callback)(uint8_t state, uint8_t percent);
+
+/**
+ * Create the writer task
+ */
+void ota_init(Ota_Progress_Callback progress_callback);
+
+/**
+ * Start an update. Fails if one is already running
+ * @param image_size Size of the firmware image in bytes
+ * @param expected_sha256 SHA-256 of the image, OTA_SHA256_HEX_LENGTH hex characters
+ * @returns false if the update could not be started
+ */
+bool ota_begin(size_t image_size, const char* expected_sha256);
+
+/**
+ * Hand the next part of the image to the writer task. Only waits if both buffers are still being written
+ * @returns false if the update has failed
+ */
+bool ota_write(const uint8_t* data, size_t length);
+
+/**
+ * The whole image has been received. The writer task verifies it and reboots into it
+ */
+void ota_end(void);
+
+/**
+ * The upload stopped before the end. Does nothing once the image has been received
+ */
+void ota_abort(void);
+
+enum Ota_State ota_state(void);
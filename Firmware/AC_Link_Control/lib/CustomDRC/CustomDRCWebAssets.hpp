@@ -0,0 +1,62 @@
+/**
+ * Author: Jaime Sequeira
+ *
+ * Web assets built into the firmware. WebDesign/Mockup/convert_to_headers.py generates the table
+ * (CustomDRCWebAssetsData.h) from every file in the mockup before each build, sorted by path so a request is found
+ * with a binary search. Like the binary protocol, this file has no Arduino, FreeRTOS or ESP-IDF dependencies
+ */
+
+#pragma once
+
+// C includes
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+struct Web_Asset {
+    const char* path;          // URL path, the table is sorted by it
+    const char* mime;          // Content-Type
+    const char* encoding;      // Content-Encoding, nullptr if sent as it is
+    const char* etag;          // Quoted hash of the uncompressed content
+    const char* cache_control; // Long lived for content hashed paths, revalidated for the rest
+    const uint8_t* data;       // Paths with the same content share it
+    size_t length;
+};
+
+constexpr int web_asset_compare_path(const char* a, const char* b) {
+    while (*a != '\0' && *a == *b) {
+        a++;
+        b++;
+    }
+    return (int)(uint8_t)*a - (int)(uint8_t)*b;
+}
+
+constexpr bool web_assets_sorted(const struct Web_Asset* assets, size_t count) {
+    for (size_t i = 1; i < count; i++) {
+        if (web_asset_compare_path(assets[i - 1].path, assets[i].path) >= 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @returns The asset served on path, nullptr if there is none
+ */
+inline const struct Web_Asset* web_asset_find(const struct Web_Asset* assets, size_t count, const char* path) {
+    size_t low = 0;
+    size_t high = count;
+    while (low < high) {
+        size_t middle = low + (high - low) / 2;
+        int compare = strcmp(path, assets[middle].path);
+        if (compare == 0) {
+            return &assets[middle];
+        }
+        if (compare < 0) {
+            high = middle;
+        } else {
+            low = middle + 1;
+        }
+    }
+    return nullptr;
+}
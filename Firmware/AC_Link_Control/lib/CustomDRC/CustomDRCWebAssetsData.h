@@ -0,0 +1,26 @@
+/* Generated by WebDesign/Mockup/convert_to_headers.py from the files next to it, do not edit */
+#pragma once
+
+#include "CustomDRCWebAssets.hpp"
+
+/* index.html: 4330 bytes, 1541 in flash */
+static const uint8_t web_asset_data_84cb841b8697ec75[] = {0x1f,0x8b,0x8,0x0,0x0,0x0,0x0,0x0,0x2,0x3,0xa5,0x58,0x59,0x73,0xdb,0x36,0x10,0x7e,0xe7,0xaf,0x40,0xf0,0xd4,0xce,0x54,0xa2,0xaf,0xa4,0xaa,0x2b,0xb1,0x63,0xc9,0xf1,0x4c,0x66,0xe2,0xc6,0xad,0xdc,0x64,0xfa,0xe4,0x81,0xc8,0x95,0x84,0x18,0x24,0x58,0x0,0x94,0xec,0x7f,0xdf,0xc5,0x41,0x91,0xa2,0x28,0xb5,0x69,0x9f,0x4,0x62,0xaf,0x6f,0xf,0x2c,0x16,0x1a,0xbf,0xb9,0xfd,0x34,0x7b,0xfc,0xf3,0xe1,0x3d,0x59,0x9b,0x5c,0x24,0xd1,0xd8,0xfe,0x10,0xc1,0x8a,0xd5,0x84,0x42,0x41,0xed,0x6,0xb0,0xc,0x7f,0x72,0x30,0x8c,0xa4,0x6b,0xa6,0x34,0x98,0x9,0xad,0xcc,0x72,0x30,0xa2,0x24,0xae,0x9,0x5,0xcb,0x61,0x42,0x37,0x1c,0xb6,0xa5,0x54,0x86,0x92,0x54,0x16,0x6,0xa,0x64,0xdc,0xf2,0xcc,0xac,0x27,0x19,0x6c,0x78,0xa,0x3,0xf7,0xf1,0x3,0xe1,0x5,0x37,0x9c,0x89,0x81,0x4e,0x99,0x80,0xc9,0xf9,0x81,0x9a,0x54,0xa,0xa9,0x90,0xba,0x86,0x1c,0x5a,0xaa,0x4,0x5f,0xad,0xd,0xc9,0x98,0x7a,0xf6,0x12,0x82,0x17,0xcf,0x44,0x81,0x98,0x50,0x6d,0x5e,0x5,0xe8,0x35,0x0,0x5a,0x36,0xaf,0x25,0xaa,0x30,0xf0,0x62,0xe2,0x54,0x6b,0x4a,0xd6,0xa,0x96,0x13,0x5a,0xf2,0x54,0xe,0x73,0x5e,0xc,0x2f,0xde,0x8d,0xd8,0xe8,0x6c,0xc1,0xce,0xdf,0xa6,0x17,0xcb,0xec,0xea,0xa7,0xa1,0x63,0xb2,0xea,0xc,0x37,0x2,0x92,0x59,0xa5,0x8d,0xcc,0xc9,0xed,0xef,0x33,0x32,0x93,0xc5,0x92,0xaf,0xc6,0xb1,0x27,0x44,0xe3,0x38,0x44,0x62,0x21,0xb3,0x57,0xb,0x98,0xf1,0x82,0xa4,0x82,0x69,0x6d,0x11,0x17,0x6,0x3f,0x41,0xd9,0x80,0x2d,0x39,0x88,0xc,0xa3,0x44,0x94,0x44,0xf7,0xe8,0x4a,0xc9,0xaa,0x74,0x81,0x3c,0x6f,0x69,0x47,0x6d,0xe7,0x56,0x57,0x65,0x8c,0x2c,0x8,0xcf,0x26,0xf4,0xaf,0x8a,0x9b,0xa9,0xfb,0xa4,0xc4,0x39,0x34,0xa1,0x19,0xd7,0xa5,0x60,0xaf,0xd7,0xa4,0x90,0x5,0xd0,0xe4,0x37,0xe4,0x18,0xc7,0x5e,0xc4,0xe2,0xa9,0xd,0xe1,0xba,0x74,0x2a,0x16,0x95,0x46,0xd0,0x5,0xa4,0x86,0x4b,0x97,0xbb,0xc,0x44,0xf2,0xd1,0x86,0x69,0x5a,0x69,0x72,0x83,0xdb,0x1b,0x18,0xc7,0x76,0x13,0xa5,0x4b,0x4b,0xe7,0x9b,0x43,0x17,0x9c,0x2a,0xeb,0xdd,0x14,0x1d,0xb5,0x5a,0xb4,0x57,0x88,0xab,0x37,0x83,0x1,0xb9,0x9d,0x3f,0x90,0x7b,0xc8,0xa5,0x7a,0x25,0x73,0x10,0x48,0x22,0x83,0x41,0xcb,0x6b,0x9b,0x18,0x58,0x41,0x91,0x25,0x7,0x8c,0xd7,0xe3,0x38,0x90,0xa2,0x31,0x2f,0xca,0xca,0x44,0x3e,0x59,0x8a,0x65,0x5c,0xd2,0xc8,0x9a,0x45,0x19,0x14,0xb9,0xa1,0xd1,0x86,0x89,0xa,0x49,0x67,0x34,0xf2,0x35,0x91,0xe9,0xd2,0xeb,0xa2,0x11,0xd6,0x45,0xfa,0xc,0x59,0xe4,0x6a,0x80,0x2d,0x40,0xb8,0xd2,0xbd,0x93,0xaa,0x11,0x4f,0x6e,0xd0,0x94,0x25,0xd5,0x96,0x48,0xdb,0x12,0x69,0x2c,0x4d,0x29,0x9,0x96,0xb0,0xc,0xbb,0x96,0xc8,0x51,0xb,0x53,0x9a,0x4c,0x1b,0xb,0xed,0x44,0xd8,0x8,0xcd,0x2a,0xa5,0xb0,0x62,0xc9,0x7,0x67,0x79,0x2e,0x2b,0x95,0xc2,0x7e,0x90,0xba,0xa5,0x81,0xb9,0xe8,0x13,0xba,0x8e,0xc6,0x95,0x3,0x9b,0x7a,0xa2,0xdf,0xfd,0x68,0xcd,0xd2,0x84,0xdc,0x33,0x6d,0x40,0x91,0x71,0x5c,0xd5,0xe9,0x6c,0x3,0x69,0x55,0x16,0x9e,0xda,0x62,0x5,0x5e,0x38,0x54,0x58,0x32,0x73,0x7b,0xc1,0x4e,0xab,0xa8,0x2c,0xfe,0xfb,0xca,0x20,0x65,0xcb,0x4d,0xba,0xf6,0xb0,0xed,0xe6,0x5e,0x82,0xdb,0xa1,0xd,0x9,0xb2,0x42,0x34,0x24,0xd4,0x65,0x68,0x21,0x5f,0x68,0xe4,0xfd,0xd4,0x4e,0x17,0x8d,0x7e,0x70,0x39,0xce,0x91,0xf3,0xa9,0xde,0xc2,0x10,0x5b,0xc9,0xa8,0x2f,0x9a,0xde,0x78,0xbc,0x5f,0x7e,0x58,0xe0,0x6,0xb5,0xfa,0x38,0x69,0xcf,0xd2,0x70,0xf8,0x6c,0x2d,0x6d,0xa6,0x72,0x17,0x9e,0xcf,0x52,0x54,0xd8,0x45,0xa2,0x24,0x44,0xcb,0x7f,0x5f,0x93,0xb1,0x2e,0x59,0x11,0x2a,0xbd,0xe1,0xfb,0x6c,0x6b,0x81,0x26,0x68,0x13,0xa9,0x51,0xd2,0x2d,0xa2,0x2e,0x3b,0xdd,0x95,0x15,0xc6,0x92,0x12,0xec,0x2f,0xb6,0x62,0x49,0xce,0x5e,0xb0,0x9e,0x2e,0xce,0xec,0x39,0x86,0xd2,0x95,0x56,0xbc,0x8f,0x4d,0x57,0x8b,0x1d,0xb0,0x79,0xb5,0x18,0xf6,0xc0,0xda,0xb1,0xfc,0xb,0x4c,0x8d,0xba,0x13,0x80,0x2e,0xae,0x8e,0xe3,0x59,0x30,0xec,0xf8,0x29,0x5a,0x99,0xfa,0x45,0x1b,0x48,0xa0,0xed,0xc1,0xe8,0x45,0x51,0x2b,0x39,0x81,0xe1,0xf2,0xdd,0x71,0xc,0x4b,0x96,0xd9,0xfe,0x79,0x67,0x7f,0xda,0xf6,0xdd,0xfe,0x3f,0x5b,0xf7,0xe2,0xdf,0x62,0xbb,0x53,0x58,0x5f,0x14,0xc7,0xb2,0xf7,0x4d,0x9f,0x18,0xe9,0xfa,0x5c,0xbb,0xba,0x8e,0x34,0xe5,0xdd,0x69,0xf0,0xf2,0x73,0x30,0x86,0x17,0x2b,0x1d,0x34,0xec,0xb7,0x9f,0x45,0x68,0xef,0xa1,0xe5,0x78,0x9,0xcf,0x48,0x9,0xea,0x65,0xb,0x1,0x99,0xc7,0xb6,0x3b,0xd,0x1d,0x90,0xb0,0x28,0x19,0x9e,0xdb,0x7,0xec,0xd9,0x5b,0xa9,0x32,0xf2,0x47,0x99,0x31,0x3,0xdf,0x0,0xd4,0x7,0xbb,0x72,0x62,0xb5,0x16,0x9a,0x4,0x35,0xf5,0x46,0x63,0xbf,0xb7,0x63,0xb9,0x80,0x77,0x55,0xec,0xf7,0xf4,0xb2,0xde,0x8f,0x10,0x43,0xa,0x6b,0x29,0x30,0x3d,0x13,0xfa,0xbe,0xb0,0x87,0xf0,0x57,0xd8,0xee,0x4c,0xd1,0x88,0x29,0xce,0x6,0xce,0x5e,0x3f,0xbd,0xe,0x8c,0x6b,0xf8,0x27,0xc2,0xd9,0xf1,0xa1,0x1b,0xd1,0x56,0xff,0xea,0x6,0x95,0xdf,0x71,0x92,0x2a,0xc8,0xb0,0xc5,0xe2,0x5c,0xa2,0x7b,0x83,0xea,0x1a,0x69,0xc3,0xe3,0xeb,0xa4,0xff,0xa6,0xfe,0xb9,0x13,0xec,0x96,0x98,0xd7,0x8c,0x37,0x49,0x4e,0x13,0x67,0x76,0x76,0x60,0xb6,0x15,0x7b,0x64,0x23,0xcc,0x99,0x9f,0x50,0xda,0x45,0xd0,0x56,0xb5,0x1f,0x7b,0x3b,0xfc,0xd4,0xf7,0xa6,0xd6,0x3c,0x73,0xad,0xb2,0x93,0x88,0xf9,0xfc,0xc3,0xed,0x7e,0xe8,0x1f,0x9d,0x94,0x35,0xb2,0xe5,0x4b,0x1e,0x70,0x31,0x2e,0xb4,0x67,0x8d,0x8f,0x26,0xd8,0x1b,0xaa,0xbf,0xfb,0x8c,0xf5,0xe7,0xfa,0xa8,0xc1,0xe,0x3b,0x2f,0x30,0xc1,0x96,0xcd,0x28,0xec,0x1,0xe,0x88,0xce,0x99,0x10,0xc9,0x3d,0xe,0x92,0x79,0x95,0x93,0x91,0x9b,0x4b,0x31,0x50,0xa0,0x34,0xe6,0xd6,0xd1,0x6c,0xc2,0x31,0x34,0x87,0xc9,0xbe,0x97,0x19,0x13,0xc4,0x5f,0x83,0x87,0x19,0xce,0x2d,0xf5,0x44,0x56,0xfb,0xca,0xaf,0x37,0x2f,0xf5,0x24,0x87,0x6b,0x36,0x30,0x4c,0xad,0xec,0xd4,0xec,0xb4,0xf,0xe0,0x85,0xe5,0xa5,0xc0,0xf6,0x24,0x8b,0x54,0xf0,0xf4,0x19,0x1d,0x93,0xab,0x95,0x0,0x87,0xec,0x3b,0xd8,0xa0,0x9e,0xef,0xbb,0x45,0xdd,0xad,0x95,0xa6,0xb8,0xb1,0x19,0x3a,0x50,0x87,0x9e,0xe,0xe3,0xe0,0xec,0xee,0xe,0x6f,0x7d,0x66,0xa8,0x45,0xae,0x1a,0x9f,0x77,0xa8,0x90,0xc6,0x94,0xe1,0xa9,0x1b,0x79,0xed,0xc4,0xb,0x6a,0x37,0x4d,0xec,0xa5,0x6f,0x26,0xa4,0xc6,0x74,0xb8,0x1,0xbc,0x54,0xb0,0xc1,0x83,0x7a,0xdc,0xd7,0xe8,0x94,0xaf,0xf6,0x52,0xdb,0xd,0x20,0xeb,0xcb,0xe4,0x88,0xcf,0xbf,0xe0,0xcc,0x7c,0x59,0xcf,0xe1,0xe,0xd5,0x52,0x4a,0xd3,0x86,0xe7,0x7b,0x54,0xc8,0x4b,0x14,0x6,0x5b,0xc,0x8a,0x2c,0xf0,0xd5,0xf0,0xfa,0x7f,0x0,0x46,0x33,0x7b,0xb5,0x89,0x1a,0x27,0x22,0xae,0x23,0x52,0x19,0xb9,0x94,0x69,0xa5,0xff,0xbb,0x72,0x57,0x3f,0xb6,0x9d,0xa8,0x7c,0x76,0xa4,0x8c,0x2c,0x0,0xcf,0x11,0xed,0x3d,0x0,0x6a,0xff,0xe3,0x26,0x65,0xb1,0xcf,0x6c,0xc8,0xf8,0xa7,0xc7,0x9b,0xba,0x9b,0xdd,0x71,0x1,0xb8,0x16,0x92,0x65,0x27,0xa6,0x26,0x69,0xd8,0xd3,0xd2,0xf5,0x94,0x46,0x74,0xbf,0x23,0x45,0xf8,0x52,0x5b,0x4b,0xc4,0xfc,0xf0,0x69,0xfe,0x88,0x47,0x34,0xf4,0xa7,0xb8,0x72,0xaa,0x69,0x4,0x45,0xea,0xcf,0x47,0x5e,0x9,0xc3,0x4b,0x44,0xe6,0x4e,0xe2,0xc0,0xc6,0x7,0x7,0xc4,0x10,0x20,0xbe,0x54,0xcc,0x8e,0x3f,0xd6,0xf9,0x9d,0xcd,0xe8,0xc4,0x88,0xdc,0x3e,0x79,0x4b,0x6e,0x8f,0xcf,0x4e,0xd4,0x7d,0xf9,0x2e,0x14,0x40,0x90,0xee,0x55,0x81,0x13,0x52,0xce,0x4d,0xeb,0x54,0x79,0x36,0x7f,0x8f,0xd9,0xf5,0x53,0xad,0xe9,0xa9,0x3e,0xd6,0x7,0x97,0x46,0xe8,0x27,0x36,0xac,0x21,0x8c,0xa5,0x92,0x2b,0x5,0x5a,0x93,0x5,0x53,0x3e,0xa6,0xf5,0x4e,0xd4,0x6,0xf7,0x14,0x4c,0xd4,0x44,0x1a,0xf5,0xde,0xd0,0xad,0x37,0x8f,0x9f,0x20,0xcf,0xce,0x5a,0xdd,0x6e,0xe7,0xae,0x36,0xcc,0x54,0xda,0xcd,0x42,0x75,0xa7,0x6b,0x32,0x89,0xd9,0xdf,0x4,0x8c,0x77,0xae,0x38,0xc2,0xbb,0xc3,0xaf,0xfb,0x5e,0xab,0x65,0xd2,0xd2,0x6f,0x2b,0x6c,0xcb,0x14,0x3c,0x6d,0xb0,0x95,0xa2,0x46,0x34,0xa6,0x70,0x9a,0xc1,0xa9,0xec,0xb,0xf9,0x8c,0x5b,0xd7,0xe4,0x7c,0x78,0x36,0x3c,0x23,0xb5,0x6d,0xff,0xec,0xa8,0x55,0x24,0xd3,0x8a,0xb,0x43,0x70,0xb2,0x5f,0x93,0x7,0x7c,0x70,0xcf,0xe6,0xf3,0xe,0x67,0x53,0xb1,0xa1,0x41,0xb5,0x41,0xc6,0xf6,0xcd,0x69,0xdd,0x4d,0x15,0x2f,0xd,0xd1,0x2a,0xc5,0x32,0x29,0x32,0x78,0x19,0xfe,0xf8,0xf6,0x32,0x3d,0x67,0x57,0xb0,0x84,0xab,0x74,0x34,0xba,0x1c,0xd,0xbf,0xea,0xbd,0x87,0xfe,0x57,0xb6,0x61,0x5e,0xca,0x85,0xc5,0xad,0xac,0xc2,0xf0,0x52,0x8f,0xdd,0x5f,0x1b,0x7f,0x3,0x46,0xfe,0x1d,0x15,0xea,0x10,0x0,0x0};
+
+/* index.js: 16297 bytes, 5486 in flash */
+static const uint8_t web_asset_data_753c1a4efe4c8838[] = {0x1f,0x8b,0x8,0x0,0x0,0x0,0x0,0x0,0x2,0x3,0xa5,0x3b,0x6b,0x73,0xdb,0x48,0x8e,0xdf,0xf5,0x2b,0x7a,0x59,0x53,0x53,0x54,0x22,0xcb,0x24,0xf5,0x8e,0xe3,0x6c,0xf9,0x95,0xb5,0x77,0x62,0x3b,0x65,0x29,0xc9,0x5c,0x79,0x7c,0x4a,0x93,0x6c,0x5a,0x9c,0x91,0x48,0xd,0x49,0x59,0xf1,0x65,0x74,0x75,0xbf,0xe6,0x7e,0xd8,0xfd,0x92,0x3,0xd0,0xcd,0xa7,0x29,0xd9,0xd9,0xdd,0xa9,0x8d,0xc5,0x26,0x80,0xc6,0xab,0xd1,0x0,0xba,0xf9,0xc0,0x23,0x76,0xcf,0x13,0xb1,0xe6,0x8f,0xec,0x90,0x7d,0x5d,0xc7,0x6f,0xf6,0xf7,0x7f,0xfa,0xbe,0xf6,0x3,0x37,0x5c,0xb7,0xe7,0xa1,0xc3,0x13,0x3f,0xc,0xda,0xb3,0x30,0x4e,0x2,0xbe,0x10,0x9b,0xfd,0x75,0xfc,0xf5,0xa0,0xf1,0x0,0x48,0x6b,0x61,0xc7,0xa1,0xf3,0x87,0x48,0xe,0x1a,0xa,0x9a,0xbb,0xee,0xd9,0x83,0x8,0x92,0xf,0x7e,0x9c,0x88,0x40,0x44,0xba,0x36,0xf,0xb9,0xab,0xb5,0x58,0x18,0xe0,0x8f,0xe6,0x1,0xdb,0xdf,0x67,0x17,0x81,0x9f,0x20,0x2e,0x93,0xc8,0x6c,0x3d,0x13,0x1,0x4b,0x66,0x82,0x2d,0xf9,0xbd,0x60,0x8,0x17,0x13,0xf9,0x87,0x70,0xbe,0x5a,0x8,0x60,0xc9,0x38,0x68,0xec,0xbf,0x62,0xa7,0xc2,0xf3,0x3,0xc1,0xf8,0x7c,0xce,0x4e,0xaf,0x2f,0x99,0x98,0x8b,0x5,0xcc,0x14,0xb3,0x99,0x88,0x4,0x7b,0xb5,0xdf,0x98,0x3,0xa9,0x25,0x8f,0xe3,0x75,0x18,0xb9,0x53,0xc9,0xf,0xe0,0xba,0xa1,0xb3,0x42,0xb8,0xf6,0xbd,0x48,0xce,0x24,0xca,0xf1,0xe3,0x85,0xab,0x6b,0x29,0xe8,0x59,0x90,0x44,0x8f,0x63,0xe1,0xa0,0x90,0x5a,0xf3,0x80,0xc8,0x2c,0xb8,0x1f,0xbc,0x80,0x4,0x82,0x1d,0x87,0xee,0x63,0x8a,0xf6,0xe7,0xca,0x4f,0xa6,0xf6,0x2a,0x49,0xc2,0x60,0x17,0x1a,0x82,0x1d,0x13,0x54,0x36,0xdf,0x2a,0x11,0xd3,0x78,0xed,0x27,0xce,0x6c,0xe7,0x7c,0x39,0x58,0x8a,0xe9,0x7,0xcb,0x55,0x32,0x8d,0x41,0x19,0x4e,0x32,0x8d,0xb8,0xeb,0x87,0xf5,0x4,0xe2,0xe3,0xc7,0x2b,0x30,0x9e,0xae,0x5d,0x20,0xc2,0x98,0xe0,0x53,0x1a,0xce,0x2a,0x8a,0x0,0x64,0x1a,0x87,0xab,0xc8,0x11,0xd3,0x39,0xb7,0xc5,0x7c,0x17,0x1b,0xa,0x7e,0x4c,0xe0,0x1f,0x10,0x3a,0xa3,0x34,0xe3,0xc1,0xbd,0x48,0x9,0x3d,0xaf,0x9,0x9,0x2f,0x9,0x95,0x35,0xe2,0xc6,0xcb,0xe9,0x42,0x2c,0xc2,0xe8,0x71,0xca,0x77,0xc9,0x25,0xe9,0x9c,0x8e,0x3f,0x5e,0x8a,0xc5,0x51,0xd,0xb2,0xfd,0x52,0xe4,0xe3,0x14,0x79,0xb5,0x74,0x61,0x2d,0x7c,0xf1,0x3d,0xff,0x24,0x12,0x2e,0x40,0xf9,0x7c,0x1e,0xbf,0xf,0xa3,0xc5,0xe,0x1a,0xd,0xcd,0xc9,0x61,0x3f,0x11,0x1,0xc4,0xd0,0x1a,0xa9,0x5e,0xaa,0x6f,0x8f,0x9f,0x53,0x4d,0xd,0x45,0xa5,0xa0,0x1a,0x9a,0x97,0xa1,0xcb,0x77,0x5b,0x2c,0xc,0x3c,0x3f,0x5a,0x9c,0x54,0x50,0x52,0x91,0xe3,0xd8,0x77,0xc9,0x2f,0x76,0xd1,0x58,0xe7,0x1a,0xe1,0xfe,0x3c,0x1e,0x8f,0x2f,0x4e,0x53,0xfc,0x74,0x29,0xfd,0x28,0x8d,0x8f,0xa,0x2f,0x73,0x9f,0x27,0x6c,0xbe,0x5c,0x5b,0x3b,0x51,0x33,0xa5,0x85,0x9,0x9f,0x7a,0xfe,0x5c,0x4c,0x57,0x4b,0x8c,0x33,0x2f,0x70,0x51,0x5,0x98,0x21,0xda,0x25,0x37,0xad,0xd2,0x5b,0x46,0xe1,0x7d,0x24,0xe2,0x78,0x6a,0x43,0xfc,0xda,0xc5,0xef,0x36,0xc4,0x12,0xa7,0x71,0xc2,0x93,0x55,0xfc,0xfc,0x82,0xcc,0x61,0x91,0x2f,0x88,0xb0,0x37,0xb8,0xac,0xd8,0x3,0x9f,0xaf,0x44,0xac,0x2,0x1a,0xc4,0xe3,0x68,0x2a,0x23,0x2a,0x2c,0x9,0x7c,0xbd,0x33,0xb0,0x21,0xf8,0x67,0x82,0xce,0x9c,0x64,0x65,0xbf,0x18,0x1f,0x60,0xcb,0xc8,0x36,0x9f,0xf3,0xc0,0x79,0x1,0xa6,0x2,0x4c,0xf1,0x3c,0xee,0x2,0xdb,0xcf,0x62,0x11,0x98,0x92,0xfd,0x83,0x1f,0xfc,0xc1,0x8e,0x57,0x31,0x7a,0x53,0x20,0xc3,0x3a,0x91,0x9a,0xc3,0x38,0x58,0x2f,0x9e,0xe6,0xe3,0x53,0xd7,0x8f,0x97,0x73,0xda,0xf5,0xb6,0x33,0xb4,0x8a,0x4f,0x32,0x4,0x9a,0xe2,0x15,0x6d,0x3f,0x69,0x5c,0x65,0x22,0x70,0x71,0xf7,0xc9,0x37,0xa8,0xfb,0x79,0x8,0x52,0x30,0xb4,0x2e,0xf2,0x0,0x86,0x29,0xee,0x52,0x34,0xc2,0xbe,0x9c,0x1d,0x8f,0xaf,0x4f,0x7e,0x39,0x9b,0x4c,0x6f,0xce,0x4e,0xae,0xaf,0xae,0xce,0x4e,0x26,0xd3,0x2f,0x47,0x17,0x93,0xe9,0x18,0x1f,0x4f,0xc7,0xc0,0x91,0x75,0xa0,0x60,0x2f,0x8f,0xc6,0x93,0xb3,0x9b,0xe9,0xe7,0xeb,0xf,0x9f,0x2e,0xcf,0xa6,0xe3,0xc9,0xd1,0xcd,0xe4,0xe2,0xea,0x1f,0xd3,0xcf,0x47,0x1f,0x3e,0x9d,0xc9,0xcd,0xb1,0xe,0xee,0xf2,0xe8,0xd7,0xc,0xc4,0xb4,0xb6,0x1,0x5d,0x5c,0x3d,0xa5,0x33,0xfe,0x74,0xfc,0xfc,0x64,0x5,0xa0,0xe2,0x4c,0x56,0xb7,0xe,0xa0,0x6e,0x96,0xe3,0xa3,0xf,0x47,0x57,0x27,0x35,0x53,0x98,0xc3,0x2a,0x48,0x71,0x82,0x4e,0xff,0xc9,0xdb,0x3a,0xea,0xef,0x8f,0x4e,0x41,0xca,0x1d,0xb4,0x25,0x40,0x3d,0x65,0xf5,0xae,0x4c,0x17,0x3c,0xeb,0xd8,0xf,0x78,0xf4,0x98,0x67,0x3d,0xc,0x16,0x6d,0x12,0x3a,0xe1,0x9c,0xe9,0x27,0xab,0x38,0x9,0x17,0xa7,0x37,0x27,0x5f,0x84,0xfd,0x51,0x8d,0xb6,0x67,0xcb,0x65,0xb3,0xcd,0x6e,0x84,0x3,0x21,0x2e,0x66,0x1c,0xec,0xcf,0x99,0xc9,0xec,0xc7,0x44,0xb0,0x8b,0x53,0x4c,0x78,0xd2,0xac,0xe7,0x11,0x43,0x40,0x2a,0xd6,0xc5,0xd5,0xd1,0xcd,0x7f,0x4c,0x3f,0xde,0x5c,0x4f,0xae,0x4f,0xae,0x3f,0xc0,0xe4,0x9a,0xe3,0x46,0x4e,0xdb,0xf6,0x83,0xf6,0x83,0xa9,0x1d,0x54,0xc0,0x8e,0x6e,0x8e,0x2e,0xcf,0xd0,0xa2,0x17,0xe4,0x34,0xdf,0x1b,0xb0,0xf7,0x5d,0xd2,0xd6,0xf7,0x86,0x19,0xdf,0xc,0xa3,0xd5,0x28,0xed,0xd6,0x34,0x68,0xb6,0x30,0xb,0x1b,0x27,0x91,0x1f,0xdc,0x37,0x8a,0x4b,0x9d,0xde,0x5a,0xad,0x46,0xb6,0x7c,0x69,0xa0,0xd3,0x6a,0xa8,0x55,0x49,0x8f,0xdd,0x56,0x83,0x96,0x1b,0x3d,0xf4,0x5a,0x8d,0x55,0x6c,0xab,0x5,0x22,0x5c,0x1a,0xeb,0x3,0xc0,0xfa,0xb3,0x88,0x62,0x58,0x30,0x34,0x30,0x28,0xce,0x7,0xb1,0x6a,0xc,0xa1,0x4a,0xd2,0x1a,0xd2,0x9b,0xf7,0x51,0xb8,0x20,0x4d,0x9c,0x8d,0x3f,0x76,0x2c,0x4c,0x15,0x1f,0x11,0xec,0xa3,0xa,0x89,0x4,0x39,0xda,0xa,0x9,0xb,0xf6,0x6,0x4,0x4e,0xc4,0x58,0x24,0x9,0xcc,0x40,0xf0,0x5d,0x83,0xe0,0x4f,0xc2,0xc5,0x82,0x7,0x6e,0x8b,0x5,0x61,0xae,0xe6,0x42,0xce,0x41,0xa0,0xe6,0x56,0xd0,0x4d,0x45,0xdb,0xef,0x2f,0x6e,0xc6,0x93,0xe9,0xc9,0xf5,0xe5,0xe5,0xd1,0xd5,0x29,0x68,0x1c,0x3d,0x3,0xa6,0xaa,0x40,0x8d,0x27,0x37,0xe8,0x73,0xd2,0x20,0xb7,0x8d,0x3a,0x4b,0xb5,0x4b,0x46,0x69,0xd5,0xc3,0x64,0x4a,0x6c,0x35,0xee,0xc8,0xff,0xae,0x21,0xcc,0x93,0xee,0x20,0xeb,0x63,0x99,0xc7,0xc1,0x28,0x7a,0x9a,0xe2,0xe1,0x7a,0x72,0x84,0x6e,0x3f,0x39,0x9b,0x5e,0x1,0x29,0xc9,0x81,0xa6,0xb5,0x1a,0xda,0x97,0xc8,0x47,0xed,0x30,0xdc,0x25,0xd7,0xe0,0x8b,0x38,0x6,0xf4,0x7d,0xef,0xb1,0x3a,0x2a,0x37,0x4e,0x8,0x5d,0x8b,0x25,0xc4,0x4d,0xc1,0xf6,0x58,0x24,0xec,0x30,0x44,0xec,0xc2,0x6b,0xf,0x36,0x70,0x1,0x99,0x3d,0xf1,0xf6,0x8a,0x9d,0x41,0x14,0x54,0x81,0x2f,0x8d,0x79,0xcc,0xa5,0x78,0x18,0x17,0x42,0xe3,0x97,0x6c,0xe9,0x38,0x90,0xc6,0xdb,0xdc,0xf9,0x83,0x79,0xab,0x80,0x42,0x6b,0x8c,0xc1,0x31,0x7d,0x0,0xcb,0x5e,0x2f,0x45,0xa0,0xb,0xac,0x25,0x9a,0xe0,0xd5,0x20,0xfd,0x17,0x5c,0x2f,0xf9,0xda,0xf3,0x21,0xf2,0xc2,0x34,0xf6,0xdc,0x8f,0x67,0x2,0xcc,0x86,0x4,0xc9,0x35,0xc0,0x1f,0xa6,0x11,0x39,0x4,0xa4,0xc5,0xd2,0x23,0xf4,0x66,0x36,0xd,0xa9,0x29,0x9c,0xb,0xa8,0x6b,0xee,0x75,0x2d,0x8f,0xec,0x2c,0x84,0xf9,0x4,0x65,0x22,0xb5,0x4,0xa8,0x70,0xf9,0x7,0xcc,0x8b,0x53,0xcc,0x41,0x1,0xa0,0xeb,0xf4,0x2d,0xb,0x3d,0x1a,0x96,0x48,0x8d,0x4d,0x51,0x8c,0x93,0x79,0x18,0x8b,0x5c,0x8e,0x6d,0xb3,0x3b,0x8,0x46,0xb3,0x3,0xd1,0x89,0xbf,0x10,0xe1,0x2a,0xd1,0x7d,0xa8,0x93,0x40,0x63,0x63,0x12,0xb8,0xf5,0xfc,0x9e,0xf1,0x8a,0x99,0x86,0x61,0x48,0x56,0x27,0x10,0xa8,0x92,0x10,0x58,0x52,0xbb,0x1d,0x3e,0x7c,0x19,0xa3,0xe3,0x7c,0x3,0xbe,0x61,0x10,0x6a,0xac,0xd,0xaa,0xf5,0x7d,0xca,0x6b,0x32,0xe3,0x9,0xc2,0xb,0xff,0x41,0xc4,0x24,0xcf,0x2,0x16,0x1f,0x56,0x64,0x5e,0x79,0xd5,0x41,0xfd,0x31,0x2b,0xc8,0x8b,0xf6,0x4e,0x22,0x8,0x82,0x91,0x80,0x4c,0x1b,0xd4,0x81,0x54,0xff,0x39,0xbe,0xbe,0x62,0x7f,0x88,0x47,0x19,0xf6,0x10,0x38,0x86,0xea,0x83,0x71,0x49,0x58,0x95,0x6e,0x10,0x5,0x8b,0xaa,0xba,0x94,0xd3,0xd5,0x2b,0x8b,0x6,0xdb,0xe0,0x79,0xbc,0x29,0x6b,0xcf,0xc5,0xe3,0xb5,0xfd,0xfb,0x41,0xc3,0xf7,0x58,0xe1,0x1d,0xc8,0x87,0xae,0xe7,0x8,0xb0,0xc8,0x51,0x14,0xf1,0xc7,0xe3,0x95,0xe7,0x89,0x8,0x89,0x11,0x3c,0x6e,0xf4,0x20,0xbc,0xb,0x69,0x1c,0xc5,0xf2,0xe9,0xa2,0x38,0x67,0x4a,0x7e,0x3,0xc,0xc6,0xa2,0x80,0x83,0xd2,0xb4,0x97,0x3c,0x8a,0xab,0x80,0xc4,0x9,0x89,0x79,0xc8,0x0,0x14,0xf4,0xdc,0xc6,0x27,0x9d,0x10,0x1,0xc0,0xb,0x23,0xa6,0x23,0x8c,0x4f,0x9b,0x8,0xfc,0x79,0x4b,0xe0,0xed,0xb9,0x8,0xee,0x93,0x19,0xc,0xbc,0x7e,0x8d,0xcc,0x29,0x32,0x0,0x84,0x6f,0x6f,0xfd,0xbb,0x83,0x92,0xf0,0x30,0x8,0x63,0x4d,0x29,0x2d,0xc1,0xc1,0xae,0x90,0x5,0x7a,0xd,0x29,0x50,0x92,0x27,0xb0,0x46,0xa1,0xb9,0x6f,0x1,0xea,0x4e,0xc2,0xd3,0x28,0xcc,0xde,0x94,0x9b,0x43,0xa5,0xaa,0x6a,0x3b,0x33,0x1,0xee,0xe5,0x2,0x62,0x12,0xad,0x44,0x26,0x7c,0x1,0xd3,0xac,0x60,0xda,0xdb,0x30,0xcb,0xde,0x5d,0xd8,0x88,0xa0,0xfe,0x7,0xdc,0x66,0x89,0x78,0x2a,0x46,0x29,0x12,0x66,0xa2,0x94,0x46,0x2b,0x42,0x95,0x66,0xa9,0xec,0x6e,0x30,0x53,0x69,0x4,0xe6,0xac,0xab,0x6e,0xdb,0x3e,0x2c,0x8a,0xe8,0x7c,0x72,0x89,0xfb,0x6b,0x9,0xe1,0x40,0xae,0x8a,0x27,0x6c,0x62,0xe9,0xad,0xa9,0x48,0xc4,0x18,0x39,0x20,0x8c,0xb8,0x15,0xd6,0xe8,0x65,0xa1,0x4a,0x2f,0xe8,0xe8,0x38,0x4,0x9e,0x79,0xa0,0x13,0x5a,0x53,0x81,0x96,0x44,0xb9,0x5c,0x25,0x52,0x82,0x1a,0x2,0x12,0x61,0xd3,0x78,0xca,0x57,0x29,0x53,0x7,0xfe,0x64,0xf9,0x2a,0x53,0xe6,0x34,0xbf,0xd5,0x6b,0xd2,0xff,0x56,0x81,0xf1,0x7a,0xcb,0xa8,0xa4,0x7a,0x1b,0xcd,0x42,0x6a,0xfe,0x3c,0xad,0x2c,0xad,0xdf,0x46,0xad,0x54,0x20,0x3c,0x4f,0xaf,0x50,0x60,0x6c,0xa3,0x58,0xad,0x57,0x9e,0x27,0x5a,0xcc,0x64,0xb4,0x74,0x59,0x16,0x2a,0x86,0xb2,0x1d,0x8b,0xc4,0x90,0x4a,0x5,0x50,0xae,0xa,0xf2,0xe7,0xed,0x85,0x47,0xc9,0xf,0xb5,0xb7,0xae,0x98,0xbf,0xcb,0xca,0x97,0x23,0x80,0x7c,0x10,0x6f,0xf7,0x71,0x50,0x2b,0x4,0xa5,0x97,0x93,0x83,0x60,0xf8,0x94,0x1c,0xe,0x22,0xb9,0x5a,0x8b,0xa7,0x19,0x47,0x26,0x7d,0x9a,0x17,0x4c,0x1f,0xe4,0xb,0x28,0x33,0x31,0x8b,0xab,0xb8,0xfd,0xf6,0xba,0xac,0x1e,0x5d,0x6b,0x4a,0x4e,0x27,0xe2,0x5b,0xc2,0xe,0x1b,0xda,0x7b,0x5,0xc6,0xb2,0xac,0x51,0x63,0xaf,0xb7,0xcd,0x5d,0x6b,0xba,0x34,0xab,0x24,0xc6,0xab,0xa5,0x73,0x71,0xb2,0x6a,0x82,0x74,0x9b,0xcb,0x71,0xc7,0xfe,0xfa,0x8b,0x69,0xda,0x36,0xfa,0x69,0x3a,0xaa,0x65,0xf9,0x8,0xec,0x97,0x33,0xd8,0xd1,0x6c,0x81,0x89,0x9,0xa4,0x57,0x9,0x26,0xf4,0x21,0xf3,0xe6,0x3c,0x9e,0xb5,0x60,0x78,0xe6,0x43,0x52,0xb4,0x46,0x30,0xdc,0xf4,0xec,0x28,0x5c,0xc7,0x22,0x22,0x94,0x18,0x34,0xd4,0xd8,0xd5,0x3b,0x68,0xc7,0xc9,0x23,0xc4,0x85,0xbc,0x3e,0xd5,0xec,0x39,0xa4,0x1,0xc0,0xdc,0x4e,0x2c,0xaa,0xf8,0x2b,0xc6,0xc9,0x1c,0xa7,0x14,0x6c,0x3e,0x5,0x7f,0x4,0xe1,0xba,0x98,0x50,0xa5,0x5b,0xb6,0x46,0x1b,0x1b,0xfe,0xa7,0xd2,0xba,0xf5,0x33,0x49,0x1b,0xe8,0x42,0xa5,0x77,0x33,0x31,0x5f,0x82,0x84,0xf9,0x5b,0x2c,0x7a,0xf3,0x2d,0x5e,0xed,0xb9,0x69,0xd5,0x34,0xe5,0xe4,0x92,0x3a,0xea,0x33,0x12,0xc9,0x2a,0x2a,0x70,0xd3,0xce,0x4a,0x2b,0xd0,0x7e,0xa5,0x24,0x52,0x21,0x7a,0x82,0x8,0x92,0x24,0xa5,0x39,0x58,0x63,0xf9,0x1,0xe8,0x3f,0xcb,0x36,0x42,0xda,0x91,0xe9,0x99,0x84,0x53,0x9b,0x7d,0xcc,0x68,0x2b,0x7,0x53,0xe5,0xac,0xd5,0x67,0x5,0x76,0x96,0x3d,0x50,0xf,0x3,0xa,0x37,0xdc,0xe8,0x3,0xb1,0x66,0x9f,0x60,0xa6,0x21,0x65,0x18,0x29,0x90,0xec,0x57,0x60,0x83,0xbc,0x9a,0xc,0xd4,0x25,0xf7,0x69,0xdf,0x57,0x65,0x58,0x50,0xb8,0x6d,0x54,0x3f,0x57,0x56,0x9b,0xeb,0x19,0x76,0xf,0x74,0xcc,0x17,0x68,0x5a,0x95,0x30,0xa4,0xac,0xf8,0x18,0x89,0xe8,0xc5,0x2d,0x64,0x10,0x77,0xf9,0xdc,0xc8,0x1e,0xb2,0xd0,0x6,0x7b,0xb8,0x3a,0xba,0x6f,0x93,0x1d,0xbe,0xab,0xad,0x16,0xc9,0x3d,0x50,0xbd,0xbe,0xab,0x22,0x18,0x50,0x7d,0x77,0xb8,0xad,0xd6,0x51,0x9,0x19,0x24,0xbc,0x72,0xaf,0x47,0x84,0x27,0x5,0xf,0xac,0x34,0x67,0xbe,0x72,0x45,0xc,0xb4,0x9a,0x29,0xb3,0x92,0xf5,0xa,0xc3,0x4a,0xf2,0x5b,0xe4,0xf6,0x4e,0x29,0x15,0x57,0xe8,0x29,0x19,0x22,0xd2,0x9b,0x6d,0x69,0x12,0x5d,0x8a,0xf,0xc1,0x9c,0x93,0xb6,0xfd,0x16,0xa8,0xe8,0xb5,0xa2,0xd9,0x44,0xc6,0xd9,0xeb,0x43,0xf5,0x58,0xcc,0xdc,0x2a,0xe4,0x8b,0x53,0xa3,0x6b,0x2b,0x7f,0x53,0x60,0xca,0xa3,0xc6,0xd8,0xca,0xe1,0x69,0x5a,0xcf,0x20,0x77,0x73,0x64,0x51,0x88,0x39,0x1c,0x2e,0xac,0x55,0x20,0x4b,0x1a,0xb7,0x89,0x89,0x34,0xd8,0x8,0x76,0x67,0x8,0x4e,0x79,0x1f,0x60,0xd,0x6b,0x3b,0x10,0xf7,0x50,0x2b,0x41,0x2c,0x72,0x73,0xf7,0x82,0xf5,0xee,0xa6,0xc5,0x4,0x1a,0xa5,0x25,0x7b,0x73,0xa8,0x21,0xda,0x3a,0xb6,0x2c,0x8c,0x92,0xb9,0xb7,0xda,0x10,0xbc,0x25,0x5b,0x36,0x38,0x91,0xde,0xa8,0x78,0xa8,0x8a,0xa,0x60,0xea,0x4c,0x0,0xf6,0x77,0x76,0xeb,0xbb,0x77,0xec,0xd,0xfe,0x69,0xb1,0xab,0xd5,0xc2,0x6,0xa5,0x4b,0xa6,0xee,0x9a,0x8d,0x62,0x12,0x5c,0xf6,0xd3,0xaf,0xdf,0x7f,0xfa,0xe,0x93,0x6e,0xde,0xb0,0x9f,0xbe,0xd7,0xd3,0x35,0x81,0x28,0xbd,0xd9,0x6c,0xbe,0x96,0x93,0x35,0x45,0xa5,0xf9,0x84,0xe1,0xfc,0xc5,0x46,0x59,0xe2,0xfc,0x68,0xcf,0xea,0xf5,0xb1,0xb0,0xe2,0x41,0x31,0x93,0xc7,0xa,0x62,0x26,0xbe,0xb5,0x99,0x13,0x3d,0x2e,0x93,0x10,0xfd,0x22,0x81,0x85,0x82,0x8d,0x0,0x26,0xbe,0xf9,0x71,0x2,0xc5,0x58,0xc0,0x66,0x49,0xb2,0x8c,0xe9,0x34,0x29,0x6e,0x21,0xb9,0xbc,0x76,0x81,0x0,0x8c,0xd5,0xd,0x4,0x55,0x5f,0x82,0x15,0x6c,0x34,0xe3,0x30,0xe5,0x14,0xa8,0x17,0xd6,0xbd,0x2c,0xaa,0x7f,0x29,0xac,0xfa,0x8e,0x25,0x95,0x7a,0xdb,0x80,0xd2,0xdf,0x1a,0x72,0xcb,0x1b,0xd,0x5b,0xcc,0xf8,0x36,0x30,0x3b,0x83,0x6e,0x77,0x64,0xe2,0x6f,0xbb,0xe7,0x18,0x9e,0xed,0x78,0xf8,0x5b,0x8c,0xec,0x9e,0x6b,0xf3,0x1e,0xfe,0xee,0x8c,0x7a,0x7d,0xc7,0xea,0xd9,0xf8,0xbb,0x37,0xf2,0x4c,0xd3,0xf4,0xcc,0x16,0xd0,0x19,0x59,0x1d,0x6f,0x68,0xf1,0x2e,0x8e,0x73,0xdb,0x74,0x7a,0xc2,0x25,0x78,0x77,0x68,0xc,0x38,0x97,0xf4,0x4d,0x6b,0xd8,0xe9,0xd9,0x6,0xd1,0xb7,0xba,0x1d,0x73,0xd8,0xb3,0x5,0xd1,0xe9,0x19,0xce,0xc0,0x75,0x3a,0x48,0x67,0x60,0xd9,0xa2,0xe7,0xe,0x88,0xce,0xd0,0x70,0x85,0x6d,0x7a,0x4,0x33,0xb2,0x5d,0xc7,0xe8,0xf3,0x1,0xfe,0x76,0xcc,0x91,0xed,0x99,0x12,0x46,0x74,0x47,0x76,0x7f,0xe4,0x10,0x4d,0xe1,0xd9,0xa2,0x3b,0x18,0xf6,0x91,0x8e,0xe1,0x1,0x94,0xeb,0xf4,0xe5,0x5c,0x86,0xc3,0x4d,0xc7,0xa1,0xdf,0xae,0x18,0x59,0x4e,0x9f,0xe4,0xea,0xf2,0x41,0x77,0xd8,0xe5,0x9c,0x78,0x70,0x6c,0x83,0x3,0x2,0xe9,0xa1,0xf,0xa,0x19,0xba,0x9c,0xe4,0x1a,0x76,0x44,0xcf,0xec,0x59,0x24,0xd7,0xb0,0x63,0x3a,0xfd,0xbe,0x4b,0xfa,0x31,0x8c,0x8e,0x35,0x70,0x48,0x2e,0xdb,0xeb,0x8d,0x6,0x9e,0x23,0x79,0xeb,0xb,0xc3,0xb0,0xbd,0xe,0xc9,0xde,0xe3,0x83,0x91,0xd9,0x1d,0x10,0x3f,0x7d,0x87,0xf7,0x3b,0x3d,0xe2,0xd3,0xec,0x5a,0x23,0x6b,0xd4,0x27,0x78,0x6b,0x60,0xf,0xc,0x3e,0x24,0x5d,0x59,0xc2,0xb4,0x2d,0xb3,0x43,0x34,0xbb,0x2e,0x70,0xe9,0x7a,0xc4,0x4f,0xaf,0xd3,0x1,0x55,0x98,0xa4,0x9f,0x7e,0xcf,0xe0,0x83,0x4e,0xaf,0x2b,0xf9,0xec,0x73,0x83,0xdb,0x64,0x8b,0xa1,0xe9,0x58,0xce,0xc8,0x92,0xba,0xb2,0x6,0x96,0xe5,0x48,0x9a,0xdc,0xb2,0x3d,0x31,0xe4,0xa6,0xe4,0xdf,0xe4,0xfd,0x7e,0xd7,0x46,0x3a,0x8e,0xd5,0xb5,0x87,0x30,0x35,0xf1,0x3c,0xe8,0x3b,0x3d,0x93,0x4b,0x9e,0x4d,0x20,0x32,0x34,0x47,0xf4,0xbb,0x3f,0x1a,0x19,0x7d,0x8b,0xe6,0xf2,0xba,0x86,0xe8,0xf4,0x24,0x4d,0x13,0xc,0xc1,0xd,0xc0,0x5,0x3a,0xe6,0x88,0x77,0x1d,0xd3,0x24,0x3d,0x9b,0xa2,0x3,0x94,0x8c,0xa1,0x94,0xab,0x3b,0x1c,0xc,0xba,0xc4,0x7f,0xa7,0x6b,0x1b,0xb6,0x63,0x2b,0xff,0x31,0x1d,0xc3,0xb1,0x69,0xae,0xae,0x70,0x87,0x9c,0x77,0x49,0xcf,0x3d,0x7b,0xe4,0x38,0xbc,0x4b,0x76,0xe9,0xf,0x2d,0xd1,0xf7,0xa4,0xe,0x81,0xc,0xf8,0x95,0x20,0xb9,0x6,0x43,0xde,0xeb,0x77,0xa4,0xed,0x86,0x5d,0x67,0x38,0x18,0x9a,0xd2,0x4f,0x1c,0x67,0x60,0x58,0x30,0x2f,0xda,0xcb,0xb0,0x85,0xe7,0x79,0x64,0x53,0xde,0xed,0x81,0xda,0x5,0xe9,0x7,0x46,0x47,0xbc,0xe3,0x29,0x1b,0xd,0xcc,0xc1,0xd0,0xb3,0x5a,0xd,0x4c,0x7c,0xe5,0xfa,0x38,0xdf,0xb2,0x3e,0x40,0xc3,0x23,0xd1,0x97,0xb6,0xb2,0xed,0xfe,0x80,0xb,0xa9,0x83,0xe,0x18,0xda,0xeb,0xc,0xa4,0x5f,0xf4,0xba,0x9e,0xd7,0xeb,0x48,0x3f,0x32,0xd,0xd1,0xb3,0x6,0x9e,0xf4,0x59,0xa3,0xd7,0x1f,0xe,0x1d,0xd2,0x93,0x37,0xec,0xb8,0x23,0x2e,0xd7,0x8d,0x2d,0xc,0x7,0x14,0x2d,0xe7,0x2f,0xef,0x2f,0xb4,0x6c,0xdb,0x18,0xeb,0x3f,0xa8,0xd,0x41,0x9e,0x4e,0xb9,0xae,0x70,0xa7,0x19,0xd8,0x25,0x4f,0xa0,0xae,0x12,0xfe,0x5c,0xd7,0xd5,0xd8,0x6b,0x36,0x6a,0xb2,0x7d,0xd6,0xef,0x36,0xd9,0x2b,0xf8,0xf7,0x60,0xd7,0x76,0x5f,0xa2,0x6,0x1c,0xa8,0xfd,0x49,0x24,0x7a,0x7d,0x5e,0x90,0x82,0xdc,0x4a,0x8c,0x3b,0xea,0x19,0xe,0xd,0x39,0xc7,0x83,0x2f,0xd6,0x6a,0x8a,0x53,0x9e,0xf0,0xcf,0xf0,0xa8,0x36,0xbc,0x2c,0xab,0x40,0x10,0x24,0x2f,0x75,0x5b,0x9e,0x9e,0xed,0x31,0xf0,0x17,0x92,0xc7,0x9b,0x87,0x61,0x94,0xca,0xb3,0x8f,0x3e,0x64,0xc8,0xff,0x35,0x9f,0xa7,0x1,0x7e,0x90,0x62,0xbe,0x62,0xc3,0x26,0x7b,0xf7,0xee,0x1d,0x33,0x94,0x72,0xd7,0x35,0xa6,0x5,0x3d,0xc9,0x97,0xb0,0x5f,0xe1,0x29,0x97,0xfe,0xad,0xc5,0x2,0xca,0x33,0xf4,0x6f,0x84,0xc,0xf,0x7f,0xe1,0xef,0xb7,0x6f,0x99,0xe,0x41,0x77,0xf,0x6,0xd2,0x66,0x8,0x69,0x16,0x53,0x59,0xd9,0x10,0x91,0x3f,0xdf,0x96,0x6d,0x94,0xe,0xc3,0xc6,0x8e,0x26,0xf9,0x9e,0x63,0x16,0xda,0x28,0x66,0x3f,0xeb,0x9e,0xac,0x6f,0x7d,0x54,0x2b,0x49,0x79,0x9f,0x49,0xa9,0x68,0x0,0xf0,0x2b,0xd6,0xa5,0xad,0xa5,0x44,0x86,0xf0,0x81,0xe,0x98,0x3b,0xa5,0x43,0xa7,0x5c,0x6,0xbc,0x43,0xb9,0x74,0xa0,0xa,0x9c,0x9b,0xbd,0xbb,0x16,0x1b,0x34,0xd9,0x7f,0x3e,0x19,0x34,0x87,0x38,0x9a,0x8f,0x90,0xe4,0x9d,0xf4,0xb0,0xcc,0x2c,0x93,0xb1,0x10,0xa1,0x4a,0x86,0x6,0x47,0x5,0x2a,0x96,0x24,0x62,0xa2,0xf2,0x95,0x50,0x8a,0x7c,0xff,0xe,0x24,0x1,0xde,0x5e,0xab,0x81,0x1,0x3d,0x9b,0x28,0x15,0x4e,0x77,0xb,0xcb,0x7,0x56,0x7,0x4,0xc,0x88,0xaf,0xb0,0xdc,0x61,0x5,0xdd,0xb7,0x18,0x39,0xdb,0xf9,0x41,0xad,0xfa,0xaa,0x62,0x67,0xfc,0x2,0x76,0x3f,0xe3,0x13,0x1e,0x4c,0xb3,0xf8,0x64,0xf5,0x52,0x1,0x33,0x3d,0xc1,0xd4,0x56,0x6,0x2,0xf,0x66,0xa7,0xf8,0x64,0x59,0xa,0x21,0xc1,0x19,0x66,0xc4,0x35,0xfc,0xa3,0xeb,0x82,0xfd,0xcc,0x3c,0x92,0xfd,0xbf,0xf1,0xe7,0x3d,0x24,0x3b,0xaf,0xd9,0x2f,0x28,0x34,0xc9,0xa8,0x72,0xda,0xc4,0x2,0x2c,0x92,0x5b,0xd7,0x39,0x80,0xd9,0x84,0x81,0xbf,0x1c,0xfa,0x65,0xd3,0x2f,0x98,0x2,0x17,0x36,0x94,0x86,0x58,0x99,0x7a,0x20,0x31,0xfc,0x81,0xac,0xe,0x13,0x16,0xdd,0x5,0xe4,0xc4,0x54,0x5e,0xd,0xb5,0x2a,0x76,0x7c,0x20,0x70,0x61,0xbc,0x80,0xa5,0x9,0x7f,0xf8,0x41,0x83,0x23,0x60,0x82,0x8c,0x25,0x56,0x6,0xb9,0x69,0x6c,0x53,0x6b,0x1b,0x34,0x7a,0xc6,0x9d,0x99,0x2e,0x33,0x26,0x48,0x49,0xa5,0xf7,0x9f,0x13,0xfb,0x87,0x2a,0xb9,0x23,0x9f,0x53,0x89,0x26,0x2d,0x9c,0x36,0x36,0x52,0xf5,0xf3,0x96,0x4a,0x27,0x9,0x87,0x7e,0xb5,0x93,0x50,0x9e,0x8e,0xe8,0x66,0xbf,0xd9,0x86,0xb5,0x0,0xb5,0x6c,0x94,0xe8,0xb0,0xb6,0x35,0x43,0x6b,0x36,0xdb,0xbf,0x87,0x7e,0xa0,0x37,0x34,0x3a,0x1b,0x2e,0x74,0x97,0x6b,0xdb,0x1e,0xf2,0x29,0x9,0xa7,0xf2,0x6d,0x21,0xd3,0xac,0xbc,0xc9,0x8a,0x45,0xfa,0x2b,0x9b,0xaa,0x54,0x28,0x4f,0xe3,0x25,0xa7,0x62,0x1b,0x2d,0x5c,0xc1,0xf1,0x51,0x9b,0xda,0x67,0xc4,0xd0,0xb6,0xd7,0xfd,0x65,0x32,0xcd,0x52,0x5b,0x42,0xcd,0xa6,0xf4,0xe2,0x71,0x48,0x32,0xf,0xca,0x2d,0xf3,0x69,0xa1,0xff,0x35,0x95,0xa7,0x35,0x54,0x23,0xae,0xe3,0x69,0x9e,0x87,0x6a,0xdf,0x17,0xb2,0x5d,0xa6,0x9a,0x9c,0x35,0x2d,0xb3,0x32,0xa,0x98,0x45,0x33,0x37,0xc5,0x46,0x4a,0xe5,0xa5,0x41,0x2f,0xab,0xa9,0x69,0xe,0xd4,0x2c,0x27,0xb3,0xa5,0x17,0x65,0xfe,0xeb,0x2f,0x19,0x4c,0x9d,0xb9,0x8f,0x7c,0x95,0xf,0x35,0xa0,0x68,0xe6,0xf,0x58,0x8b,0x62,0xed,0x2a,0x22,0x47,0x2c,0x65,0xc1,0xea,0xe1,0x85,0x13,0xc8,0x6e,0x17,0x7e,0xc2,0xb8,0x6a,0xd0,0x87,0x8c,0x3f,0x84,0x60,0x1,0xba,0x26,0x15,0x9,0xf,0xca,0xfe,0x99,0x5c,0x8c,0x74,0x9d,0x7,0xe2,0x27,0x9d,0x39,0x3f,0x73,0x51,0x0,0x61,0x34,0xd5,0x44,0x27,0x2e,0x55,0xdd,0x58,0x22,0xd2,0xc6,0x7f,0xe2,0x5b,0xe3,0xae,0x8d,0x6f,0xcb,0x92,0x67,0x48,0x5,0x22,0xe6,0xd8,0xff,0xaf,0x1d,0x44,0x62,0x78,0x5b,0x26,0xf2,0xf5,0x7a,0x72,0x24,0x8f,0xc8,0xf1,0x1d,0x56,0x13,0x19,0x99,0xcd,0x57,0x55,0x8f,0x66,0x13,0xe5,0x65,0xa5,0x86,0xe7,0xa0,0x5a,0xf3,0xc9,0x51,0x4a,0xaa,0x47,0x9e,0x76,0x4,0x88,0xf4,0x5,0xb3,0xc5,0xdc,0x7,0x7d,0x67,0xd7,0x9,0x40,0xab,0x53,0x3a,0x28,0x90,0xbb,0x1a,0x5e,0xd2,0xc1,0x8d,0x57,0xb5,0xf5,0x61,0xd5,0x81,0xc6,0xe4,0x1,0x8a,0x13,0x9,0x3c,0xe6,0x4a,0x21,0xe4,0x21,0x8,0x59,0x85,0xe,0x4a,0x60,0xb9,0xde,0xdf,0x8b,0x8,0x2a,0x1e,0x42,0xdd,0xdd,0x73,0xd2,0xce,0x79,0x3c,0x2b,0x1d,0xb3,0x51,0x3b,0x77,0x52,0x3a,0xc8,0x64,0x78,0xc6,0x26,0xcf,0x47,0xfc,0x5,0x5a,0x18,0x54,0xe0,0x53,0x87,0x69,0x86,0xe7,0x31,0x85,0xbe,0x86,0xaa,0x8e,0x1a,0x5b,0x94,0xcd,0xf3,0x72,0x9,0xca,0x68,0x3c,0x66,0xd6,0x33,0xef,0xd4,0x89,0x74,0xda,0xdd,0x5b,0x45,0x78,0xad,0x44,0xdb,0x97,0x7e,0xaa,0x49,0x73,0x46,0xe2,0xcf,0x15,0x9e,0x6e,0x49,0xd,0xfd,0x7a,0xf9,0xe1,0x1c,0xca,0xa4,0x1b,0x39,0xa8,0x37,0x71,0xe5,0xd2,0xcf,0x36,0x1e,0x98,0xe9,0xda,0xc7,0xeb,0xf1,0x44,0x6b,0x21,0xa5,0x96,0x6c,0x78,0xe6,0x0,0x31,0x1e,0xcc,0xd2,0xcf,0x73,0x81,0xbd,0x62,0x5d,0xfb,0x75,0xf,0xac,0xbe,0x87,0x36,0x6,0x94,0xcc,0xde,0x2f,0x41,0x39,0x3f,0x2,0x81,0x1,0xa9,0x50,0xa4,0x49,0x49,0x8a,0xc,0xd1,0x15,0x43,0xdc,0x0,0x32,0x69,0xd3,0x2,0x3b,0xa3,0x4f,0x16,0x62,0x7f,0x3b,0x64,0x90,0x1e,0x3d,0xdb,0x2a,0xac,0x1c,0x75,0x52,0x75,0x5a,0x9c,0x4e,0x44,0x51,0x18,0x3d,0x99,0xaf,0xe4,0x97,0xef,0x9,0x15,0xad,0xa7,0xfc,0x9,0x8d,0xa8,0xf4,0x9d,0x6a,0x9a,0x1a,0x6e,0xe4,0x10,0x69,0x8b,0x11,0xfb,0xe,0x60,0xf3,0xca,0xb9,0x5b,0x88,0xad,0x6,0x7c,0xcc,0x42,0x54,0xb,0xcb,0x61,0xbc,0x4b,0x19,0xf9,0x89,0xf4,0x11,0xea,0x3d,0x16,0xd4,0x9,0x11,0x2c,0xf3,0xf9,0xe6,0xb,0x9b,0x87,0xc6,0xc1,0xbf,0xd8,0x9a,0xdc,0x34,0xb7,0x75,0x1b,0x61,0x79,0xba,0x21,0xb,0xc2,0xa4,0x66,0x95,0xca,0x7e,0xa3,0x5c,0x80,0xcb,0x88,0xfe,0x9e,0xa,0x8f,0xaf,0xe6,0xe4,0x6d,0xe5,0xc8,0x4a,0x77,0xde,0xfc,0x4,0x36,0x8d,0x29,0x89,0x45,0xb7,0x1f,0xf3,0x80,0x5a,0xbc,0x8b,0x6,0x8c,0x95,0xae,0xa5,0xb5,0xd5,0xc6,0x83,0xee,0x90,0xbe,0x50,0x5d,0x35,0xec,0x7a,0xd,0x11,0xbf,0x8c,0x0,0xce,0x78,0x94,0xc0,0x3a,0x87,0xf0,0x2d,0x74,0x8d,0x47,0x3e,0xdf,0xf3,0x3,0xa0,0xe2,0xe3,0x7d,0x56,0x8d,0x76,0x2e,0xe4,0x7d,0xcb,0x3d,0x3d,0x54,0x10,0xb7,0xe7,0x74,0x66,0x90,0xee,0x72,0xa9,0x6e,0x7e,0x64,0x1e,0x5c,0x54,0x2f,0x9c,0x26,0x3d,0x86,0xab,0xe8,0xac,0xe6,0x4e,0xe6,0xd3,0xbd,0xa8,0xd4,0xa1,0x2a,0xdd,0xcb,0x94,0xf6,0x29,0x9d,0x14,0x87,0x10,0x57,0xa9,0x19,0x2c,0xdc,0xfc,0xf2,0xae,0xba,0x2e,0xeb,0xc7,0xea,0x28,0xbd,0xc8,0x4,0x3a,0x51,0x3e,0x57,0xe9,0x5c,0x1b,0x8d,0x8c,0x3,0x2a,0x8d,0x21,0x8b,0xe2,0x79,0x3b,0xce,0x58,0xdc,0xd5,0x9f,0xde,0x2c,0x96,0x4c,0xd2,0xdd,0xe2,0x9a,0x94,0x1,0x55,0x56,0x23,0xf9,0x53,0x3a,0xd,0x8d,0x94,0xa1,0xb5,0x1a,0xcf,0x28,0xb,0xb3,0xaf,0x74,0x67,0x6d,0xd4,0x6f,0xad,0x78,0xe7,0xb3,0xd9,0xa8,0xe1,0x55,0xee,0xe4,0x92,0xd7,0xdd,0xe9,0x1,0x4c,0xb2,0xf5,0x6,0x6a,0xd,0x61,0xd2,0x97,0xa4,0x5b,0xbb,0x38,0x9a,0xb5,0x59,0x5a,0x76,0x1b,0xb8,0x70,0x88,0x9c,0x25,0xb5,0x79,0x38,0xa3,0x8d,0x42,0xd4,0xa9,0x5e,0x6a,0xac,0x12,0xf9,0xca,0x3e,0x94,0x93,0x86,0xdc,0x59,0xae,0xbe,0xa6,0x8a,0x11,0xcf,0x30,0xe5,0x17,0xaf,0x28,0xff,0xfb,0x6c,0x95,0x1b,0x98,0xda,0xf7,0x2,0x79,0x79,0xd0,0x94,0xa6,0xc2,0x90,0xd9,0x6e,0xb4,0x1f,0x6f,0x59,0xa6,0xff,0xcf,0x1d,0xbe,0xc6,0x9f,0xb1,0x27,0xfd,0xf4,0x10,0x76,0xb7,0x41,0x25,0x5,0xe9,0xd,0x78,0x33,0xa4,0x72,0xa0,0xf9,0x43,0xc8,0xa5,0xf3,0xd5,0x1f,0xc2,0x2c,0x9c,0xf3,0xfe,0x10,0x1e,0xac,0x5f,0x82,0x5d,0x41,0x9c,0xc0,0x4b,0x73,0x6c,0x1d,0xae,0xe6,0xae,0x2a,0x5a,0xf2,0x4b,0x24,0xea,0x2e,0x4d,0xb6,0xd7,0x5d,0x9e,0x7c,0xfa,0x81,0x33,0xec,0x5d,0x77,0x23,0xb3,0x95,0xf4,0xec,0xc1,0xf0,0xd6,0x1b,0x8f,0xdb,0x48,0x54,0x4e,0xab,0xeb,0xef,0x32,0x6e,0x43,0x2e,0x1d,0x9c,0xd7,0x5d,0x54,0x2c,0x3b,0x53,0xfd,0x7d,0xa6,0xea,0x6a,0x7b,0x72,0xb,0x4e,0x2b,0x53,0x21,0xe8,0xec,0xeb,0x8,0xbe,0x4a,0x66,0x7a,0x9a,0x5,0x16,0x76,0xcc,0x97,0x7d,0x2c,0x1,0x8b,0xb2,0x50,0x33,0x16,0xcf,0x6,0x52,0x30,0x58,0x57,0x3f,0x65,0xf,0x1b,0xed,0x5f,0x38,0x8,0xc0,0xfd,0x6,0x92,0xab,0x0,0x76,0x94,0xdf,0x57,0x31,0x5e,0x4c,0xa,0x5c,0x95,0xfe,0x4,0x98,0x9d,0xc9,0xdd,0xa6,0x51,0xf9,0xde,0xe3,0x69,0x6e,0x12,0x40,0x9a,0x6,0x6b,0xba,0xf0,0x41,0xc7,0xf6,0xfc,0xa5,0xf0,0xf9,0xc6,0xcb,0x80,0xb6,0x47,0x20,0x58,0xe,0x5,0x40,0xc8,0x9f,0x40,0x30,0x8a,0xed,0xe5,0xbd,0xb9,0x6,0x86,0xcc,0xb2,0x93,0x93,0x97,0x88,0xa4,0x60,0x9e,0x55,0x4f,0x96,0xba,0x95,0xd8,0x2a,0xae,0xe4,0xcc,0x4d,0x62,0x48,0x48,0x70,0xfd,0xa9,0x2c,0x31,0x99,0xf9,0x71,0xd1,0xd,0xdc,0x70,0x21,0xdf,0xe5,0x57,0x4,0x8,0xe4,0x65,0x1d,0x83,0x2a,0x76,0xb9,0x67,0x50,0x9c,0xab,0xe4,0xf6,0x6a,0x86,0x56,0x89,0x39,0x59,0xbf,0x5d,0x81,0xe7,0x40,0xd0,0x41,0x70,0xc2,0x87,0x7f,0xa2,0x70,0x75,0x2f,0x83,0xce,0x97,0x71,0x5a,0x50,0x61,0xb8,0xa9,0x44,0xee,0x42,0x6a,0x52,0xcd,0x63,0x27,0x11,0xdd,0x96,0x4,0x5c,0xcc,0x71,0x20,0x8f,0xcd,0x60,0xb,0xb7,0xcd,0xff,0xef,0x7f,0xfe,0x57,0x5d,0x45,0xbf,0x90,0xf7,0x2,0xe9,0xd0,0x9,0x35,0x4,0x39,0x3a,0xe6,0xc0,0x3c,0x88,0xd7,0xf0,0x9c,0x85,0x40,0x95,0xc,0xe7,0xa7,0x88,0x80,0x92,0x80,0x7d,0x80,0x1f,0x3c,0xb7,0xce,0x17,0x89,0xaa,0xc9,0x72,0x6,0xd5,0x57,0x5b,0x2d,0x76,0x5b,0x39,0x23,0xbf,0x2b,0xad,0x2d,0x39,0xc1,0xe4,0x71,0x49,0x1b,0x20,0xd5,0x87,0xb2,0xbf,0xac,0x15,0xa1,0xc2,0x80,0x84,0x3a,0x54,0x97,0x2f,0xcb,0xaf,0xe8,0x82,0x22,0xbd,0xa3,0x1b,0x8d,0xe5,0x97,0x79,0x8,0xc8,0x6e,0xf1,0x51,0xce,0xf8,0xaa,0xf1,0x8a,0xd1,0x87,0x26,0xd,0xfc,0xf5,0xd1,0x77,0xc2,0xb6,0x3,0xd5,0xcd,0x9e,0x3c,0xa0,0x7b,0xb3,0xbf,0xbf,0x84,0x21,0x18,0x69,0x43,0xbd,0x3,0x0,0x27,0xe1,0xf2,0x11,0xca,0xea,0x59,0x2,0xd5,0x99,0x39,0xda,0xb3,0xc,0xab,0xb,0xb0,0x1f,0x7c,0x47,0x4,0xb0,0x30,0xe8,0x90,0x31,0x62,0x97,0x17,0x93,0x86,0xbc,0x74,0x70,0x82,0x9f,0x7c,0xdc,0xab,0x23,0x8,0x3f,0x46,0x9e,0x4f,0xa0,0xfc,0xc1,0x9e,0xbd,0xb6,0xc0,0x59,0xf7,0xfc,0x78,0xf,0x45,0xca,0x2e,0x4d,0xe3,0x3,0xd8,0xaf,0x1e,0xa,0xef,0xa5,0xa4,0x80,0x28,0x6d,0x2d,0xa0,0x7a,0x91,0x1,0xc6,0x4e,0x14,0xe2,0x9d,0x88,0xe8,0x8b,0xef,0x26,0xb3,0x93,0x38,0xfe,0x4c,0xdf,0x7d,0x68,0x7b,0x7b,0x28,0xda,0x5e,0xf6,0x7a,0x6f,0x8d,0xef,0x33,0x34,0x1e,0x40,0xf5,0x8a,0xbe,0x72,0xba,0x8a,0xe8,0x2f,0xe0,0x74,0xd,0x83,0x1c,0x77,0x11,0xab,0xa3,0x81,0xd8,0x87,0xbc,0x3e,0xfd,0xb4,0x27,0x58,0xcd,0xe7,0xb2,0x69,0x10,0xde,0xdf,0xcf,0x5,0x23,0x8e,0x14,0xb5,0x84,0x86,0x52,0xc8,0x34,0xcf,0x3e,0x7c,0x87,0x59,0xd2,0x96,0xb2,0x4a,0x22,0x2e,0x9e,0xf9,0x6e,0x48,0x62,0xab,0xfb,0x71,0x13,0x6a,0x8e,0xd0,0xd5,0x47,0x58,0x7e,0x59,0xaf,0x84,0xa,0xaa,0xbf,0x11,0xa5,0x26,0x93,0x5d,0x3d,0x88,0x4d,0x44,0xf8,0xe7,0x9f,0x99,0x4e,0xbf,0xa8,0x57,0xc0,0xfe,0x2e,0x6f,0xb9,0x12,0x9f,0xba,0x42,0x78,0x43,0x36,0x29,0xe,0x65,0xc5,0x30,0xda,0xb3,0x24,0x66,0x6,0x89,0x42,0x2a,0x7c,0x12,0x52,0xbe,0xfe,0x9e,0x89,0xa1,0x44,0x78,0x3,0x6e,0xb6,0x98,0xb3,0x4d,0x41,0xc0,0x7a,0xb3,0x61,0xeb,0x58,0x24,0xe3,0xd2,0x98,0xae,0x24,0x2b,0x43,0x62,0x40,0x40,0xa2,0x2a,0x90,0x82,0x1e,0xa0,0x64,0x5f,0x8a,0x28,0x79,0xd4,0xeb,0x3c,0xa1,0xc5,0xbe,0xfe,0xf4,0xbd,0xfc,0x62,0xb3,0xfc,0xf6,0x95,0xb6,0x1,0x22,0xe3,0xa0,0x83,0xe1,0xee,0x81,0x5b,0x89,0x5e,0xf0,0xe1,0x56,0xc9,0x57,0xcb,0xd7,0x82,0x75,0x25,0x76,0xc5,0x43,0x48,0x23,0x7,0x55,0xba,0x98,0x39,0x3c,0x8,0xbd,0x42,0x6d,0xd3,0x7a,0xea,0x82,0x4d,0x65,0xb6,0x76,0x3c,0xb,0xd7,0xd2,0x22,0x99,0x2d,0x68,0xcd,0x97,0x8c,0x91,0x9b,0xb2,0x6a,0x8d,0x5a,0xc7,0xfd,0x11,0x13,0xd5,0x68,0xa6,0xb8,0x1e,0xeb,0x95,0x51,0x2f,0x76,0x11,0xaf,0x55,0x8c,0x11,0xcd,0x83,0xa2,0x1d,0x25,0xf4,0x4e,0x53,0x66,0xda,0x21,0xc1,0xf5,0xed,0x3a,0x94,0xdf,0xc,0xec,0xf8,0x16,0x6d,0x47,0xd6,0xf0,0xa2,0xa5,0x9b,0x7e,0xb0,0x87,0xdd,0xd6,0xf4,0xbb,0xbd,0x74,0x73,0xfc,0x77,0x1b,0x20,0xa5,0xe,0x2d,0x7e,0xe1,0x87,0x8d,0x59,0x9c,0x65,0xf3,0x5b,0xf2,0x31,0xcb,0xed,0xa,0xa9,0xdd,0xd7,0xf4,0x98,0xb0,0xd8,0x9b,0xff,0xfa,0xfd,0xb7,0x40,0x43,0x2c,0x8d,0xf2,0x40,0xc2,0xd7,0x5a,0x30,0x96,0xa2,0x69,0x95,0xfc,0xf0,0xb7,0xa0,0x9a,0x21,0x96,0xbb,0xeb,0xd5,0x9e,0x12,0x35,0xde,0x74,0x2d,0xe5,0x88,0x2d,0x30,0x43,0xb4,0x5,0x1b,0xe2,0x9d,0x1d,0x28,0x39,0x5,0x7e,0x88,0x1a,0x71,0x7,0xea,0x5,0x95,0x7,0x6f,0x9a,0x5,0x3f,0xa6,0x8d,0x97,0x33,0xd2,0x3a,0x3,0x27,0x2,0xfe,0x44,0x9e,0x99,0xbc,0xd0,0x3c,0xa8,0xc6,0xb2,0xab,0x1f,0x4a,0x67,0xcf,0xa3,0x60,0x21,0xc8,0xc2,0x5e,0x95,0xe0,0x8d,0xf7,0xc3,0x52,0x5c,0x6f,0xff,0xb9,0x12,0xf8,0xed,0x31,0x96,0xa2,0x28,0x10,0x8f,0x12,0xdf,0x91,0x1d,0xb1,0x74,0x57,0x3b,0xc1,0xb9,0x2f,0x2,0x64,0x31,0x5d,0xe3,0x8a,0x56,0x1b,0x6f,0x63,0x41,0xe,0x18,0x57,0x9a,0xd7,0x8d,0xbf,0x95,0xb1,0x20,0xa,0x17,0xe2,0x6e,0x71,0x7a,0x55,0xb8,0x96,0xf5,0x72,0x16,0x3b,0x78,0xb,0x70,0x97,0x3e,0xe0,0x35,0x24,0x93,0x41,0x9d,0x46,0x24,0x2b,0xf2,0xd6,0x24,0x6c,0x83,0x40,0x8c,0x2f,0x85,0x86,0x3c,0x94,0x26,0x46,0x5b,0x6e,0xe7,0x29,0xe5,0xa,0x3f,0xb7,0xc8,0xd6,0x22,0xa3,0x1d,0x54,0xe9,0xe5,0x49,0xb8,0xc6,0x20,0x54,0xda,0xd,0xaa,0x11,0x3e,0xfd,0x40,0x9d,0xd2,0x4a,0x39,0xb6,0x97,0xef,0x7b,0x95,0xb0,0x4,0x8b,0xdc,0x87,0x3f,0x4,0x96,0x1d,0x55,0x95,0x29,0xa6,0x91,0xf1,0x22,0x2e,0xb0,0xa8,0x4,0xc9,0x8c,0x97,0xf1,0xf8,0x59,0xbe,0x28,0x70,0xa9,0x88,0x66,0x1c,0xd8,0xa1,0xfb,0xd8,0x96,0x94,0xce,0x5,0xe5,0x40,0xef,0x90,0xb0,0x10,0x41,0x7b,0x46,0xcf,0x38,0xe1,0xff,0x3,0x44,0xa3,0x18,0x7d,0xa9,0x3f,0x0,0x0};
+
+/* pico.min.css: 82191 bytes, 11513 in flash */
+static const uint8_t web_asset_data_268a80ba15c2fd49[] = {0x1f,0x8b,0x8,0x0,0x0,0x0,0x0,0x0,0x2,0x3,0xed,0x7d,0xdb,0x92,0xe3,0x38,0x72,0xe8,0xbb,0xbf,0x82,0xee,0x89,0x8e,0x2e,0xf6,0x92,0x6a,0x92,0xba,0x96,0x14,0xdd,0x31,0xf6,0x1c,0x6f,0x1c,0x47,0xec,0xfa,0x38,0x3c,0xde,0x8,0x3b,0xda,0xf5,0x40,0x49,0x50,0x89,0xdb,0x94,0x28,0x93,0x54,0x5d,0x86,0xa1,0x8d,0xf3,0x7e,0x7e,0xc1,0x1f,0xe0,0xef,0xf2,0x97,0x1c,0x5c,0x49,0x0,0x4,0x40,0x50,0xa5,0xea,0xaa,0x99,0xad,0xd8,0xd9,0x2e,0xa,0x48,0x0,0x89,0x44,0x22,0x91,0x48,0x24,0x12,0x3f,0xae,0xb6,0x71,0x5e,0x80,0xd2,0x79,0xf7,0xa7,0x7f,0xfd,0xbd,0x3f,0x7b,0xb7,0xf8,0xf4,0xf1,0x6f,0xff,0xe6,0xa3,0xf3,0xcf,0xc9,0x2a,0x73,0x7e,0xfa,0xf9,0x67,0xe7,0x7f,0xfe,0xeb,0xbf,0x9d,0xbb,0x68,0x10,0xc,0x26,0xce,0xd5,0xb6,0x2c,0xf,0xc5,0xfc,0xd3,0xa7,0x3,0xcc,0x5c,0x15,0xc5,0x60,0x95,0xed,0x5c,0x8,0xfb,0x53,0x76,0x78,0xcc,0x93,0xdb,0x6d,0xe9,0x44,0x41,0x78,0xed,0x47,0x41,0x34,0x72,0x7c,0xe7,0xf,0xc9,0xa,0xec,0xb,0xb0,0x76,0x8e,0xfb,0x35,0xc8,0x9d,0x3f,0xfe,0xe3,0xbf,0xfe,0xcd,0xc7,0x4f,0xf3,0x3c,0xcb,0xca,0xca,0xf7,0x51,0xd,0xfe,0x26,0xdb,0x97,0xfe,0x26,0xde,0x25,0xe9,0xa3,0xf,0x76,0xd9,0x9f,0x93,0xf9,0xbb,0xbf,0x3b,0x1c,0x52,0x0,0x2b,0x4c,0xb3,0xdc,0xf9,0x7,0x94,0xf4,0xce,0x7b,0xf7,0x33,0xb8,0xcd,0x80,0xf3,0xa7,0x7f,0x6c,0x27,0xfc,0xfc,0xb8,0x5b,0x66,0x29,0x4c,0xf9,0xa7,0xac,0xcc,0x84,0x52,0xb,0x45,0x13,0x45,0xbc,0x2f,0xfc,0x2,0xe4,0xc9,0x66,0x5e,0x3c,0x16,0x25,0xd8,0xf9,0xc7,0xa4,0xa9,0xec,0x9d,0xf7,0x2f,0xd9,0x12,0x56,0xe3,0xfd,0x9f,0x87,0xc7,0x5b,0xb0,0xf7,0xfe,0xb4,0x3c,0xee,0xcb,0xa3,0xf7,0x53,0xbc,0x2f,0xe3,0x1c,0xa4,0xa9,0xf7,0xbf,0x41,0x7a,0x7,0xca,0x64,0x15,0x7b,0x7f,0x97,0x27,0x71,0xea,0xbd,0xab,0x13,0x9c,0x7f,0x2,0x47,0xf0,0xce,0x6b,0xea,0xf7,0xee,0xe2,0xfc,0x4a,0xd7,0x49,0x57,0x85,0xdb,0x2e,0xdb,0x67,0xc5,0x21,0x5e,0x81,0xf9,0x31,0x69,0x7e,0x78,0x3f,0xff,0xfe,0x8f,0xf0,0xdb,0xff,0x17,0x70,0x7b,0x4c,0xe3,0x1c,0x22,0xfb,0x7b,0x7,0x25,0xbc,0xf3,0xfe,0x8,0xf6,0x69,0xe6,0xfd,0x94,0xed,0x8b,0x2c,0x8d,0xb,0xef,0xdd,0x1f,0x92,0x25,0xc8,0xe3,0x32,0xc9,0xf6,0x14,0xa0,0xa9,0xa3,0x2f,0x2e,0x73,0x4d,0x81,0xa6,0x7b,0x75,0xa9,0x34,0xd9,0x3,0x7f,0xb,0xd0,0xd0,0xcf,0xc3,0xc1,0x58,0xa8,0xec,0x9e,0x24,0x8f,0x82,0x40,0x48,0x2e,0x92,0x5f,0xc0,0x3c,0xc,0x82,0xf7,0x2c,0xb5,0x4,0xf,0xa5,0x8f,0x59,0x4,0xd7,0x96,0x6d,0x36,0x90,0x19,0xe7,0xc1,0x20,0xcc,0xc1,0x8e,0xc1,0x2c,0xb3,0x1c,0xe6,0xfb,0x79,0xbc,0x4e,0x8e,0x5,0xcc,0x8b,0xc6,0xed,0xcc,0xfb,0x64,0x5d,0x6e,0x61,0x5e,0x30,0x11,0x72,0xb3,0x63,0x89,0xeb,0x65,0xd9,0xa1,0x90,0x5b,0xe6,0xb0,0x53,0x9,0x22,0x1b,0xaa,0xb5,0x70,0x40,0x5c,0x0,0x3f,0xd9,0xa3,0x52,0xc,0x4,0x11,0x31,0xd9,0xdf,0xce,0x79,0x7c,0xca,0xc7,0x43,0x76,0x9b,0xc7,0x87,0xed,0x23,0xcb,0xf6,0xef,0x40,0x8e,0x58,0x21,0x15,0xe0,0x96,0x69,0xb6,0xfa,0xd6,0x6,0xe1,0x8,0x4c,0xf3,0x5c,0x75,0x89,0x6d,0x96,0x27,0xbf,0x40,0xaa,0x99,0xcb,0xdc,0xe6,0xc9,0xda,0x5f,0x65,0xe9,0x71,0xb7,0xf7,0x6f,0xe3,0x43,0x27,0x68,0x9e,0xdd,0x77,0xc1,0x6d,0xb2,0x7c,0xe7,0x83,0x14,0xec,0x0,0x1a,0x32,0x19,0xff,0x60,0x30,0xe5,0x89,0xa8,0x4,0xe6,0x50,0xe7,0x29,0x72,0x9b,0x67,0xc7,0x3,0x1c,0xb2,0x7,0xbf,0xd8,0xc6,0xeb,0xec,0x7e,0x1e,0x38,0xe8,0x7f,0xf9,0xed,0x32,0xbe,0xa,0x3c,0x87,0xfe,0xe7,0xea,0xc0,0x61,0x5b,0xab,0x63,0x1,0x7,0xb3,0xdc,0xfa,0xcb,0x63,0x59,0xa2,0x71,0xc3,0x15,0x70,0x7d,0x11,0x46,0xdc,0xe5,0x73,0xe,0x79,0xb2,0x8b,0xf3,0x47,0x52,0x89,0x55,0x1b,0xc9,0xfe,0x70,0x2c,0x69,0x13,0x35,0x6b,0x39,0xc2,0x4,0xe1,0xfa,0x4e,0x39,0x71,0x85,0xe4,0x50,0x5d,0xfd,0x2e,0x5b,0xc7,0xa9,0x9f,0x41,0xe2,0xa5,0xf1,0xa3,0xbf,0x8c,0x57,0xdf,0xd6,0x79,0x76,0xf0,0x37,0x49,0x5a,0x82,0x7c,0xbe,0x4c,0x8f,0xf9,0x55,0x30,0x18,0x62,0x82,0xd6,0x65,0xf6,0xf1,0x9d,0x9e,0xfa,0x3c,0x39,0x55,0x80,0x1c,0xe5,0x83,0xc1,0x58,0x2,0x86,0x94,0xf9,0xa6,0x1a,0x50,0x23,0x9c,0xb1,0xc6,0x65,0xe,0xe2,0xf5,0x2a,0x3f,0xee,0x96,0xfe,0x3a,0xb9,0x4b,0x20,0x1,0xe6,0xef,0xbe,0xd4,0xf2,0x17,0xfe,0x7f,0xef,0xaf,0xb6,0x60,0xf5,0xd,0x12,0x78,0x7e,0xcc,0xd3,0xab,0x77,0xeb,0xb8,0x8c,0xe7,0x70,0x20,0x6e,0xc1,0xa7,0xe2,0xee,0xf6,0x77,0xf,0xbb,0xd4,0x7b,0x3f,0xfc,0x9,0x7e,0x3a,0xf0,0x73,0x5f,0x7c,0xfe,0x80,0x56,0x19,0xb8,0xc8,0xdc,0xdf,0xdf,0xf,0xee,0x87,0x83,0x2c,0xbf,0xfd,0x14,0x5,0x41,0x80,0x80,0x3f,0x38,0x78,0x50,0x3f,0x7f,0x88,0x46,0x1f,0x1c,0x22,0x77,0xc8,0xf7,0x5d,0x2,0xee,0xff,0x3e,0x7b,0xf8,0xfc,0x1,0xd,0x14,0x5c,0x7d,0x50,0x1a,0xa4,0x70,0xfa,0xf9,0xc3,0x3e,0xdb,0x83,0xf,0x4e,0x51,0xe6,0xd9,0x37,0xf0,0xf9,0x3,0xe4,0xb3,0xab,0x68,0x3c,0xf6,0x1c,0xf6,0x8f,0xcb,0xf2,0x7c,0x5a,0xf3,0xa8,0x4e,0x40,0x4c,0xb4,0x8a,0xf,0xb0,0x50,0x6,0xc5,0x93,0x90,0xfc,0xe7,0x2c,0xd9,0xb3,0xf4,0xf7,0xc3,0x7f,0x80,0xe8,0x1f,0xb2,0xf4,0x11,0xe5,0x38,0x7,0x98,0x55,0xc2,0x4e,0x44,0x81,0x33,0x71,0xae,0x9d,0x70,0xea,0x8c,0x9c,0x30,0xa2,0x50,0x9f,0x18,0x18,0xfd,0x9,0xbb,0x4,0xbf,0xde,0xb9,0x2,0xb5,0x76,0xc9,0x1e,0xa,0xb9,0xdf,0x2e,0xa9,0x30,0x99,0x1e,0xc2,0xcf,0x1f,0xc6,0x1f,0x9c,0x47,0xf8,0x7,0x52,0xc7,0x79,0x88,0xe0,0xdf,0x6b,0xf8,0x3b,0xc2,0xbf,0x29,0x79,0xba,0x28,0x5,0xf9,0xea,0x2e,0x87,0x22,0xe0,0x55,0xd0,0x2a,0x1c,0x4e,0x3c,0x27,0x1c,0x41,0x5a,0x85,0x93,0x51,0x8b,0x56,0xd1,0x85,0xd8,0xa,0xf3,0x54,0xe4,0x84,0x63,0x27,0x9c,0x39,0xd7,0x7d,0xd8,0xa,0xd2,0x7,0xfc,0x86,0x29,0x95,0x83,0x55,0xe9,0xc0,0xf6,0x87,0x90,0x89,0x30,0x6b,0xd2,0xea,0xc2,0x59,0x83,0x28,0xfa,0xce,0x1f,0x70,0x13,0xf9,0x23,0xfa,0x43,0xe9,0x85,0xca,0x4a,0xbc,0x19,0x4e,0x8,0x73,0x32,0xde,0x9c,0x10,0xde,0x9c,0xb4,0x59,0xb3,0x2e,0x32,0x13,0x4a,0xcc,0xba,0xb,0xc,0x29,0xff,0x7,0xa4,0x44,0x14,0x52,0xfe,0xf,0x6c,0xf9,0xbf,0x4c,0x76,0xbf,0xe5,0x21,0x5d,0x25,0xf9,0xa,0x6e,0x6,0x56,0xf,0x44,0x46,0xac,0x1e,0xc9,0xdf,0x9c,0x27,0x11,0x81,0xd1,0x4c,0x16,0x38,0x51,0x26,0x78,0xb6,0xc0,0xff,0xe0,0xc7,0xa8,0xcf,0x74,0x29,0x40,0x9c,0xaf,0xb6,0xbf,0x6,0xea,0x42,0xc5,0xfb,0xe9,0xf4,0xd,0x29,0x7d,0x43,0x4c,0xdf,0x99,0x8a,0xbc,0x35,0xdf,0x62,0x46,0xa5,0x7f,0xc9,0xe4,0x18,0x4c,0xc6,0x94,0x77,0xf1,0xa7,0xad,0xf8,0x4e,0xb3,0xe2,0x57,0xc1,0xbf,0xc3,0x27,0x2e,0x74,0x21,0x15,0xd,0x13,0x42,0x2f,0x2a,0x4b,0xc2,0x99,0x41,0x36,0x4c,0x84,0x12,0xe1,0x4c,0x5f,0x44,0x4d,0xdb,0x34,0x83,0x7b,0x25,0xb8,0x6b,0xe9,0xa0,0x2e,0x4f,0xf,0x9e,0x76,0x1c,0x49,0x55,0x64,0xb4,0x18,0x14,0x82,0x5c,0x51,0x3e,0x62,0xf6,0x71,0x6e,0x9d,0xf7,0xd3,0xbf,0x77,0xe2,0x3d,0xc4,0x2,0xef,0xb6,0x9c,0x3c,0x2b,0xe1,0x82,0xe4,0xc0,0x3d,0x17,0xea,0x4a,0x9c,0x3b,0xc9,0x7e,0x93,0xec,0x93,0x12,0x2c,0x1c,0xbc,0x29,0xc3,0x8a,0x35,0xd4,0x3b,0x6f,0x13,0x8,0xbc,0x82,0xfa,0x2d,0xc8,0xe9,0x9f,0x5,0xac,0xea,0x7f,0x39,0x94,0x79,0x51,0xad,0x74,0x10,0xd6,0x31,0xd4,0xdf,0xf3,0x3c,0x7e,0x9c,0x3b,0xd3,0xb1,0x7,0xb7,0x98,0xb,0x3e,0x87,0xee,0x2b,0x1d,0x7f,0xbc,0xe0,0xd1,0x40,0x59,0xe,0x9c,0x41,0xc2,0xd6,0x8f,0xc3,0x45,0x1c,0x77,0x84,0x36,0x1c,0x5f,0x82,0xc1,0x8f,0xdf,0xc0,0xe3,0x26,0x8f,0x77,0xa0,0x60,0x9d,0x41,0xc8,0x4,0xef,0xa3,0x31,0xfe,0xa8,0x7b,0xc1,0xfa,0x7a,0x15,0xac,0x1,0xdc,0x61,0xe1,0xb2,0x68,0x3,0xac,0x85,0x1b,0x4e,0x38,0x48,0xa9,0x25,0x8c,0xaf,0xd0,0x4e,0xbb,0xf7,0xa1,0xb6,0xf3,0x1,0xa9,0x73,0x6c,0x28,0x3c,0x1a,0xd,0xc,0xc4,0xb,0xa7,0x70,0x97,0x2f,0xf7,0xa0,0x6f,0x25,0x93,0xa8,0xe9,0x1a,0x66,0x60,0xca,0x24,0xf0,0xfb,0xd6,0x42,0xf2,0x9f,0x39,0x89,0x21,0xdb,0x7e,0xa2,0x33,0xe6,0x56,0x9a,0x39,0xa7,0x1f,0x77,0x60,0x9d,0xc4,0xce,0x15,0x54,0xbd,0xa9,0xa1,0x60,0x3c,0x9d,0x1c,0x1e,0xdc,0xaa,0x6d,0xae,0xa2,0xf6,0x8b,0xc9,0x20,0x1a,0xbf,0x3f,0x29,0xa,0x4e,0x27,0x33,0x53,0xc1,0x30,0x1a,0xa8,0xcb,0x85,0x41,0x34,0x32,0x16,0x9c,0xc1,0x4d,0xb7,0xba,0x64,0x34,0xb,0x4c,0x25,0x35,0x88,0x86,0xe3,0xa1,0xb1,0x8b,0xc3,0x90,0x74,0x31,0xae,0x78,0x43,0xcd,0x1a,0xac,0x32,0x62,0x67,0x9a,0xd7,0x36,0x9b,0x53,0x3c,0x80,0x22,0x7,0xf2,0x71,0x51,0x7a,0xf1,0xa0,0x80,0x10,0xfb,0x35,0xdc,0x66,0x77,0x97,0x2b,0x76,0x71,0x9a,0xb6,0x9b,0xe,0x6,0xb3,0xe9,0x18,0xec,0x4e,0xdb,0xd0,0xdb,0x46,0xde,0x76,0xe8,0x6d,0x47,0xde,0x76,0xec,0x6d,0x27,0x95,0xc2,0xbe,0x34,0xd,0x2,0x8,0xd8,0xae,0x24,0xe2,0xb6,0xa9,0xa2,0x99,0xa,0x12,0xc4,0x60,0xc7,0x29,0xb3,0xc3,0x7c,0x98,0xa3,0xd6,0x23,0x5,0x51,0x44,0xc3,0x87,0x54,0x6f,0x57,0xb5,0xd1,0x80,0xd8,0xf,0x4e,0xdb,0xa1,0xaa,0x6a,0x43,0xcd,0xd3,0xee,0xaa,0x69,0xcd,0x23,0x55,0xcd,0x91,0xbe,0xea,0xa8,0xa3,0xe2,0x10,0x8e,0xc5,0x8,0xd7,0x3c,0x56,0xd5,0x1c,0x9a,0xaa,0xee,0xa4,0x73,0x38,0x98,0xcc,0xa6,0x4,0xef,0x89,0xa2,0x76,0x7d,0xcd,0xdd,0x15,0xe3,0x5a,0xcb,0xd,0x64,0x6d,0xa7,0x5c,0x7b,0xf4,0x63,0xeb,0x95,0x5b,0x10,0xaf,0x71,0xa,0xf9,0xd8,0xaa,0x58,0x6a,0xd2,0x98,0x2c,0x25,0xdb,0x62,0x48,0xd1,0x5d,0x65,0x6b,0xe0,0x7d,0x5b,0xae,0xbd,0x43,0xe,0xbc,0x22,0xde,0x1d,0x2a,0x7b,0x33,0x6a,0x6d,0x98,0x75,0x4f,0xb0,0x6,0x55,0xfb,0xcb,0x2c,0x85,0x8d,0x9e,0xe6,0xf7,0x5b,0x90,0x83,0xab,0x2,0xa4,0x70,0x7b,0xe2,0xa1,0x59,0x14,0xe7,0x20,0x76,0x3d,0x62,0x93,0xda,0x67,0xe5,0xd5,0x57,0xd8,0x7d,0xf0,0xb9,0x38,0x2e,0x77,0x49,0x79,0xe3,0x91,0x5f,0xc4,0x2a,0xc6,0x7e,0xe5,0x0,0x8a,0x5c,0xf6,0x83,0x99,0x61,0xea,0x4c,0xa8,0x22,0x64,0xec,0x7,0x14,0xaa,0xe0,0xc6,0xad,0x34,0x56,0x53,0x6a,0xf9,0x3a,0xd1,0x16,0xb1,0x6e,0x7c,0x53,0x29,0xad,0xb3,0x1c,0x9c,0xba,0xc1,0x4a,0x43,0xdb,0x48,0x55,0xf2,0x6b,0x9e,0xa5,0xb0,0xc1,0xfb,0xa4,0x6c,0x37,0x28,0x8f,0xca,0x1a,0x94,0x71,0x92,0x16,0x3,0x64,0x5f,0x5b,0x67,0xf7,0x7b,0xa7,0x38,0xee,0x90,0xbd,0x8f,0xd0,0xa,0x57,0x44,0xa9,0xd3,0xd9,0xcf,0x7d,0x7c,0xe7,0x68,0xab,0x23,0xf6,0xc1,0xbb,0xa4,0x48,0x96,0x29,0xa8,0x8c,0x76,0xe6,0x13,0xc5,0xbf,0x9b,0x60,0x18,0xe,0x9b,0x22,0x6f,0xe6,0xdb,0xb8,0xb8,0x22,0x98,0x36,0xd2,0x94,0xb4,0xea,0x9,0x43,0xae,0xc9,0xa5,0x9d,0x6c,0xe7,0xf2,0x24,0x90,0x73,0x5d,0x4f,0x40,0xf5,0x65,0x70,0xa8,0x9e,0xc5,0xec,0x5b,0xb7,0x42,0xd,0xbf,0x5a,0x62,0xb3,0x55,0x4c,0xd9,0x4f,0x65,0x26,0xeb,0x88,0x9c,0x29,0xf4,0x52,0xcc,0x34,0x10,0xfa,0xfb,0xb4,0xff,0x3c,0x44,0x66,0x8d,0xa8,0x68,0xec,0x8,0xf8,0x78,0x62,0x96,0x28,0xb5,0xda,0x59,0xb5,0x78,0xe3,0xb3,0x8,0xbc,0x48,0x49,0x65,0x2b,0x75,0x9e,0xa2,0x19,0x31,0x4f,0x6c,0x87,0xe5,0x91,0x12,0x95,0xe5,0x49,0x47,0xc4,0x89,0x21,0x26,0x2e,0x4,0xac,0xb0,0x28,0x1a,0x50,0x2a,0xba,0xf3,0x79,0xbc,0x81,0x1b,0x9a,0x8a,0x9d,0x5,0xe0,0x33,0xd4,0x3d,0x28,0x8a,0xab,0xc0,0x85,0x7b,0x10,0x64,0x9e,0xbf,0xa,0x21,0x29,0xe3,0x3c,0x89,0xe1,0x90,0x14,0x8f,0x9f,0xcb,0xfc,0x8,0x48,0x25,0x78,0x15,0xf0,0xe4,0xc5,0x61,0x9e,0x30,0x66,0xf2,0xec,0x17,0x7,0x41,0x32,0xca,0x18,0x2e,0x1,0xec,0x34,0xe8,0x42,0x11,0x2b,0x91,0x44,0xce,0xa2,0xcd,0xa6,0xf,0x97,0xd7,0x1d,0xf8,0xc,0xe7,0xdc,0xb7,0x1b,0xc8,0xef,0x5c,0x52,0x8a,0xca,0x37,0x82,0x30,0x5e,0x7d,0xbb,0xc5,0x5b,0x2a,0x72,0x68,0x32,0xff,0x61,0xb3,0xd9,0x2c,0x6a,0x8e,0xc2,0x29,0xc3,0xe9,0x70,0x35,0x1a,0x9,0xa7,0x85,0xa4,0xd7,0x9,0x32,0x21,0x60,0x18,0x7c,0x7a,0x14,0x41,0xb5,0x7f,0x3c,0xf2,0x9c,0x68,0x8,0xbf,0xd0,0x11,0x61,0x73,0x2,0x73,0x2c,0x41,0xdd,0xc0,0x64,0x34,0x59,0x4e,0xaf,0xc5,0x2c,0xfe,0xdc,0x66,0xfe,0x3,0x98,0x82,0x78,0x53,0x6b,0x0,0xf4,0xcc,0x68,0xfe,0x43,0x10,0x4e,0xa3,0x78,0x2d,0x25,0x73,0x3d,0xd0,0x42,0xe0,0xca,0xe7,0x8a,0x63,0xa8,0xa6,0xac,0x2b,0x17,0xaa,0x75,0x64,0xd2,0xb7,0x10,0xf6,0x2d,0x84,0x7d,0xb,0xa7,0x43,0xd4,0xb7,0x71,0xb,0x7e,0x8b,0xce,0x97,0x10,0x6,0xe3,0xd9,0x6c,0xaa,0xcc,0x14,0x31,0x8d,0x26,0xe3,0xeb,0x58,0x3,0xa7,0xc5,0x57,0xae,0x47,0x8d,0x5,0x87,0xbb,0xae,0x8e,0x56,0x41,0x2c,0x33,0x94,0xc3,0xd8,0xee,0x2a,0x66,0xba,0x2,0x8,0xac,0xd2,0xac,0x23,0x3f,0x8c,0xd7,0x93,0xe5,0xec,0xba,0x95,0x21,0x74,0x7f,0x1c,0x8d,0x37,0xd3,0x58,0x1,0xd3,0xea,0xba,0xaa,0xbc,0xdb,0x2e,0x28,0xd,0xd7,0x35,0x1c,0xa5,0x30,0x98,0xc2,0x7f,0x86,0x53,0xb1,0x13,0x4d,0x11,0x3a,0x62,0xa3,0x19,0xdc,0x86,0x2d,0x35,0xd9,0x2,0xd2,0x1d,0x90,0x6,0xd4,0xb5,0xe3,0x26,0x83,0x28,0x47,0x4e,0x2,0x52,0x14,0xe6,0x46,0x4f,0xee,0x79,0xa4,0xea,0xba,0x6a,0x4,0xeb,0x35,0xea,0x87,0x70,0x16,0xae,0x1a,0x5,0xbf,0x5e,0x56,0x78,0x52,0xe8,0x40,0x5a,0x34,0x50,0x94,0x76,0x5b,0xc5,0xa4,0xc1,0x8b,0x10,0xf3,0xcd,0x3c,0x47,0x1e,0xba,0x1a,0x9e,0xcd,0xb5,0x66,0x97,0x20,0x66,0x89,0x33,0x4d,0xf,0xa5,0xc7,0x56,0x3b,0x60,0x12,0x44,0xaf,0xf1,0x12,0x17,0xe8,0xce,0xe1,0xaa,0xc1,0x55,0xa3,0xc5,0x9f,0xdf,0xf,0x82,0x70,0x84,0x4f,0xc5,0xe1,0x57,0x74,0x4d,0x3e,0x42,0xbc,0x67,0x24,0xa7,0xfa,0x61,0x74,0xcd,0xac,0x32,0xb3,0x10,0x35,0x12,0x84,0x93,0xeb,0x99,0xeb,0xc1,0x8f,0xe1,0x90,0x15,0x9c,0x4c,0xc9,0xc7,0x28,0x88,0xc,0x5,0xa3,0x11,0x2e,0x46,0x4f,0xe1,0x99,0x8e,0xed,0x50,0x77,0x4,0x5d,0xa9,0x21,0x2a,0x14,0xd6,0xb0,0x11,0xf9,0x8,0x7,0x43,0x63,0xa1,0x9,0x2a,0x15,0x5,0x33,0x5a,0x6a,0x14,0x62,0xc,0xa3,0xc1,0xd8,0x88,0xe1,0x68,0x18,0x44,0xa8,0x20,0x69,0x2,0xfd,0x33,0x31,0x40,0xa3,0x36,0x24,0xd7,0x2,0x1d,0xc9,0x9a,0x81,0xd9,0x86,0x6c,0xa1,0x8a,0xd6,0xc3,0x70,0x38,0xab,0xd3,0x23,0xf5,0x8a,0xb9,0x1d,0xb2,0xf4,0x51,0x34,0x9a,0x8e,0xc3,0x3a,0x7d,0x54,0xa7,0xaf,0xc7,0xc3,0x31,0xa8,0xd3,0xc7,0x2c,0x7d,0xbc,0x9a,0xc,0xa7,0x35,0xfb,0x6e,0x27,0x9a,0x25,0x14,0x2e,0xf2,0xaa,0x85,0x7c,0xd,0xa6,0xab,0x40,0x0,0xa2,0x39,0xc1,0x26,0x84,0x8b,0x59,0x6d,0xad,0xde,0x17,0x2c,0x23,0x5c,0x4f,0xe2,0x71,0x9d,0xb1,0x6,0x29,0xcb,0x98,0xcd,0x86,0xd7,0xc3,0xb1,0xe0,0x22,0xf3,0x9f,0xc7,0xac,0x4,0xe2,0xc2,0xcd,0xcd,0x81,0xf6,0xb2,0xee,0x2a,0x4a,0x23,0xa3,0x80,0xbe,0xb4,0x54,0xc,0xab,0x47,0xf6,0x8e,0x2b,0x14,0x9e,0x4d,0x75,0xcb,0x52,0x65,0xc,0x77,0x94,0xe7,0xf4,0x8a,0x14,0x44,0x8e,0x3d,0x45,0x99,0x27,0x87,0x3,0x82,0x93,0x87,0x84,0xb0,0x56,0x88,0x74,0x89,0x28,0x40,0x53,0x7e,0x4c,0x38,0x7d,0xca,0x4f,0xfa,0x35,0x50,0x8d,0xe5,0x70,0x3,0x17,0x4c,0x1,0x48,0xc9,0xa,0x38,0xe7,0xdb,0x52,0xd1,0xb6,0x20,0xe5,0x78,0xc4,0xeb,0x22,0x2d,0x38,0xb9,0xe,0xb5,0x6f,0x92,0x2,0xd9,0xe5,0x66,0xb5,0x59,0xa9,0x7d,0x93,0xb0,0xde,0xa8,0xa2,0xcd,0xf,0xeb,0xd,0x18,0x82,0xe5,0xa2,0xcb,0xab,0x67,0xfe,0xc3,0x6a,0xb3,0x1e,0x83,0x48,0x9,0xc8,0xa6,0xe5,0x30,0x9a,0x44,0x6a,0x4,0xe,0x69,0xbc,0x2,0x5b,0x6c,0xde,0xb1,0x63,0x3b,0xa1,0x74,0xc,0x75,0xde,0x3b,0x60,0x56,0x9a,0x95,0x5,0x34,0xfc,0x24,0x6a,0xa8,0xea,0x36,0xc9,0x9e,0xf0,0xac,0xa2,0xeb,0xa4,0x40,0x5c,0xb9,0xf6,0x33,0xb4,0x51,0x2a,0x1f,0x91,0xef,0x90,0x12,0x10,0xae,0x30,0x71,0x9a,0xc8,0x6a,0xf8,0x72,0x36,0x89,0x27,0x4b,0x63,0x1,0x55,0xff,0x7e,0x58,0xcd,0x46,0x9b,0xd1,0xcc,0x58,0x4e,0xd3,0x29,0xdb,0x36,0xd4,0xdd,0x55,0xf5,0x61,0xb4,0xba,0x5e,0xce,0x62,0x3,0xb8,0xb2,0x7,0xd1,0xf4,0xfa,0x7a,0x3a,0x35,0x94,0xb2,0xc1,0xbf,0x1b,0x7b,0x62,0x54,0x53,0xb0,0x13,0x9c,0x40,0xd3,0xf5,0xb5,0x4,0x86,0x2d,0x72,0xc0,0x3c,0xb5,0xd,0x1b,0x1b,0x56,0x4b,0x8b,0x61,0x69,0x46,0xb9,0x45,0xe,0x64,0xd6,0x82,0x32,0x8f,0xf7,0xb7,0x32,0xd9,0xc4,0x29,0x4c,0x20,0x94,0xf4,0x15,0xfb,0x47,0x0,0x59,0xfb,0xea,0x99,0xa2,0x95,0x45,0x7c,0xe1,0x56,0x29,0xe3,0xe6,0x81,0x2f,0x49,0xb1,0xec,0x43,0xcf,0x78,0xb5,0x82,0xb8,0x26,0x78,0x49,0xea,0xbd,0x5a,0x34,0x85,0x69,0xcb,0xd4,0x54,0xa1,0xc7,0x40,0x54,0x25,0x9b,0xf2,0xf8,0x8,0x5f,0x5f,0x5c,0xd7,0x6c,0x76,0x0,0x7b,0x7d,0x29,0x95,0x20,0x5c,0xc5,0xb9,0x99,0xf7,0xb4,0x43,0x44,0x4a,0xf6,0x27,0x12,0x2d,0x57,0x33,0x24,0xdf,0x56,0x9d,0x2a,0x42,0x17,0xc4,0x2a,0x81,0x8c,0x42,0x5d,0xeb,0x12,0x33,0x2a,0x9b,0xa5,0x79,0x3,0x25,0x5a,0x28,0x36,0x9b,0x70,0x33,0x52,0x0,0x59,0x22,0x5b,0x97,0xe8,0x18,0xb0,0x1a,0x4e,0xde,0x90,0xa8,0x11,0xa1,0x3e,0x7,0x7e,0x71,0x48,0xf6,0x7b,0x8,0xaf,0x90,0xfb,0x6d,0x67,0xd8,0xb6,0x8a,0x82,0x77,0xfe,0xd1,0x10,0xdb,0x0,0xf0,0xae,0x64,0xca,0x1b,0x1,0xb2,0xdb,0x1c,0x14,0x45,0xe7,0xa,0x5e,0x3,0xf6,0x99,0x54,0x65,0x96,0xa5,0x65,0x72,0xe8,0x50,0x5f,0xf4,0x5b,0x4a,0x56,0x5e,0x5f,0x88,0x6e,0xa6,0x44,0x5f,0xd,0x2c,0xaa,0x5f,0x87,0x1f,0xcc,0x14,0x9d,0xa0,0x23,0x7f,0x4f,0xb8,0xb1,0x78,0x36,0x1f,0xc6,0xf3,0x5d,0x63,0xe9,0xa2,0xfc,0x4a,0x9c,0x63,0x3,0xb8,0x24,0x4d,0xe1,0x4e,0x6d,0x1a,0xbd,0x94,0xc7,0x5b,0xe3,0x61,0x14,0x11,0x7f,0xa1,0x19,0xf5,0x17,0x8a,0xf4,0xae,0xb4,0xad,0x32,0x21,0x73,0x32,0x8a,0xe0,0x3e,0x93,0xb9,0x71,0x99,0xfc,0x8c,0x30,0x7b,0xfb,0xc5,0xa,0x19,0x74,0xe7,0xd8,0xa0,0x6b,0xb4,0xff,0x3a,0xe4,0xc0,0x32,0x29,0x9e,0xe1,0xbc,0x52,0x61,0x5b,0x7e,0xce,0xe6,0xaa,0x33,0x54,0x64,0x7a,0x1e,0x42,0x1d,0x30,0xb2,0x7d,0xfa,0xe8,0x14,0xab,0x1c,0x80,0xbd,0x13,0xef,0xd7,0xce,0xd5,0x21,0x7,0x1b,0x28,0x12,0x7c,0x81,0xa8,0x88,0x70,0xd4,0x33,0x43,0x26,0x6a,0x83,0x44,0x5b,0x4,0x86,0xc3,0x70,0x1a,0xca,0xf6,0xf3,0x55,0x4,0xb5,0x9d,0xa0,0xdb,0x7e,0x8e,0xf6,0x85,0xd3,0x80,0xba,0x7b,0x93,0x43,0x55,0xb5,0x5,0x7d,0xba,0x9c,0x8d,0xae,0xc7,0x26,0xb,0x7a,0x14,0x44,0x93,0x61,0xa4,0xb0,0xa0,0xc7,0x71,0xb3,0xb6,0x7d,0x7f,0xb,0x3a,0xd7,0x3b,0xad,0x5,0x7d,0x7a,0xbd,0xa,0xda,0x38,0x2a,0xec,0x7a,0xe1,0x74,0xb3,0xa,0x5e,0xa5,0x5,0x5d,0xea,0xea,0x70,0xda,0xdb,0x86,0x7e,0x3d,0xb9,0x6,0xf1,0xe6,0x65,0x6d,0xe8,0xe1,0x18,0xd9,0x28,0xc6,0x33,0xd4,0x99,0x71,0x87,0x11,0x7d,0x39,0x5c,0x5e,0xaf,0xc6,0x36,0x46,0x74,0xdd,0xe9,0xc0,0xab,0x32,0xa2,0x87,0xa3,0x11,0xeb,0xfa,0x75,0x70,0xa6,0x15,0x5d,0xd4,0x86,0x94,0x56,0x74,0x51,0x79,0xbb,0xb4,0x15,0x3d,0x1a,0x42,0xe,0x8c,0xa6,0x48,0x89,0x1b,0x9b,0xd,0xe9,0xa,0xfc,0x15,0x23,0x67,0x80,0x7a,0x26,0x43,0xba,0x8,0x63,0xb4,0xa3,0x47,0xc8,0x86,0x1e,0x85,0xb8,0xcb,0x93,0x4e,0x43,0x7a,0xc0,0xfb,0x17,0xd9,0x1b,0xd2,0x61,0x13,0xc8,0x2c,0x1c,0xf5,0xb1,0xa1,0xb,0x65,0x6c,0xcc,0xe7,0x42,0x1,0xb,0xcb,0xb9,0x8,0x6f,0x63,0x34,0x17,0x4a,0x98,0xec,0xe5,0x2,0xa0,0xce,0x54,0x2e,0x12,0x45,0x65,0x25,0xdf,0x4,0x90,0xcd,0x87,0x6d,0x2b,0x39,0x8,0xe0,0xc,0x99,0xb6,0xad,0xe4,0xe2,0x7a,0xd9,0x58,0xc9,0x45,0x21,0xd3,0x58,0xc9,0xe3,0x51,0xbc,0x5a,0xc6,0x6d,0x2b,0xf9,0x6c,0x76,0x1d,0xc6,0xa3,0xe,0x2b,0x39,0x1c,0xf2,0x60,0x32,0x54,0x59,0xc9,0x39,0x7e,0xe7,0x4c,0xe4,0x93,0x28,0xde,0x34,0x7,0xb7,0x9c,0x89,0x7c,0x5,0xa6,0x60,0xba,0x7c,0x33,0x91,0xbf,0x94,0x89,0x3c,0x8c,0xc3,0x4d,0x34,0x53,0x99,0xc8,0x45,0x3e,0x78,0x15,0x26,0xf2,0x70,0x15,0x85,0x51,0x6f,0x13,0x79,0x14,0xf,0x21,0xb7,0x5a,0x98,0xc8,0xd,0x80,0xca,0xb9,0xd7,0x61,0x22,0x97,0x28,0x68,0x67,0x12,0x17,0xc7,0xe3,0xb7,0x63,0x15,0xbf,0x9e,0x8c,0xe2,0x71,0xd0,0xdf,0x2a,0xbe,0x9c,0x8e,0x82,0xe1,0xf2,0x75,0x58,0xc5,0xa3,0x78,0xba,0x9c,0x6c,0xfa,0x5a,0xc5,0xc3,0xc9,0xec,0x7a,0x12,0xbf,0x9c,0x55,0x7c,0x38,0x1c,0xae,0x46,0xe0,0x57,0x67,0x15,0x17,0xf7,0x62,0x6,0xab,0xb8,0x38,0x6b,0xdf,0xac,0xe2,0xbf,0x5e,0xab,0xb8,0xec,0x1f,0x63,0x32,0x80,0x2b,0x6b,0x78,0x36,0x1b,0xb8,0x28,0x95,0xd,0x36,0x70,0xb1,0x7,0x1a,0x33,0xb8,0xc8,0xda,0x2f,0x68,0x6,0x17,0x11,0xb9,0x90,0x19,0x7c,0x46,0x34,0xdb,0xc0,0xde,0x2,0x2e,0x9b,0x5d,0xde,0x2c,0xe0,0x67,0x58,0x75,0x47,0xc8,0x1,0x11,0x6d,0x5e,0xa1,0x1a,0xf8,0x66,0x1,0xef,0xb8,0x35,0x8b,0x6c,0x34,0xd3,0x91,0xe7,0xcc,0x82,0xbf,0x62,0xb,0x38,0x32,0xd6,0x9e,0x34,0xb6,0xda,0x57,0x6a,0x8c,0xd6,0x61,0x6b,0x72,0x5d,0x6f,0xae,0x11,0x58,0xfb,0xb0,0x6b,0xdb,0xe9,0xe1,0xd1,0xde,0x34,0xfb,0x3d,0x5d,0xdb,0x4f,0xa7,0xd6,0x39,0xc6,0x9b,0xd9,0xfd,0xcd,0xec,0xfe,0x66,0x76,0x7f,0x33,0xbb,0xbf,0x99,0xdd,0xdf,0xcc,0xee,0x6f,0x66,0xf7,0x37,0xb3,0xfb,0x9b,0xd9,0xfd,0xcd,0xec,0xfe,0x66,0x76,0x7f,0x33,0xbb,0xbf,0x99,0xdd,0xdf,0xcc,0xee,0x6f,0x66,0xf7,0x37,0xb3,0xfb,0x9b,0xd9,0xfd,0xcd,0xec,0xfe,0x66,0x76,0x7f,0x33,0xbb,0xbf,0x99,0xdd,0xbf,0xa3,0xd9,0xbd,0x65,0xa5,0x7d,0xa5,0x6,0xf7,0x36,0x9e,0x97,0x36,0xb5,0xb7,0x5b,0x78,0xfd,0x46,0x76,0xb,0xca,0x63,0xcd,0xe4,0xc6,0x63,0x52,0xb5,0x82,0xcb,0x76,0xb3,0xa1,0x69,0xd3,0xdb,0x3d,0x7d,0xf4,0x28,0x99,0xbc,0xba,0x6d,0xbc,0x6,0x25,0xbf,0xa0,0x70,0xa8,0x74,0x25,0x83,0x29,0xb,0x4e,0xd6,0xe6,0xe0,0x0,0x62,0x44,0x6c,0xfa,0x75,0x6a,0x55,0x21,0xc7,0x30,0x4c,0xf6,0x5b,0x90,0x27,0xe5,0x82,0x45,0xd0,0xf7,0xa1,0x74,0xb8,0xad,0x93,0x59,0xe8,0x36,0x7c,0xfc,0x1,0xd9,0xe6,0x1e,0x2c,0xbf,0x25,0x25,0xdc,0xa,0x1f,0xfc,0x2d,0xec,0x3f,0xbe,0xa7,0x40,0xbb,0x80,0xa3,0x7f,0x1e,0xe0,0x20,0xec,0xcb,0x45,0xd,0x87,0xf,0xb,0x92,0x5f,0xa0,0xc6,0xb8,0xfe,0xf3,0x11,0xe,0xa,0x79,0x2e,0x63,0x97,0xfd,0xa2,0xc9,0x52,0xa7,0xf6,0xbb,0x2d,0xa7,0x5b,0x8c,0xf9,0xc0,0x74,0x72,0x44,0x3b,0x92,0x4c,0x61,0x70,0xcc,0x3e,0x19,0x2,0x25,0xba,0xb,0x3e,0x7a,0x1f,0x7,0xc1,0x25,0xd3,0x3a,0x8c,0x91,0xf3,0xdc,0x85,0xfa,0xa9,0x10,0xe,0x5a,0x9,0x40,0xcb,0x41,0x12,0xc3,0x74,0xc4,0x4,0xd9,0xa1,0x4c,0x76,0x10,0xb1,0x3f,0x80,0xdb,0x64,0x99,0xa4,0x50,0x49,0x58,0x20,0x9d,0x60,0x93,0x66,0xf7,0xfe,0x7d,0x1e,0x1f,0xe6,0xe8,0x49,0x83,0x6f,0xfe,0x3d,0xe4,0x15,0x4a,0xf5,0x78,0x49,0xba,0x7,0x77,0xc3,0x19,0xff,0xab,0xf9,0x3c,0x2d,0xb3,0xf5,0x63,0xc5,0x42,0x79,0x42,0xea,0x43,0x6e,0x44,0xa1,0x6b,0x83,0xd3,0x2e,0x4e,0xf6,0x15,0xdc,0x7e,0xc2,0x1d,0xf6,0xe3,0x1c,0xdb,0x78,0x30,0xec,0x17,0x62,0xe3,0xf1,0xf0,0x37,0xa,0x46,0xc8,0xbe,0x31,0xfc,0x21,0x5e,0x63,0x65,0x6,0xc3,0xb,0x3,0xa7,0x7c,0x51,0xc4,0x3d,0x51,0xfd,0xaf,0x22,0xcd,0x42,0x6,0x87,0xb3,0x71,0x67,0x53,0x10,0x4f,0x7d,0xd8,0x24,0x6c,0xbe,0xf9,0xf4,0x37,0xe9,0x31,0x59,0xb7,0xbb,0xe3,0xe3,0xe9,0x3b,0x8f,0x8f,0x65,0xc6,0x52,0x52,0xb0,0xa1,0x9,0xc,0xe7,0x5c,0x1e,0xe7,0xfa,0x71,0x11,0x6,0x81,0xcb,0x28,0x0,0xf4,0x71,0x58,0x1b,0xd4,0x60,0xf,0x1f,0x58,0x5e,0x18,0x1c,0x1e,0xa4,0x66,0x3,0xb1,0x91,0xc0,0x10,0xa2,0x55,0x59,0xe7,0x34,0x80,0x75,0x9a,0xe2,0xb3,0x2a,0x4b,0x5d,0x8f,0x75,0xa5,0x68,0x6c,0x56,0x65,0xa9,0x30,0xd2,0x36,0x46,0x63,0xb3,0xaa,0x8b,0x8d,0x48,0x6b,0x3,0xf4,0x98,0x4b,0x65,0x78,0xfc,0x45,0xca,0x72,0x17,0xba,0xd7,0x5f,0xf8,0x74,0x77,0xc1,0x78,0x15,0xa5,0x92,0x22,0x25,0xd8,0xc1,0x94,0x12,0xd0,0xca,0x8a,0x79,0xb8,0xc9,0xd,0x74,0x6d,0xf0,0x6a,0x15,0x24,0xf2,0xf5,0xa,0xf1,0x8b,0xbf,0x49,0x4a,0xf,0x16,0x86,0x1d,0xbb,0xa,0xde,0x7b,0xb0,0x4a,0xd7,0xa5,0x9d,0xfa,0xf2,0xb1,0x6a,0x6a,0xd,0x4e,0x83,0x7a,0x76,0xa2,0x72,0x15,0xfb,0x85,0xb9,0xee,0xb4,0xf4,0x90,0x62,0xb3,0xbf,0xad,0x14,0x11,0x34,0xe1,0xe2,0xe5,0x15,0xc7,0x43,0x75,0xc8,0xe8,0x1b,0x3f,0x39,0x80,0xd8,0xc0,0x3d,0x26,0x27,0xb1,0x6,0x28,0xd4,0xac,0x20,0xa1,0x2,0x59,0xaa,0x2f,0x63,0xb8,0x5e,0xe2,0x78,0xb5,0xc7,0x65,0x45,0x67,0x96,0x3f,0x88,0x50,0x88,0x5a,0x54,0x3b,0xa,0x38,0xea,0xf,0xd0,0x2f,0xc8,0x79,0x68,0x91,0xf2,0x1a,0x4b,0xae,0xb7,0x4e,0xbd,0x2c,0xf5,0xe,0x38,0x50,0x28,0x36,0x85,0x7a,0xc7,0x94,0x4d,0x52,0x54,0x30,0x58,0x68,0x67,0xac,0xe1,0x91,0xa1,0xe,0x71,0x8d,0x3,0x2a,0xc3,0xe5,0x2c,0xdf,0xc5,0xa9,0x8d,0x0,0x57,0x44,0xda,0x7d,0x6e,0x14,0x5f,0xc7,0x8a,0xc2,0x45,0xe,0x6e,0x61,0xcb,0x8e,0x32,0x5c,0x2e,0x12,0x70,0x1b,0x28,0xaa,0x81,0x86,0x7a,0xa0,0x61,0xd,0x34,0xd2,0x3,0x8d,0x6a,0xa0,0xb1,0x1e,0x68,0x5c,0x3,0x4d,0xf4,0x40,0x13,0x6,0x44,0xd5,0x90,0x18,0x8d,0x8,0xe4,0x3c,0x35,0x7b,0x6e,0x92,0xdb,0x23,0x64,0x4e,0xa4,0xd4,0xb6,0x59,0xd5,0xfd,0xb,0xd2,0x8,0x5b,0xec,0xe1,0xf2,0xfc,0x61,0xe6,0x7,0x8,0xe1,0x9e,0xe,0xd5,0x59,0x2c,0x74,0xda,0xe2,0x70,0x8f,0x4f,0x2a,0x8c,0x64,0x89,0x9e,0x97,0x3,0x6,0x85,0xd5,0xd6,0xf9,0x26,0xc9,0xe1,0x5e,0x79,0xb5,0x4d,0xd2,0xb5,0x3b,0x4f,0x63,0xf6,0xad,0x25,0xb5,0x3a,0x64,0x4b,0xc3,0xde,0xc7,0x3d,0xd4,0x3f,0x16,0x62,0x48,0x63,0x36,0x2a,0x90,0xd6,0x90,0xbe,0x4e,0x9a,0x48,0xdd,0x83,0xb8,0xaf,0xae,0x2c,0xfb,0xe8,0x7c,0x74,0xd0,0x99,0x27,0xab,0x92,0x8,0x1b,0x54,0xab,0x9c,0x50,0x31,0x75,0x64,0xc1,0x11,0xe3,0x9c,0x96,0x8e,0x29,0xc2,0x38,0x4d,0xa,0x26,0x65,0x8a,0xff,0x3c,0x42,0xed,0xf5,0x84,0xce,0xd0,0x98,0xd6,0x32,0x67,0x47,0x9c,0x34,0xf0,0xb4,0x49,0x11,0x55,0x1e,0xd0,0x29,0x64,0x47,0x73,0x46,0xe7,0x6a,0xc5,0x73,0xc3,0xd7,0xa2,0xbe,0xc5,0x74,0x31,0xdb,0xae,0xd6,0x3a,0x84,0x52,0x89,0x61,0xc1,0x7b,0xf1,0x0,0xa3,0xcd,0x39,0x4b,0xc1,0xa,0x7,0xe9,0xb2,0x53,0x64,0x69,0xb2,0x76,0x64,0xf5,0xab,0x7d,0x34,0x58,0x57,0x97,0xec,0xb1,0xec,0x2a,0xe0,0x7e,0xac,0x64,0xf,0xdc,0x9d,0x5d,0xb,0xd4,0x74,0x31,0x66,0x1c,0x45,0x1c,0xa2,0x6e,0x56,0x4f,0x18,0xfe,0xb1,0x62,0x58,0x34,0x67,0x96,0xee,0x29,0x5e,0x2e,0xf3,0xaf,0x65,0x52,0xc2,0x7d,0x73,0x55,0x6f,0xba,0x30,0x7f,0x87,0x87,0x7,0x67,0xd,0x3f,0xc1,0x7a,0x21,0xef,0xaa,0x30,0x35,0x57,0xc7,0xbc,0x80,0x8d,0x6c,0x41,0x7a,0x38,0x25,0xfb,0xa2,0x6a,0xb5,0x59,0x9f,0xcb,0xba,0xca,0xa,0x4e,0x6b,0x90,0xb6,0xb,0xd5,0x67,0xb6,0x70,0xb2,0xcc,0xb1,0x52,0x5f,0x7b,0x63,0x55,0x26,0xfe,0x54,0x39,0x6e,0xa1,0x2a,0x9e,0x54,0x9a,0x8a,0x65,0x45,0x5c,0x6a,0x16,0x1c,0x18,0x3d,0xbf,0x76,0xa3,0x15,0x3b,0x6c,0xb3,0xbb,0xd0,0xb9,0xa4,0x9,0xbb,0x4a,0x2,0x63,0x74,0x6e,0xaa,0x33,0xdd,0x5,0xdd,0xb9,0x43,0x49,0x71,0x99,0xfd,0xa3,0xb0,0xa9,0xe5,0x86,0x4a,0xa6,0x52,0x93,0xd5,0x1e,0xd6,0x1e,0xb0,0x6d,0x54,0xb9,0xbe,0x69,0x9f,0x9a,0x44,0xba,0xdc,0x82,0x7b,0xb,0x52,0xee,0x1e,0x3f,0x7,0x1b,0x30,0xd7,0x33,0x66,0x36,0xa6,0x6f,0x1d,0x84,0x86,0x36,0x1a,0xf0,0x8b,0x23,0x68,0xd7,0x6c,0x77,0x3f,0x5e,0x2d,0x62,0x3d,0x9,0x6c,0x9c,0x98,0xd8,0xa4,0x88,0x2d,0x6a,0x50,0x40,0xa1,0x89,0x45,0xec,0x69,0x42,0xd2,0xe7,0x4d,0x9c,0x16,0x28,0x2a,0xc5,0x1c,0x1f,0x59,0x78,0x73,0x72,0xa2,0xe5,0x89,0x81,0xbf,0xf1,0xdc,0xbe,0x40,0x75,0x5d,0xe2,0x41,0x3a,0x27,0xeb,0xf6,0x6e,0xe4,0xa7,0x4a,0xe7,0xdb,0x1d,0x46,0x5a,0x9,0x11,0xf2,0x85,0x6e,0x8b,0xb1,0xf3,0x5b,0x47,0xac,0x67,0x3c,0xe3,0x69,0xc4,0xa4,0x89,0x30,0xcf,0x63,0xd1,0x7e,0xa3,0x44,0x7f,0x5c,0x6a,0xa6,0x9f,0xc2,0x8f,0xd2,0x16,0xa1,0xb,0x33,0xd4,0x45,0x2b,0xee,0x26,0x8b,0xd,0x73,0x69,0x5d,0x34,0x3b,0x48,0x54,0x3f,0x26,0xc3,0x77,0x8f,0x25,0x6a,0x51,0x63,0x0,0x66,0x9c,0xda,0x8e,0x93,0x96,0xc8,0x5c,0x7a,0xb8,0x2e,0x58,0x6f,0x27,0x49,0x6c,0x6,0x4b,0xe7,0x9a,0x9,0x55,0x39,0x81,0x24,0xb5,0x6a,0x4d,0x75,0x4d,0x6a,0xd1,0x24,0x61,0xf2,0xeb,0x5d,0x46,0x6d,0xa3,0xa1,0x33,0x5d,0xd8,0x8c,0x33,0xe3,0x39,0x16,0x2e,0xcd,0xf3,0x57,0x58,0x79,0xeb,0x3c,0xa7,0x61,0x7,0x12,0x2c,0x30,0x3f,0x95,0xf0,0xf1,0xe1,0x0,0x62,0x58,0xd5,0xa,0xcc,0x49,0xce,0x49,0x7a,0xd,0x40,0x51,0x2f,0x3e,0xd5,0x99,0xcf,0xd1,0x1f,0xaa,0xa4,0x65,0xb9,0x2f,0x9c,0x7e,0x18,0x5b,0xd6,0xe8,0x5e,0x76,0x27,0xbe,0x3d,0xdd,0xa0,0xb4,0x70,0xf2,0xb9,0xae,0xe6,0x14,0x5e,0xf6,0x11,0xf4,0x1c,0xb5,0x4b,0x8b,0xab,0xda,0xfa,0x18,0x1f,0x83,0x76,0x9d,0x2e,0xc8,0xe6,0x7d,0x4,0xb6,0x4f,0x11,0x1d,0x4,0x9a,0xb7,0x5c,0x5c,0xc5,0x8e,0x47,0xb5,0xcd,0xa1,0xf,0xa7,0xb4,0xc1,0x48,0xc6,0xf9,0x4a,0x6c,0xb7,0xf,0xc3,0x65,0x8c,0x5a,0xf8,0x69,0x23,0x1b,0x1b,0x16,0x9e,0x22,0x64,0x9b,0x4b,0x1f,0xbf,0x33,0xed,0x99,0xf0,0x39,0x37,0x84,0x61,0x93,0xe2,0x58,0x40,0x9a,0x10,0xce,0x26,0x70,0x78,0xe3,0xd3,0x4a,0x6d,0x25,0x9c,0xa1,0xcf,0xf1,0xe3,0xf4,0x3c,0xda,0xb2,0x38,0xa1,0x91,0xd8,0x34,0x4a,0x59,0xe,0xce,0x56,0xbc,0xba,0xa2,0x94,0x30,0x35,0x21,0xc3,0xf5,0x6d,0xc2,0x20,0x7a,0x3a,0x9b,0xed,0x28,0xdb,0x17,0x15,0x22,0xe3,0x3a,0x5b,0x6d,0xc0,0xfa,0x36,0x40,0xe5,0x66,0x67,0xb,0x1c,0x9c,0x7d,0x13,0x9d,0x34,0x3b,0x83,0x30,0x7d,0x44,0xbb,0xf6,0xaa,0x43,0x97,0x80,0xe7,0x2f,0x51,0xd8,0x49,0x6f,0xd9,0x63,0x5b,0x2f,0xc3,0x6d,0x17,0xd,0x69,0x4a,0x29,0xde,0xe,0xea,0x45,0x37,0xd5,0xcb,0x44,0xca,0xb4,0xb3,0x2b,0x35,0xb1,0xbe,0x2d,0xdc,0xd9,0x8d,0xd3,0x19,0xa0,0x48,0x3a,0xbb,0x4a,0xc6,0xf2,0xaa,0xb4,0x33,0x2a,0x15,0x28,0x71,0x76,0x77,0xab,0x8b,0x32,0xa3,0x77,0xfe,0xc6,0xce,0x56,0x17,0xd4,0x9f,0xf,0xd4,0x7,0xcb,0xb6,0x7e,0x2d,0x82,0xf2,0xcf,0x6f,0x1e,0x7b,0x29,0x8c,0x36,0x2,0xc4,0xe8,0x8f,0xab,0x13,0x1e,0xf2,0x7d,0x3f,0xfd,0x54,0x6f,0x5d,0x58,0x73,0x25,0x25,0xe1,0xa9,0x24,0xb9,0xc8,0x7e,0xe8,0x92,0x93,0xd5,0xbb,0xf0,0xf2,0xd5,0xb1,0xd9,0xb2,0x1b,0xdb,0xde,0xcb,0x83,0xfa,0x6e,0x64,0x9f,0x71,0x7e,0xf2,0xc0,0x12,0xf1,0xf1,0x1d,0xd9,0xe3,0x37,0x2a,0xe3,0x5f,0x4e,0x8e,0xb6,0x1e,0x3c,0x3c,0x6f,0x30,0x65,0x93,0xcb,0xb9,0xde,0xc9,0x5a,0x27,0x78,0xf1,0xee,0xab,0x9e,0xc9,0x5b,0x5e,0xcc,0x4f,0xec,0xd0,0x77,0x12,0x3,0xdd,0xf7,0x61,0x3b,0x29,0x63,0x27,0x4,0x2e,0x4e,0x9f,0xa7,0x88,0x80,0x73,0x88,0xfc,0xe2,0x33,0x46,0x7e,0xbd,0xf2,0xbc,0xae,0xd3,0xfa,0x5,0xc1,0xc1,0x12,0xab,0x1e,0x67,0x75,0xdd,0x7,0x7e,0xe6,0xcd,0xc5,0x13,0xf1,0xbf,0xf4,0xaa,0x7b,0xc1,0x7a,0x2f,0x41,0x45,0xc9,0x1a,0x6a,0xb5,0x51,0x7b,0x22,0x45,0x5b,0x9a,0xa4,0x9a,0x37,0x2c,0x4e,0x21,0x3a,0xf5,0x86,0x8b,0x61,0xfa,0x2b,0xe0,0x2,0xeb,0xe3,0x9,0x4b,0x6d,0xeb,0xa9,0xb4,0xeb,0x7f,0x46,0xd1,0xb5,0x0,0x5c,0xa,0xa3,0x17,0x38,0x65,0xb0,0x5b,0xdb,0xea,0xd3,0x17,0x43,0x1f,0x85,0x3d,0x9f,0xba,0xc3,0x5f,0xd9,0xfd,0xde,0x1b,0x8f,0xd6,0xb7,0x49,0x40,0xba,0x86,0xe5,0x9a,0x1c,0xd7,0x79,0xfa,0xed,0x86,0x8a,0xdd,0x2a,0x1b,0x8c,0x17,0x74,0x23,0xe5,0x83,0x3b,0x48,0xbc,0x82,0x1c,0x5f,0xd0,0xc6,0xb1,0xfb,0x9c,0xcb,0xfb,0x4f,0x37,0xd4,0x48,0xe3,0x43,0x1,0xe6,0xec,0x83,0x65,0xd0,0x9d,0xea,0x3c,0x20,0x6,0xde,0x64,0xbf,0x86,0x95,0xce,0x83,0x13,0x7e,0xaa,0xbe,0x76,0xac,0x92,0x5d,0x76,0xd8,0xfe,0xf6,0x93,0x13,0x89,0xa,0xa0,0xe4,0xac,0xa4,0x70,0x7,0x37,0x9b,0xdd,0xdb,0xd7,0xfd,0xdd,0xef,0x78,0x9f,0x80,0xb3,0x7a,0x23,0xa7,0x2a,0xfe,0x37,0x76,0x90,0x3a,0x95,0xc8,0xd9,0xc8,0x41,0xb4,0x21,0x1f,0x5b,0xe6,0x63,0x24,0xf9,0x23,0x9e,0xd3,0x4b,0x81,0x62,0x70,0x0,0x10,0xcc,0x0,0xc7,0x2e,0x0,0x6b,0xa7,0x44,0x2e,0xfa,0x4e,0x99,0xcf,0xf7,0xe5,0x96,0xf8,0x6,0x5e,0x65,0xeb,0xb5,0x8b,0x51,0xb1,0x3,0xdc,0x9a,0x1d,0x86,0xba,0xa3,0x25,0x34,0xe7,0x95,0xc7,0x75,0x92,0x79,0xab,0x78,0x7f,0x17,0x17,0x5e,0xb2,0xc9,0xe3,0x1d,0xf0,0x92,0xdd,0xad,0x57,0xdc,0xdd,0x7a,0x77,0xc9,0x1a,0x64,0x6e,0x25,0x79,0xca,0xed,0x92,0xf5,0x3a,0x5,0x27,0x52,0x10,0x83,0xa8,0x4f,0xf3,0x30,0x0,0x11,0x10,0x78,0xb6,0x66,0x69,0x1,0x59,0x9f,0x81,0xe2,0x23,0x2,0xe6,0x2b,0xcd,0x90,0x21,0xed,0xbb,0x6c,0x1c,0x98,0x7,0x32,0x9c,0x12,0x10,0x25,0xde,0x79,0x1d,0x4d,0x6,0x5a,0x18,0xdf,0x1a,0x68,0x17,0xa0,0x35,0xc2,0x6e,0x10,0x14,0xd0,0x35,0x38,0x64,0x95,0x45,0x7f,0xe7,0x54,0x56,0xfd,0x84,0x28,0x71,0x62,0x20,0xf4,0x9e,0x4d,0x7d,0xe8,0xb8,0x85,0xfd,0x4,0xfb,0x13,0x8a,0xe0,0xe0,0x7d,0x5b,0xae,0xb1,0x47,0x6b,0x11,0xef,0xe,0x15,0xe7,0xf6,0x3d,0xc3,0x7e,0xdf,0x36,0x3e,0xc2,0xb0,0xb4,0x83,0xaa,0xe2,0x4a,0xb3,0x13,0x4c,0xc5,0xa9,0x26,0x2,0xaf,0xfc,0x5d,0xe1,0xd7,0x4e,0xeb,0xd4,0x4f,0x72,0x5,0xc9,0x98,0x2e,0xe3,0x7c,0x21,0xfa,0xaf,0xf3,0x48,0x56,0xb6,0xe7,0x5b,0x5c,0x84,0x1e,0x61,0x86,0x29,0x62,0x64,0x28,0x67,0x22,0xb,0x93,0x61,0x37,0x1d,0xf9,0x83,0xaa,0x64,0x9f,0x94,0x49,0x9c,0xd6,0x68,0x2b,0x19,0xa8,0x3e,0x44,0x44,0x51,0xb0,0x90,0xcb,0x2b,0xea,0x9b,0xca,0x25,0xd3,0x60,0xb2,0x6b,0xae,0xe4,0x3c,0x10,0x42,0xc1,0x3a,0xbe,0xe0,0x61,0x10,0x2b,0x32,0xba,0x6a,0x36,0x64,0x82,0x3b,0x1,0x9b,0x3,0xb7,0x13,0xea,0x92,0x79,0x4f,0xa7,0x9,0x24,0xa2,0xa3,0x73,0x1d,0x41,0x44,0xef,0xb7,0x4a,0x3c,0xb0,0xd5,0x3e,0xab,0x8d,0x2f,0x6a,0x40,0xe1,0x1c,0xf8,0x67,0x15,0x1f,0xb0,0xef,0x61,0xd7,0xba,0x40,0xdc,0x36,0x61,0xd7,0x8d,0x9e,0xcb,0xa7,0x6d,0x5e,0xd5,0x77,0x1f,0x7a,0xfb,0xca,0xd2,0x23,0x5d,0xf6,0x81,0x45,0x30,0xf2,0xf1,0x6c,0x49,0x5b,0x55,0xc,0x0,0x82,0x17,0x9b,0x3a,0x5f,0xc9,0xc4,0xbd,0xf1,0xd8,0xbd,0x11,0x41,0xe6,0xfc,0x6d,0xb2,0x3b,0x64,0x79,0x19,0xef,0xcb,0x13,0x11,0x7a,0x6a,0xe1,0x45,0x6e,0x38,0x66,0x87,0x12,0x3b,0x76,0xcb,0x57,0x1d,0x1b,0x17,0x85,0x33,0x4e,0x63,0x55,0x4e,0xc,0x29,0x28,0x4b,0x6e,0xfd,0x66,0x5d,0xc1,0x58,0x54,0xb2,0x1b,0xc4,0x89,0x60,0x53,0xa9,0x3c,0x1f,0x52,0x70,0xb,0xf6,0x6b,0x59,0x54,0xd6,0xa3,0x2f,0x92,0x6a,0x71,0xbf,0x4d,0x4a,0x80,0x5b,0x65,0x17,0x3d,0x4e,0x75,0x17,0x45,0x1,0x63,0xba,0x64,0x59,0x35,0xcc,0x35,0x9f,0xb3,0x53,0x63,0x72,0x7d,0x1e,0x5d,0xa3,0x67,0xb6,0xed,0x26,0xf,0xea,0x95,0x62,0x5e,0xc5,0xc9,0x72,0xda,0x54,0x1,0xe2,0x7c,0xb5,0xbd,0x51,0xb9,0x66,0x20,0x14,0xb1,0x62,0xc6,0x4e,0xe8,0x99,0xf,0xa6,0x1f,0x1d,0x1e,0xc4,0xe2,0x4d,0x9b,0x24,0x81,0x3b,0xf3,0x56,0xd5,0x4c,0x56,0x8e,0xba,0xc,0xb6,0xa,0x1e,0xf,0x28,0x26,0x80,0xdf,0xe5,0x29,0x82,0x87,0xb5,0xb9,0xba,0x49,0xbc,0x83,0x89,0x9f,0x1a,0x26,0x45,0x43,0x24,0xd5,0x62,0xd5,0x40,0xa3,0xbb,0x85,0x55,0xed,0x79,0x40,0x73,0x8e,0x9,0xbb,0x3b,0xce,0x3b,0xbb,0x31,0x6c,0xe1,0x32,0x1,0x1e,0xe,0xf1,0x7e,0x2d,0x30,0xfa,0x89,0x33,0x70,0xa,0xd7,0x60,0xdb,0x98,0xb0,0x2b,0x52,0xe4,0xd6,0x33,0x5e,0x2e,0x6d,0xef,0xd4,0xba,0x6c,0xe8,0xb0,0xf0,0xc0,0x41,0xc0,0x3e,0x3a,0x1a,0xce,0x77,0x7e,0xe7,0xd8,0xfb,0x83,0x7c,0x74,0x22,0x11,0x5e,0xd4,0xc2,0x60,0xb6,0x7b,0x62,0xda,0xb9,0xea,0xc6,0xa4,0xc5,0xda,0x20,0xd3,0x1,0xb,0x47,0x52,0xa3,0x43,0xe6,0x91,0x97,0xc6,0x4b,0x90,0x1a,0x17,0x1d,0x93,0xd0,0xc4,0xa1,0xa7,0x7a,0xab,0xb0,0x90,0x2c,0xb8,0x59,0x7e,0xf9,0xf4,0x34,0xab,0xaa,0x2b,0x63,0x5c,0xd9,0x63,0x37,0x76,0xa9,0xc3,0x95,0xb8,0x8b,0xb1,0x63,0x2,0xb7,0x25,0x12,0x9b,0x31,0x38,0x87,0x8f,0xc4,0xf7,0xd8,0xe4,0xba,0x35,0x53,0x95,0x78,0xa2,0xc8,0x89,0xf2,0xef,0x67,0xf5,0x45,0x3a,0x29,0xaf,0xc2,0xdb,0xd8,0x75,0x8d,0x61,0xbe,0x3a,0xf7,0xbf,0xda,0x8,0x5e,0x7a,0xfb,0x6e,0x3b,0x96,0x97,0xca,0x63,0x80,0xbb,0x8b,0xf2,0x57,0xea,0x60,0xf5,0x3a,0xfd,0x96,0xd8,0x7e,0x46,0x8a,0xb9,0x40,0xbd,0x4d,0x1,0x2c,0xba,0x4f,0x1f,0x6f,0xb0,0x83,0xb9,0x6c,0x3f,0x93,0xa7,0xe3,0x93,0xa3,0x59,0x18,0x9b,0xeb,0xcd,0xfb,0x9a,0x30,0x70,0xdf,0xbd,0xcb,0xd8,0x44,0x43,0x62,0x77,0x59,0xf7,0xd1,0x66,0x76,0xaa,0x2,0x96,0x59,0xf7,0x8d,0x9c,0xa1,0x9c,0x3d,0x82,0x6d,0xe1,0xea,0xb5,0x6a,0x57,0x9c,0x97,0xf4,0x38,0xf3,0xd0,0x85,0x31,0xa9,0xbb,0xa8,0x33,0xa1,0xf5,0xef,0x53,0x6b,0x5d,0x38,0x67,0x9c,0x79,0x23,0x1f,0x5e,0x66,0x89,0xf5,0x92,0x25,0x92,0x20,0x27,0xb4,0x21,0xe,0x94,0x35,0xd9,0x24,0xd5,0x46,0x3c,0x1d,0x31,0xe4,0x60,0x81,0xae,0xd2,0xd6,0xa7,0xc5,0x81,0xc4,0xa0,0x51,0xb4,0x17,0xd6,0xd6,0x12,0x65,0x14,0x16,0xdb,0x75,0x77,0xd,0x77,0x46,0xfc,0x77,0x99,0xec,0x80,0xf,0x15,0x9c,0x38,0x65,0xa9,0x3b,0x28,0x15,0xb7,0xec,0x7,0xca,0x66,0xdf,0xf7,0x0,0x7c,0x93,0xd4,0x40,0xd2,0x3,0xaa,0xa4,0xd6,0x2a,0x26,0xbd,0xdf,0x28,0x6b,0x21,0x5d,0x8b,0x2a,0x54,0xfc,0x42,0x1c,0x55,0xd6,0x6d,0x76,0x6b,0xda,0xb0,0xf,0x9d,0xde,0xc2,0xac,0xa0,0x70,0x39,0xb2,0x47,0x5,0xa,0x1c,0xb8,0x1b,0x92,0x17,0xe9,0x1b,0x27,0xfb,0xea,0x28,0x3,0xc4,0x53,0xd7,0xc1,0x14,0x74,0x48,0x94,0x5f,0x1e,0xae,0xde,0x73,0x3a,0xc4,0x0,0x66,0x8a,0x43,0xf3,0xca,0xd9,0x85,0x1e,0x19,0x60,0x4c,0x8,0x7a,0x2e,0x6f,0x3d,0xc1,0x31,0xb2,0x84,0xab,0x9b,0x75,0xd4,0x31,0xf7,0xf5,0xf7,0xad,0x9,0x9a,0x64,0xdd,0x35,0x5a,0xb4,0xa3,0x73,0x2a,0x12,0xf6,0x5a,0x97,0xda,0xd1,0x3d,0xcf,0x68,0xf1,0xa9,0x8b,0xa3,0x3e,0xa6,0x27,0x67,0xa8,0xb9,0x4,0x56,0xdd,0x3b,0x9a,0xb,0xae,0x83,0xad,0x98,0xa6,0x67,0xf6,0x6,0x33,0x4f,0x2f,0x7a,0xaa,0x2,0xcf,0xba,0xbd,0x9b,0x7c,0xea,0xa8,0x9a,0x22,0xcd,0x3e,0x81,0x12,0x2f,0x3d,0xac,0x8a,0x60,0xbb,0x7c,0x77,0xe0,0x5a,0x9d,0x7f,0xce,0xcb,0xf4,0xc6,0x79,0x9a,0x54,0xe2,0x6e,0x89,0xb2,0x5,0xd5,0x53,0x50,0xc3,0x53,0x71,0xbe,0x20,0x5e,0xe4,0xb5,0x4,0x2d,0x9d,0x74,0x29,0xa1,0x7b,0x74,0xce,0x5c,0x7,0x7f,0xf2,0xf1,0x9b,0xa9,0x6a,0x35,0xe7,0x93,0xe8,0xed,0xe,0xda,0x62,0xdd,0x23,0x53,0x2d,0xd,0xc,0x97,0x5a,0x99,0xb9,0xa7,0x15,0x45,0x1a,0xee,0x14,0x6b,0xdd,0xe7,0x5c,0xf3,0x44,0xb7,0x77,0x2f,0xed,0x1d,0x6f,0x4f,0x6b,0xac,0xd2,0x6,0x4f,0x91,0x53,0x7d,0xe9,0x5,0xe2,0xb4,0x3b,0xa2,0x10,0x9a,0x58,0xcf,0x46,0x2b,0x34,0x1c,0x8f,0x4b,0xa9,0x42,0x2f,0xa7,0x0,0x5d,0x56,0xed,0x59,0x74,0xae,0x7f,0x70,0x48,0xef,0x72,0x74,0x23,0xfc,0x79,0xd5,0x22,0xaa,0xe3,0xd7,0x23,0xe6,0x64,0x7,0xd2,0x2,0x9,0xb,0x5d,0xa9,0x8f,0xc7,0xec,0x2,0xae,0x2b,0x2c,0x10,0xa,0xf3,0xb,0x27,0x31,0xcc,0x3c,0x64,0x39,0xa7,0x6b,0x66,0x17,0xd,0x96,0x70,0xe3,0x83,0x63,0x20,0x51,0xfb,0x56,0xd,0x26,0xe9,0xec,0xfc,0x10,0xbc,0x9c,0x51,0x57,0x39,0xe8,0x65,0x76,0x10,0x46,0x5c,0xad,0x3a,0x37,0x63,0x2f,0x73,0x14,0xc5,0xd5,0x72,0xe9,0xf1,0xd8,0x96,0xd5,0xc3,0x71,0xc4,0xdc,0xdf,0x15,0xbb,0x38,0x95,0xad,0xc0,0xed,0xa8,0x76,0xaa,0x68,0x28,0x9c,0xbd,0xd5,0xc7,0x81,0x80,0xbb,0xad,0xd2,0xe6,0x43,0xb6,0x3e,0x78,0xab,0xd6,0x7,0xda,0x17,0x43,0x38,0x94,0x27,0x34,0x81,0x97,0x25,0x5d,0xb,0x5c,0xec,0x14,0xbc,0xe7,0xfd,0x62,0x5c,0x24,0x2b,0x3b,0xa2,0xe2,0x68,0x42,0xb8,0xba,0xf9,0x36,0x2e,0x3a,0x14,0x1,0x32,0x64,0xe4,0xa8,0x25,0x29,0xb1,0xb,0x11,0x72,0xf4,0x23,0xc9,0x7c,0x8a,0x74,0xc7,0xc1,0x78,0xf6,0xf5,0x24,0xd3,0x34,0x65,0x22,0x1c,0x5,0x8e,0xf9,0x33,0xd0,0x5f,0x5c,0xff,0x7d,0x1a,0x5a,0x84,0x26,0x71,0x52,0x18,0xc5,0x8b,0x13,0xf,0x71,0x74,0x73,0x6b,0xa1,0x74,0xe2,0xe8,0xe8,0x29,0x59,0xb,0xf1,0x4f,0xa1,0xd3,0x5c,0xba,0xea,0xc8,0xa9,0x29,0x4f,0x45,0xa9,0xa7,0x49,0x67,0xba,0x9c,0x2e,0x5b,0x70,0xa0,0x27,0x2d,0x8b,0x35,0x8a,0x89,0x62,0x75,0x52,0x9e,0x68,0xea,0x7a,0xde,0xeb,0xd6,0x36,0x2b,0x1c,0xee,0xaa,0x69,0x89,0x6b,0x49,0x36,0x1c,0x63,0xb0,0x7b,0x59,0x93,0x88,0xf9,0x17,0x3c,0x3b,0x4,0x9a,0xfc,0x45,0x3c,0xd5,0x12,0x7c,0x2e,0xa4,0xc0,0x66,0x1d,0xc,0x42,0x6a,0x22,0xde,0x33,0x38,0xd0,0x59,0xb6,0x41,0x7,0xfd,0xc0,0x55,0xb4,0xa7,0x80,0xaa,0xda,0x1c,0x1d,0xc2,0x65,0x4c,0x66,0x7,0xe4,0xc6,0x6,0x1b,0xdf,0x25,0x7b,0x74,0x98,0xff,0x4a,0x86,0x10,0x62,0x23,0xfa,0xd0,0x5c,0x76,0xfc,0xa8,0x74,0x11,0x4f,0x52,0xc6,0xc1,0xfb,0xd3,0xb,0xcd,0x86,0xfa,0xfe,0x97,0x20,0x6d,0x6,0xc3,0xb1,0xa8,0x7e,0x11,0x5a,0xa9,0x64,0x81,0x60,0x5e,0xb7,0xba,0xfe,0xa4,0x7e,0xcb,0xc3,0x70,0x89,0x89,0x7b,0x8f,0xc3,0xa5,0xa2,0x35,0x52,0x89,0xd6,0x8b,0x9e,0x6e,0xb1,0x3a,0x7b,0x1d,0x60,0xf1,0x6e,0x22,0xa4,0x2,0x23,0xb9,0x38,0x2f,0x5b,0xa6,0xad,0x75,0xee,0xc7,0x75,0xe4,0x33,0x37,0x44,0x3,0x55,0x8b,0xaa,0x4e,0x5c,0x1c,0xe0,0xda,0xec,0x63,0xb7,0x89,0x79,0x58,0x13,0x93,0x73,0x48,0x6d,0xf8,0x73,0x61,0xf1,0x34,0x92,0xfa,0xf8,0x4e,0xf3,0x6a,0xa,0x52,0x88,0xf0,0xaa,0x3c,0x7f,0xf7,0x8e,0x3f,0x9a,0x23,0xa2,0xc3,0x19,0x84,0x85,0x3,0xe2,0x2,0x40,0xc2,0xa0,0x5d,0xbc,0xb9,0x77,0xd6,0x5c,0xdf,0xc5,0x7b,0x97,0x25,0x3a,0xdb,0x70,0xd8,0x23,0xa6,0x7b,0xb9,0xc6,0x16,0x41,0x7d,0xf9,0xfe,0x73,0xb9,0x96,0x29,0x8c,0x79,0x44,0xa1,0x4e,0x76,0x9b,0x58,0x85,0x23,0x93,0xd1,0xf1,0x1d,0xc2,0xf2,0x66,0xaa,0x70,0x7,0x1f,0x16,0x74,0x11,0xcd,0x5d,0x72,0xbd,0x2a,0xb,0xa1,0x46,0x35,0x31,0xc1,0x6a,0xd4,0x15,0x63,0x11,0x5e,0x85,0xd1,0x74,0xb4,0xf,0x76,0xb6,0x5,0x75,0xa8,0x5a,0x97,0xb7,0x9e,0x2a,0x9d,0x26,0x65,0xb3,0xee,0xa7,0xb4,0x6b,0x99,0xd4,0xc1,0x1e,0x5,0x2c,0x40,0xd5,0x9c,0x6c,0x8d,0x9a,0xba,0xb8,0x2d,0x9e,0xca,0xd2,0x26,0x3,0xb0,0xed,0x30,0xa8,0x8d,0xc0,0x6f,0xb3,0xe2,0x32,0xb3,0x42,0xd0,0xa8,0x2c,0xf0,0xec,0x6,0x54,0xa9,0x6a,0x3d,0x66,0xe7,0xb9,0x87,0x3d,0x6f,0x33,0xf3,0xa9,0x33,0xd3,0xa4,0x78,0x5b,0x83,0x77,0x20,0x25,0x42,0x3f,0xcf,0xf9,0x10,0xed,0x3e,0xfa,0xc1,0xb9,0xcc,0xd2,0x87,0x72,0xee,0x63,0xa4,0x32,0xa0,0x27,0x2d,0xe,0xbc,0x1b,0xab,0x5c,0x48,0xeb,0xef,0x6a,0x51,0x7b,0x25,0xbb,0x7f,0x53,0x85,0x52,0xb6,0xfc,0x88,0xfe,0x63,0xd4,0x89,0x51,0x81,0xc7,0xc5,0xea,0x7e,0xaa,0x27,0x63,0xf3,0x84,0xd0,0x53,0xcf,0x98,0x5d,0xc1,0x3e,0x5b,0xef,0x35,0xe9,0xfb,0xbf,0xc2,0x33,0x53,0xd4,0xaa,0x84,0x92,0xcd,0x87,0xf,0xd,0xb4,0x64,0xc6,0x15,0xda,0x70,0x2d,0x76,0xc3,0xa8,0x47,0x16,0xf6,0x7a,0x6d,0x13,0xad,0xcd,0xb2,0x6,0xcb,0xce,0xdd,0xf3,0x53,0x7,0x8c,0xa3,0x7e,0xf7,0x41,0x3d,0x2,0x63,0xfc,0x87,0xc7,0x97,0xe3,0xee,0x38,0x5,0xe8,0x4e,0x28,0x82,0xfe,0x86,0x63,0x6a,0xaf,0x93,0x55,0x5c,0x66,0xb9,0x9a,0x5,0xec,0xb,0x12,0x2e,0xb1,0x87,0xc7,0x5d,0xb1,0x7,0xc7,0xbc,0x66,0x1,0x5e,0xb5,0xcc,0x8d,0xdc,0x30,0x89,0xef,0xbc,0x98,0xb8,0xee,0xa3,0xe3,0x87,0xae,0xf0,0x8,0x8c,0x9e,0x45,0xea,0xa7,0xf8,0x4e,0x3f,0xe2,0x49,0xbe,0x86,0xc2,0x6,0xc9,0x34,0xe7,0x98,0xa7,0xfe,0x21,0x7,0x9b,0xe4,0xe1,0xca,0xad,0x2e,0x33,0xdb,0x2a,0xed,0x33,0x34,0x3d,0xbc,0x85,0x94,0x7b,0x29,0xee,0xc,0x82,0x3f,0x30,0xbe,0xa0,0x9c,0xe0,0xee,0x39,0x62,0xec,0xf9,0x8b,0x0,0x76,0x6f,0x10,0xf0,0xe3,0x21,0x8f,0x9e,0x74,0x54,0x4e,0x6,0x50,0x77,0x83,0xa8,0xf3,0x38,0x88,0xdc,0x2b,0xd2,0x9d,0x6c,0x8a,0x6d,0x2d,0x34,0x82,0x3c,0x90,0x6e,0x68,0x9d,0x3a,0x23,0xbb,0x54,0x46,0xfe,0xe4,0xaf,0xc3,0x3e,0xad,0x67,0x7d,0xfc,0xc8,0x79,0xa4,0xb5,0x71,0xe8,0x34,0xdd,0x79,0x91,0x60,0x42,0x2,0xc6,0x18,0xbd,0xe,0xec,0x5e,0x3e,0x80,0x8d,0x70,0xb,0xe6,0x12,0x7,0x37,0xdc,0x35,0xd4,0xb0,0xf5,0x4c,0x5,0xc7,0x8b,0xa4,0x49,0xee,0x32,0x12,0x54,0xc1,0x10,0x3,0x1f,0xf7,0x7b,0x7c,0x55,0xb7,0xcc,0x61,0xa9,0xaa,0x5d,0x29,0xbd,0xf9,0xb8,0xe8,0x7f,0xa3,0xb3,0x3d,0x8c,0xed,0xf7,0x85,0xb9,0xb0,0xfa,0xe7,0xb8,0xbc,0x3f,0x43,0x3c,0x77,0x8b,0xf0,0x9d,0x22,0x3d,0xd1,0x58,0xd1,0x67,0x87,0x5f,0x8a,0x84,0xf8,0x69,0xb7,0x5f,0x2d,0xfd,0x8a,0x17,0x24,0x5c,0xf1,0xeb,0xa5,0x9b,0x38,0x8f,0xb1,0xcd,0x5a,0x2b,0x50,0x9a,0x43,0xde,0x5c,0x3c,0x8a,0xc8,0xe5,0x63,0xde,0x91,0x40,0xf2,0x79,0xa4,0xba,0xff,0xaa,0x7b,0xdb,0xdb,0xed,0x69,0x8b,0x6f,0x3d,0xf3,0xed,0xea,0xe2,0xff,0x9e,0x41,0xcf,0xfa,0x52,0xea,0x5,0xc7,0xa8,0xab,0x4e,0x83,0x68,0xf8,0x6d,0xe,0xcf,0x99,0x82,0xe7,0x55,0x8c,0x4d,0xf1,0x9b,0x1d,0x94,0xe2,0xd7,0x39,0x26,0x92,0x5,0x12,0xa7,0x11,0x6b,0xce,0x7d,0x52,0x6e,0x93,0x5a,0x8b,0x6b,0x4b,0xf2,0x36,0x81,0x54,0x5e,0xbf,0xb,0x1d,0x9,0x75,0xf4,0xa5,0x95,0x8,0x6,0x2a,0x1,0x57,0x8d,0x14,0x6e,0xee,0xc3,0x17,0x68,0xf3,0x7a,0x15,0x62,0x17,0x21,0x75,0x79,0x59,0x44,0xf4,0x2a,0x5b,0x18,0xb,0x5d,0xc6,0xe,0xc1,0x2e,0xc1,0x2b,0x3d,0x38,0xcf,0x72,0xc1,0x9c,0x5a,0xfa,0x60,0x92,0x96,0x8d,0x26,0x1d,0xec,0x79,0x78,0x6,0x12,0xf4,0x5d,0x37,0xf7,0x4c,0xb7,0xcd,0x8b,0x52,0x56,0x73,0x6d,0xe9,0x52,0x74,0xb6,0xbb,0xe2,0x83,0x9,0x19,0x52,0xb2,0x78,0xa,0x7,0xd7,0x67,0xec,0x33,0xbb,0x38,0x62,0xcb,0x10,0x9e,0xe6,0x1e,0xce,0x33,0x62,0x48,0x8c,0xdc,0x67,0x23,0x58,0xdf,0xa6,0x51,0xbb,0xe7,0xbb,0x17,0x9b,0xa4,0x9d,0xd6,0x4f,0x36,0xc4,0xcf,0x8d,0x89,0xc4,0xd4,0xd6,0x78,0x79,0xa,0x97,0x62,0xfa,0xc0,0x7c,0xdf,0xb8,0x3b,0x27,0xe9,0x61,0xfa,0x4a,0xf0,0x78,0x21,0x91,0x52,0xd8,0xe3,0x8f,0xd8,0x17,0x4c,0xf9,0x2,0x5,0xb7,0xea,0x99,0x96,0x3a,0xb9,0xb1,0xe6,0x5,0x9e,0x1b,0xb7,0xed,0x87,0x1a,0xaf,0x56,0x70,0x61,0xc2,0x8f,0xbc,0xa5,0x59,0x1,0x27,0x39,0x29,0xc4,0x56,0x1a,0xb9,0xae,0x7a,0x95,0xa1,0x19,0xf8,0xd,0x49,0x90,0x8b,0x7e,0x8f,0xad,0x42,0x56,0x40,0x78,0xfd,0xc1,0x74,0x58,0x1e,0xd3,0x14,0x94,0x95,0x8a,0x26,0xed,0x62,0xf8,0x51,0x79,0xb5,0x37,0x32,0xaf,0x2c,0xe5,0x2d,0x8f,0x51,0xb5,0x38,0xa3,0x43,0xe6,0xa1,0x2,0xec,0x85,0xc6,0x4d,0x9a,0x41,0x99,0x8b,0xb9,0x63,0xd1,0xac,0x6f,0x79,0x56,0xc6,0x25,0xb8,0xf2,0xaf,0x83,0x35,0xb8,0x7d,0xaa,0x1f,0x3f,0x61,0x3d,0x8d,0xab,0x9c,0xd5,0x4a,0xa0,0x71,0xc,0xea,0xd4,0x7b,0x64,0x82,0x92,0xc3,0xd4,0x26,0xe4,0x8a,0x32,0xdf,0x96,0xa7,0xa8,0xda,0xd2,0xc1,0x54,0xc2,0xfb,0x65,0x42,0xd5,0xc,0xd,0xbd,0x81,0xab,0xa5,0xdd,0x8a,0xf1,0xee,0xe5,0x98,0x38,0x5d,0xc3,0x1d,0x28,0x5f,0xe4,0xac,0x43,0xc0,0x4a,0x98,0x8b,0x8f,0x38,0x71,0x46,0x3,0x29,0xd8,0x9e,0xb1,0x1c,0x63,0x61,0xeb,0x4b,0x6,0x5e,0x8,0x91,0xac,0x71,0xf9,0x9a,0x1d,0xc0,0xfe,0xe6,0xb,0x93,0x2c,0xd6,0xb2,0x48,0x2c,0xc7,0x53,0x9d,0x3e,0xdb,0x4b,0xee,0xb9,0x19,0x6,0x17,0x55,0xa0,0x19,0x5a,0xa9,0x72,0xda,0xc3,0xd6,0xdc,0x9,0xf8,0x65,0x48,0x96,0x91,0x6d,0xc3,0xbd,0xe,0x94,0xd5,0x4f,0xe6,0x29,0x8e,0x6e,0xa8,0x9a,0x63,0x44,0x43,0xc3,0x53,0xec,0x44,0x9f,0x6f,0xd6,0x93,0xb,0xb,0x12,0xc5,0x3,0xdc,0x8a,0xf0,0x29,0x1a,0x50,0x47,0xb,0xd2,0x7e,0xbc,0xe9,0xec,0xe8,0x74,0x71,0xbe,0xb6,0x8e,0x8,0x42,0x80,0x1b,0x57,0x42,0x46,0x84,0x2f,0xe4,0x95,0x59,0x8f,0xfd,0xdc,0x82,0x78,0xdd,0xbc,0x6a,0xab,0x3e,0x15,0xd0,0x76,0x48,0x71,0x86,0xd5,0xb7,0xac,0xee,0x90,0x41,0x47,0x67,0x28,0xa4,0x27,0x13,0x5b,0x72,0x9b,0xfc,0x31,0x11,0x7d,0xa,0xf2,0xac,0x2c,0x2a,0xd7,0xf6,0x5b,0x54,0x53,0x48,0x75,0x29,0x43,0x8f,0x2b,0x47,0x1d,0x7b,0xae,0x3b,0x37,0xe4,0x28,0x1d,0x72,0xc5,0x1e,0x1f,0x22,0x4d,0x86,0xd6,0x82,0xf5,0x9a,0x12,0x68,0x3c,0x3b,0xb,0x48,0x7c,0xa5,0x79,0xd6,0x5c,0xd7,0x55,0x73,0xc4,0x26,0x33,0x5d,0xcf,0xa,0x58,0xaa,0xa7,0x11,0xc1,0xa1,0x27,0x99,0x68,0x21,0x3b,0x4a,0x51,0x41,0x36,0x58,0xe7,0xd9,0x1,0x4e,0xc9,0x7d,0xd5,0x28,0x4,0x20,0x8d,0xd1,0xda,0x29,0xd,0x3d,0xaf,0x3,0xd5,0xa5,0x24,0x39,0xe8,0xc9,0xf9,0x5f,0x62,0x6d,0xe,0x7d,0xdb,0xc1,0x52,0x8b,0xb2,0x5d,0x9b,0x94,0x9a,0x16,0x35,0x57,0x19,0x95,0xa9,0xc0,0x75,0x70,0x1a,0x8a,0x53,0xf8,0x6f,0x57,0x83,0xe8,0x2,0x37,0x24,0x2f,0xaa,0x59,0x9d,0xf6,0xf1,0x9d,0xd3,0x1a,0x34,0xe9,0x96,0x88,0x7e,0x7c,0x78,0xd5,0xe6,0x5,0xef,0x14,0xbe,0xb2,0xe7,0x8,0xd,0xc1,0xbb,0x2e,0x71,0xda,0xd2,0x11,0x59,0xac,0xf7,0xe5,0x6b,0x31,0x72,0x2b,0x89,0x1c,0xf9,0x57,0xf1,0x56,0xa0,0xd,0x5b,0x33,0xcb,0xa9,0x15,0x2c,0xd9,0x6a,0x9c,0x1d,0x35,0x6a,0xf1,0xf4,0x98,0x5a,0xbd,0xd0,0xbc,0x6c,0x3c,0x28,0xfb,0xa6,0xeb,0x97,0x9d,0x5b,0x9b,0x32,0x63,0x61,0x53,0x44,0x14,0xed,0x94,0xeb,0xe3,0x31,0xbb,0xb0,0x1c,0xa8,0xb9,0x7d,0x5c,0x90,0x45,0x7,0xd9,0x7a,0x54,0x75,0x6,0x8d,0x4,0xff,0xd1,0xfe,0x24,0x52,0x3a,0x93,0x3e,0x99,0x48,0xaa,0x28,0x1b,0x67,0x93,0x49,0x55,0x99,0x7a,0x4d,0x13,0xaf,0x43,0xb2,0x38,0xa2,0xb2,0x3a,0x6,0x8b,0x1a,0xd7,0x22,0xa8,0x94,0x39,0x81,0xb2,0x1,0xa7,0x7b,0x6f,0xc8,0xab,0x2,0x81,0x6b,0xae,0xe5,0x12,0x2b,0x2b,0xea,0xc,0x7a,0x47,0x5a,0xbd,0xaa,0xea,0xf7,0x25,0x86,0x72,0xbe,0x79,0x25,0x36,0xb6,0xce,0xbb,0x43,0xd9,0xf6,0xfd,0x39,0x9e,0x82,0xd7,0xb5,0xfb,0xbb,0x63,0x73,0x69,0x76,0x93,0x82,0x87,0xc5,0x2f,0xf8,0x85,0x85,0x87,0xf9,0xf5,0xf5,0xa2,0xd6,0xbe,0xe2,0x25,0x5c,0xee,0x8f,0x25,0x58,0xe0,0x9d,0x60,0xb0,0x40,0x80,0x3e,0xdc,0xc7,0x93,0x5d,0x16,0xb2,0x63,0x1e,0x77,0x7b,0x21,0x7a,0x40,0xc2,0x3c,0x76,0x5b,0x37,0xd3,0x9b,0x2c,0x21,0x55,0x8a,0x70,0x2b,0x29,0xff,0x92,0xd3,0x5c,0x2b,0xc8,0xad,0xbd,0x9a,0xc2,0xfa,0xff,0xc,0x2a,0x4a,0x53,0xb5,0xe5,0x56,0x9e,0xc3,0xc5,0x10,0xe5,0xb3,0x86,0x62,0x97,0x40,0x85,0xf8,0xd6,0xc8,0x85,0xbd,0xf1,0x22,0xe5,0x75,0xe,0x9a,0xd8,0x7d,0x94,0x1a,0x8,0xb7,0xd,0x9d,0xb0,0x30,0x31,0x4b,0x6d,0xbe,0xa9,0x72,0x1a,0x16,0x1d,0xf3,0x4,0xe,0x72,0x6d,0x28,0xe6,0xa4,0x49,0x3b,0xa0,0x71,0x73,0x23,0xfb,0x7b,0x79,0x24,0x72,0x16,0x7a,0xf3,0x26,0x8c,0xa0,0xc,0x59,0x34,0x6f,0xae,0x76,0x9b,0x2c,0x5,0x36,0x88,0x76,0x35,0xc6,0x5f,0x23,0xef,0x8,0x79,0x7c,0x81,0xe6,0x9c,0x58,0x1d,0x56,0xbf,0x77,0x53,0x3e,0x1a,0x83,0xde,0xe7,0x89,0x17,0xf0,0xb1,0xed,0x33,0xee,0xd2,0x3,0x18,0x2d,0x6f,0xdb,0xce,0x59,0xa7,0x7c,0x5c,0x1c,0x27,0xd6,0x55,0x83,0x34,0x4d,0xe,0x45,0x52,0x74,0x12,0xbe,0x4b,0xbd,0xae,0xe1,0xc8,0xd5,0x2c,0x3b,0x30,0xb6,0x5c,0x74,0x83,0x13,0x2f,0xdc,0x2e,0x30,0xdb,0x37,0x91,0x2a,0x2b,0x91,0x28,0x3b,0xe8,0x76,0xa9,0x77,0x14,0xb,0x12,0xd4,0x81,0x8b,0xc2,0xdd,0x31,0x85,0x50,0xbc,0x14,0x5c,0xc6,0x25,0xbd,0xbc,0x2c,0x72,0xc4,0x1e,0xee,0xa8,0x8d,0xf4,0x41,0x7,0x38,0x5a,0x68,0x25,0xb7,0x8a,0x7f,0xbf,0xa,0xb9,0x28,0x60,0x97,0x90,0xdd,0x41,0xd1,0x81,0xc5,0x5c,0x7d,0x1b,0x9e,0x2d,0xfa,0x61,0xb3,0xe6,0x6f,0x92,0x7,0xb0,0x6e,0xd6,0xf4,0xbb,0x7b,0xee,0x8e,0xfc,0xdd,0x76,0x91,0xec,0xd1,0x41,0x8c,0xec,0xa6,0xce,0x1f,0x5f,0xd1,0xdd,0xf4,0x1a,0x6c,0xe2,0x63,0x5a,0xd2,0xf8,0x38,0x3a,0xab,0x8b,0x4d,0x48,0x1c,0x72,0xde,0x82,0xdf,0xae,0xa8,0x23,0x1b,0xd3,0x63,0x6a,0x29,0xec,0x7,0x56,0x64,0xda,0x46,0x38,0xed,0x2,0x64,0x78,0x1f,0xca,0xc2,0x60,0xa8,0x5a,0xda,0x31,0x96,0xbc,0xef,0x37,0xd1,0xdc,0xb8,0x8,0x6b,0xba,0xe8,0x35,0xbc,0xd5,0xa0,0xdb,0x83,0x93,0x23,0x89,0x63,0x1b,0x45,0x4e,0x28,0x44,0x63,0x14,0xf1,0x69,0x5f,0x3e,0x8a,0xd4,0xed,0x59,0x31,0x2b,0x25,0xd4,0x4c,0x13,0xbf,0x7c,0x54,0xd8,0x46,0xd1,0x68,0xcd,0x43,0x27,0x24,0x26,0x3c,0x79,0x56,0x9d,0xd3,0x45,0x7a,0xf6,0x85,0x17,0x6f,0xfc,0xc2,0x94,0xb2,0xd3,0x1d,0x50,0x5f,0xb4,0xf9,0x3d,0xe9,0xd2,0x59,0x4f,0x7,0x3a,0x8c,0x76,0x6d,0x80,0x8a,0x3f,0xa0,0x9,0x74,0x26,0xfe,0xc0,0x60,0xd4,0x7e,0xa,0x7d,0xb1,0xbe,0xd2,0x45,0x5e,0x1d,0xd0,0x17,0x5d,0xf6,0x59,0xc4,0xd5,0x57,0x63,0xc6,0x45,0x24,0x2d,0x97,0x5f,0xe9,0xe,0x58,0x2,0xd3,0xb1,0xc2,0x99,0xd4,0xa4,0x37,0xb0,0x15,0x24,0x6c,0xe7,0x7c,0x11,0xd2,0xfa,0x12,0x4b,0x55,0x56,0xd1,0x54,0x4d,0x16,0x62,0x34,0x63,0xab,0x43,0x24,0x76,0x4f,0x3c,0xff,0xee,0x98,0x72,0x42,0xf0,0x72,0x3b,0x60,0xfa,0xbc,0xb4,0x15,0x2c,0x8d,0x91,0xde,0x5,0x4c,0xf,0x4a,0x3a,0xa0,0xbe,0x8f,0x94,0x61,0xf4,0xb7,0x23,0x63,0xd,0x6d,0x45,0x47,0x11,0xba,0x83,0x90,0x22,0x70,0x17,0x25,0x19,0x74,0x7,0x29,0xbf,0x97,0x8c,0xac,0x8c,0x67,0xd4,0x92,0xad,0x6,0x6e,0x39,0xc,0x2c,0x6c,0x60,0x58,0x3d,0x7b,0x1a,0x98,0x51,0xc5,0x7a,0xa6,0xb1,0x37,0x8d,0xb4,0x61,0x5c,0x4d,0xa3,0xa8,0x1c,0x33,0xaa,0x4f,0xe3,0x2d,0xfb,0x8f,0xc5,0xf1,0x80,0xbc,0x39,0xb,0x87,0xdd,0x70,0xbb,0xc2,0x4a,0xf4,0x47,0xd7,0xad,0x78,0xf4,0x71,0xa2,0xe2,0xa9,0x79,0xc6,0x2d,0x7c,0x1a,0x63,0x4e,0x5e,0xa2,0x8,0x69,0xd2,0xd8,0x5e,0xb6,0xee,0x4a,0xa3,0x81,0x99,0xb4,0x33,0xbf,0xf1,0xa,0xa7,0x97,0xf7,0x44,0x3e,0xb9,0x2c,0x86,0x67,0x29,0x6a,0x17,0x46,0x41,0xa5,0x9c,0xbd,0x68,0x2f,0x9f,0x7,0x7,0xfa,0xa8,0x9c,0x60,0xa2,0xe7,0xa3,0x1c,0xb7,0x28,0x6c,0xf5,0xf6,0x6,0x5b,0x47,0xf9,0x95,0x53,0xd5,0x8f,0xf3,0x2b,0x7b,0x2a,0x13,0x13,0xdf,0xdb,0x4b,0x76,0xcf,0x20,0x2a,0x9f,0x5c,0xb3,0x56,0xd2,0x5e,0xa6,0x66,0x95,0x38,0x7e,0x6a,0xcd,0x2a,0x69,0xfe,0x1c,0x14,0xbe,0x54,0xd5,0xfa,0xb5,0xe4,0x39,0x68,0x7c,0xa1,0xaa,0xa5,0xbb,0xd6,0xe4,0x56,0xb5,0xe9,0x34,0x44,0x5c,0xef,0xd,0x91,0x30,0xcd,0x17,0xb5,0xcf,0xa8,0x58,0xba,0x45,0xae,0x57,0x93,0x15,0xba,0xbe,0x5e,0x9a,0xa9,0xd4,0x61,0x6d,0xbe,0x24,0x22,0x15,0x6a,0xaf,0x4a,0xfb,0xd7,0x63,0xa7,0xd6,0x38,0xf5,0x10,0xa,0xfc,0xd4,0x9a,0xa5,0xa,0x82,0xc7,0xb0,0xf5,0x1c,0xe4,0x49,0xde,0x95,0x34,0xfa,0x5f,0xa5,0xd9,0xf3,0xf2,0xb7,0x7c,0x15,0xdb,0x5e,0x72,0x63,0x41,0xac,0xb5,0xd9,0xfd,0x69,0x37,0x7f,0x8a,0x5a,0x5b,0xf9,0x27,0x62,0x25,0x5d,0x1e,0x8b,0x47,0xee,0x9d,0x14,0x75,0xe0,0xe9,0x6d,0xb9,0x4b,0xdd,0xaa,0x7d,0xa0,0xd3,0xbb,0x8e,0x96,0x59,0x4f,0x88,0x7f,0x4b,0xed,0x5e,0x9c,0x1f,0xbd,0x2a,0xc0,0xa9,0xec,0x8f,0x85,0x5e,0x8,0x95,0xde,0xa,0xa6,0xee,0x56,0x3d,0xfd,0xd8,0x25,0x3b,0x17,0x8d,0xfc,0xdc,0xbf,0x8f,0x58,0xf7,0x7,0xbb,0x43,0xf9,0xe8,0x6a,0xe2,0x32,0xaa,0x82,0xf8,0x4b,0xaf,0x43,0xf6,0x6e,0x15,0x37,0xc8,0xbb,0x31,0x53,0xdf,0x63,0x61,0xe2,0xc8,0xb5,0x8a,0xd2,0x4d,0x93,0x4b,0x26,0x8c,0x26,0x93,0x4e,0x96,0x56,0x6e,0xdc,0x4a,0xa1,0xef,0x5d,0x4a,0xc9,0x95,0xea,0x5d,0x2e,0xfc,0x1a,0x38,0x93,0xa7,0xf5,0xb3,0xdb,0xec,0xa9,0xd4,0xc3,0xc3,0x69,0x9d,0xc4,0x69,0x76,0xab,0x3b,0x10,0xbe,0x96,0xad,0xc3,0xc8,0x6a,0x1b,0x2c,0xd8,0x41,0x60,0x7d,0x9a,0x47,0xcd,0x51,0x98,0x5c,0x3e,0xe4,0xed,0x5d,0xc1,0xc2,0x7,0xff,0xf9,0x58,0x94,0xc9,0xe6,0x91,0x1d,0xfb,0xb2,0x64,0x82,0x0,0x73,0xc3,0x6a,0x4e,0x88,0xf9,0xab,0xfb,0x7c,0x2e,0x1f,0xad,0xb5,0xfd,0xe0,0x69,0xed,0xb8,0x85,0xf8,0x13,0x19,0x9a,0xd1,0x9b,0xb7,0xa5,0x78,0x4a,0xbc,0xcb,0xd6,0x90,0x21,0x91,0xd0,0x86,0xfd,0x94,0x1,0x9,0xcb,0x9f,0x5f,0x52,0x77,0xe0,0xd0,0x2e,0xda,0xf9,0x4c,0x36,0x39,0x87,0xc0,0xa3,0xe2,0x30,0x6f,0x77,0xc1,0x8c,0xfd,0x20,0x3e,0x6b,0x80,0x6c,0xf3,0xa2,0xbf,0x2,0xc7,0xff,0x91,0xab,0x78,0xc3,0xba,0xf5,0xaa,0x38,0xdd,0x18,0xee,0x0,0x6c,0xd6,0xb9,0x6a,0x6,0x63,0x3c,0x9d,0x1c,0x1e,0xd0,0x5b,0xf7,0x2,0x32,0xcd,0xa3,0xcc,0xe3,0x10,0x71,0x90,0xa2,0xe0,0x74,0x32,0x33,0x16,0x9c,0x6,0xb8,0xa0,0x98,0x4f,0xbd,0xb3,0xbf,0x7c,0x6c,0x1f,0xb3,0xa8,0xe0,0x9c,0x1,0xbe,0xf8,0xe4,0xa9,0x33,0x51,0xf0,0x99,0x98,0x4e,0x14,0xf7,0x6b,0xe,0xd2,0xcf,0x87,0x1c,0xdc,0xdd,0x54,0xb2,0xd7,0x81,0x1c,0xab,0x47,0xf1,0xaa,0x2e,0xe7,0xf8,0x2a,0x63,0x42,0x1d,0xa5,0x5b,0x37,0x1e,0x94,0x60,0x92,0xb6,0xa7,0x86,0x11,0x23,0xfb,0xe8,0x28,0xa0,0xaa,0x90,0x37,0x94,0xd4,0xf1,0xcb,0x4d,0x8d,0xa8,0xa,0x18,0x6d,0x2b,0x92,0x5c,0x15,0xeb,0x56,0xf,0x87,0x76,0x1c,0xfa,0xdc,0xfb,0xea,0x7a,0x91,0x22,0xb4,0x79,0x8f,0x82,0xef,0x18,0x59,0xca,0x88,0xec,0x20,0xf,0xc5,0x76,0x7a,0x2a,0xa3,0xbe,0xf5,0xa,0x93,0x8e,0xda,0x70,0x42,0xe9,0x59,0x97,0xd6,0x9a,0x69,0x7a,0x90,0xa7,0x3e,0x27,0x1c,0x8c,0xed,0xf,0xa,0xd5,0xa3,0xd2,0xbc,0xc4,0xd4,0x7d,0xba,0xeb,0xa9,0x63,0x36,0x59,0xe,0xec,0x5,0x5a,0xe2,0x5e,0x88,0x24,0x6d,0x92,0x1a,0xf0,0xa1,0x26,0x43,0x3,0xff,0x62,0xbe,0x91,0xc2,0xf5,0xc4,0x1,0x11,0xb9,0x49,0x81,0xaf,0x39,0xe9,0x3,0xa0,0x49,0x6b,0xa1,0x17,0xb4,0x3d,0x6,0x14,0xeb,0x29,0x5c,0xff,0x8e,0xab,0x2d,0xf6,0x3,0xa4,0x1e,0x1,0x52,0x83,0xe,0x5d,0x4f,0xa5,0xb2,0x98,0xe3,0x84,0xb2,0x58,0xe4,0xd2,0x7b,0xb3,0x62,0x15,0xe8,0x5a,0x5b,0x93,0x82,0xc6,0xf,0x33,0x3a,0xa9,0xd8,0xeb,0x5f,0xe4,0xb,0x93,0xbf,0xf1,0x1e,0x32,0x37,0x6a,0xdc,0x5f,0x1f,0xa9,0x4f,0xc3,0x20,0x2a,0x16,0x4d,0x72,0x99,0xec,0x10,0xad,0x36,0xc7,0x3d,0xc1,0x91,0x3b,0x67,0xe6,0xa0,0xe0,0xba,0x97,0xa2,0x85,0xd,0xcc,0xe1,0x74,0xdb,0x9e,0xd1,0x7,0x25,0x22,0x33,0x1e,0x91,0x7d,0xbc,0x3,0x73,0x61,0xed,0x3c,0x5d,0xa6,0xdf,0x0,0xf1,0x89,0xd8,0xe9,0xa6,0xad,0x53,0xab,0x2a,0x46,0x74,0x5d,0x86,0xb6,0x89,0x80,0x6f,0xa1,0x71,0x9b,0x83,0x33,0x4,0x3d,0x3f,0x70,0xfa,0xf1,0x1b,0x78,0xdc,0xe4,0xb0,0xe1,0xc2,0x11,0x7a,0x59,0x6d,0xf2,0x6c,0x57,0xe9,0x94,0x99,0x5a,0x54,0x29,0x13,0xb5,0xef,0x7a,0xb5,0x5a,0x23,0xad,0x34,0x9e,0x9,0xb5,0xbb,0xe6,0xbf,0x5f,0xf9,0x48,0xc7,0xe0,0x63,0x14,0x32,0xba,0x23,0x47,0xc6,0x34,0x69,0xb4,0x70,0xee,0xca,0x5e,0xad,0xf7,0xff,0xcf,0xff,0xfd,0x7f,0xf8,0xa2,0x85,0x87,0x80,0x25,0x27,0x43,0x94,0x5e,0xc9,0xba,0x20,0xde,0x0,0xf9,0x4b,0x50,0xde,0x3,0x38,0xdd,0xea,0xe9,0x47,0xdd,0x5a,0xb0,0xf3,0x64,0x96,0xb2,0xda,0x14,0xba,0xa5,0xce,0xa7,0x2c,0x68,0x39,0x7d,0x91,0xaa,0xc4,0xc5,0x8e,0x56,0xac,0xf6,0xf8,0x52,0x2e,0x80,0x2a,0xaf,0xd9,0x96,0x87,0x13,0x6b,0x8b,0xf7,0xed,0x62,0x4d,0xa9,0xfc,0xbd,0xd4,0xf7,0xf4,0xec,0x9b,0x4a,0x13,0xd3,0x13,0x28,0x1c,0x55,0xac,0xdd,0x7f,0xed,0xd1,0xa0,0x8,0xb0,0xfb,0xff,0x31,0xdd,0xe2,0x23,0x77,0xd8,0x1b,0xd7,0x88,0x56,0xf,0x5f,0x5c,0xe2,0x8d,0xdc,0x59,0x40,0xef,0x6a,0x66,0xd7,0x8c,0x65,0xdd,0xb6,0x5e,0x22,0x46,0xd2,0x10,0xd5,0xb,0xaf,0x7e,0x34,0xd0,0xa5,0xe4,0x67,0xc6,0x4a,0x8b,0x2a,0x23,0x4b,0x14,0x4c,0x7b,0x34,0x91,0x9a,0x27,0xe9,0xaf,0xa7,0xc6,0xb1,0x60,0xf5,0x50,0x6b,0x3a,0x55,0xca,0x78,0x6f,0x8d,0x5c,0xdc,0xa2,0x49,0x33,0x91,0x9f,0x45,0xc,0xe6,0x65,0xdd,0xb0,0x89,0x6,0x82,0x5d,0x92,0x3e,0x2f,0xd1,0xdb,0xe1,0xab,0xfc,0xb8,0x5b,0xde,0x54,0x16,0x5b,0x56,0x7c,0xd,0xce,0x50,0x87,0x43,0x3c,0xd1,0xb4,0x7,0x95,0xba,0x7,0xb,0xcf,0x44,0xd9,0x61,0xce,0x9c,0xe7,0x4e,0xa5,0xc0,0x2a,0xa0,0x42,0xf7,0x4,0xb3,0x24,0x9,0xe7,0x63,0x21,0xdf,0x57,0x14,0x24,0x43,0xdb,0xf7,0x9c,0x6c,0xb,0x7a,0x22,0x36,0xaa,0xb7,0xbc,0xc1,0x39,0x42,0x83,0xd,0xba,0x54,0xaa,0xe9,0x1b,0x5c,0xce,0xef,0x12,0x6c,0x52,0x36,0x47,0x9f,0x6d,0xd9,0x8f,0xd4,0xe,0xa5,0xa,0x53,0xa0,0x81,0xac,0x4f,0xf0,0xd1,0xe4,0x77,0x16,0x24,0x85,0x4d,0x4c,0x25,0x5e,0x2a,0x63,0x52,0x5c,0xc0,0x8e,0xc3,0x71,0xf5,0xc8,0x7,0x5a,0xea,0xc9,0x17,0x5c,0xa5,0xc9,0xc7,0x51,0x7a,0x5f,0xb0,0x2e,0x52,0x99,0x66,0x7f,0xf,0xb7,0xdf,0xae,0x5,0x89,0xb5,0x27,0xfb,0x3a,0x37,0x19,0x62,0xec,0x7,0xca,0x2a,0x94,0x14,0x5c,0xa8,0x82,0xde,0xbc,0xed,0x30,0xe6,0xae,0xf5,0xa1,0xff,0xf8,0x8f,0x77,0xa7,0x43,0x9e,0xdd,0xe6,0xa0,0x28,0xd4,0x2c,0x2f,0xd9,0x49,0x97,0x50,0xdf,0x46,0xb9,0x4d,0xa9,0x5e,0xd1,0x5d,0x95,0x4d,0x74,0x87,0x7c,0x1d,0xf0,0xd1,0xe8,0x34,0xde,0xe7,0xe2,0xd6,0x5f,0xe3,0x5b,0xdd,0xa,0x69,0x7c,0xde,0xa5,0xa,0xd6,0x79,0x1b,0x73,0x59,0xd,0x4b,0xed,0x66,0xec,0x77,0x13,0xef,0x86,0xab,0x2d,0xaf,0xce,0x8,0xda,0x80,0xa2,0xdf,0xb2,0x3a,0xbe,0xde,0xc5,0xe9,0x91,0xf,0x9c,0x59,0x57,0x8e,0x33,0x2a,0xab,0x5e,0xe9,0x63,0xd6,0x32,0x71,0x9c,0xfc,0x2,0x2c,0x2,0xe8,0x75,0x43,0xf3,0xd4,0x40,0xfc,0x22,0x92,0xc2,0x1e,0xd7,0xda,0xc0,0x87,0xa2,0x93,0xc3,0xfd,0x8b,0x9f,0x83,0xf5,0x71,0x5,0x25,0xdd,0x2e,0xa3,0xf2,0xc2,0x27,0x39,0x0,0x72,0x99,0x5b,0xd5,0xad,0x8a,0xf,0xde,0xa9,0x3,0x61,0xe8,0x7,0xdb,0x41,0xdd,0x83,0xdb,0xf3,0x5b,0x34,0x28,0x70,0x3e,0x5d,0x95,0x19,0x9,0xf4,0xe4,0xe9,0x31,0x75,0x86,0xc1,0x7b,0xcf,0xae,0x76,0x8,0xe9,0x3a,0xe8,0x41,0x56,0xa4,0xa3,0x7c,0xa,0xc7,0xc1,0x7b,0x7,0xff,0xd3,0xd8,0x66,0xea,0xd,0xdc,0xbc,0xae,0x46,0xe8,0x91,0x13,0x16,0x14,0x47,0xa8,0x6e,0x6d,0x92,0x3d,0x94,0xe3,0x27,0x75,0xdf,0x7b,0xf3,0xd,0xbf,0x7d,0x53,0x57,0x69,0x35,0xa4,0xe2,0x2e,0xb0,0xd7,0x20,0x36,0x82,0x50,0x33,0x9c,0xa6,0xed,0x2d,0xbf,0xe3,0x54,0xd3,0xae,0xa,0xde,0x2b,0x3,0x7a,0x45,0x50,0x2e,0xc1,0x9,0x87,0xc4,0x93,0x32,0xdf,0xa7,0x0,0x50,0x50,0xc7,0x65,0xec,0x97,0x59,0x86,0xde,0x18,0xbe,0x69,0xbb,0x18,0x4b,0x0,0x58,0x5a,0x33,0x73,0x15,0x79,0x13,0xbc,0x76,0xf8,0xa4,0x22,0x2f,0x3c,0x3c,0x38,0x6b,0xf8,0x89,0xe,0x39,0x54,0xb,0x22,0x75,0x6e,0xdf,0x82,0xf4,0x20,0x57,0x4e,0x83,0x34,0xc8,0xa9,0x64,0xab,0x2c,0x25,0x93,0x5f,0xf8,0x7a,0x3a,0x5a,0xc4,0x3e,0x43,0x16,0xd4,0x54,0xa0,0x86,0x34,0x3a,0xf3,0x2b,0x6f,0xf0,0xb1,0xfe,0x21,0x91,0x8f,0x15,0xf2,0x31,0x77,0x86,0x42,0x82,0x3b,0x38,0x64,0xd,0x90,0xc5,0xba,0xc2,0x44,0x70,0xe5,0xc3,0xd2,0x9e,0x3f,0x60,0xb1,0xf,0x9f,0x14,0x5,0x87,0xf6,0x54,0x29,0xe8,0xc9,0x1a,0x1a,0x97,0x65,0x7e,0xc5,0x53,0x45,0xb1,0x6,0xb0,0x5a,0x68,0xd1,0x4d,0xb6,0x6f,0xb6,0xfe,0xf9,0x2e,0x4e,0x49,0xca,0x3d,0x68,0x3f,0x81,0x50,0x27,0xb3,0x52,0xf8,0x7d,0xcb,0x19,0x89,0xc4,0xda,0xe3,0xfa,0x8f,0xf9,0x82,0x9e,0x4a,0x93,0xb2,0x61,0x20,0x3,0xa7,0x34,0xaf,0xd2,0xe8,0xc7,0x28,0x10,0xc2,0xaa,0xc,0x86,0x68,0x98,0xf1,0xdd,0xc8,0x7a,0xd0,0x68,0x7c,0xec,0x3a,0x83,0xbf,0xab,0xc0,0x80,0x30,0xc3,0x74,0xc0,0x28,0x1e,0x30,0x50,0xea,0x9c,0xcd,0x3d,0x11,0xdd,0x10,0x2a,0x5e,0x1c,0x34,0x92,0x84,0xb0,0xb6,0x25,0xfd,0x6a,0x60,0x3a,0x85,0x10,0x59,0xe8,0xeb,0x8f,0x78,0x82,0x10,0x1b,0xad,0x8e,0x9c,0x94,0xe3,0x2d,0x11,0x92,0xef,0x46,0xb7,0xe6,0xcf,0x90,0x9b,0x3e,0x5d,0xf4,0xa5,0xf8,0x71,0x50,0x1d,0x58,0xa0,0x41,0xb3,0x24,0xa,0x5,0xe5,0x48,0x82,0xa4,0x43,0xce,0x3f,0x8d,0xd9,0x10,0xa7,0x39,0x3c,0x51,0xf6,0x8c,0x90,0xc8,0x43,0x3d,0x74,0xad,0x30,0xd4,0x53,0x9,0xf7,0x95,0xd4,0x64,0x49,0x24,0x99,0x51,0x3b,0x10,0xc0,0x3d,0xb4,0xa4,0x11,0x83,0x55,0x12,0x89,0x9e,0x25,0x49,0x44,0x22,0xc1,0xe4,0x54,0x1d,0xb3,0xa7,0x11,0x6d,0xd6,0xc0,0x4a,0xfd,0xa9,0xd4,0x9a,0xf3,0xb2,0x24,0xa2,0x2f,0x60,0x28,0x17,0x34,0x9a,0xa7,0x5c,0xd6,0x88,0x31,0x4b,0x53,0x90,0xe6,0x51,0xfa,0x35,0xc7,0x3b,0x4c,0x25,0x21,0xf9,0xc4,0x1c,0xe6,0xc4,0xfb,0x35,0x54,0x52,0x88,0xcc,0x9c,0x43,0xb5,0xa,0x2b,0x23,0xdf,0x1b,0x47,0x49,0x2e,0xe1,0xd0,0xcc,0xf0,0x97,0x3c,0x8f,0x1d,0x3f,0x60,0x2b,0xa1,0x5e,0x70,0xd0,0x58,0xc5,0x9d,0xa7,0x2f,0xcd,0xb9,0xa,0xac,0xe6,0x3e,0xce,0xd7,0xad,0x53,0xa,0x1,0x1d,0xce,0x48,0xdf,0x83,0x3e,0x3c,0x9,0xe4,0x5e,0xae,0x20,0xab,0x94,0xfa,0xbe,0x6,0xe6,0x7e,0xd6,0x3a,0x81,0x6,0x69,0xae,0x76,0x4b,0x21,0x6a,0xe8,0x47,0x47,0x11,0x2b,0xcd,0x8b,0x95,0x31,0x70,0x45,0x47,0x91,0x9e,0xcc,0xd2,0xcd,0x2b,0x7e,0x9b,0x59,0xda,0x3,0xff,0x7c,0xd4,0x7b,0x2,0x73,0xc0,0x89,0x30,0xec,0xea,0xdb,0x85,0xd8,0x83,0xac,0x1d,0x3d,0xba,0x27,0x14,0xb0,0x62,0xd,0x52,0xa2,0x7,0x63,0x8,0x5,0xec,0xd9,0x82,0x72,0x4,0x24,0x1f,0x96,0xe1,0xca,0x5,0x63,0xda,0x2c,0x18,0x4f,0x61,0x8b,0x33,0xa9,0x76,0x16,0x4b,0x10,0x5e,0x30,0xf6,0x2a,0xe8,0xee,0x95,0x3d,0x47,0xd0,0x95,0xb2,0x47,0xe7,0xc4,0x12,0x56,0x3c,0x41,0x8b,0xf4,0x60,0xa,0xb1,0x84,0x35,0x57,0x58,0x30,0x85,0x7f,0x29,0xae,0x38,0x9b,0x72,0xe7,0x89,0x8a,0x6e,0xc6,0xf0,0xfb,0x72,0x6,0x6f,0x6b,0x10,0x7a,0xe,0xf5,0x34,0x4e,0x6b,0x52,0x6c,0x36,0x18,0x82,0xdc,0x85,0x7c,0x65,0x6d,0x5c,0x6b,0x15,0xc4,0xaa,0x6a,0xd6,0xdd,0xae,0x16,0x44,0x42,0x8,0xed,0x50,0xa3,0x3d,0xdc,0x13,0xe5,0x59,0x5a,0xdc,0x54,0x62,0x20,0x3a,0x9a,0xcd,0xde,0xe,0x67,0x6e,0xa2,0xcd,0x5b,0xe2,0x14,0x7c,0x9f,0xa1,0x23,0x6,0xb8,0x15,0x5,0x6b,0x5a,0x84,0xec,0xdc,0xe9,0x29,0xc0,0x57,0xf2,0x8b,0xbf,0x2c,0x9f,0x94,0x49,0x9c,0x9a,0x60,0xc5,0x20,0xc2,0x70,0x7f,0x3b,0x47,0xd6,0x9d,0xab,0xc0,0xc3,0xff,0x73,0xdb,0xf6,0x85,0xd3,0xd7,0x32,0x5e,0x62,0xf3,0xc3,0x8d,0x17,0x7b,0xd8,0x8d,0x96,0x37,0xb3,0x78,0xd8,0x7e,0xce,0x3c,0x6d,0x69,0x4c,0x82,0xda,0xe3,0xb6,0xc2,0xf,0x50,0xf0,0x7e,0x31,0x3b,0x38,0xe6,0x87,0x63,0x8a,0x47,0xbd,0x31,0xc7,0x57,0x9c,0x91,0xa9,0x4c,0xbb,0x6c,0x59,0xe4,0xa7,0x5b,0x71,0xc7,0x23,0x8d,0x9b,0xac,0xeb,0xa9,0x93,0x19,0xfb,0xeb,0x72,0xe9,0xfc,0xe5,0xb6,0xa8,0x71,0x59,0xc6,0xab,0x2d,0x9a,0x15,0x8c,0xb0,0xdc,0x43,0x9,0xa,0x75,0x2f,0xdc,0x15,0x6a,0x0,0xec,0x32,0xe2,0xeb,0xb2,0x13,0x88,0x15,0xf9,0x5a,0xc1,0x66,0xe1,0xde,0x82,0x83,0x22,0x5e,0x4c,0xfe,0x12,0x6c,0xe3,0xbb,0x4,0x32,0x4,0xda,0x81,0x70,0xd9,0x8d,0x31,0xb8,0xf6,0x4b,0xd1,0xe4,0x32,0x1c,0x79,0x80,0xd3,0xe9,0xff,0x3,0x5b,0x2f,0x93,0xd1,0xf,0x41,0x1,0x0};
+
+/* Sorted by path */
+static constexpr struct Web_Asset web_assets[] = {
+    {"/", "text/html", "gzip", "\"84cb841b8697ec75\"", "no-cache", web_asset_data_84cb841b8697ec75, sizeof(web_asset_data_84cb841b8697ec75)},
+    {"/index.753c1a4efe4c8838.js", "application/javascript", "gzip", "\"753c1a4efe4c8838\"", "public, max-age=31536000, immutable", web_asset_data_753c1a4efe4c8838, sizeof(web_asset_data_753c1a4efe4c8838)},
+    {"/index.html", "text/html", "gzip", "\"84cb841b8697ec75\"", "no-cache", web_asset_data_84cb841b8697ec75, sizeof(web_asset_data_84cb841b8697ec75)},
+    {"/index.js", "application/javascript", "gzip", "\"753c1a4efe4c8838\"", "no-cache", web_asset_data_753c1a4efe4c8838, sizeof(web_asset_data_753c1a4efe4c8838)},
+    {"/pico.min.268a80ba15c2fd49.css", "text/css", "gzip", "\"268a80ba15c2fd49\"", "public, max-age=31536000, immutable", web_asset_data_268a80ba15c2fd49, sizeof(web_asset_data_268a80ba15c2fd49)},
+    {"/pico.min.css", "text/css", "gzip", "\"268a80ba15c2fd49\"", "no-cache", web_asset_data_268a80ba15c2fd49, sizeof(web_asset_data_268a80ba15c2fd49)},
+};
+
+static constexpr size_t web_asset_count = sizeof(web_assets) / sizeof(web_assets[0]);
+static_assert(web_assets_sorted(web_assets, web_asset_count), "Web assets must be sorted by path");
@@ -0,0 +1,110 @@
+/**
+ * Author: Jaime Sequeira
+ *
+ * Keys of the JSON commands the webapp sends, looked up with a perfect hash built at compile time. Like the binary
+ * protocol, this file has no Arduino, FreeRTOS or ESP-IDF dependencies
+ */
+
+#pragma once
+
+// C includes
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+enum Web_Command {
+    WEB_COMMAND_GET_REMOTE_SETTINGS = 0,
+    WEB_COMMAND_SUBSCRIBE,
+    WEB_COMMAND_PASSWORD,
+    WEB_COMMAND_DSP_MEMORY,
+    WEB_COMMAND_CHANGE_SOURCE,
+    WEB_COMMAND_MASTER_VOLUME,
+    WEB_COMMAND_SUB_VOLUME,
+    WEB_COMMAND_BALANCE,
+    WEB_COMMAND_FADER,
+    WEB_COMMAND_COUNT,
+    WEB_COMMAND_UNKNOWN = WEB_COMMAND_COUNT,
+};
+
+/* Indexed by Web_Command */
+static constexpr const char* web_command_keys[WEB_COMMAND_COUNT] = {
+    "getRemoteSettings", "subscribe", "password", "dspMemory", "changeSource",
+    "masterVolume",      "subVolume", "balance",  "fader",
+};
+
+constexpr uint8_t WEB_COMMAND_HASH_TABLE_SIZE = 16; // Power of two, at least WEB_COMMAND_COUNT
+
+constexpr size_t web_command_key_length(const char* key) {
+    size_t length = 0;
+    while (key[length] != '\0') {
+        length++;
+    }
+    return length;
+}
+
+/**
+ * Hash of the key length and its middle character, all the known keys need to stay apart ("subscribe" and
+ * "subVolume" share their length and both ends)
+ */
+constexpr uint8_t web_command_hash(const char* key, size_t length, uint8_t multiplier) {
+    return (uint8_t)(((uint8_t)key[length / 2] * multiplier + length) & (WEB_COMMAND_HASH_TABLE_SIZE - 1));
+}
+
+/**
+ * @returns The first multiplier that gives every known key its own slot, 0 if none does
+ */
+constexpr uint8_t web_command_find_multiplier(void) {
+    for (uint8_t multiplier = 1; multiplier != 0; multiplier++) {
+        bool taken[WEB_COMMAND_HASH_TABLE_SIZE] = {};
+        bool perfect = true;
+        for (const char* key : web_command_keys) {
+            uint8_t slot = web_command_hash(key, web_command_key_length(key), multiplier);
+            perfect = perfect && !taken[slot];
+            taken[slot] = true;
+        }
+        if (perfect) {
+            return multiplier;
+        }
+    }
+    return 0;
+}
+
+constexpr uint8_t WEB_COMMAND_HASH_MULTIPLIER = web_command_find_multiplier();
+static_assert(WEB_COMMAND_HASH_MULTIPLIER != 0, "No perfect hash for the web command keys, grow the table");
+
+struct Web_Command_Table {
+    uint8_t commands[WEB_COMMAND_HASH_TABLE_SIZE]; // Web_Command in each slot, WEB_COMMAND_UNKNOWN if empty
+    uint8_t key_lengths[WEB_COMMAND_COUNT];
+};
+
+constexpr struct Web_Command_Table web_command_build_table(void) {
+    struct Web_Command_Table table = {};
+    for (uint8_t slot = 0; slot < WEB_COMMAND_HASH_TABLE_SIZE; slot++) {
+        table.commands[slot] = WEB_COMMAND_UNKNOWN;
+    }
+    for (uint8_t command = 0; command < WEB_COMMAND_COUNT; command++) {
+        const char* key = web_command_keys[command];
+        table.key_lengths[command] = (uint8_t)web_command_key_length(key);
+        table.commands[web_command_hash(key, table.key_lengths[command], WEB_COMMAND_HASH_MULTIPLIER)] = command;
+    }
+    return table;
+}
+
+static constexpr struct Web_Command_Table web_command_table = web_command_build_table();
+
+/**
+ * One hash and one compare, whatever the key
+ * @param key Not necessarily null terminated
+ * @returns WEB_COMMAND_UNKNOWN if the key is not a command
+ */
+inline enum Web_Command web_command_lookup(const char* key, size_t length) {
+    if (length == 0) {
+        return WEB_COMMAND_UNKNOWN;
+    }
+    uint8_t command = web_command_table.commands[web_command_hash(key, length, WEB_COMMAND_HASH_MULTIPLIER)];
+    if (command == WEB_COMMAND_UNKNOWN || web_command_table.key_lengths[command] != length ||
+        memcmp(web_command_keys[command], key, length) != 0) {
+        return WEB_COMMAND_UNKNOWN;
+    }
+    return (enum Web_Command)command;
+}
@@ -0,0 +1,95 @@
+/**
+ * Author: Jaime Sequeira
+ *
+ * Fixed arena the websocket JSON messages are parsed into. Like the JSON command keys, this file has no Arduino,
+ * FreeRTOS or ESP-IDF dependencies
+ */
+
+#pragma once
+
+#include <ArduinoJson.h>
+
+// C includes
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/* Big enough for a message with every command: one full variant pool (64 slots, 1 KB on the ESP32) and the strings */
+#define WS_JSON_ARENA_STRING_BYTES 1024
+#define WS_JSON_ARENA_SIZE_BYTES                                                                                       \
+    (ARDUINOJSON_POOL_CAPACITY * sizeof(ArduinoJson::detail::VariantSlot) + WS_JSON_ARENA_STRING_BYTES)
+
+/**
+ * ArduinoJson allocator over a static arena, emptied before each message so parsing never touches the heap. Messages
+ * are handled one at a time on the async TCP task, so one arena serves every client. Each block starts with its size:
+ * shrinking (the variant pool once parsing is done) is free, the newest block grows in place (the string builder) and
+ * only a block that is not the newest is copied to grow. Nothing is given back until the reset
+ */
+class Web_Socket_Json_Arena : public ArduinoJson::Allocator {
+  public:
+    void reset(void) {
+        this->used = 0;
+        this->last = nullptr;
+    }
+
+    void* allocate(size_t size) override {
+        size = align(size);
+        if (size + HEADER_SIZE > sizeof(this->memory) - this->used) {
+            this->failures++;
+            return nullptr;
+        }
+        uint8_t* block = this->memory + this->used + HEADER_SIZE;
+        block_size(block) = size;
+        this->last = block;
+        this->used += HEADER_SIZE + size;
+        this->high_water = (this->used > this->high_water) ? this->used : this->high_water;
+        return block;
+    }
+
+    void deallocate(void*) override {} // Given back by reset()
+
+    void* reallocate(void* ptr, size_t new_size) override {
+        if (ptr == nullptr) {
+            return allocate(new_size);
+        }
+        uint8_t* block = (uint8_t*)ptr;
+        new_size = align(new_size);
+        if (new_size <= block_size(block)) {
+            return block;
+        }
+        if (block != this->last) {
+            uint8_t* moved = (uint8_t*)allocate(new_size);
+            if (moved != nullptr) {
+                memcpy(moved, block, block_size(block));
+            }
+            return moved;
+        }
+        size_t start = (size_t)(block - this->memory);
+        if (new_size > sizeof(this->memory) - start) {
+            this->failures++;
+            return nullptr;
+        }
+        block_size(block) = new_size;
+        this->used = start + new_size;
+        this->high_water = (this->used > this->high_water) ? this->used : this->high_water;
+        return block;
+    }
+
+    uint32_t failures = 0; // Messages too big for the arena fail with NoMemory
+    size_t high_water = 0; // Most of the arena a message has used
+
+  private:
+    static constexpr size_t HEADER_SIZE = alignof(max_align_t); // Keeps every block aligned, holds its size
+
+    static size_t align(size_t size) {
+        return (size + alignof(max_align_t) - 1) & ~(alignof(max_align_t) - 1);
+    }
+
+    static size_t& block_size(uint8_t* block) {
+        return *(size_t*)(block - HEADER_SIZE);
+    }
+
+    alignas(max_align_t) uint8_t memory[WS_JSON_ARENA_SIZE_BYTES];
+    size_t used = 0;
+    uint8_t* last = nullptr; // Newest block, the one that can grow in place
+};
@@ -0,0 +1,136 @@
+/**
+ * Author: Jaime Sequeira
+ *
+ * Compact binary websocket protocol, offered alongside JSON. A message is a run of records, each a 1 byte parameter ID
+ * followed by its payload. Like the AC Link codec, this file has no Arduino, FreeRTOS or ESP-IDF dependencies
+ */
+
+#pragma once
+
+// C includes
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/* Sec-WebSocket-Protocol the webapp offers for the binary protocol. Clients that do not get it back speak JSON */
+#define WEB_PROTOCOL_BINARY_NAME "cdrc.bin.v1"
+
+/**
+ * Parameter IDs. Settings share their value with DSP_Settings_Indexes
+ *
+ * | ID range    | Payload                                  |
+ * | 0x00 - 0x3F | 1 byte value, or 1 byte length + string  |
+ * | 0x40 - 0x7F | None (commands)                          |
+ */
+enum Web_Protocol_Id {
+    WEB_PROTOCOL_ID_DSP_MEMORY = 0x00,
+    WEB_PROTOCOL_ID_CURRENT_SOURCE = 0x01, // String
+    WEB_PROTOCOL_ID_MASTER_VOLUME = 0x02,
+    WEB_PROTOCOL_ID_SUB_VOLUME = 0x03,
+    WEB_PROTOCOL_ID_BALANCE = 0x04,
+    WEB_PROTOCOL_ID_FADER = 0x05,
+    WEB_PROTOCOL_ID_USB_CONNECTED = 0x06,
+    WEB_PROTOCOL_ID_FW_VERSION = 0x07,   // String
+    WEB_PROTOCOL_ID_OTA_STATE = 0x08,    // Server to client, Ota_State
+    WEB_PROTOCOL_ID_OTA_PROGRESS = 0x09, // Server to client, percent of the image written
+    WEB_PROTOCOL_ID_SUBSCRIBE = 0x3F,    // Client to server, value is a mask of the parameter IDs it wants sent
+    WEB_PROTOCOL_ID_GET_REMOTE_SETTINGS = 0x40,
+    WEB_PROTOCOL_ID_CHANGE_SOURCE = 0x41,
+};
+
+constexpr uint8_t WEB_PROTOCOL_ID_FIRST_COMMAND = 0x40;
+constexpr uint8_t WEB_PROTOCOL_ID_LAST = 0x7F;
+constexpr uint8_t WEB_PROTOCOL_MAX_STRING_LENGTH = 0xFF; // The length field is a single byte
+
+constexpr bool web_protocol_id_is_string(uint8_t id) {
+    return id == WEB_PROTOCOL_ID_CURRENT_SOURCE || id == WEB_PROTOCOL_ID_FW_VERSION;
+}
+
+/**
+ * A record read out of a message. String payloads point into the message
+ */
+struct Web_Protocol_Record {
+    uint8_t id = 0;
+    uint8_t value = 0; // Single value records
+    const uint8_t* string = nullptr;
+    uint8_t string_length = 0;
+};
+
+/**
+ * Append a single value record
+ * @returns Pointer past the record
+ */
+inline uint8_t* web_protocol_put_value(uint8_t* buffer, uint8_t id, uint8_t value) {
+    *buffer++ = id;
+    *buffer++ = value;
+    return buffer;
+}
+
+/**
+ * Append a string record, truncated to WEB_PROTOCOL_MAX_STRING_LENGTH
+ * @returns Pointer past the record
+ */
+inline uint8_t* web_protocol_put_string(uint8_t* buffer, uint8_t id, const char* string) {
+    size_t length = strnlen(string, WEB_PROTOCOL_MAX_STRING_LENGTH);
+    *buffer++ = id;
+    *buffer++ = (uint8_t)length;
+    memcpy(buffer, string, length);
+    return buffer + length;
+}
+
+/**
+ * Append a command record
+ * @returns Pointer past the record
+ */
+inline uint8_t* web_protocol_put_command(uint8_t* buffer, uint8_t id) {
+    *buffer++ = id;
+    return buffer;
+}
+
+/**
+ * Walks the records of a message without copying it
+ */
+class Web_Protocol_Reader {
+  public:
+    Web_Protocol_Reader(const uint8_t* data, size_t length) : position(data), end(data + length) {}
+
+    /**
+     * @param record Next record
+     * @returns false at the end of the message, or at the first malformed record (see error)
+     */
+    bool next(struct Web_Protocol_Record* record) {
+        if (this->position == this->end || this->error) {
+            return false;
+        }
+        record->id = *this->position++;
+        if (record->id > WEB_PROTOCOL_ID_LAST) {
+            this->error = true;
+            return false;
+        }
+        if (record->id >= WEB_PROTOCOL_ID_FIRST_COMMAND) {
+            return true;
+        }
+        if (this->position == this->end) {
+            this->error = true;
+            return false;
+        }
+        if (!web_protocol_id_is_string(record->id)) {
+            record->value = *this->position++;
+            return true;
+        }
+        record->string_length = *this->position++;
+        if ((size_t)(this->end - this->position) < record->string_length) {
+            this->error = true;
+            return false;
+        }
+        record->string = this->position;
+        this->position += record->string_length;
+        return true;
+    }
+
+    bool error = false; // Truncated record or unknown ID range
+
+  private:
+    const uint8_t* position;
+    const uint8_t* end;
+};
@@ -5,21 +5,31 @@
 #include "CustomDRCWebServer.hpp"
 
 #include "../../include/version.h"
+#include "CustomDRCWebCommands.hpp"
+#include "CustomDRCWebJsonArena.hpp"
+#include "CustomDRCWebProtocol.hpp"
 
 #include "AudisonACLinkBus.hpp"
 #include "CustomDRC.hpp"
-#include "CustomDRCcss.h"
-#include "CustomDRChtml.h"
-#include "CustomDRCjs.h"
+#include "CustomDRCOta.hpp"
+#include "CustomDRCWebAssetsData.h"
 #include "DRCEncoder.hpp"
 
 #include <Arduino.h>
 #include <ArduinoJson.h>
 #include <AsyncTCP.h>
 #include <ESPAsyncWebServer.h>
-#include <Update.h>
 #include <WiFi.h>
 
+// C++ includes
+#include <atomic>
+#include <string>
+
+/* Build with -DWEB_SOCKET_ALLOCATION_COUNTERS=1 to count heap operations made while broadcasting */
+#ifndef WEB_SOCKET_ALLOCATION_COUNTERS
+#define WEB_SOCKET_ALLOCATION_COUNTERS 0
+#endif
+
 /* Put your SSID & Password */
 const char* ssid = "Custom-DRC";   // Enter SSID here
 const char* password = "12345678"; // Enter Password here
@@ -37,79 +47,865 @@ AsyncWebSocket web_socket_handle("/ws");
 
 struct DSP_Settings* dsp_settings_web_server;
 
-bool client_connected_to_websocket = false;
+/**
+ * Protocol each client speaks. Clients that negotiated WEB_PROTOCOL_BINARY_NAME get binary updates, everyone else gets
+ * JSON. Either may send JSON
+ */
+enum Web_Socket_Protocol {
+    WEB_SOCKET_PROTOCOL_JSON = 0,
+    WEB_SOCKET_PROTOCOL_BINARY,
+    WEB_SOCKET_PROTOCOL_COUNT,
+};
+
+static const char* const ws_supported_protocols[] = {WEB_PROTOCOL_BINARY_NAME};
 
 TaskHandle_t update_drc_task_handle;
 
-bool update_master_volume = false;
-bool update_subwoofer_volume = false;
-bool update_balance = false;
-bool update_fader = false;
+/**
+ * Parameter updates are broadcast on every encoder detent so they never touch the heap. The JSON is formatted once into
+ * a buffer from a fixed pool, and each client gets a message from a fixed pool that references it. A buffer goes back
+ * to the pool once every client has sent it. If either pool runs dry we fall back to the library's allocating path
+ */
+#define WS_BROADCAST_BUFFER_COUNT        8
+#define WS_BROADCAST_BUFFER_SIZE_BYTES   256 // Fits every parameter at once (the page load snapshot)
+#define WS_BROADCAST_MESSAGE_COUNT       32  // Messages queued across all clients
+#define WS_BROADCAST_STATS_LOG_INTERVAL  256 // Broadcasts between stats logs
 
 /**
- * Handle JSON keys and values that are received from webserver websocket
+ * Updates raised within one scheduler tick go out as a single multi-key frame. Each update only records the latest
+ * value of its parameter and wakes the flush task, which waits out the tick before sending everything pending
+ */
+#define WS_COALESCE_TICKS                1
+#define WS_SOURCE_NAME_LENGTH            16
+
+/* Parameters only the web server has, after DSP_Settings_Indexes and numbered like their binary protocol IDs */
+#define WS_PARAMETER_OTA_STATE           (FIRMWARE_VERSION_NUMBER_STRING_PARAMETER + 1)
+#define WS_PARAMETER_OTA_PROGRESS        (FIRMWARE_VERSION_NUMBER_STRING_PARAMETER + 2)
+#define WS_PARAMETER_COUNT               (WS_PARAMETER_OTA_PROGRESS + 1)
+
+/* Frame writers from AsyncWebSocket.cpp */
+extern size_t webSocketSendFrameWindow(AsyncClient* client);
+extern size_t webSocketSendFrame(AsyncClient* client, bool final, uint8_t opcode, bool mask, uint8_t* data,
+                                 size_t len);
+
+struct Web_Socket_Broadcast_Buffer {
+    std::atomic<uint8_t> references{0}; // The broadcaster while filling it plus one per queued message
+    uint16_t length;
+    uint8_t data[WS_BROADCAST_BUFFER_SIZE_BYTES];
+};
+
+static struct Web_Socket_Broadcast_Buffer ws_broadcast_buffers[WS_BROADCAST_BUFFER_COUNT];
+
+static struct Web_Socket_Broadcast_Buffer* acquire_broadcast_buffer(void) {
+    for (uint8_t i = 0; i < WS_BROADCAST_BUFFER_COUNT; i++) {
+        uint8_t unused = 0;
+        if (ws_broadcast_buffers[i].references.compare_exchange_strong(unused, 1)) {
+            return &ws_broadcast_buffers[i];
+        }
+    }
+    return nullptr;
+}
+
+/* Latest value of each parameter not yet sent. Written by the encoder, bus and web tasks, taken by the flush task */
+struct Web_Socket_Pending_Updates {
+    uint16_t mask = 0;         // 1 << DSP_Settings_Indexes
+    uint16_t refresh_mask = 0; // Values to take without broadcasting them (snapshots)
+    uint8_t values[WS_PARAMETER_COUNT]; // Single value parameters only
+    char current_source[WS_SOURCE_NAME_LENGTH + 1];
+};
+
+static struct Web_Socket_Pending_Updates ws_pending_updates;
+static portMUX_TYPE ws_pending_updates_mux = portMUX_INITIALIZER_UNLOCKED;
+
+/* Only the flush task broadcasts, so the client list is only ever walked from one place */
+static TaskHandle_t ws_flush_task_handle;
+
+/* Newest value of every parameter, what a client is sent once it is ready for more. Only the flush task uses it */
+static struct Web_Socket_Pending_Updates ws_latest_updates;
+
+#define WS_MAX_SESSIONS      DEFAULT_MAX_WS_CLIENTS
+#define WS_SUBSCRIBE_ALL     ((1 << WS_PARAMETER_COUNT) - 1)
+#define WS_SETTINGS_MASK     ((1 << (FIRMWARE_VERSION_NUMBER_STRING_PARAMETER + 1)) - 1) // What a snapshot refreshes
+#define WS_STRING_MASK       (1 << DSP_SETTINGS_CURRENT_INPUT_SOURCE | 1 << FIRMWARE_VERSION_NUMBER_STRING_PARAMETER)
+#define WS_SINGLE_VALUE_MASK (WS_SUBSCRIBE_ALL & ~WS_STRING_MASK) // Only these are compared with what was last sent
+
+/**
+ * Session registry, one slot per connected client keyed by AsyncWebSocketClient::id(). Each client picks the
+ * parameters it wants (all by default) and only the parameters someone wants wake the flush task.
+ *
+ * A client has at most one broadcast queued. Updates raised while it waits to go out only mark their parameter dirty,
+ * so a slow client is never queued stale values: once its TCP window opens it is sent the newest value of everything
+ * it missed. A value the client was last sent is not sent again. Guarded by ws_pending_updates_mux
+ */
+struct Web_Socket_Session {
+    uint32_t client_id;         // 0 while the slot is free, the library numbers clients from 1
+    uint8_t protocol;           // Web_Socket_Protocol
+    uint16_t subscription_mask; // Parameters (1 << DSP_Settings_Indexes) the client wants
+    uint16_t dirty_mask;        // Parameters the client is owed the newest value of
+    uint16_t in_flight_mask;    // Parameters in the queued broadcast, 0 if none is queued
+    uint16_t last_sent_mask;    // Single value parameters last_sent holds
+    uint8_t last_sent[WS_PARAMETER_COUNT];
+    bool snapshot_requested;    // Owed everything it subscribes to in the next flush
+    uint32_t coalesced;         // Updates replaced by a newer value before they were sent
+    uint32_t dropped;           // Broadcasts the client's queue turned away (their parameters are sent again)
+    uint32_t unchanged;         // Updates not sent because the client already has the value
+};
+
+static struct Web_Socket_Session ws_sessions[WS_MAX_SESSIONS];
+static uint16_t ws_interest_mask; // Subscriptions of every open session
+
+static void update_interest_mask(void) {
+    ws_interest_mask = 0;
+    for (struct Web_Socket_Session& session : ws_sessions) {
+        if (session.client_id != 0) {
+            ws_interest_mask |= session.subscription_mask;
+        }
+    }
+}
+
+/**
+ * @returns The client's session, nullptr if it has none. Call with ws_pending_updates_mux held
+ */
+static struct Web_Socket_Session* find_session(uint32_t client_id) {
+    for (struct Web_Socket_Session& session : ws_sessions) {
+        if (session.client_id == client_id) {
+            return &session;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * @returns false if the registry is full
+ */
+static bool open_session(uint32_t client_id, uint8_t protocol) {
+    taskENTER_CRITICAL(&ws_pending_updates_mux);
+    struct Web_Socket_Session* session = find_session(0);
+    if (session != nullptr) {
+        *session = {};
+        session->client_id = client_id;
+        session->protocol = protocol;
+        session->subscription_mask = WS_SUBSCRIBE_ALL;
+        update_interest_mask();
+    }
+    taskEXIT_CRITICAL(&ws_pending_updates_mux);
+    return session != nullptr;
+}
+
+static void close_session(uint32_t client_id) {
+    struct Web_Socket_Session closed = {};
+    taskENTER_CRITICAL(&ws_pending_updates_mux);
+    struct Web_Socket_Session* session = find_session(client_id);
+    if (session != nullptr) {
+        closed = *session;
+        session->client_id = 0;
+        update_interest_mask();
+    }
+    taskEXIT_CRITICAL(&ws_pending_updates_mux);
+    if (closed.client_id != 0) {
+        log_i("WS client #%u: %u updates coalesced, %u unchanged, %u broadcasts dropped", (unsigned)client_id,
+              (unsigned)closed.coalesced, (unsigned)closed.unchanged, (unsigned)closed.dropped);
+    }
+}
+
+/**
+ * Change the parameters a client is sent. Newly subscribed parameters are sent straight away
+ */
+static void subscribe_session(uint32_t client_id, uint16_t subscription_mask) {
+    taskENTER_CRITICAL(&ws_pending_updates_mux);
+    struct Web_Socket_Session* session = find_session(client_id);
+    if (session != nullptr) {
+        uint16_t added = subscription_mask & ~session->subscription_mask;
+        session->subscription_mask = subscription_mask & WS_SUBSCRIBE_ALL;
+        session->dirty_mask = (session->dirty_mask | (added & ws_latest_updates.mask)) & session->subscription_mask;
+        update_interest_mask();
+    }
+    taskEXIT_CRITICAL(&ws_pending_updates_mux);
+    if (ws_flush_task_handle != nullptr) {
+        xTaskNotifyGive(ws_flush_task_handle);
+    }
+}
+
+/**
+ * Send the client everything it subscribes to in the next flush
+ */
+static void request_session_snapshot(uint32_t client_id) {
+    taskENTER_CRITICAL(&ws_pending_updates_mux);
+    struct Web_Socket_Session* session = find_session(client_id);
+    if (session != nullptr) {
+        session->snapshot_requested = true;
+    }
+    taskEXIT_CRITICAL(&ws_pending_updates_mux);
+    if (ws_flush_task_handle != nullptr) {
+        xTaskNotifyGive(ws_flush_task_handle);
+    }
+}
+
+/**
+ * The session's queued broadcast is done with. If it never went out, its parameters are owed again. Either way the
+ * flush task is woken if the client has fallen behind
+ * @param sent The whole frame was acknowledged
+ */
+static void finish_session_broadcast(struct Web_Socket_Session* session, bool sent) {
+    taskENTER_CRITICAL(&ws_pending_updates_mux);
+    if (!sent) {
+        session->dropped++;
+        session->dirty_mask |= session->in_flight_mask;
+        session->last_sent_mask &= ~session->in_flight_mask;
+    }
+    session->in_flight_mask = 0;
+    bool behind = session->dirty_mask != 0;
+    taskEXIT_CRITICAL(&ws_pending_updates_mux);
+    if (behind && ws_flush_task_handle != nullptr) {
+        xTaskNotifyGive(ws_flush_task_handle);
+    }
+}
+
+/**
+ * A text or binary message that sends a shared pool buffer. Only ever a single frame, the buffers are far smaller than
+ * the TCP window so it simply waits until the whole message fits
+ */
+class Web_Socket_Pooled_Message : public AsyncWebSocketMessage {
+  public:
+    Web_Socket_Pooled_Message(struct Web_Socket_Broadcast_Buffer* buffer, uint8_t opcode,
+                              struct Web_Socket_Session* session)
+        : buffer(buffer), session(session) {
+        this->buffer->references++;
+        _opcode = opcode;
+        _status = WS_MSG_SENDING;
+    }
+
+    ~Web_Socket_Pooled_Message() override {
+        this->buffer->references--;
+        finish_session_broadcast(this->session, _status == WS_MSG_SENT);
+    }
+
+    bool betweenFrames() const override {
+        return this->acked == this->ack_expected;
+    }
+
+    void ack(size_t len, uint32_t time) override {
+        this->acked += len;
+        if (this->sent && this->acked >= this->ack_expected) {
+            _status = WS_MSG_SENT;
+        }
+    }
+
+    size_t send(AsyncClient* client) override {
+        if (_status != WS_MSG_SENDING || this->sent || webSocketSendFrameWindow(client) < this->buffer->length) {
+            return 0;
+        }
+        size_t written = webSocketSendFrame(client, true, _opcode, false, this->buffer->data, this->buffer->length);
+        if (written == this->buffer->length) {
+            this->sent = true;
+            this->ack_expected = written + ((written < 126) ? 2 : 4); // Header of an unmasked frame
+        }
+        return written;
+    }
+
+    static void* operator new(size_t size) noexcept;
+    static void operator delete(void* ptr);
+
+  private:
+    struct Web_Socket_Broadcast_Buffer* buffer;
+    struct Web_Socket_Session* session; // Closed only after the client has deleted its messages
+    bool sent = false;
+    size_t acked = 0;
+    size_t ack_expected = 0;
+};
+
+static uint8_t ws_message_pool[WS_BROADCAST_MESSAGE_COUNT][sizeof(Web_Socket_Pooled_Message)]
+    __attribute__((aligned(alignof(Web_Socket_Pooled_Message))));
+static std::atomic<bool> ws_message_pool_used[WS_BROADCAST_MESSAGE_COUNT];
+
+void* Web_Socket_Pooled_Message::operator new(size_t size) noexcept {
+    for (uint8_t i = 0; i < WS_BROADCAST_MESSAGE_COUNT; i++) {
+        bool unused = false;
+        if (ws_message_pool_used[i].compare_exchange_strong(unused, true)) {
+            return ws_message_pool[i];
+        }
+    }
+    return nullptr; // The caller falls back to a library message
+}
+
+void Web_Socket_Pooled_Message::operator delete(void* ptr) {
+    ws_message_pool_used[((uint8_t*)ptr - ws_message_pool[0]) / sizeof(Web_Socket_Pooled_Message)] = false;
+}
+
+struct Web_Socket_Broadcast_Stats {
+    uint32_t updates = 0;    // Parameter updates raised
+    uint32_t unwanted = 0;   // No session subscribed, the flush task was not woken
+    uint32_t broadcasts = 0; // Flushes they were coalesced into
+    uint32_t messages_queued = 0;
+    uint32_t bytes_formatted[WEB_SOCKET_PROTOCOL_COUNT] = {}; // Once per flush that a client of the protocol needed
+    uint32_t pool_misses = 0;    // Fell back to the allocating path
+    uint32_t heap_operations = 0; // Only counted with WEB_SOCKET_ALLOCATION_COUNTERS
+};
+
+static struct Web_Socket_Broadcast_Stats ws_broadcast_stats;
+
+#if WEB_SOCKET_ALLOCATION_COUNTERS
+/* Every C++ heap operation goes through these. Only the ones made by a task while it broadcasts are counted */
+static volatile TaskHandle_t allocation_watch_task = nullptr;
+
+static inline void count_heap_operation(void) {
+    if (allocation_watch_task != nullptr && xTaskGetCurrentTaskHandle() == allocation_watch_task) {
+        ws_broadcast_stats.heap_operations++;
+    }
+}
+
+void* operator new(size_t size) {
+    count_heap_operation();
+    return malloc(size);
+}
+
+void* operator new[](size_t size) {
+    count_heap_operation();
+    return malloc(size);
+}
+
+void operator delete(void* ptr) noexcept {
+    count_heap_operation();
+    free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+    count_heap_operation();
+    free(ptr);
+}
+
+void operator delete(void* ptr, size_t size) noexcept {
+    operator delete(ptr);
+}
+
+void operator delete[](void* ptr, size_t size) noexcept {
+    operator delete[](ptr);
+}
+#endif
+
+/**
+ * Key of each parameter in the JSON sent to the webapp, indexed by DSP_Settings_Indexes then the WS_PARAMETER_*
  */
-void handle_json_key_value(JsonPair key_value) {
-    if (strcmp(key_value.key().c_str(), "getRemoteSettings") == 0) {
-        Serial.println("*WS* Webpage loaded. Get settings");
-        // Get the latest remote settings
-        update_web_server_parameter(DSP_SETTING_INDEX_MEMORY_SELECT, dsp_settings_web_server->memory_select);
-        update_web_server_parameter_string(DSP_SETTINGS_CURRENT_INPUT_SOURCE, dsp_settings_web_server->current_source);
-        update_web_server_parameter(DSP_SETTING_INDEX_MASTER_VOLUME, dsp_settings_web_server->master_volume);
-        update_web_server_parameter(DSP_SETTING_INDEX_SUB_VOLUME, dsp_settings_web_server->sub_volume);
-        update_web_server_parameter(DSP_SETTING_INDEX_BALANCE, dsp_settings_web_server->balance);
-        update_web_server_parameter(DSP_SETTING_INDEX_FADER, dsp_settings_web_server->fader);
-        update_web_server_parameter(DSP_SETTING_INDEX_USB_CONNECTED, (uint8_t)dsp_settings_web_server->usb_connected);
-        update_web_server_parameter_string(FIRMWARE_VERSION_NUMBER_STRING_PARAMETER, FW_VERSION);
-    } else if (strcmp(key_value.key().c_str(), "password") == 0) {
-        String password = key_value.value();
-        Serial.printf("*WS* password: %s\n", password.c_str());
-    } else if (strcmp(key_value.key().c_str(), "dspMemory") == 0) {
-        uint8_t dspMemoryValue = key_value.value();
-        Serial.printf("*WS* dspMemory: %d\n", dspMemoryValue);
-        Audison_AC_Link.set_dsp_memory(dspMemoryValue);
-        dsp_settings_web_server->memory_select = dspMemoryValue;
-    } else if (strcmp(key_value.key().c_str(), "changeSource") == 0) {
-        Audison_AC_Link.change_source();
-    } else if (strcmp(key_value.key().c_str(), "masterVolume") == 0) {
-        uint8_t master_volume_value = key_value.value();
-        dsp_settings_web_server->master_volume = master_volume_value;
-        update_master_volume = true;
-        Serial.printf("*WS* masterVolume: %d\n", master_volume_value);
-    } else if (strcmp(key_value.key().c_str(), "subVolume") == 0) {
-        uint8_t sub_volume_value = key_value.value();
-        dsp_settings_web_server->sub_volume = sub_volume_value;
-        update_subwoofer_volume = true;
-        Serial.printf("*WS* subVolume: %d\n", sub_volume_value);
-    } else if (strcmp(key_value.key().c_str(), "balance") == 0) {
-        uint8_t balance_value = key_value.value();
-        dsp_settings_web_server->balance = balance_value;
-        update_balance = true;
-        Serial.printf("*WS* balance: %d\n", balance_value);
-    } else if (strcmp(key_value.key().c_str(), "fader") == 0) {
-        uint8_t fader_value = key_value.value();
-        dsp_settings_web_server->fader = fader_value;
-        update_fader = true;
-        Serial.printf("*WS* fader: %d\n", fader_value);
+static constexpr const char* ws_parameter_keys[] = {"dspMemory", "currentSource", "masterVolume", "subVolume",
+                                                     "balance",   "fader",         "usbConnected", "fwVersion",
+                                                     "otaState",  "otaProgress"};
+static_assert(sizeof(ws_parameter_keys) / sizeof(ws_parameter_keys[0]) == WS_PARAMETER_COUNT,
+              "Every web server parameter needs a key");
+
+constexpr size_t max_update_length(void) {
+    size_t length = 2; // {}
+    for (const char* key : ws_parameter_keys) {
+        length += std::char_traits<char>::length(key) + 9; // Quotes, ": ", ", " and 3 digits or the string quotes
+    }
+    return length + WS_SOURCE_NAME_LENGTH + sizeof(FW_VERSION);
+}
+static_assert(max_update_length() <= WS_BROADCAST_BUFFER_SIZE_BYTES, "Broadcast buffers must fit every parameter");
+
+/**
+ * Append an unsigned value in decimal
+ * @returns Pointer past the last digit
+ */
+static uint8_t* format_uint(uint8_t* buffer, uint32_t value) {
+    uint8_t digits[10];
+    uint8_t count = 0;
+    do {
+        digits[count++] = '0' + (value % 10);
+        value /= 10;
+    } while (value);
+    while (count) {
+        *buffer++ = digits[--count];
+    }
+    return buffer;
+}
+
+/**
+ * Append "key": and the opening quote of a string value
+ * @returns Pointer past the colon (or the quote)
+ */
+static uint8_t* format_key(uint8_t* buffer, const char* key, bool first, bool string) {
+    if (!first) {
+        *buffer++ = ',';
+        *buffer++ = ' ';
+    }
+    *buffer++ = '"';
+    size_t key_length = strlen(key);
+    memcpy(buffer, key, key_length);
+    buffer += key_length;
+    *buffer++ = '"';
+    *buffer++ = ':';
+    *buffer++ = ' ';
+    if (string) {
+        *buffer++ = '"';
+    }
+    return buffer;
+}
+
+/**
+ * @returns The string value of a parameter, nullptr for single value parameters
+ */
+static const char* pending_update_string(const struct Web_Socket_Pending_Updates* updates, uint8_t parameter) {
+    return (parameter == DSP_SETTINGS_CURRENT_INPUT_SOURCE)          ? updates->current_source
+           : (parameter == FIRMWARE_VERSION_NUMBER_STRING_PARAMETER) ? FW_VERSION
+                                                                      : nullptr;
+}
+
+/**
+ * Build {"key": value, ...} for every parameter in the mask in one pass without printf
+ * @param data At least WS_BROADCAST_BUFFER_SIZE_BYTES long
+ * @returns Length of the message
+ */
+static size_t format_json_updates(const struct Web_Socket_Pending_Updates* updates, uint16_t mask, uint8_t* data) {
+    uint8_t* position = data;
+    *position++ = '{';
+    for (uint8_t parameter = 0; parameter < WS_PARAMETER_COUNT; parameter++) {
+        if (!(mask & (1 << parameter))) {
+            continue;
+        }
+        bool first = position == data + 1;
+        const char* key = ws_parameter_keys[parameter];
+        const char* string = pending_update_string(updates, parameter);
+        if (string) {
+            size_t string_length = strlen(string);
+            position = format_key(position, key, first, true);
+            memcpy(position, string, string_length);
+            position += string_length;
+            *position++ = '"';
+        } else {
+            position = format_uint(format_key(position, key, first, false), updates->values[parameter]);
+        }
+    }
+    *position++ = '}';
+    return position - data;
+}
+
+/**
+ * Build a binary record for every parameter in the mask. Smaller than the JSON, so it fits the same buffers
+ * @param data At least WS_BROADCAST_BUFFER_SIZE_BYTES long
+ * @returns Length of the message
+ */
+static size_t format_binary_updates(const struct Web_Socket_Pending_Updates* updates, uint16_t mask,
+                                    uint8_t* data) {
+    uint8_t* position = data;
+    for (uint8_t parameter = 0; parameter < WS_PARAMETER_COUNT; parameter++) {
+        if (!(mask & (1 << parameter))) {
+            continue;
+        }
+        const char* string = pending_update_string(updates, parameter);
+        position = string ? web_protocol_put_string(position, parameter, string)
+                          : web_protocol_put_value(position, parameter, updates->values[parameter]);
+    }
+    return position - data;
+}
+
+static size_t format_updates(uint16_t mask, uint8_t protocol, uint8_t* data) {
+    size_t length = (protocol == WEB_SOCKET_PROTOCOL_BINARY) ? format_binary_updates(&ws_latest_updates, mask, data)
+                                                              : format_json_updates(&ws_latest_updates, mask, data);
+    ws_broadcast_stats.bytes_formatted[protocol] += length;
+    return length;
+}
+
+/**
+ * Queue a copy of a message the pools could not take. The library message is not followed, so the client is treated
+ * as having been sent it
+ */
+static void send_unpooled(AsyncWebSocketClient* client, struct Web_Socket_Session* session, uint8_t* data,
+                          size_t length) {
+    ws_broadcast_stats.pool_misses++;
+    if (session->protocol == WEB_SOCKET_PROTOCOL_BINARY) {
+        client->binary(data, length);
     } else {
-        Serial.println("Unknown JSON format key value pair");
+        client->text(data, length);
+    }
+    finish_session_broadcast(session, true);
+}
+
+/**
+ * Queue one broadcast to a client
+ * @param buffer Formatted buffer, holding a reference for the caller
+ */
+static void send_client_broadcast(AsyncWebSocketClient* client, struct Web_Socket_Session* session,
+                                  struct Web_Socket_Broadcast_Buffer* buffer) {
+    uint8_t opcode = (session->protocol == WEB_SOCKET_PROTOCOL_BINARY) ? WS_BINARY : WS_TEXT;
+    Web_Socket_Pooled_Message* message = new Web_Socket_Pooled_Message(buffer, opcode, session);
+    if (message == nullptr) {
+        send_unpooled(client, session, buffer->data, buffer->length);
+        return;
+    }
+    client->message(message); // Deleted by the client once sent, or straight away if its queue is full
+    ws_broadcast_stats.messages_queued++;
+}
+
+/**
+ * Take the parameters a session is owed and mark them in flight. Call with ws_pending_updates_mux held
+ * @param new_mask Parameters updated since the last flush
+ * @returns Parameters to send now, 0 if the session has a broadcast queued or is owed nothing
+ */
+static uint16_t take_session_updates(struct Web_Socket_Session* session, uint16_t new_mask) {
+    uint16_t owed = new_mask & session->subscription_mask;
+    for (uint8_t parameter = 0; parameter < WS_PARAMETER_COUNT; parameter++) {
+        uint16_t bit = 1 << parameter;
+        if ((owed & session->last_sent_mask & WS_SINGLE_VALUE_MASK & bit) && !(session->dirty_mask & bit) &&
+            ws_latest_updates.values[parameter] == session->last_sent[parameter]) {
+            owed &= ~bit;
+            session->unchanged++;
+        }
+    }
+    session->coalesced += __builtin_popcount(session->dirty_mask & owed);
+    session->dirty_mask |= owed;
+    if (session->snapshot_requested) {
+        session->snapshot_requested = false;
+        session->dirty_mask |= session->subscription_mask & ws_latest_updates.mask;
+    }
+    if (session->in_flight_mask != 0 || session->dirty_mask == 0) {
+        return 0;
+    }
+    uint16_t send_mask = session->dirty_mask;
+    session->in_flight_mask = send_mask;
+    session->dirty_mask = 0;
+    for (uint8_t parameter = 0; parameter < WS_PARAMETER_COUNT; parameter++) {
+        if (send_mask & WS_SINGLE_VALUE_MASK & (1 << parameter)) {
+            session->last_sent[parameter] = ws_latest_updates.values[parameter];
+        }
+    }
+    session->last_sent_mask |= send_mask & WS_SINGLE_VALUE_MASK;
+    return send_mask;
+}
+
+/**
+ * Mark the new updates dirty for every session that wants them and send each client that has nothing queued
+ * everything it is owed, as one frame. Sessions owed the same parameters share one buffer per protocol, formatted the
+ * first time it is needed
+ * @param new_mask Parameters updated since the last flush, 0 to only catch up clients that fell behind
+ */
+static void broadcast_updates(uint16_t new_mask) {
+#if WEB_SOCKET_ALLOCATION_COUNTERS
+    allocation_watch_task = xTaskGetCurrentTaskHandle();
+#endif
+    ws_broadcast_stats.broadcasts++;
+    struct Web_Socket_Broadcast_Buffer* shared[WEB_SOCKET_PROTOCOL_COUNT] = {};
+    uint16_t shared_mask[WEB_SOCKET_PROTOCOL_COUNT] = {};
+    for (struct Web_Socket_Session& session : ws_sessions) {
+        taskENTER_CRITICAL(&ws_pending_updates_mux);
+        uint32_t client_id = session.client_id;
+        uint16_t send_mask = (client_id != 0) ? take_session_updates(&session, new_mask) : 0;
+        taskEXIT_CRITICAL(&ws_pending_updates_mux);
+        if (send_mask == 0) {
+            continue;
+        }
+        AsyncWebSocketClient* client = web_socket_handle.client(client_id);
+        if (client == nullptr || client->status() != WS_CONNECTED) {
+            finish_session_broadcast(&session, true); // Closing, the session goes with it
+            continue;
+        }
+        uint8_t protocol = session.protocol;
+        struct Web_Socket_Broadcast_Buffer* buffer = shared[protocol];
+        if (buffer == nullptr || shared_mask[protocol] != send_mask) {
+            buffer = acquire_broadcast_buffer();
+            if (buffer == nullptr) {
+                uint8_t unpooled[WS_BROADCAST_BUFFER_SIZE_BYTES];
+                send_unpooled(client, &session, unpooled, format_updates(send_mask, protocol, unpooled));
+                continue;
+            }
+            buffer->length = format_updates(send_mask, protocol, buffer->data);
+            if (shared[protocol] == nullptr) {
+                shared[protocol] = buffer; // Most sessions are owed just the new updates
+                shared_mask[protocol] = send_mask;
+                buffer->references++;
+            }
+        } else {
+            buffer->references++;
+        }
+        send_client_broadcast(client, &session, buffer);
+        buffer->references--; // The message holds it from here
+    }
+    for (struct Web_Socket_Broadcast_Buffer* buffer : shared) {
+        if (buffer != nullptr) {
+            buffer->references--;
+        }
+    }
+#if WEB_SOCKET_ALLOCATION_COUNTERS
+    allocation_watch_task = nullptr;
+#endif
+    if ((ws_broadcast_stats.broadcasts % WS_BROADCAST_STATS_LOG_INTERVAL) == 0) {
+        log_i("WS broadcast: %u updates (%u nobody wanted) in %u flushes, %u messages queued, %u pool misses, %u heap "
+              "operations",
+              (unsigned)ws_broadcast_stats.updates, (unsigned)ws_broadcast_stats.unwanted,
+              (unsigned)ws_broadcast_stats.broadcasts, (unsigned)ws_broadcast_stats.messages_queued,
+              (unsigned)ws_broadcast_stats.pool_misses, (unsigned)ws_broadcast_stats.heap_operations);
+        log_i("WS broadcast bytes formatted: %u JSON, %u binary",
+              (unsigned)ws_broadcast_stats.bytes_formatted[WEB_SOCKET_PROTOCOL_JSON],
+              (unsigned)ws_broadcast_stats.bytes_formatted[WEB_SOCKET_PROTOCOL_BINARY]);
+        for (struct Web_Socket_Session& session : ws_sessions) {
+            if (session.client_id != 0) {
+                log_i("WS client #%u: %u updates coalesced, %u unchanged, %u broadcasts dropped",
+                      (unsigned)session.client_id, (unsigned)session.coalesced, (unsigned)session.unchanged,
+                      (unsigned)session.dropped);
+            }
+        }
+    }
+}
+
+/**
+ * Record a value for the next flush. Call with ws_pending_updates_mux held
+ * @param string Source name for DSP_SETTINGS_CURRENT_INPUT_SOURCE, nullptr otherwise
+ */
+static void store_pending_value(uint8_t parameter, uint8_t value, const char* string) {
+    if (parameter == DSP_SETTINGS_CURRENT_INPUT_SOURCE) {
+        strncpy(ws_pending_updates.current_source, string, WS_SOURCE_NAME_LENGTH);
+        ws_pending_updates.current_source[WS_SOURCE_NAME_LENGTH] = '\0';
+    } else if (WS_SINGLE_VALUE_MASK & (1 << parameter)) {
+        ws_pending_updates.values[parameter] = value;
+    }
+}
+
+/**
+ * Record the latest value of a parameter and wake the flush task, unless no client wants it. The value is still kept
+ * for the next flush, so a client that subscribes later gets the newest
+ * @param string Source name for DSP_SETTINGS_CURRENT_INPUT_SOURCE, nullptr otherwise
+ */
+static void queue_parameter_update(uint8_t parameter, uint8_t value, const char* string) {
+    taskENTER_CRITICAL(&ws_pending_updates_mux);
+    store_pending_value(parameter, value, string);
+    ws_pending_updates.mask |= (1 << parameter);
+    ws_broadcast_stats.updates++;
+    bool wanted = ws_interest_mask & (1 << parameter);
+    if (!wanted) {
+        ws_broadcast_stats.unwanted++;
+    }
+    taskEXIT_CRITICAL(&ws_pending_updates_mux);
+    // The bus can report changes before the web server is up (it starts in parallel), they wait here until then
+    if (wanted && ws_flush_task_handle != nullptr) {
+        xTaskNotifyGive(ws_flush_task_handle);
+    }
+}
+
+/**
+ * Sends the updates pending at the end of each tick they were raised in. Also woken when a client that fell behind
+ * has room again
+ */
+static void web_socket_flush_task(void* pvParameters) {
+    struct Web_Socket_Pending_Updates updates;
+    while (1) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        vTaskDelay(WS_COALESCE_TICKS);
+        ulTaskNotifyTake(pdTRUE, 0); // Covered by this flush
+        taskENTER_CRITICAL(&ws_pending_updates_mux);
+        updates = ws_pending_updates;
+        ws_pending_updates.mask = 0;
+        ws_pending_updates.refresh_mask = 0;
+        taskEXIT_CRITICAL(&ws_pending_updates_mux);
+        uint16_t taken_mask = updates.mask | updates.refresh_mask;
+        for (uint8_t parameter = 0; parameter < WS_PARAMETER_COUNT; parameter++) {
+            if (taken_mask & (1 << parameter)) {
+                ws_latest_updates.values[parameter] = updates.values[parameter];
+            }
+        }
+        if (taken_mask & (1 << DSP_SETTINGS_CURRENT_INPUT_SOURCE)) {
+            memcpy(ws_latest_updates.current_source, updates.current_source, sizeof(updates.current_source));
+        }
+        ws_latest_updates.mask |= taken_mask;
+        broadcast_updates(updates.mask);
     }
 }
 
-void handleWebSocketMessage(void* arg, uint8_t* data, size_t len) {
+/**
+ * Setting changes from the webapp are handed to update_drc_settings_task through a queue. The websocket handler runs
+ * in the async TCP task so it only stamps and posts the change
+ */
+struct Web_Parameter_Event {
+    uint8_t parameter; // DSP_Settings_Indexes
+    uint8_t value;
+    uint32_t received_us; // micros() when the websocket message was handled
+};
+
+#define WEB_PARAMETER_EVENT_QUEUE_LENGTH 16
+QueueHandle_t web_parameter_event_queue;
+
+static void post_web_parameter_event(uint8_t parameter, uint8_t value) {
+    struct Web_Parameter_Event event = {parameter, value, (uint32_t)micros()};
+    if (xQueueSend(web_parameter_event_queue, &event, 0) != pdTRUE) {
+        log_e("Web parameter event queue full, dropping parameter %d", parameter);
+    }
+}
+
+/**
+ * Every setting goes out together in the next flush, as one snapshot frame. The values are refreshed without being
+ * broadcast, only the client that asked is sent them
+ */
+static void queue_settings_snapshot(uint32_t client_id) {
+    taskENTER_CRITICAL(&ws_pending_updates_mux);
+    store_pending_value(DSP_SETTING_INDEX_MEMORY_SELECT, dsp_settings_web_server->memory_select, nullptr);
+    store_pending_value(DSP_SETTINGS_CURRENT_INPUT_SOURCE, 0, dsp_settings_web_server->current_source);
+    store_pending_value(DSP_SETTING_INDEX_MASTER_VOLUME, dsp_settings_web_server->master_volume, nullptr);
+    store_pending_value(DSP_SETTING_INDEX_SUB_VOLUME, dsp_settings_web_server->sub_volume, nullptr);
+    store_pending_value(DSP_SETTING_INDEX_BALANCE, dsp_settings_web_server->balance, nullptr);
+    store_pending_value(DSP_SETTING_INDEX_FADER, dsp_settings_web_server->fader, nullptr);
+    store_pending_value(DSP_SETTING_INDEX_USB_CONNECTED, dsp_settings_web_server->usb_connected, nullptr);
+    ws_pending_updates.refresh_mask |= WS_SETTINGS_MASK;
+    taskEXIT_CRITICAL(&ws_pending_updates_mux);
+    request_session_snapshot(client_id);
+}
+
+/**
+ * Handle JSON keys and values that are received from webserver websocket
+ */
+void handle_json_key_value(JsonPair key_value, uint32_t client_id) {
+    JsonString key = key_value.key();
+    switch (web_command_lookup(key.c_str(), key.size())) {
+        case WEB_COMMAND_GET_REMOTE_SETTINGS:
+            Serial.println("*WS* Webpage loaded. Get settings");
+            queue_settings_snapshot(client_id);
+            break;
+        case WEB_COMMAND_SUBSCRIBE:
+            subscribe_session(client_id, key_value.value().as<uint16_t>());
+            break;
+        case WEB_COMMAND_PASSWORD:
+            Serial.printf("*WS* password: %s\n", key_value.value().as<const char*>());
+            break;
+        case WEB_COMMAND_DSP_MEMORY: {
+            uint8_t dspMemoryValue = key_value.value();
+            Serial.printf("*WS* dspMemory: %d\n", dspMemoryValue);
+            post_web_parameter_event(DSP_SETTING_INDEX_MEMORY_SELECT, dspMemoryValue);
+            break;
+        }
+        case WEB_COMMAND_CHANGE_SOURCE:
+            Audison_AC_Link.change_source();
+            break;
+        case WEB_COMMAND_MASTER_VOLUME: {
+            uint8_t master_volume_value = key_value.value();
+            post_web_parameter_event(DSP_SETTING_INDEX_MASTER_VOLUME, master_volume_value);
+            Serial.printf("*WS* masterVolume: %d\n", master_volume_value);
+            break;
+        }
+        case WEB_COMMAND_SUB_VOLUME: {
+            uint8_t sub_volume_value = key_value.value();
+            post_web_parameter_event(DSP_SETTING_INDEX_SUB_VOLUME, sub_volume_value);
+            Serial.printf("*WS* subVolume: %d\n", sub_volume_value);
+            break;
+        }
+        case WEB_COMMAND_BALANCE: {
+            uint8_t balance_value = key_value.value();
+            post_web_parameter_event(DSP_SETTING_INDEX_BALANCE, balance_value);
+            Serial.printf("*WS* balance: %d\n", balance_value);
+            break;
+        }
+        case WEB_COMMAND_FADER: {
+            uint8_t fader_value = key_value.value();
+            post_web_parameter_event(DSP_SETTING_INDEX_FADER, fader_value);
+            Serial.printf("*WS* fader: %d\n", fader_value);
+            break;
+        }
+        default:
+            Serial.println("Unknown JSON format key value pair");
+            break;
+    }
+}
+
+/**
+ * Handle a record received from a client speaking the binary protocol
+ */
+static void handle_binary_record(const struct Web_Protocol_Record* record, uint32_t client_id) {
+    switch (record->id) {
+        case WEB_PROTOCOL_ID_GET_REMOTE_SETTINGS:
+            queue_settings_snapshot(client_id);
+            break;
+        case WEB_PROTOCOL_ID_SUBSCRIBE:
+            subscribe_session(client_id, record->value);
+            break;
+        case WEB_PROTOCOL_ID_CHANGE_SOURCE:
+            Audison_AC_Link.change_source();
+            break;
+        case WEB_PROTOCOL_ID_DSP_MEMORY:
+        case WEB_PROTOCOL_ID_MASTER_VOLUME:
+        case WEB_PROTOCOL_ID_SUB_VOLUME:
+        case WEB_PROTOCOL_ID_BALANCE:
+        case WEB_PROTOCOL_ID_FADER:
+            post_web_parameter_event(record->id, record->value); // IDs match DSP_Settings_Indexes
+            break;
+        default:
+            log_e("Unknown binary websocket parameter 0x%02X", record->id);
+            break;
+    }
+}
+
+static_assert(WEB_PROTOCOL_ID_DSP_MEMORY == DSP_SETTING_INDEX_MEMORY_SELECT &&
+                  WEB_PROTOCOL_ID_CURRENT_SOURCE == DSP_SETTINGS_CURRENT_INPUT_SOURCE &&
+                  WEB_PROTOCOL_ID_MASTER_VOLUME == DSP_SETTING_INDEX_MASTER_VOLUME &&
+                  WEB_PROTOCOL_ID_SUB_VOLUME == DSP_SETTING_INDEX_SUB_VOLUME &&
+                  WEB_PROTOCOL_ID_BALANCE == DSP_SETTING_INDEX_BALANCE &&
+                  WEB_PROTOCOL_ID_FADER == DSP_SETTING_INDEX_FADER &&
+                  WEB_PROTOCOL_ID_USB_CONNECTED == DSP_SETTING_INDEX_USB_CONNECTED &&
+                  WEB_PROTOCOL_ID_FW_VERSION == FIRMWARE_VERSION_NUMBER_STRING_PARAMETER &&
+                  WEB_PROTOCOL_ID_OTA_STATE == WS_PARAMETER_OTA_STATE &&
+                  WEB_PROTOCOL_ID_OTA_PROGRESS == WS_PARAMETER_OTA_PROGRESS,
+              "Binary parameter IDs must match DSP_Settings_Indexes and the web server parameters");
+
+/* Cost of handling received messages, by the protocol they arrived in */
+#define WS_INBOUND_STATS_LOG_INTERVAL 64 // Messages between stats logs
+
+struct Web_Socket_Inbound_Stats {
+    uint32_t messages[WEB_SOCKET_PROTOCOL_COUNT] = {};
+    uint32_t bytes[WEB_SOCKET_PROTOCOL_COUNT] = {};
+    uint32_t handle_us[WEB_SOCKET_PROTOCOL_COUNT] = {}; // Parse and dispatch
+    uint32_t errors = 0;
+};
+
+static struct Web_Socket_Inbound_Stats ws_inbound_stats;
+
+static Web_Socket_Json_Arena ws_json_arena;
+
+static void count_inbound_message(uint8_t protocol, size_t len, uint32_t start_us) {
+    ws_inbound_stats.messages[protocol]++;
+    ws_inbound_stats.bytes[protocol] += len;
+    ws_inbound_stats.handle_us[protocol] += micros() - start_us;
+    uint32_t total = ws_inbound_stats.messages[WEB_SOCKET_PROTOCOL_JSON] +
+                     ws_inbound_stats.messages[WEB_SOCKET_PROTOCOL_BINARY];
+    if ((total % WS_INBOUND_STATS_LOG_INTERVAL) == 0) {
+        for (uint8_t i = 0; i < WEB_SOCKET_PROTOCOL_COUNT; i++) {
+            uint32_t count = ws_inbound_stats.messages[i] ? ws_inbound_stats.messages[i] : 1;
+            log_i("WS inbound %s: %u messages, %u bytes average, %uus average to handle",
+                  (i == WEB_SOCKET_PROTOCOL_BINARY) ? "binary" : "JSON", (unsigned)ws_inbound_stats.messages[i],
+                  (unsigned)(ws_inbound_stats.bytes[i] / count), (unsigned)(ws_inbound_stats.handle_us[i] / count));
+        }
+        log_i("WS inbound JSON arena: %u of %u bytes used at most, %u allocations refused",
+              (unsigned)ws_json_arena.high_water, (unsigned)WS_JSON_ARENA_SIZE_BYTES, (unsigned)ws_json_arena.failures);
+    }
+}
+
+void handleWebSocketMessage(AsyncWebSocketClient* client, void* arg, uint8_t* data, size_t len) {
     AwsFrameInfo* info = (AwsFrameInfo*)arg;
-    if (info->final && info->index == 0 && info->len == len && info->opcode == WS_TEXT) {
+    if (!info->final || info->index != 0 || info->len != len) {
+        return;
+    }
+    uint32_t start_us = micros();
+    if (info->opcode == WS_BINARY) {
+        Web_Protocol_Reader reader(data, len);
+        struct Web_Protocol_Record record;
+        while (reader.next(&record)) {
+            handle_binary_record(&record, client->id());
+        }
+        if (reader.error) {
+            ws_inbound_stats.errors++;
+            log_e("Malformed binary websocket message");
+        }
+        count_inbound_message(WEB_SOCKET_PROTOCOL_BINARY, len, start_us);
+    } else if (info->opcode == WS_TEXT) {
         data[len] = '\0';
         // Serial.printf("WS Message Rec: %s\n", data);
-        JsonDocument doc;                                        // Allocate the JSON document
-        DeserializationError error = deserializeJson(doc, data); // Parse JSON object
-        if (error == DeserializationError::Ok) {
-            for (JsonPair kv : doc.as<JsonObject>()) {
-                handle_json_key_value(kv);
+        ws_json_arena.reset();
+        {
+            JsonDocument doc(&ws_json_arena);                             // Allocate the JSON document in the arena
+            DeserializationError error = deserializeJson(doc, data, len); // Parse JSON object
+            if (error == DeserializationError::Ok) {
+                for (JsonPair kv : doc.as<JsonObject>()) {
+                    handle_json_key_value(kv, client->id());
+                }
+            } else {
+                ws_inbound_stats.errors++;
+                Serial.printf("Error parsing JSON: %s\n", error.c_str());
             }
-        } else {
-            Serial.println("Error parsing JSON");
         }
+        count_inbound_message(WEB_SOCKET_PROTOCOL_JSON, len, start_us);
     }
 }
 
@@ -117,17 +913,26 @@ void handleWebSocketMessage(void* arg, uint8_t* data, size_t len) {
 void onEvent(AsyncWebSocket* server, AsyncWebSocketClient* client, AwsEventType type, void* arg, uint8_t* data,
              size_t len) {
     switch (type) {
-        case WS_EVT_CONNECT:
-            client_connected_to_websocket = true;
-            Serial.printf("WebSocket client #%u connected from %s\n", client->id(),
-                          client->remoteIP().toString().c_str());
+        case WS_EVT_CONNECT: {
+            // arg is the upgrade request, the handshake answered with the same choice
+            AsyncWebHeader* protocol_header = ((AsyncWebServerRequest*)arg)->getHeader("Sec-WebSocket-Protocol");
+            bool binary = protocol_header != nullptr &&
+                          server->selectProtocol(protocol_header->value()).equals(WEB_PROTOCOL_BINARY_NAME);
+            if (!open_session(client->id(), binary ? WEB_SOCKET_PROTOCOL_BINARY : WEB_SOCKET_PROTOCOL_JSON)) {
+                log_e("No room for WebSocket client #%u", client->id());
+                client->close(1013); // Try again later
+                break;
+            }
+            Serial.printf("WebSocket client #%u connected from %s (%s)\n", client->id(),
+                          client->remoteIP().toString().c_str(), binary ? "binary" : "JSON");
             break;
+        }
         case WS_EVT_DISCONNECT:
-            client_connected_to_websocket = false;
             Serial.printf("WebSocket client #%u disconnected\n", client->id());
+            close_session(client->id()); // Its queued messages were deleted before this event
             break;
         case WS_EVT_DATA:
-            handleWebSocketMessage(arg, data, len);
+            handleWebSocketMessage(client, arg, data, len);
             break;
         case WS_EVT_PONG:
         case WS_EVT_ERROR:
@@ -136,6 +941,7 @@ void onEvent(AsyncWebSocket* server, AsyncWebSocketClient* client, AwsEventType
 }
 
 void initWebSocket() {
+    web_socket_handle.setProtocols(ws_supported_protocols, sizeof(ws_supported_protocols) / sizeof(char*));
     web_socket_handle.onEvent(onEvent);
     server.addHandler(&web_socket_handle);
 }
@@ -144,46 +950,92 @@ void notFound(AsyncWebServerRequest* request) {
     request->send(404, "text/plain", "Not found");
 }
 
-// handles uploads
+/**
+ * Send an asset built in by convert_to_headers.py, or 304 if the browser already holds this version
+ */
+static void send_embedded_asset(AsyncWebServerRequest* request, const struct Web_Asset* asset) {
+    AsyncWebServerResponse* response;
+    if (request->hasHeader("If-None-Match") && request->header("If-None-Match").indexOf(asset->etag) >= 0) {
+        response = request->beginResponse(304);
+    } else {
+        response = request->beginResponse_P(200, asset->mime, asset->data, asset->length);
+        if (asset->encoding != nullptr) {
+            response->addHeader("Content-Encoding", asset->encoding);
+        }
+    }
+    response->addHeader("ETag", asset->etag);
+    response->addHeader("Cache-Control", asset->cache_control);
+    request->send(response);
+}
+
+/**
+ * Serves every asset in the generated table, so a new webapp file needs no firmware code
+ */
+class Web_Asset_Handler : public AsyncWebHandler {
+  public:
+    bool canHandle(AsyncWebServerRequest* request) override {
+        if (request->method() != HTTP_GET || find(request) == nullptr) {
+            return false;
+        }
+        request->addInterestingHeader("If-None-Match");
+        return true;
+    }
+
+    void handleRequest(AsyncWebServerRequest* request) override {
+        send_embedded_asset(request, find(request));
+    }
+
+  private:
+    static const struct Web_Asset* find(AsyncWebServerRequest* request) {
+        return web_asset_find(web_assets, web_asset_count, request->url().c_str());
+    }
+};
+
+static Web_Asset_Handler web_asset_handler;
+
+/**
+ * Tell every client how the update is going. Called from the OTA writer task, so like any other update it only records
+ * the values and the flush task sends them
+ */
+static void send_ota_progress(uint8_t state, uint8_t percent) {
+    queue_parameter_update(WS_PARAMETER_OTA_STATE, state, nullptr);
+    queue_parameter_update(WS_PARAMETER_OTA_PROGRESS, percent, nullptr);
+}
+
+/* The upload the running update belongs to, any other is ignored. Only used on the async TCP task */
+static AsyncWebServerRequest* ota_upload_request;
+
+/**
+ * Upload chunks are handed straight to the OTA writer task, the async TCP task never waits on flash unless both
+ * buffers are still being written. The webapp sends the image size and SHA-256 as headers
+ */
 void handleUpload(AsyncWebServerRequest* request, String filename, size_t index, uint8_t* data, size_t len,
                   bool final) {
-    String logmessage = "Client:" + request->client()->remoteIP().toString() + " " + request->url();
-    Serial.println(logmessage);
-
     if (!index) {
-        logmessage = "Upload Start: " + String(filename);
-        // open the file on first call and store the file handle in the request object
-        // request->_tempFile = SPIFFS.open("/" + filename, "w");
-        if (!Update.begin(UPDATE_SIZE_UNKNOWN, U_FLASH)) {
-            Update.printError(Serial);
+        AsyncWebHeader* size_header = request->getHeader("X-OTA-Size");
+        AsyncWebHeader* sha256_header = request->getHeader("X-OTA-SHA256");
+        Serial.printf("Upload Start: %s from %s\n", filename.c_str(), request->client()->remoteIP().toString().c_str());
+        if (!ota_begin(size_header ? strtoul(size_header->value().c_str(), nullptr, 10) : 0,
+                       sha256_header ? sha256_header->value().c_str() : nullptr)) {
+            return;
         }
-        Serial.println(logmessage);
+        ota_upload_request = request;
+        request->onDisconnect([request]() {
+            if (ota_upload_request == request) {
+                ota_upload_request = nullptr;
+                ota_abort(); // Does nothing once the whole image has been received
+            }
+        });
+    }
+    if (request != ota_upload_request) {
+        return;
     }
-
     if (len) {
-        // stream the incoming chunk to the opened file
-        // request->_tempFile.write(data, len);
-        logmessage = "Writing file: " + String(filename) + " index=" + String(index) + " len=" + String(len);
-        Serial.println(logmessage);
-        if (Update.write(data, len) != len) {
-            Update.printError(Serial);
-            Serial.printf("Progress: %d%%\n", (Update.progress() * 100) / Update.size());
-        }
+        ota_write(data, len);
     }
-
     if (final) {
-        logmessage = "Upload Complete: " + String(filename) + ",size: " + String(index + len);
-        // close the file handle as the upload is now done
-        // request->_tempFile.close();
-        Serial.println(logmessage);
-        if (!Update.end(true)) {
-            Update.printError(Serial);
-        } else {
-            Serial.println("Update complete - rebooting in 5 seconds");
-            vTaskDelay(pdMS_TO_TICKS(5000));
-            Serial.flush();
-            ESP.restart();
-        }
+        Serial.printf("Upload Complete: %s, size: %u\n", filename.c_str(), (unsigned)(index + len));
+        ota_end();
     }
 }
 
@@ -209,24 +1061,35 @@ void web_server_init(struct DSP_Settings* settings) {
     WiFi.softAPConfig(local_ip, gateway, subnet);
     WiFi.onEvent(WiFiEvent);
 
+    web_parameter_event_queue = xQueueCreate(WEB_PARAMETER_EVENT_QUEUE_LENGTH, sizeof(struct Web_Parameter_Event));
     initWebSocket();
+    ota_init(send_ota_progress);
+    xTaskCreatePinnedToCore(web_socket_flush_task, "WS-FLUSH", 4000, NULL, tskIDLE_PRIORITY + 1,
+                            &ws_flush_task_handle, 1);
     xTaskCreatePinnedToCore(update_drc_settings_task, "WEB-DRC", 8000, NULL, tskIDLE_PRIORITY + 1,
                             &update_drc_task_handle, 1);
 
-    server.on("/", HTTP_GET, [](AsyncWebServerRequest* request) {
-        request->send_P(200, "text/html", (const uint8_t*)custom_html, sizeof(custom_html), nullptr);
-    });
+    server.addHandler(&web_asset_handler);
 
-    server.on("/pico.min.css", HTTP_GET, [](AsyncWebServerRequest* request) {
-        request->send_P(200, "text/css", (const uint8_t*)custom_css, sizeof(custom_css), nullptr);
-    });
-
-    server.on("/index.js", HTTP_GET, [](AsyncWebServerRequest* request) {
-        request->send_P(200, "text/js", (const uint8_t*)custom_js, sizeof(custom_js), nullptr);
+    // Download the latest bus traffic. Open with Wireshark (DLT_USER0): 1 direction byte (0 RX, 1 TX) then the frame
+    server.on("/capture", HTTP_GET, [](AsyncWebServerRequest* request) {
+        AC_Link_Pcap_Stream<AC_LINK_CAPTURE_RING_CAPACITY> pcap_stream(&ac_link_capture_ring);
+        AsyncWebServerResponse* response = request->beginChunkedResponse(
+            "application/vnd.tcpdump.pcap", [pcap_stream](uint8_t* buffer, size_t max_length, size_t index) mutable {
+                return pcap_stream.read(buffer, max_length);
+            });
+        response->addHeader("Content-Disposition", "attachment; filename=\"ac_link_capture.pcap\"");
+        request->send(response);
     });
 
     // run handleUpload function when any file is uploaded
-    server.on("/upload", HTTP_POST, [](AsyncWebServerRequest* request) { request->send(200); }, handleUpload);
+    // The image is still being verified when this answers, the result arrives over the websocket
+    server.on(
+        "/upload", HTTP_POST,
+        [](AsyncWebServerRequest* request) {
+            request->send((request == ota_upload_request && ota_state() != OTA_STATE_FAILED) ? 200 : 500);
+        },
+        handleUpload);
 
     server.begin();
     Serial.println("HTTP server started");
@@ -235,51 +1098,29 @@ void web_server_init(struct DSP_Settings* settings) {
 }
 
 void update_web_server_parameter(uint8_t parameter, uint8_t value) {
+    switch (parameter) {
+        case DSP_SETTING_INDEX_MEMORY_SELECT:
+        case DSP_SETTING_INDEX_MASTER_VOLUME:
+        case DSP_SETTING_INDEX_SUB_VOLUME:
+        case DSP_SETTING_INDEX_BALANCE:
+        case DSP_SETTING_INDEX_FADER:
+        case DSP_SETTING_INDEX_USB_CONNECTED:
+            queue_parameter_update(parameter, value, nullptr);
+            break;
 
-    if (client_connected_to_websocket) {
-        switch (parameter) {
-            case DSP_SETTING_INDEX_MEMORY_SELECT:
-                web_socket_handle.printfAll("{\"dspMemory\": %d}", value);
-                break;
-
-            case DSP_SETTINGS_CURRENT_INPUT_SOURCE:
-                web_socket_handle.printfAll("{\"inputSelect\": %d}", value);
-                break;
-
-            case DSP_SETTING_INDEX_MASTER_VOLUME:
-                web_socket_handle.printfAll("{\"masterVolume\": %d}", value);
-                break;
-
-            case DSP_SETTING_INDEX_SUB_VOLUME:
-                web_socket_handle.printfAll("{\"subVolume\": %d}", value);
-                break;
-
-            case DSP_SETTING_INDEX_BALANCE:
-                web_socket_handle.printfAll("{\"balance\": %d}", value);
-                break;
-
-            case DSP_SETTING_INDEX_FADER:
-                web_socket_handle.printfAll("{\"fader\": %d}", value);
-                break;
-
-            case DSP_SETTING_INDEX_USB_CONNECTED:
-                web_socket_handle.printfAll("{\"usbConnected\": %d}", value);
-                break;
-
-            default:
-                log_e("Unknown web server parameter update request");
-                break;
-        }
+        default:
+            log_e("Unknown web server parameter update request");
+            break;
     }
 }
 
 void update_web_server_parameter_string(uint8_t parameter, char* value_string) {
     switch (parameter) {
         case DSP_SETTINGS_CURRENT_INPUT_SOURCE:
-            web_socket_handle.printfAll("{\"currentSource\": \"%s\"}", value_string);
+            queue_parameter_update(parameter, 0, value_string);
             break;
         case FIRMWARE_VERSION_NUMBER_STRING_PARAMETER:
-            web_socket_handle.printfAll("{\"fwVersion\": \"%s\"}", value_string);
+            queue_parameter_update(parameter, 0, nullptr); // Always FW_VERSION
             break;
         default:
             log_e("Unknown webserver parameter string update requested");
@@ -288,31 +1129,41 @@ void update_web_server_parameter_string(uint8_t parameter, char* value_string) {
 }
 
 void update_drc_settings_task(void* pvParameters) {
+    struct Web_Parameter_Event event;
+    // The web server comes up alongside the bus, changes wait in the queue until there is somewhere to send them
+    wait_for_boot_phases((1 << BOOT_PHASE_BUS_LIVE) | (1 << BOOT_PHASE_ENCODERS_READY), portMAX_DELAY);
     while (1) {
-        /* We need to make sure we do not inundate the bus with too many messages
-        so we update at a rate of 4Hz */
-        if (update_master_volume) {
-            Audison_AC_Link.set_volume(dsp_settings_web_server->master_volume);
-            set_encoder_value(0, dsp_settings_web_server->master_volume);
-            update_master_volume = false;
-            vTaskDelay(pdMS_TO_TICKS(250));
-        }
-        if (update_subwoofer_volume) {
-            Audison_AC_Link.set_sub_volume(dsp_settings_web_server->sub_volume);
-            set_encoder_value(1, dsp_settings_web_server->sub_volume);
-            update_subwoofer_volume = false;
-            vTaskDelay(pdMS_TO_TICKS(250));
-        }
-        if (update_balance) {
-            Audison_AC_Link.set_balance(dsp_settings_web_server->balance);
-            update_balance = false;
-            vTaskDelay(pdMS_TO_TICKS(250));
-        }
-        if (update_fader) {
-            Audison_AC_Link.set_fader(dsp_settings_web_server->fader);
-            update_fader = false;
-            vTaskDelay(pdMS_TO_TICKS(250));
-        }
-        vTaskDelay(pdMS_TO_TICKS(250));
-    }
-}
\ No newline at end of file
+        /* Events are handled as soon as they arrive. The bus keeps only the latest value of each setting until it is
+        free to send it, so there is no need to rate limit here */
+        if (xQueueReceive(web_parameter_event_queue, &event, portMAX_DELAY) != pdTRUE) {
+            continue;
+        }
+        switch (event.parameter) {
+            case DSP_SETTING_INDEX_MEMORY_SELECT:
+                dsp_settings_web_server->memory_select = event.value;
+                Audison_AC_Link.set_dsp_memory(event.value);
+                break;
+            case DSP_SETTING_INDEX_MASTER_VOLUME:
+                dsp_settings_web_server->master_volume = event.value;
+                Audison_AC_Link.set_volume(event.value, AC_LINK_ADDRESS_MASTER_MCU, event.received_us);
+                set_encoder_value(0, event.value);
+                break;
+            case DSP_SETTING_INDEX_SUB_VOLUME:
+                dsp_settings_web_server->sub_volume = event.value;
+                Audison_AC_Link.set_sub_volume(event.value, AC_LINK_ADDRESS_MASTER_MCU, event.received_us);
+                set_encoder_value(1, event.value);
+                break;
+            case DSP_SETTING_INDEX_BALANCE:
+                dsp_settings_web_server->balance = event.value;
+                Audison_AC_Link.set_balance(event.value, AC_LINK_ADDRESS_MASTER_MCU, event.received_us);
+                break;
+            case DSP_SETTING_INDEX_FADER:
+                dsp_settings_web_server->fader = event.value;
+                Audison_AC_Link.set_fader(event.value, AC_LINK_ADDRESS_MASTER_MCU, event.received_us);
+                break;
+            default:
+                log_e("Unknown web parameter event: %d", event.parameter);
+                break;
+        }
+    }
+}
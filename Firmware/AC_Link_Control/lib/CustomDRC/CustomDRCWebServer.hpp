@@ -21,6 +21,7 @@ void update_web_server_parameter(uint8_t parameter, uint8_t value);
 void update_web_server_parameter_string(uint8_t parameter, char* value_string);
 
 /**
- * Task to handle updating the DRC with the latest settings / inputs from the webserver
+ * Task to handle updating the DRC with the latest settings / inputs from the webserver. Blocks on the web parameter
+ * event queue
  */
 void update_drc_settings_task(void* pvParameters);
\ No newline at end of file
@@ -1,3 +0,0 @@
-/* Compile Time: 17/1/2025 | 11:5:6 */ 
- #pragma once
-const char custom_html[] = {0x3c,0x21,0x44,0x4f,0x43,0x54,0x59,0x50,0x45,0x20,0x68,0x74,0x6d,0x6c,0x3e,0xa,0x3c,0x68,0x74,0x6d,0x6c,0x20,0x6c,0x61,0x6e,0x67,0x3d,0x22,0x65,0x6e,0x22,0x3e,0xa,0x20,0x20,0x3c,0x68,0x65,0x61,0x64,0x3e,0xa,0x20,0x20,0x20,0x20,0x3c,0x6d,0x65,0x74,0x61,0x20,0x63,0x68,0x61,0x72,0x73,0x65,0x74,0x3d,0x22,0x75,0x74,0x66,0x2d,0x38,0x22,0x20,0x2f,0x3e,0xa,0x20,0x20,0x20,0x20,0x3c,0x6d,0x65,0x74,0x61,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x65,0x77,0x70,0x6f,0x72,0x74,0x22,0x20,0x63,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x3d,0x22,0x77,0x69,0x64,0x74,0x68,0x3d,0x64,0x65,0x76,0x69,0x63,0x65,0x2d,0x77,0x69,0x64,0x74,0x68,0x2c,0x20,0x69,0x6e,0x69,0x74,0x69,0x61,0x6c,0x2d,0x73,0x63,0x61,0x6c,0x65,0x3d,0x31,0x22,0x20,0x2f,0x3e,0xa,0x20,0x20,0x20,0x20,0x3c,0x6d,0x65,0x74,0x61,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x6f,0x6c,0x6f,0x72,0x2d,0x73,0x63,0x68,0x65,0x6d,0x65,0x22,0x20,0x63,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x3d,0x22,0x6c,0x69,0x67,0x68,0x74,0x20,0x64,0x61,0x72,0x6b,0x22,0x20,0x2f,0x3e,0xa,0x20,0x20,0x20,0x20,0x3c,0x6c,0x69,0x6e,0x6b,0x20,0x72,0x65,0x6c,0x3d,0x22,0x73,0x74,0x79,0x6c,0x65,0x73,0x68,0x65,0x65,0x74,0x22,0x20,0x74,0x79,0x70,0x65,0x3d,0x22,0x74,0x65,0x78,0x74,0x2f,0x63,0x73,0x73,0x22,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x70,0x69,0x63,0x6f,0x2e,0x6d,0x69,0x6e,0x2e,0x63,0x73,0x73,0x22,0x20,0x2f,0x3e,0xa,0x20,0x20,0x20,0x20,0x3c,0x74,0x69,0x74,0x6c,0x65,0x3e,0x43,0x75,0x73,0x74,0x6f,0x6d,0x20,0x44,0x52,0x43,0x20,0x43,0x6f,0x6e,0x66,0x69,0x67,0x3c,0x2f,0x74,0x69,0x74,0x6c,0x65,0x3e,0xa,0x20,0x20,0x3c,0x2f,0x68,0x65,0x61,0x64,0x3e,0xa,0xa,0x20,0x20,0x3c,0x62,0x6f,0x64,0x79,0x3e,0xa,0x20,0x20,0x20,0x20,0x3c,0x6d,0x61,0x69,0x6e,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x63,0x6f,0x6e,0x74,0x61,0x69,0x6e,0x65,0x72,0x22,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x66,0x69,0x65,0x6c,0x64,0x73,0x65,0x74,0x20,0x72,0x6f,0x6c,0x65,0x3d,0x22,0x67,0x72,0x6f,0x75,0x70,0x22,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x68,0x31,0x3e,0x43,0x75,0x73,0x74,0x6f,0x6d,0x20,0x44,0x52,0x43,0x3c,0x2f,0x68,0x31,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x62,0x75,0x74,0x74,0x6f,0x6e,0x20,0x69,0x64,0x3d,0x22,0x71,0x75,0x69,0x74,0x42,0x75,0x74,0x74,0x6f,0x6e,0x22,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,0x20,0x6e,0x6f,0x6e,0x65,0x22,0x3e,0x51,0x75,0x69,0x74,0x3c,0x2f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x66,0x69,0x65,0x6c,0x64,0x73,0x65,0x74,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x20,0x69,0x64,0x3d,0x22,0x62,0x75,0x73,0x43,0x6f,0x6e,0x6e,0x65,0x63,0x74,0x69,0x6f,0x6e,0x22,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x64,0x65,0x6c,0x3e,0x4c,0x69,0x6e,0x6b,0x20,0x42,0x75,0x73,0x20,0x41,0x63,0x74,0x69,0x76,0x65,0x3c,0x2f,0x64,0x65,0x6c,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x70,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x63,0x6f,0x6e,0x74,0x61,0x69,0x6e,0x65,0x72,0x22,0x20,0x69,0x64,0x3d,0x22,0x6d,0x61,0x69,0x6e,0x42,0x6f,0x64,0x79,0x22,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,0x65,0x63,0x74,0x69,0x6f,0x6e,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x21,0x2d,0x2d,0x20,0x44,0x53,0x50,0x20,0x4d,0x65,0x6d,0x6f,0x72,0x79,0x20,0x53,0x65,0x6c,0x65,0x63,0x74,0x20,0x2d,0x2d,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x66,0x69,0x65,0x6c,0x64,0x73,0x65,0x74,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6c,0x65,0x67,0x65,0x6e,0x64,0x3e,0x44,0x53,0x50,0x20,0x4d,0x65,0x6d,0x6f,0x72,0x79,0x20,0x53,0x65,0x6c,0x65,0x63,0x74,0x3a,0x3c,0x2f,0x6c,0x65,0x67,0x65,0x6e,0x64,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x69,0x6e,0x70,0x75,0x74,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x79,0x70,0x65,0x3d,0x22,0x72,0x61,0x64,0x69,0x6f,0x22,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x64,0x3d,0x22,0x44,0x53,0x50,0x4d,0x65,0x6d,0x41,0x22,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x61,0x6c,0x75,0x65,0x3d,0x22,0x30,0x22,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x64,0x73,0x70,0x4d,0x65,0x6d,0x6f,0x72,0x79,0x22,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x68,0x65,0x63,0x6b,0x65,0x64,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x68,0x74,0x6d,0x6c,0x46,0x6f,0x72,0x3d,0x22,0x44,0x53,0x50,0x4d,0x65,0x6d,0x41,0x22,0x3e,0x41,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x22,0x72,0x61,0x64,0x69,0x6f,0x22,0x20,0x69,0x64,0x3d,0x22,0x44,0x53,0x50,0x4d,0x65,0x6d,0x42,0x22,0x20,0x76,0x61,0x6c,0x75,0x65,0x3d,0x22,0x31,0x22,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x64,0x73,0x70,0x4d,0x65,0x6d,0x6f,0x72,0x79,0x22,0x20,0x2f,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x68,0x74,0x6d,0x6c,0x46,0x6f,0x72,0x3d,0x22,0x44,0x53,0x50,0x4d,0x65,0x6d,0x42,0x22,0x3e,0x42,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x66,0x69,0x65,0x6c,0x64,0x73,0x65,0x74,0x3e,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x21,0x2d,0x2d,0x20,0x43,0x75,0x72,0x72,0x65,0x6e,0x74,0x20,0x49,0x6e,0x70,0x75,0x74,0x20,0x53,0x6f,0x75,0x72,0x63,0x65,0x20,0x2d,0x2d,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x66,0x69,0x65,0x6c,0x64,0x73,0x65,0x74,0x20,0x72,0x6f,0x6c,0x65,0x3d,0x22,0x67,0x72,0x6f,0x75,0x70,0x22,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x43,0x75,0x72,0x72,0x65,0x6e,0x74,0x20,0x49,0x6e,0x70,0x75,0x74,0x20,0x53,0x6f,0x75,0x72,0x63,0x65,0x3a,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x75,0x20,0x69,0x64,0x3d,0x22,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x53,0x6f,0x75,0x72,0x63,0x65,0x4c,0x61,0x62,0x65,0x6c,0x22,0x3e,0x20,0x4d,0x61,0x73,0x74,0x65,0x72,0x20,0x3c,0x2f,0x75,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x70,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x66,0x69,0x65,0x6c,0x64,0x73,0x65,0x74,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x62,0x75,0x74,0x74,0x6f,0x6e,0x20,0x69,0x64,0x3d,0x22,0x63,0x68,0x61,0x6e,0x67,0x65,0x53,0x6f,0x75,0x72,0x63,0x65,0x42,0x75,0x74,0x74,0x6f,0x6e,0x22,0x3e,0x43,0x68,0x61,0x6e,0x67,0x65,0x20,0x53,0x6f,0x75,0x72,0x63,0x65,0x3c,0x2f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x21,0x2d,0x2d,0x20,0x4d,0x75,0x74,0x65,0x20,0x53,0x77,0x69,0x74,0x63,0x68,0x20,0x2d,0x2d,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x21,0x2d,0x2d,0x20,0x3c,0x66,0x69,0x65,0x6c,0x64,0x73,0x65,0x74,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x69,0x6e,0x70,0x75,0x74,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x4d,0x75,0x74,0x65,0x22,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x79,0x70,0x65,0x3d,0x22,0x63,0x68,0x65,0x63,0x6b,0x62,0x6f,0x78,0x22,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x6f,0x6c,0x65,0x3d,0x22,0x73,0x77,0x69,0x74,0x63,0x68,0x22,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2c,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x64,0x3d,0x22,0x6d,0x75,0x74,0x65,0x5f,0x73,0x77,0x69,0x74,0x63,0x68,0x22,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x4d,0x75,0x74,0x65,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x66,0x69,0x65,0x6c,0x64,0x73,0x65,0x74,0x3e,0x20,0x2d,0x2d,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x73,0x65,0x63,0x74,0x69,0x6f,0x6e,0x3e,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x21,0x2d,0x2d,0x20,0x43,0x6f,0x6e,0x74,0x72,0x6f,0x6c,0x20,0x49,0x6e,0x70,0x75,0x74,0x73,0x20,0x2d,0x2d,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,0x65,0x63,0x74,0x69,0x6f,0x6e,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x66,0x6f,0x72,0x3d,0x22,0x6d,0x61,0x73,0x74,0x65,0x72,0x56,0x6f,0x6c,0x75,0x6d,0x65,0x22,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3e,0x4d,0x61,0x73,0x74,0x65,0x72,0x20,0x56,0x6f,0x6c,0x75,0x6d,0x65,0x3a,0x20,0x3c,0x73,0x70,0x61,0x6e,0x20,0x69,0x64,0x3d,0x22,0x6d,0x61,0x73,0x74,0x65,0x72,0x56,0x6f,0x6c,0x75,0x6d,0x65,0x56,0x61,0x6c,0x75,0x65,0x22,0x3e,0x3c,0x2f,0x73,0x70,0x61,0x6e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3e,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x69,0x64,0x3d,0x22,0x6d,0x61,0x73,0x74,0x65,0x72,0x56,0x6f,0x6c,0x75,0x6d,0x65,0x22,0x20,0x74,0x79,0x70,0x65,0x3d,0x22,0x72,0x61,0x6e,0x67,0x65,0x22,0x20,0x6d,0x69,0x6e,0x3d,0x22,0x30,0x22,0x20,0x6d,0x61,0x78,0x3d,0x22,0x31,0x32,0x30,0x22,0x20,0x73,0x74,0x65,0x70,0x3d,0x22,0x31,0x22,0x20,0x2f,0x3e,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x66,0x6f,0x72,0x3d,0x22,0x73,0x75,0x62,0x56,0x6f,0x6c,0x75,0x6d,0x65,0x22,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3e,0x53,0x75,0x62,0x2e,0x20,0x56,0x6f,0x6c,0x75,0x6d,0x65,0x3a,0x20,0x3c,0x73,0x70,0x61,0x6e,0x20,0x69,0x64,0x3d,0x22,0x73,0x75,0x62,0x56,0x6f,0x6c,0x75,0x6d,0x65,0x56,0x61,0x6c,0x75,0x65,0x22,0x3e,0x3c,0x2f,0x73,0x70,0x61,0x6e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3e,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x69,0x64,0x3d,0x22,0x73,0x75,0x62,0x56,0x6f,0x6c,0x75,0x6d,0x65,0x22,0x20,0x74,0x79,0x70,0x65,0x3d,0x22,0x72,0x61,0x6e,0x67,0x65,0x22,0x20,0x6d,0x69,0x6e,0x3d,0x22,0x30,0x22,0x20,0x6d,0x61,0x78,0x3d,0x22,0x32,0x34,0x22,0x20,0x73,0x74,0x65,0x70,0x3d,0x22,0x31,0x22,0x20,0x2f,0x3e,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x66,0x6f,0x72,0x3d,0x22,0x62,0x61,0x6c,0x61,0x6e,0x63,0x65,0x22,0x3e,0x42,0x61,0x6c,0x61,0x6e,0x63,0x65,0x3a,0x20,0x3c,0x73,0x70,0x61,0x6e,0x20,0x69,0x64,0x3d,0x22,0x62,0x61,0x6c,0x61,0x6e,0x63,0x65,0x56,0x61,0x6c,0x75,0x65,0x22,0x3e,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x69,0x64,0x3d,0x22,0x62,0x61,0x6c,0x61,0x6e,0x63,0x65,0x22,0x20,0x74,0x79,0x70,0x65,0x3d,0x22,0x72,0x61,0x6e,0x67,0x65,0x22,0x20,0x6d,0x69,0x6e,0x3d,0x22,0x30,0x22,0x20,0x6d,0x61,0x78,0x3d,0x22,0x33,0x36,0x22,0x20,0x73,0x74,0x65,0x70,0x3d,0x22,0x31,0x22,0x20,0x2f,0x3e,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x66,0x6f,0x72,0x3d,0x22,0x66,0x61,0x64,0x65,0x72,0x22,0x3e,0x46,0x61,0x64,0x65,0x72,0x3a,0x20,0x3c,0x73,0x70,0x61,0x6e,0x20,0x69,0x64,0x3d,0x22,0x66,0x61,0x64,0x65,0x72,0x56,0x61,0x6c,0x75,0x65,0x22,0x3e,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x69,0x64,0x3d,0x22,0x66,0x61,0x64,0x65,0x72,0x22,0x20,0x74,0x79,0x70,0x65,0x3d,0x22,0x72,0x61,0x6e,0x67,0x65,0x22,0x20,0x6d,0x69,0x6e,0x3d,0x22,0x30,0x22,0x20,0x6d,0x61,0x78,0x3d,0x22,0x33,0x36,0x22,0x20,0x73,0x74,0x65,0x70,0x3d,0x22,0x31,0x22,0x20,0x2f,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x73,0x65,0x63,0x74,0x69,0x6f,0x6e,0x3e,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x21,0x2d,0x2d,0x20,0x57,0x72,0x69,0x74,0x65,0x20,0x43,0x6f,0x6e,0x66,0x69,0x67,0x20,0x74,0x6f,0x20,0x44,0x53,0x50,0x20,0x2d,0x2d,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,0x65,0x63,0x74,0x69,0x6f,0x6e,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,0x20,0x6e,0x6f,0x6e,0x65,0x22,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x57,0x72,0x69,0x74,0x65,0x20,0x53,0x65,0x74,0x74,0x69,0x6e,0x67,0x73,0x20,0x74,0x6f,0x20,0x44,0x53,0x50,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x22,0x62,0x75,0x74,0x74,0x6f,0x6e,0x22,0x20,0x76,0x61,0x6c,0x75,0x65,0x3d,0x22,0x57,0x72,0x69,0x74,0x65,0x20,0x74,0x6f,0x20,0x44,0x53,0x50,0x22,0x20,0x64,0x69,0x73,0x61,0x62,0x6c,0x65,0x64,0x20,0x2f,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x73,0x65,0x63,0x74,0x69,0x6f,0x6e,0x3e,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x21,0x2d,0x2d,0x20,0x57,0x65,0x62,0x70,0x61,0x67,0x65,0x20,0x50,0x61,0x73,0x73,0x77,0x6f,0x72,0x64,0x20,0x55,0x70,0x64,0x61,0x74,0x65,0x20,0x2d,0x2d,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,0x65,0x63,0x74,0x69,0x6f,0x6e,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,0x20,0x6e,0x6f,0x6e,0x65,0x22,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x66,0x6f,0x72,0x3d,0x22,0x75,0x70,0x64,0x61,0x74,0x65,0x50,0x61,0x73,0x73,0x77,0x6f,0x72,0x64,0x22,0x3e,0x55,0x70,0x64,0x61,0x74,0x65,0x20,0x50,0x61,0x73,0x73,0x77,0x6f,0x72,0x64,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x66,0x69,0x65,0x6c,0x64,0x73,0x65,0x74,0x20,0x72,0x6f,0x6c,0x65,0x3d,0x22,0x67,0x72,0x6f,0x75,0x70,0x22,0x20,0x69,0x64,0x3d,0x22,0x75,0x70,0x64,0x61,0x74,0x65,0x50,0x61,0x73,0x73,0x77,0x6f,0x72,0x64,0x22,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x69,0x6e,0x70,0x75,0x74,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x79,0x70,0x65,0x3d,0x22,0x70,0x61,0x73,0x73,0x77,0x6f,0x72,0x64,0x22,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x70,0x6c,0x61,0x63,0x65,0x68,0x6f,0x6c,0x64,0x65,0x72,0x3d,0x22,0x45,0x6e,0x74,0x65,0x72,0x20,0x4e,0x65,0x77,0x20,0x50,0x61,0x73,0x73,0x77,0x6f,0x72,0x64,0x22,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x72,0x69,0x61,0x2d,0x6c,0x61,0x62,0x65,0x6c,0x3d,0x22,0x45,0x6e,0x74,0x65,0x72,0x20,0x4e,0x65,0x77,0x20,0x50,0x61,0x73,0x73,0x77,0x6f,0x72,0x64,0x22,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x69,0x73,0x61,0x62,0x6c,0x65,0x64,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x22,0x62,0x75,0x74,0x74,0x6f,0x6e,0x22,0x20,0x76,0x61,0x6c,0x75,0x65,0x3d,0x22,0x55,0x70,0x64,0x61,0x74,0x65,0x20,0x50,0x61,0x73,0x73,0x77,0x6f,0x72,0x64,0x22,0x20,0x64,0x69,0x73,0x61,0x62,0x6c,0x65,0x64,0x20,0x2f,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x66,0x69,0x65,0x6c,0x64,0x73,0x65,0x74,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x73,0x65,0x63,0x74,0x69,0x6f,0x6e,0x3e,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x21,0x2d,0x2d,0x20,0x57,0x69,0x46,0x69,0x20,0x63,0x72,0x65,0x64,0x65,0x6e,0x74,0x69,0x61,0x6c,0x73,0x20,0x55,0x70,0x64,0x61,0x74,0x65,0x20,0x2d,0x2d,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,0x65,0x63,0x74,0x69,0x6f,0x6e,0x20,0x69,0x64,0x3d,0x22,0x63,0x72,0x65,0x64,0x65,0x6e,0x74,0x69,0x61,0x6c,0x73,0x43,0x6f,0x6e,0x66,0x69,0x67,0x22,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,0x20,0x6e,0x6f,0x6e,0x65,0x3b,0x22,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x66,0x6f,0x72,0x3d,0x22,0x63,0x72,0x65,0x64,0x65,0x6e,0x74,0x69,0x61,0x6c,0x73,0x55,0x70,0x64,0x61,0x74,0x65,0x46,0x6f,0x72,0x6d,0x22,0x3e,0x57,0x69,0x46,0x69,0x20,0x43,0x72,0x65,0x64,0x65,0x6e,0x74,0x69,0x61,0x6c,0x73,0x20,0x55,0x70,0x64,0x61,0x74,0x65,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x66,0x6f,0x72,0x6d,0x20,0x61,0x63,0x74,0x69,0x6f,0x6e,0x3d,0x22,0x22,0x20,0x69,0x64,0x3d,0x22,0x63,0x72,0x65,0x64,0x65,0x6e,0x74,0x69,0x61,0x6c,0x73,0x55,0x70,0x64,0x61,0x74,0x65,0x46,0x6f,0x72,0x6d,0x22,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x69,0x6e,0x70,0x75,0x74,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x79,0x70,0x65,0x3d,0x22,0x74,0x65,0x78,0x74,0x22,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x73,0x73,0x69,0x64,0x49,0x6e,0x70,0x75,0x74,0x22,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x70,0x6c,0x61,0x63,0x65,0x68,0x6f,0x6c,0x64,0x65,0x72,0x3d,0x22,0x53,0x53,0x49,0x44,0x22,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x72,0x69,0x61,0x2d,0x6c,0x61,0x62,0x65,0x6c,0x3d,0x22,0x54,0x65,0x78,0x74,0x22,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x64,0x3d,0x22,0x77,0x69,0x66,0x69,0x43,0x72,0x65,0x64,0x65,0x6e,0x74,0x61,0x69,0x6c,0x73,0x53,0x53,0x49,0x44,0x22,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x69,0x6e,0x70,0x75,0x74,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x79,0x70,0x65,0x3d,0x22,0x70,0x61,0x73,0x73,0x77,0x6f,0x72,0x64,0x22,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x70,0x61,0x73,0x73,0x77,0x6f,0x72,0x64,0x49,0x6e,0x70,0x75,0x74,0x22,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x70,0x6c,0x61,0x63,0x65,0x68,0x6f,0x6c,0x64,0x65,0x72,0x3d,0x22,0x50,0x61,0x73,0x73,0x77,0x6f,0x72,0x64,0x22,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x72,0x69,0x61,0x2d,0x6c,0x61,0x62,0x65,0x6c,0x3d,0x22,0x54,0x65,0x78,0x74,0x22,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x64,0x3d,0x22,0x77,0x69,0x66,0x69,0x43,0x72,0x65,0x64,0x65,0x6e,0x74,0x61,0x69,0x6c,0x73,0x50,0x61,0x73,0x73,0x77,0x6f,0x72,0x64,0x22,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x72,0x69,0x61,0x2d,0x69,0x6e,0x76,0x61,0x6c,0x69,0x64,0x3d,0x22,0x74,0x72,0x75,0x65,0x22,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,0x6d,0x61,0x6c,0x6c,0x3e,0x4d,0x69,0x6e,0x69,0x6d,0x75,0x6d,0x20,0x38,0x20,0x63,0x68,0x61,0x72,0x61,0x63,0x74,0x65,0x72,0x73,0x3c,0x2f,0x73,0x6d,0x61,0x6c,0x6c,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x66,0x6f,0x72,0x6d,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x73,0x65,0x63,0x74,0x69,0x6f,0x6e,0x3e,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x21,0x2d,0x2d,0x20,0x4d,0x6f,0x64,0x61,0x6c,0x20,0x42,0x75,0x74,0x74,0x6f,0x6e,0x20,0x2d,0x2d,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,0x65,0x63,0x74,0x69,0x6f,0x6e,0x20,0x69,0x64,0x3d,0x22,0x6d,0x6f,0x64,0x61,0x6c,0x22,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,0x20,0x6e,0x6f,0x6e,0x65,0x3b,0x22,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x22,0x62,0x75,0x74,0x74,0x6f,0x6e,0x22,0x20,0x69,0x64,0x3d,0x22,0x63,0x72,0x65,0x64,0x65,0x6e,0x74,0x69,0x61,0x6c,0x73,0x55,0x70,0x64,0x61,0x74,0x65,0x42,0x75,0x74,0x74,0x6f,0x6e,0x22,0x20,0x64,0x61,0x74,0x61,0x2d,0x74,0x61,0x72,0x67,0x65,0x74,0x3d,0x22,0x6d,0x6f,0x64,0x61,0x6c,0x2d,0x65,0x78,0x61,0x6d,0x70,0x6c,0x65,0x22,0x20,0x6f,0x6e,0x63,0x6c,0x69,0x63,0x6b,0x3d,0x22,0x74,0x6f,0x67,0x67,0x6c,0x65,0x4d,0x6f,0x64,0x61,0x6c,0x28,0x65,0x76,0x65,0x6e,0x74,0x29,0x22,0x20,0x76,0x61,0x6c,0x75,0x65,0x3d,0x22,0x55,0x70,0x64,0x61,0x74,0x65,0x20,0x57,0x69,0x46,0x69,0x20,0x43,0x72,0x65,0x64,0x65,0x6e,0x74,0x69,0x61,0x6c,0x73,0x22,0x20,0x64,0x69,0x73,0x61,0x62,0x6c,0x65,0x64,0x3e,0x3c,0x2f,0x69,0x6e,0x70,0x75,0x74,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x73,0x65,0x63,0x74,0x69,0x6f,0x6e,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x21,0x2d,0x2d,0x20,0x2e,0x2f,0x20,0x4d,0x6f,0x64,0x61,0x6c,0x20,0x2d,0x2d,0x3e,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x21,0x2d,0x2d,0x20,0x4d,0x6f,0x64,0x61,0x6c,0x20,0x2d,0x2d,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x64,0x69,0x61,0x6c,0x6f,0x67,0x20,0x69,0x64,0x3d,0x22,0x6d,0x6f,0x64,0x61,0x6c,0x2d,0x65,0x78,0x61,0x6d,0x70,0x6c,0x65,0x22,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x68,0x65,0x61,0x64,0x65,0x72,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x62,0x75,0x74,0x74,0x6f,0x6e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x72,0x69,0x61,0x2d,0x6c,0x61,0x62,0x65,0x6c,0x3d,0x22,0x43,0x6c,0x6f,0x73,0x65,0x22,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x6c,0x3d,0x22,0x70,0x72,0x65,0x76,0x22,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x61,0x74,0x61,0x2d,0x74,0x61,0x72,0x67,0x65,0x74,0x3d,0x22,0x6d,0x6f,0x64,0x61,0x6c,0x2d,0x65,0x78,0x61,0x6d,0x70,0x6c,0x65,0x22,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6f,0x6e,0x63,0x6c,0x69,0x63,0x6b,0x3d,0x22,0x74,0x6f,0x67,0x67,0x6c,0x65,0x4d,0x6f,0x64,0x61,0x6c,0x28,0x65,0x76,0x65,0x6e,0x74,0x29,0x22,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3e,0x3c,0x2f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x68,0x33,0x3e,0x55,0x70,0x64,0x61,0x74,0x65,0x20,0x57,0x69,0x46,0x69,0x20,0x43,0x72,0x65,0x64,0x65,0x6e,0x74,0x69,0x61,0x6c,0x73,0x3f,0x3c,0x2f,0x68,0x33,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x68,0x65,0x61,0x64,0x65,0x72,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x66,0x6f,0x6f,0x74,0x65,0x72,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x62,0x75,0x74,0x74,0x6f,0x6e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x6f,0x6c,0x65,0x3d,0x22,0x62,0x75,0x74,0x74,0x6f,0x6e,0x22,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x73,0x65,0x63,0x6f,0x6e,0x64,0x61,0x72,0x79,0x22,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x61,0x74,0x61,0x2d,0x74,0x61,0x72,0x67,0x65,0x74,0x3d,0x22,0x6d,0x6f,0x64,0x61,0x6c,0x2d,0x65,0x78,0x61,0x6d,0x70,0x6c,0x65,0x22,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6f,0x6e,0x63,0x6c,0x69,0x63,0x6b,0x3d,0x22,0x74,0x6f,0x67,0x67,0x6c,0x65,0x4d,0x6f,0x64,0x61,0x6c,0x28,0x65,0x76,0x65,0x6e,0x74,0x29,0x22,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x43,0x61,0x6e,0x63,0x65,0x6c,0x3c,0x2f,0x62,0x75,0x74,0x74,0x6f,0x6e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3e,0x3c,0x62,0x75,0x74,0x74,0x6f,0x6e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x75,0x74,0x6f,0x66,0x6f,0x63,0x75,0x73,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x61,0x74,0x61,0x2d,0x74,0x61,0x72,0x67,0x65,0x74,0x3d,0x22,0x6d,0x6f,0x64,0x61,0x6c,0x2d,0x65,0x78,0x61,0x6d,0x70,0x6c,0x65,0x22,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6f,0x6e,0x63,0x6c,0x69,0x63,0x6b,0x3d,0x22,0x74,0x6f,0x67,0x67,0x6c,0x65,0x4d,0x6f,0x64,0x61,0x6c,0x28,0x65,0x76,0x65,0x6e,0x74,0x29,0x22,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x64,0x3d,0x22,0x63,0x6f,0x6e,0x66,0x69,0x72,0x6d,0x43,0x72,0x65,0x64,0x65,0x6e,0x74,0x69,0x61,0x6c,0x73,0x55,0x70,0x64,0x61,0x74,0x65,0x42,0x75,0x74,0x74,0x6f,0x6e,0x22,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x43,0x6f,0x6e,0x66,0x69,0x72,0x6d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x66,0x6f,0x6f,0x74,0x65,0x72,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x64,0x69,0x61,0x6c,0x6f,0x67,0x3e,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x21,0x2d,0x2d,0x20,0x4f,0x54,0x41,0x20,0x55,0x70,0x64,0x61,0x74,0x65,0x20,0x46,0x69,0x6c,0x65,0x20,0x55,0x70,0x6c,0x6f,0x61,0x64,0x20,0x2d,0x2d,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,0x65,0x63,0x74,0x69,0x6f,0x6e,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x66,0x6f,0x72,0x3d,0x22,0x6f,0x74,0x61,0x5f,0x66,0x6f,0x72,0x6d,0x22,0x3e,0x4f,0x54,0x41,0x20,0x55,0x70,0x64,0x61,0x74,0x65,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x66,0x6f,0x72,0x6d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x65,0x74,0x68,0x6f,0x64,0x3d,0x22,0x50,0x4f,0x53,0x54,0x22,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x63,0x74,0x69,0x6f,0x6e,0x3d,0x22,0x2f,0x75,0x70,0x6c,0x6f,0x61,0x64,0x22,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6e,0x63,0x74,0x79,0x70,0x65,0x3d,0x22,0x6d,0x75,0x6c,0x74,0x69,0x70,0x61,0x72,0x74,0x2f,0x66,0x6f,0x72,0x6d,0x2d,0x64,0x61,0x74,0x61,0x22,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x61,0x72,0x67,0x65,0x74,0x3d,0x22,0x69,0x66,0x72,0x61,0x6d,0x65,0x22,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x64,0x3d,0x22,0x6f,0x74,0x61,0x5f,0x66,0x6f,0x72,0x6d,0x22,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x66,0x69,0x65,0x6c,0x64,0x73,0x65,0x74,0x20,0x72,0x6f,0x6c,0x65,0x3d,0x22,0x67,0x72,0x6f,0x75,0x70,0x22,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x22,0x66,0x69,0x6c,0x65,0x22,0x20,0x69,0x64,0x3d,0x22,0x6f,0x74,0x61,0x5f,0x66,0x69,0x6c,0x65,0x22,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x75,0x70,0x6c,0x6f,0x61,0x64,0x22,0x20,0x2f,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x22,0x73,0x75,0x62,0x6d,0x69,0x74,0x22,0x20,0x76,0x61,0x6c,0x75,0x65,0x3d,0x22,0x55,0x70,0x6c,0x6f,0x61,0x64,0x22,0x20,0x69,0x64,0x3d,0x22,0x75,0x70,0x6c,0x6f,0x61,0x64,0x5f,0x6f,0x74,0x61,0x5f,0x66,0x69,0x6c,0x65,0x5f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x22,0x20,0x2f,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x66,0x69,0x65,0x6c,0x64,0x73,0x65,0x74,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x66,0x6f,0x72,0x6d,0x3e,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x21,0x2d,0x2d,0x20,0x55,0x70,0x6c,0x6f,0x61,0x64,0x20,0x70,0x72,0x6f,0x67,0x72,0x65,0x73,0x73,0x20,0x62,0x61,0x72,0x20,0x2d,0x2d,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x67,0x72,0x65,0x73,0x73,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x64,0x3d,0x22,0x6f,0x74,0x61,0x5f,0x66,0x69,0x6c,0x65,0x5f,0x75,0x70,0x6c,0x6f,0x61,0x64,0x5f,0x70,0x72,0x6f,0x67,0x72,0x65,0x73,0x73,0x22,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,0x20,0x6e,0x6f,0x6e,0x65,0x22,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x61,0x6c,0x75,0x65,0x3d,0x22,0x30,0x22,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x78,0x3d,0x22,0x31,0x30,0x30,0x22,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x73,0x65,0x63,0x74,0x69,0x6f,0x6e,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x64,0x69,0x76,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x21,0x2d,0x2d,0x20,0x46,0x6f,0x6f,0x74,0x65,0x72,0x20,0x2d,0x2d,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x66,0x6f,0x6f,0x74,0x65,0x72,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x63,0x6f,0x6e,0x74,0x61,0x69,0x6e,0x65,0x72,0x22,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x3e,0x3c,0x73,0x6d,0x61,0x6c,0x6c,0x20,0x69,0x64,0x3d,0x22,0x66,0x69,0x72,0x6d,0x77,0x61,0x72,0x65,0x5f,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x5f,0x73,0x74,0x72,0x69,0x6e,0x67,0x22,0x3e,0x46,0x57,0x20,0x56,0x65,0x72,0x73,0x3a,0x20,0x31,0x2e,0x30,0x2e,0x30,0x20,0x3c,0x2f,0x73,0x6d,0x61,0x6c,0x6c,0x3e,0x3c,0x2f,0x70,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x3e,0x3c,0x73,0x6d,0x61,0x6c,0x6c,0x3e,0x42,0x75,0x69,0x6c,0x74,0x20,0x77,0x69,0x74,0x68,0x20,0x50,0x69,0x63,0x6f,0x43,0x53,0x53,0x20,0x3c,0x2f,0x73,0x6d,0x61,0x6c,0x6c,0x3e,0x3c,0x2f,0x70,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x66,0x6f,0x6f,0x74,0x65,0x72,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x21,0x2d,0x2d,0x20,0x2e,0x2f,0x20,0x46,0x6f,0x6f,0x74,0x65,0x72,0x20,0x2d,0x2d,0x3e,0xa,0x20,0x20,0x20,0x20,0x3c,0x2f,0x6d,0x61,0x69,0x6e,0x3e,0xa,0x20,0x20,0x20,0x20,0x3c,0x73,0x63,0x72,0x69,0x70,0x74,0x20,0x73,0x72,0x63,0x3d,0x22,0x69,0x6e,0x64,0x65,0x78,0x2e,0x6a,0x73,0x22,0x20,0x74,0x79,0x70,0x65,0x3d,0x22,0x74,0x65,0x78,0x74,0x2f,0x6a,0x61,0x76,0x61,0x73,0x63,0x72,0x69,0x70,0x74,0x22,0x3e,0x3c,0x2f,0x73,0x63,0x72,0x69,0x70,0x74,0x3e,0xa,0x20,0x20,0x3c,0x2f,0x62,0x6f,0x64,0x79,0x3e,0xa,0x3c,0x2f,0x68,0x74,0x6d,0x6c,0x3e,0xa,0xa};
\ No newline at end of file
@@ -1,3 +0,0 @@
-/* Compile Time: 17/1/2025 | 11:5:6 */ 
- #pragma once
-const char custom_js[] = {0x76,0x61,0x72,0x20,0x67,0x61,0x74,0x65,0x77,0x61,0x79,0x20,0x3d,0x20,0x60,0x77,0x73,0x3a,0x2f,0x2f,0x24,0x7b,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x2e,0x68,0x6f,0x73,0x74,0x6e,0x61,0x6d,0x65,0x7d,0x2f,0x77,0x73,0x60,0x3b,0xa,0x76,0x61,0x72,0x20,0x77,0x65,0x62,0x73,0x6f,0x63,0x6b,0x65,0x74,0x3b,0xa,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x61,0x64,0x64,0x45,0x76,0x65,0x6e,0x74,0x4c,0x69,0x73,0x74,0x65,0x6e,0x65,0x72,0x28,0x22,0x6c,0x6f,0x61,0x64,0x22,0x2c,0x20,0x6f,0x6e,0x6c,0x6f,0x61,0x64,0x29,0x3b,0x20,0x2f,0x2f,0x20,0x49,0x6e,0x69,0x74,0x20,0x77,0x65,0x62,0x20,0x73,0x6f,0x63,0x6b,0x65,0x74,0x20,0x77,0x68,0x65,0x6e,0x20,0x74,0x68,0x65,0x20,0x70,0x61,0x67,0x65,0x20,0x6c,0x6f,0x61,0x64,0x73,0xa,0xa,0x76,0x61,0x72,0x20,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x20,0x3d,0x20,0x30,0x3b,0xa,0xa,0x2f,0x2a,0x20,0x44,0x65,0x66,0x69,0x6e,0x65,0x20,0x61,0x6c,0x6c,0x20,0x44,0x4f,0x4d,0x20,0x65,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x73,0x20,0x68,0x65,0x72,0x65,0x20,0x2a,0x2f,0xa,0x6c,0x65,0x74,0x20,0x70,0x61,0x73,0x73,0x77,0x6f,0x72,0x64,0x5f,0x77,0x69,0x6e,0x64,0x6f,0x77,0x20,0x3d,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x70,0x61,0x73,0x73,0x77,0x6f,0x72,0x64,0x45,0x6e,0x74,0x72,0x79,0x53,0x65,0x63,0x74,0x69,0x6f,0x6e,0x22,0x29,0x3b,0xa,0x6c,0x65,0x74,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x77,0x69,0x6e,0x64,0x6f,0x77,0x20,0x3d,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x6d,0x61,0x69,0x6e,0x42,0x6f,0x64,0x79,0x22,0x29,0x3b,0xa,0x6c,0x65,0x74,0x20,0x71,0x75,0x69,0x74,0x5f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x20,0x3d,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x71,0x75,0x69,0x74,0x42,0x75,0x74,0x74,0x6f,0x6e,0x22,0x29,0x3b,0xa,0x6c,0x65,0x74,0x20,0x6d,0x75,0x74,0x65,0x5f,0x73,0x77,0x69,0x74,0x63,0x68,0x20,0x3d,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x6d,0x75,0x74,0x65,0x5f,0x73,0x77,0x69,0x74,0x63,0x68,0x22,0x29,0x3b,0xa,0x6c,0x65,0x74,0x20,0x69,0x6e,0x70,0x75,0x74,0x5f,0x73,0x65,0x6c,0x65,0x63,0x74,0x5f,0x72,0x61,0x64,0x69,0x6f,0x20,0x3d,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x73,0x42,0x79,0x4e,0x61,0x6d,0x65,0x28,0x22,0x49,0x6e,0x70,0x75,0x74,0x53,0x65,0x6c,0x65,0x63,0x74,0x22,0x29,0x3b,0xa,0x6c,0x65,0x74,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x6c,0x61,0x62,0x65,0x6c,0x20,0x3d,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x53,0x6f,0x75,0x72,0x63,0x65,0x4c,0x61,0x62,0x65,0x6c,0x22,0x29,0x3b,0xa,0x6c,0x65,0x74,0x20,0x63,0x68,0x61,0x6e,0x67,0x65,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x20,0x3d,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x63,0x68,0x61,0x6e,0x67,0x65,0x53,0x6f,0x75,0x72,0x63,0x65,0x42,0x75,0x74,0x74,0x6f,0x6e,0x22,0x29,0x3b,0xa,0x6c,0x65,0x74,0x20,0x64,0x73,0x70,0x5f,0x6d,0x65,0x6d,0x6f,0x72,0x79,0x5f,0x61,0x5f,0x72,0x61,0x64,0x69,0x6f,0x20,0x3d,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x44,0x53,0x50,0x4d,0x65,0x6d,0x41,0x22,0x29,0x3b,0xa,0x6c,0x65,0x74,0x20,0x64,0x73,0x70,0x5f,0x6d,0x65,0x6d,0x6f,0x72,0x79,0x5f,0x62,0x5f,0x72,0x61,0x64,0x69,0x6f,0x20,0x3d,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x44,0x53,0x50,0x4d,0x65,0x6d,0x42,0x22,0x29,0x3b,0xa,0x6c,0x65,0x74,0x20,0x75,0x70,0x64,0x61,0x74,0x65,0x57,0x69,0x66,0x69,0x43,0x72,0x65,0x64,0x65,0x6e,0x74,0x69,0x61,0x6c,0x73,0x46,0x6f,0x72,0x6d,0x20,0x3d,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0xa,0x20,0x20,0x22,0x63,0x72,0x65,0x64,0x65,0x6e,0x74,0x69,0x61,0x6c,0x73,0x55,0x70,0x64,0x61,0x74,0x65,0x46,0x6f,0x72,0x6d,0x22,0xa,0x29,0x3b,0xa,0x6c,0x65,0x74,0x20,0x63,0x72,0x65,0x64,0x65,0x6e,0x74,0x69,0x61,0x6c,0x73,0x55,0x70,0x64,0x61,0x74,0x65,0x42,0x75,0x74,0x74,0x6f,0x6e,0x20,0x3d,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0xa,0x20,0x20,0x22,0x63,0x72,0x65,0x64,0x65,0x6e,0x74,0x69,0x61,0x6c,0x73,0x55,0x70,0x64,0x61,0x74,0x65,0x42,0x75,0x74,0x74,0x6f,0x6e,0x22,0xa,0x29,0x3b,0xa,0x6c,0x65,0x74,0x20,0x63,0x72,0x65,0x64,0x65,0x6e,0x74,0x69,0x61,0x6c,0x73,0x4d,0x6f,0x64,0x61,0x6c,0x20,0x3d,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x63,0x6f,0x6e,0x66,0x69,0x72,0x6d,0x43,0x72,0x65,0x64,0x65,0x6e,0x74,0x69,0x61,0x6c,0x73,0x4d,0x6f,0x64,0x61,0x6c,0x22,0x29,0x3b,0xa,0x6c,0x65,0x74,0x20,0x73,0x73,0x69,0x64,0x49,0x6e,0x70,0x75,0x74,0x20,0x3d,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x77,0x69,0x66,0x69,0x43,0x72,0x65,0x64,0x65,0x6e,0x74,0x61,0x69,0x6c,0x73,0x53,0x53,0x49,0x44,0x22,0x29,0x3b,0xa,0x6c,0x65,0x74,0x20,0x70,0x61,0x73,0x73,0x77,0x6f,0x72,0x64,0x49,0x6e,0x70,0x75,0x74,0x20,0x3d,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x77,0x69,0x66,0x69,0x43,0x72,0x65,0x64,0x65,0x6e,0x74,0x61,0x69,0x6c,0x73,0x50,0x61,0x73,0x73,0x77,0x6f,0x72,0x64,0x22,0x29,0x3b,0xa,0x6c,0x65,0x74,0x20,0x63,0x6f,0x6e,0x66,0x69,0x72,0x6d,0x43,0x72,0x65,0x64,0x65,0x6e,0x74,0x69,0x61,0x6c,0x73,0x55,0x70,0x64,0x61,0x74,0x65,0x42,0x75,0x74,0x74,0x6f,0x6e,0x20,0x3d,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0xa,0x20,0x20,0x22,0x63,0x6f,0x6e,0x66,0x69,0x72,0x6d,0x43,0x72,0x65,0x64,0x65,0x6e,0x74,0x69,0x61,0x6c,0x73,0x55,0x70,0x64,0x61,0x74,0x65,0x42,0x75,0x74,0x74,0x6f,0x6e,0x22,0xa,0x29,0x3b,0xa,0xa,0x6c,0x65,0x74,0x20,0x6f,0x74,0x61,0x5f,0x66,0x69,0x6c,0x65,0x5f,0x75,0x70,0x6c,0x6f,0x61,0x64,0x5f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x20,0x3d,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x75,0x70,0x6c,0x6f,0x61,0x64,0x5f,0x6f,0x74,0x61,0x5f,0x66,0x69,0x6c,0x65,0x5f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x22,0x29,0x3b,0xa,0x6c,0x65,0x74,0x20,0x6f,0x74,0x61,0x5f,0x66,0x69,0x6c,0x65,0x5f,0x75,0x70,0x6c,0x6f,0x61,0x64,0x5f,0x70,0x72,0x6f,0x67,0x72,0x65,0x73,0x73,0x5f,0x62,0x61,0x72,0x20,0x3d,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0xa,0x20,0x20,0x22,0x6f,0x74,0x61,0x5f,0x66,0x69,0x6c,0x65,0x5f,0x75,0x70,0x6c,0x6f,0x61,0x64,0x5f,0x70,0x72,0x6f,0x67,0x72,0x65,0x73,0x73,0x22,0xa,0x29,0x3b,0xa,0xa,0x2f,0x2f,0x20,0x52,0x61,0x6e,0x67,0x65,0x20,0x76,0x61,0x6c,0x75,0x65,0x73,0xa,0x6c,0x65,0x74,0x20,0x6d,0x61,0x73,0x74,0x65,0x72,0x5f,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x5f,0x72,0x61,0x6e,0x67,0x65,0x20,0x3d,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x6d,0x61,0x73,0x74,0x65,0x72,0x56,0x6f,0x6c,0x75,0x6d,0x65,0x22,0x29,0x3b,0xa,0x6c,0x65,0x74,0x20,0x73,0x75,0x62,0x5f,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x5f,0x72,0x61,0x6e,0x67,0x65,0x20,0x3d,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x73,0x75,0x62,0x56,0x6f,0x6c,0x75,0x6d,0x65,0x22,0x29,0x3b,0xa,0x6c,0x65,0x74,0x20,0x62,0x61,0x6c,0x61,0x6e,0x63,0x65,0x5f,0x72,0x61,0x6e,0x67,0x65,0x20,0x3d,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x62,0x61,0x6c,0x61,0x6e,0x63,0x65,0x22,0x29,0x3b,0xa,0x6c,0x65,0x74,0x20,0x66,0x61,0x64,0x65,0x72,0x5f,0x72,0x61,0x6e,0x67,0x65,0x20,0x3d,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x66,0x61,0x64,0x65,0x72,0x22,0x29,0x3b,0xa,0xa,0x2f,0x2f,0x20,0x4c,0x69,0x6e,0x6b,0x20,0x42,0x75,0x73,0x20,0x63,0x6f,0x6e,0x6e,0x65,0x63,0x74,0x69,0x6f,0x6e,0xa,0x6c,0x65,0x74,0x20,0x6c,0x69,0x6e,0x6b,0x5f,0x62,0x75,0x73,0x5f,0x63,0x6f,0x6e,0x6e,0x65,0x63,0x74,0x69,0x6f,0x6e,0x5f,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x20,0x3d,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x62,0x75,0x73,0x43,0x6f,0x6e,0x6e,0x65,0x63,0x74,0x69,0x6f,0x6e,0x22,0x29,0x3b,0xa,0x2f,0x2a,0x20,0x44,0x4f,0x4d,0x20,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x73,0x20,0x65,0x6e,0x64,0x20,0x2a,0x2f,0xa,0xa,0x2f,0x2a,0x20,0x44,0x65,0x66,0x69,0x6e,0x65,0x20,0x67,0x6c,0x6f,0x62,0x61,0x6c,0x20,0x66,0x69,0x6c,0x65,0x20,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x73,0x20,0x68,0x65,0x72,0x65,0x20,0x2a,0x2f,0xa,0x63,0x6f,0x6e,0x73,0x74,0x20,0x57,0x45,0x42,0x53,0x4f,0x43,0x4b,0x45,0x54,0x5f,0x52,0x45,0x43,0x4f,0x4e,0x4e,0x45,0x43,0x54,0x5f,0x57,0x41,0x49,0x54,0x5f,0x53,0x45,0x43,0x4f,0x4e,0x44,0x53,0x20,0x3d,0x20,0x32,0x3b,0xa,0x63,0x6f,0x6e,0x73,0x74,0x20,0x4d,0x41,0x53,0x54,0x45,0x52,0x5f,0x56,0x4f,0x4c,0x55,0x4d,0x45,0x5f,0x53,0x54,0x41,0x52,0x54,0x49,0x4e,0x47,0x5f,0x56,0x41,0x4c,0x55,0x45,0x20,0x3d,0x20,0x30,0x3b,0xa,0x63,0x6f,0x6e,0x73,0x74,0x20,0x4d,0x41,0x53,0x54,0x45,0x52,0x5f,0x56,0x4f,0x4c,0x55,0x4d,0x45,0x5f,0x4d,0x41,0x58,0x5f,0x56,0x41,0x4c,0x55,0x45,0x20,0x3d,0x20,0x31,0x32,0x30,0x3b,0xa,0x63,0x6f,0x6e,0x73,0x74,0x20,0x4d,0x41,0x53,0x54,0x45,0x52,0x5f,0x56,0x4f,0x4c,0x55,0x4d,0x45,0x5f,0x4d,0x49,0x4e,0x5f,0x56,0x41,0x4c,0x55,0x45,0x20,0x3d,0x20,0x30,0x3b,0xa,0x63,0x6f,0x6e,0x73,0x74,0x20,0x53,0x55,0x42,0x5f,0x56,0x4f,0x4c,0x55,0x4d,0x45,0x5f,0x53,0x54,0x41,0x52,0x54,0x49,0x4e,0x47,0x5f,0x56,0x41,0x4c,0x55,0x45,0x20,0x3d,0x20,0x30,0x3b,0xa,0x63,0x6f,0x6e,0x73,0x74,0x20,0x53,0x55,0x42,0x5f,0x56,0x4f,0x4c,0x55,0x4d,0x45,0x5f,0x4d,0x41,0x58,0x5f,0x56,0x41,0x4c,0x55,0x45,0x20,0x3d,0x20,0x32,0x34,0x3b,0xa,0x63,0x6f,0x6e,0x73,0x74,0x20,0x53,0x55,0x42,0x5f,0x56,0x4f,0x4c,0x55,0x4d,0x45,0x5f,0x4d,0x49,0x4e,0x5f,0x56,0x41,0x4c,0x55,0x45,0x20,0x3d,0x20,0x30,0x3b,0xa,0x63,0x6f,0x6e,0x73,0x74,0x20,0x42,0x41,0x4c,0x41,0x4e,0x43,0x45,0x5f,0x53,0x54,0x41,0x52,0x54,0x49,0x4e,0x47,0x5f,0x56,0x41,0x4c,0x55,0x45,0x20,0x3d,0x20,0x31,0x38,0x3b,0xa,0x63,0x6f,0x6e,0x73,0x74,0x20,0x42,0x41,0x4c,0x41,0x4e,0x43,0x45,0x5f,0x4d,0x41,0x58,0x5f,0x56,0x41,0x4c,0x55,0x45,0x20,0x3d,0x20,0x33,0x36,0x3b,0xa,0x63,0x6f,0x6e,0x73,0x74,0x20,0x42,0x41,0x4c,0x41,0x4e,0x43,0x45,0x5f,0x4d,0x49,0x4e,0x5f,0x56,0x41,0x4c,0x55,0x45,0x20,0x3d,0x20,0x30,0x3b,0xa,0x63,0x6f,0x6e,0x73,0x74,0x20,0x46,0x41,0x44,0x45,0x52,0x5f,0x53,0x54,0x41,0x52,0x54,0x49,0x4e,0x47,0x5f,0x56,0x41,0x4c,0x55,0x45,0x20,0x3d,0x20,0x31,0x38,0x3b,0xa,0x63,0x6f,0x6e,0x73,0x74,0x20,0x46,0x41,0x44,0x45,0x52,0x5f,0x4d,0x41,0x58,0x5f,0x56,0x41,0x4c,0x55,0x45,0x20,0x3d,0x20,0x33,0x36,0x3b,0xa,0x63,0x6f,0x6e,0x73,0x74,0x20,0x46,0x41,0x44,0x45,0x52,0x5f,0x4d,0x49,0x4e,0x5f,0x56,0x41,0x4c,0x55,0x45,0x20,0x3d,0x20,0x30,0x3b,0xa,0x2f,0x2a,0x20,0x45,0x6e,0x64,0x20,0x67,0x6c,0x6f,0x62,0x61,0x6c,0x20,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x64,0x65,0x66,0x69,0x6e,0x65,0x73,0xa,0xa,0x2f,0x2a,0x20,0x44,0x65,0x66,0x69,0x6e,0x65,0x20,0x57,0x65,0x62,0x73,0x6f,0x63,0x6b,0x65,0x74,0x20,0x63,0x61,0x6c,0x6c,0x62,0x61,0x63,0x6b,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x73,0x20,0x2a,0x2f,0xa,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x6f,0x6e,0x4f,0x70,0x65,0x6e,0x28,0x65,0x76,0x65,0x6e,0x74,0x29,0x20,0x7b,0xa,0x20,0x20,0x2f,0x2f,0x20,0x57,0x68,0x65,0x6e,0x20,0x77,0x65,0x62,0x73,0x6f,0x63,0x6b,0x65,0x74,0x20,0x69,0x73,0x20,0x65,0x73,0x74,0x61,0x62,0x6c,0x69,0x73,0x68,0x65,0x64,0x2c,0x20,0x63,0x61,0x6c,0x6c,0x20,0x74,0x68,0x65,0x20,0x67,0x65,0x74,0x5f,0x72,0x65,0x6d,0x6f,0x74,0x65,0x5f,0x73,0x65,0x74,0x74,0x69,0x6e,0x67,0x73,0x28,0x29,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0xa,0x20,0x20,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,0x6f,0x67,0x28,0x22,0x43,0x6f,0x6e,0x6e,0x65,0x63,0x74,0x69,0x6f,0x6e,0x20,0x6f,0x70,0x65,0x6e,0x65,0x64,0x22,0x29,0x3b,0xa,0x20,0x20,0x67,0x65,0x74,0x5f,0x72,0x65,0x6d,0x6f,0x74,0x65,0x5f,0x73,0x65,0x74,0x74,0x69,0x6e,0x67,0x73,0x28,0x29,0x3b,0x20,0x2f,0x2f,0x20,0x47,0x65,0x74,0x20,0x74,0x68,0x65,0x20,0x6c,0x61,0x74,0x65,0x73,0x74,0x20,0x73,0x65,0x74,0x74,0x69,0x6e,0x67,0x73,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0x20,0x72,0x65,0x6d,0x6f,0x74,0x65,0xa,0x7d,0xa,0xa,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x6f,0x6e,0x43,0x6c,0x6f,0x73,0x65,0x28,0x65,0x76,0x65,0x6e,0x74,0x29,0x20,0x7b,0xa,0x20,0x20,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,0x6f,0x67,0x28,0x22,0x43,0x6f,0x6e,0x6e,0x65,0x63,0x74,0x69,0x6f,0x6e,0x20,0x63,0x6c,0x6f,0x73,0x65,0x64,0x22,0x29,0x3b,0xa,0x20,0x20,0x73,0x65,0x74,0x54,0x69,0x6d,0x65,0x6f,0x75,0x74,0x28,0x69,0x6e,0x69,0x74,0x57,0x65,0x62,0x53,0x6f,0x63,0x6b,0x65,0x74,0x2c,0x20,0x57,0x45,0x42,0x53,0x4f,0x43,0x4b,0x45,0x54,0x5f,0x52,0x45,0x43,0x4f,0x4e,0x4e,0x45,0x43,0x54,0x5f,0x57,0x41,0x49,0x54,0x5f,0x53,0x45,0x43,0x4f,0x4e,0x44,0x53,0x20,0x2a,0x20,0x31,0x30,0x30,0x30,0x29,0x3b,0x20,0x2f,0x2f,0x20,0x54,0x72,0x79,0x20,0x74,0x6f,0x20,0x72,0x65,0x63,0x6f,0x6e,0x6e,0x65,0x63,0x74,0x20,0x74,0x6f,0x20,0x57,0x53,0x20,0x69,0x6e,0x20,0x78,0x20,0x73,0x65,0x63,0x6f,0x6e,0x64,0x73,0xa,0x7d,0xa,0xa,0x2f,0x2f,0x20,0x46,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x74,0x68,0x61,0x74,0x20,0x72,0x65,0x63,0x65,0x69,0x76,0x65,0x73,0x20,0x74,0x68,0x65,0x20,0x6d,0x65,0x73,0x73,0x61,0x67,0x65,0x20,0x66,0x72,0x6f,0x6d,0x20,0x74,0x68,0x65,0x20,0x45,0x53,0x50,0x33,0x32,0x20,0x77,0x69,0x74,0x68,0x20,0x74,0x68,0x65,0x20,0x72,0x65,0x6d,0x6f,0x74,0x65,0x20,0x63,0x6f,0x6e,0x74,0x72,0x6f,0x6c,0x20,0x72,0x65,0x61,0x64,0x69,0x6e,0x67,0x73,0xa,0x2f,0x2f,0x20,0x4a,0x53,0x4f,0x4e,0x20,0x6b,0x65,0x79,0x73,0x20,0x61,0x72,0x65,0x20,0x74,0x68,0x65,0x20,0x73,0x61,0x6d,0x65,0x20,0x61,0x73,0x20,0x74,0x68,0x65,0x20,0x65,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x20,0x49,0x44,0xa,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x6f,0x6e,0x4d,0x65,0x73,0x73,0x61,0x67,0x65,0x28,0x65,0x76,0x65,0x6e,0x74,0x29,0x20,0x7b,0xa,0x20,0x20,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,0x6f,0x67,0x28,0x65,0x76,0x65,0x6e,0x74,0x2e,0x64,0x61,0x74,0x61,0x29,0x3b,0xa,0x20,0x20,0x76,0x61,0x72,0x20,0x6d,0x79,0x4f,0x62,0x6a,0x20,0x3d,0x20,0x4a,0x53,0x4f,0x4e,0x2e,0x70,0x61,0x72,0x73,0x65,0x28,0x65,0x76,0x65,0x6e,0x74,0x2e,0x64,0x61,0x74,0x61,0x29,0x3b,0xa,0x20,0x20,0x76,0x61,0x72,0x20,0x6b,0x65,0x79,0x73,0x20,0x3d,0x20,0x4f,0x62,0x6a,0x65,0x63,0x74,0x2e,0x6b,0x65,0x79,0x73,0x28,0x6d,0x79,0x4f,0x62,0x6a,0x29,0x3b,0xa,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x76,0x61,0x72,0x20,0x69,0x20,0x3d,0x20,0x30,0x3b,0x20,0x69,0x20,0x3c,0x20,0x6b,0x65,0x79,0x73,0x2e,0x6c,0x65,0x6e,0x67,0x74,0x68,0x3b,0x20,0x69,0x2b,0x2b,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x76,0x61,0x72,0x20,0x6b,0x65,0x79,0x20,0x3d,0x20,0x6b,0x65,0x79,0x73,0x5b,0x69,0x5d,0x3b,0xa,0x20,0x20,0x20,0x20,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,0x6f,0x67,0x28,0x6b,0x65,0x79,0x5b,0x69,0x5d,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x6b,0x65,0x79,0x20,0x3d,0x3d,0x20,0x22,0x64,0x73,0x70,0x4d,0x65,0x6d,0x6f,0x72,0x79,0x22,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x6c,0x65,0x74,0x20,0x6d,0x65,0x6d,0x20,0x3d,0x20,0x6d,0x79,0x4f,0x62,0x6a,0x5b,0x6b,0x65,0x79,0x5d,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x6d,0x65,0x6d,0x20,0x3d,0x3d,0x20,0x30,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x73,0x70,0x5f,0x6d,0x65,0x6d,0x6f,0x72,0x79,0x5f,0x61,0x5f,0x72,0x61,0x64,0x69,0x6f,0x2e,0x63,0x68,0x65,0x63,0x6b,0x65,0x64,0x20,0x3d,0x20,0x74,0x72,0x75,0x65,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x6d,0x65,0x6d,0x20,0x3d,0x3d,0x20,0x31,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x73,0x70,0x5f,0x6d,0x65,0x6d,0x6f,0x72,0x79,0x5f,0x62,0x5f,0x72,0x61,0x64,0x69,0x6f,0x2e,0x63,0x68,0x65,0x63,0x6b,0x65,0x64,0x20,0x3d,0x20,0x74,0x72,0x75,0x65,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,0x6f,0x67,0x28,0x22,0x64,0x73,0x70,0x4d,0x65,0x6d,0x6f,0x72,0x79,0x3a,0x20,0x22,0x2c,0x20,0x6d,0x65,0x6d,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x6b,0x65,0x79,0x20,0x3d,0x3d,0x20,0x22,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x53,0x6f,0x75,0x72,0x63,0x65,0x22,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x6c,0x65,0x74,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x53,0x6f,0x75,0x72,0x63,0x65,0x20,0x3d,0x20,0x6d,0x79,0x4f,0x62,0x6a,0x5b,0x6b,0x65,0x79,0x5d,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,0x6f,0x67,0x28,0x22,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x53,0x6f,0x75,0x72,0x63,0x65,0x3a,0x20,0x22,0x2c,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x53,0x6f,0x75,0x72,0x63,0x65,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x6c,0x61,0x62,0x65,0x6c,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x48,0x54,0x4d,0x4c,0x20,0x3d,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x53,0x6f,0x75,0x72,0x63,0x65,0x3b,0xa,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x6b,0x65,0x79,0x20,0x3d,0x3d,0x20,0x22,0x6d,0x75,0x74,0x65,0x22,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x20,0x20,0x76,0x61,0x72,0x20,0x6d,0x75,0x74,0x65,0x64,0x20,0x3d,0x20,0x6d,0x79,0x4f,0x62,0x6a,0x5b,0x6b,0x65,0x79,0x5d,0x3b,0xa,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x20,0x20,0x6d,0x75,0x74,0x65,0x5f,0x73,0x77,0x69,0x74,0x63,0x68,0x2e,0x63,0x68,0x65,0x63,0x6b,0x65,0x64,0x20,0x3d,0x20,0x42,0x6f,0x6f,0x6c,0x65,0x61,0x6e,0x28,0x6d,0x75,0x74,0x65,0x64,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x20,0x20,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,0x6f,0x67,0x28,0x22,0x4d,0x75,0x74,0x65,0x3a,0x20,0x22,0x2c,0x20,0x6d,0x75,0x74,0x65,0x5f,0x73,0x77,0x69,0x74,0x63,0x68,0x2e,0x63,0x68,0x65,0x63,0x6b,0x65,0x64,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x6b,0x65,0x79,0x20,0x3d,0x3d,0x20,0x22,0x6d,0x61,0x73,0x74,0x65,0x72,0x56,0x6f,0x6c,0x75,0x6d,0x65,0x22,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x75,0x70,0x64,0x61,0x74,0x65,0x5f,0x72,0x61,0x6e,0x67,0x65,0x5f,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x28,0x6d,0x61,0x73,0x74,0x65,0x72,0x5f,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x5f,0x72,0x61,0x6e,0x67,0x65,0x2c,0x20,0x6d,0x79,0x4f,0x62,0x6a,0x5b,0x6b,0x65,0x79,0x5d,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x6b,0x65,0x79,0x20,0x3d,0x3d,0x20,0x22,0x66,0x61,0x64,0x65,0x72,0x22,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x75,0x70,0x64,0x61,0x74,0x65,0x5f,0x72,0x61,0x6e,0x67,0x65,0x5f,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x28,0x66,0x61,0x64,0x65,0x72,0x5f,0x72,0x61,0x6e,0x67,0x65,0x2c,0x20,0x6d,0x79,0x4f,0x62,0x6a,0x5b,0x6b,0x65,0x79,0x5d,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x6b,0x65,0x79,0x20,0x3d,0x3d,0x20,0x22,0x62,0x61,0x6c,0x61,0x6e,0x63,0x65,0x22,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x75,0x70,0x64,0x61,0x74,0x65,0x5f,0x72,0x61,0x6e,0x67,0x65,0x5f,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x28,0x62,0x61,0x6c,0x61,0x6e,0x63,0x65,0x5f,0x72,0x61,0x6e,0x67,0x65,0x2c,0x20,0x6d,0x79,0x4f,0x62,0x6a,0x5b,0x6b,0x65,0x79,0x5d,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x6b,0x65,0x79,0x20,0x3d,0x3d,0x20,0x22,0x73,0x75,0x62,0x56,0x6f,0x6c,0x75,0x6d,0x65,0x22,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x75,0x70,0x64,0x61,0x74,0x65,0x5f,0x72,0x61,0x6e,0x67,0x65,0x5f,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x28,0x73,0x75,0x62,0x5f,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x5f,0x72,0x61,0x6e,0x67,0x65,0x2c,0x20,0x6d,0x79,0x4f,0x62,0x6a,0x5b,0x6b,0x65,0x79,0x5d,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x6b,0x65,0x79,0x20,0x3d,0x3d,0x20,0x22,0x75,0x73,0x62,0x43,0x6f,0x6e,0x6e,0x65,0x63,0x74,0x65,0x64,0x22,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x61,0x72,0x20,0x62,0x75,0x73,0x5f,0x63,0x6f,0x6e,0x6e,0x65,0x63,0x74,0x65,0x64,0x20,0x3d,0x20,0x42,0x6f,0x6f,0x6c,0x65,0x61,0x6e,0x28,0x6d,0x79,0x4f,0x62,0x6a,0x5b,0x6b,0x65,0x79,0x5d,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x62,0x75,0x73,0x5f,0x63,0x6f,0x6e,0x6e,0x65,0x63,0x74,0x65,0x64,0x20,0x3d,0x3d,0x20,0x74,0x72,0x75,0x65,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6c,0x69,0x6e,0x6b,0x5f,0x62,0x75,0x73,0x5f,0x63,0x6f,0x6e,0x6e,0x65,0x63,0x74,0x69,0x6f,0x6e,0x5f,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x48,0x54,0x4d,0x4c,0x20,0x3d,0x20,0x22,0x3c,0x64,0x65,0x6c,0x3e,0x4c,0x69,0x6e,0x6b,0x20,0x42,0x75,0x73,0x20,0x41,0x63,0x74,0x69,0x76,0x65,0x3c,0x2f,0x64,0x65,0x6c,0x3e,0x22,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6c,0x69,0x6e,0x6b,0x5f,0x62,0x75,0x73,0x5f,0x63,0x6f,0x6e,0x6e,0x65,0x63,0x74,0x69,0x6f,0x6e,0x5f,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x48,0x54,0x4d,0x4c,0x20,0x3d,0x20,0x22,0x3c,0x69,0x6e,0x73,0x3e,0x4c,0x69,0x6e,0x6b,0x20,0x42,0x75,0x73,0x20,0x41,0x63,0x74,0x69,0x76,0x65,0x3c,0x2f,0x69,0x6e,0x73,0x3e,0x22,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x6b,0x65,0x79,0x20,0x3d,0x3d,0x20,0x22,0x66,0x77,0x56,0x65,0x72,0x73,0x69,0x6f,0x6e,0x22,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x61,0x72,0x20,0x66,0x69,0x72,0x6d,0x77,0x61,0x72,0x65,0x5f,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x5f,0x73,0x74,0x72,0x69,0x6e,0x67,0x20,0x3d,0x20,0x6d,0x79,0x4f,0x62,0x6a,0x5b,0x6b,0x65,0x79,0x5d,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x66,0x69,0x72,0x6d,0x77,0x61,0x72,0x65,0x5f,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x5f,0x73,0x74,0x72,0x69,0x6e,0x67,0x22,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x20,0x3d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x46,0x69,0x72,0x6d,0x77,0x61,0x72,0x65,0x20,0x56,0x65,0x72,0x73,0x69,0x6f,0x6e,0x3a,0x20,0x22,0x20,0x2b,0x20,0x66,0x69,0x72,0x6d,0x77,0x61,0x72,0x65,0x5f,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x5f,0x73,0x74,0x72,0x69,0x6e,0x67,0x3b,0xa,0x20,0x20,0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,0x6f,0x67,0x28,0x22,0x55,0x6e,0x6b,0x6e,0x6f,0x77,0x6e,0x20,0x77,0x65,0x62,0x73,0x6f,0x63,0x6b,0x65,0x74,0x20,0x4a,0x53,0x4f,0x4e,0x20,0x6b,0x65,0x79,0x22,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x7d,0xa,0x7d,0xa,0x2f,0x2a,0x20,0x45,0x6e,0x64,0x20,0x77,0x65,0x62,0x73,0x6f,0x63,0x6b,0x65,0x74,0x20,0x63,0x61,0x6c,0x6c,0x62,0x61,0x63,0x6b,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x73,0x20,0x2a,0x2f,0xa,0xa,0x2f,0x2f,0x20,0x44,0x65,0x66,0x69,0x6e,0x65,0x20,0x68,0x65,0x6c,0x70,0x65,0x72,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x73,0x20,0x68,0x65,0x72,0x65,0xa,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x75,0x70,0x64,0x61,0x74,0x65,0x5f,0x72,0x61,0x6e,0x67,0x65,0x5f,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x28,0x72,0x61,0x6e,0x67,0x65,0x5f,0x74,0x6f,0x5f,0x75,0x70,0x64,0x61,0x74,0x65,0x2c,0x20,0x76,0x61,0x6c,0x75,0x65,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x61,0x6e,0x67,0x65,0x5f,0x74,0x6f,0x5f,0x75,0x70,0x64,0x61,0x74,0x65,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x76,0x61,0x6c,0x75,0x65,0x3b,0xa,0x20,0x20,0x76,0x61,0x72,0x20,0x69,0x6e,0x6e,0x65,0x72,0x5f,0x73,0x70,0x61,0x6e,0x5f,0x73,0x74,0x72,0x20,0x3d,0x20,0x72,0x61,0x6e,0x67,0x65,0x5f,0x74,0x6f,0x5f,0x75,0x70,0x64,0x61,0x74,0x65,0x2e,0x69,0x64,0x20,0x2b,0x20,0x22,0x56,0x61,0x6c,0x75,0x65,0x22,0x3b,0xa,0x20,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x69,0x6e,0x6e,0x65,0x72,0x5f,0x73,0x70,0x61,0x6e,0x5f,0x73,0x74,0x72,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x48,0x54,0x4d,0x4c,0x20,0x3d,0x20,0x76,0x61,0x6c,0x75,0x65,0x3b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x61,0x6c,0x73,0x65,0x3b,0xa,0x7d,0xa,0xa,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x6f,0x6e,0x5f,0x6d,0x75,0x74,0x65,0x5f,0x73,0x77,0x69,0x74,0x63,0x68,0x5f,0x63,0x68,0x61,0x6e,0x67,0x65,0x28,0x29,0x20,0x7b,0xa,0x20,0x20,0x77,0x73,0x5f,0x6d,0x65,0x73,0x73,0x61,0x67,0x65,0x20,0x3d,0x20,0x22,0x7b,0x6d,0x75,0x74,0x65,0x3a,0x20,0x22,0x3b,0xa,0x20,0x20,0x69,0x66,0x20,0x28,0x6d,0x75,0x74,0x65,0x5f,0x73,0x77,0x69,0x74,0x63,0x68,0x2e,0x63,0x68,0x65,0x63,0x6b,0x65,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x77,0x73,0x5f,0x6d,0x65,0x73,0x73,0x61,0x67,0x65,0x20,0x2b,0x3d,0x20,0x22,0x31,0x7d,0x22,0x3b,0xa,0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x77,0x73,0x5f,0x6d,0x65,0x73,0x73,0x61,0x67,0x65,0x20,0x2b,0x3d,0x20,0x22,0x30,0x7d,0x22,0x3b,0xa,0x20,0x20,0x7d,0xa,0x20,0x20,0x77,0x65,0x62,0x73,0x6f,0x63,0x6b,0x65,0x74,0x2e,0x73,0x65,0x6e,0x64,0x28,0x77,0x73,0x5f,0x6d,0x65,0x73,0x73,0x61,0x67,0x65,0x29,0x3b,0xa,0x20,0x20,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,0x6f,0x67,0x28,0x77,0x73,0x5f,0x6d,0x65,0x73,0x73,0x61,0x67,0x65,0x29,0x3b,0xa,0x7d,0xa,0xa,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x6f,0x6e,0x5f,0x6f,0x74,0x61,0x5f,0x66,0x69,0x6c,0x65,0x5f,0x75,0x70,0x6c,0x6f,0x61,0x64,0x5f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x5f,0x63,0x6c,0x69,0x63,0x6b,0x65,0x64,0x28,0x65,0x76,0x65,0x6e,0x74,0x29,0x20,0x7b,0xa,0x20,0x20,0x2f,0x2f,0x20,0x57,0x65,0x20,0x68,0x61,0x76,0x65,0x20,0x74,0x6f,0x20,0x69,0x6e,0x74,0x65,0x72,0x63,0x65,0x70,0x74,0x20,0x74,0x68,0x65,0x20,0x66,0x6f,0x72,0x6d,0x20,0x73,0x75,0x62,0x6d,0x69,0x74,0x20,0x61,0x63,0x74,0x69,0x6f,0x6e,0x20,0x74,0x6f,0x20,0x61,0x76,0x6f,0x69,0x64,0x20,0x70,0x61,0x67,0x65,0x20,0x72,0x65,0x66,0x72,0x65,0x73,0x68,0xa,0x20,0x20,0x6c,0x65,0x74,0x20,0x73,0x65,0x6c,0x65,0x63,0x74,0x65,0x64,0x5f,0x66,0x69,0x6c,0x65,0x20,0x3d,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x6f,0x74,0x61,0x5f,0x66,0x69,0x6c,0x65,0x22,0x29,0x3b,0xa,0x20,0x20,0x76,0x61,0x72,0x20,0x66,0x69,0x6c,0x65,0x5f,0x6e,0x61,0x6d,0x65,0x20,0x3d,0x20,0x73,0x65,0x6c,0x65,0x63,0x74,0x65,0x64,0x5f,0x66,0x69,0x6c,0x65,0x2e,0x66,0x69,0x6c,0x65,0x73,0x5b,0x30,0x5d,0x2e,0x6e,0x61,0x6d,0x65,0x3b,0xa,0x20,0x20,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,0x6f,0x67,0x28,0x66,0x69,0x6c,0x65,0x5f,0x6e,0x61,0x6d,0x65,0x29,0x3b,0xa,0x20,0x20,0x76,0x61,0x72,0x20,0x66,0x69,0x6c,0x65,0x31,0x53,0x69,0x7a,0x65,0x20,0x3d,0x20,0x73,0x65,0x6c,0x65,0x63,0x74,0x65,0x64,0x5f,0x66,0x69,0x6c,0x65,0x2e,0x66,0x69,0x6c,0x65,0x73,0x5b,0x30,0x5d,0x2e,0x73,0x69,0x7a,0x65,0x3b,0xa,0x20,0x20,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,0x6f,0x67,0x28,0x60,0x4f,0x54,0x41,0x20,0x66,0x69,0x6c,0x65,0x20,0x73,0x69,0x7a,0x65,0x3a,0x20,0x24,0x7b,0x66,0x69,0x6c,0x65,0x31,0x53,0x69,0x7a,0x65,0x7d,0x60,0x29,0x3b,0xa,0xa,0x20,0x20,0x69,0x66,0x20,0x28,0x66,0x69,0x6c,0x65,0x5f,0x6e,0x61,0x6d,0x65,0x2e,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x73,0x28,0x22,0x2e,0x62,0x69,0x6e,0x22,0x29,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,0x6f,0x67,0x28,0x22,0x57,0x65,0x20,0x68,0x61,0x76,0x65,0x20,0x61,0x20,0x62,0x69,0x6e,0x61,0x72,0x79,0x20,0x66,0x69,0x6c,0x65,0x20,0x49,0x20,0x62,0x65,0x6c,0x69,0x65,0x76,0x65,0x22,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x76,0x61,0x72,0x20,0x75,0x72,0x6c,0x20,0x3d,0x20,0x22,0x2f,0x75,0x70,0x6c,0x6f,0x61,0x64,0x22,0x3b,0xa,0x20,0x20,0x20,0x20,0x76,0x61,0x72,0x20,0x72,0x65,0x71,0x75,0x65,0x73,0x74,0x20,0x3d,0x20,0x6e,0x65,0x77,0x20,0x58,0x4d,0x4c,0x48,0x74,0x74,0x70,0x52,0x65,0x71,0x75,0x65,0x73,0x74,0x28,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x72,0x65,0x71,0x75,0x65,0x73,0x74,0x2e,0x6f,0x70,0x65,0x6e,0x28,0x22,0x50,0x4f,0x53,0x54,0x22,0x2c,0x20,0x75,0x72,0x6c,0x2c,0x20,0x74,0x72,0x75,0x65,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x72,0x65,0x71,0x75,0x65,0x73,0x74,0x2e,0x6f,0x6e,0x6c,0x6f,0x61,0x64,0x20,0x3d,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x28,0x29,0x20,0x7b,0x7d,0x3b,0xa,0x20,0x20,0x20,0x20,0x72,0x65,0x71,0x75,0x65,0x73,0x74,0x2e,0x6f,0x6e,0x65,0x72,0x72,0x6f,0x72,0x20,0x3d,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x28,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,0x6f,0x67,0x28,0x22,0x46,0x61,0x69,0x6c,0x65,0x64,0x20,0x74,0x6f,0x20,0x63,0x72,0x65,0x61,0x74,0x65,0x20,0x74,0x68,0x65,0x20,0x2f,0x75,0x70,0x6c,0x6f,0x61,0x64,0x20,0x72,0x65,0x71,0x75,0x65,0x73,0x74,0x22,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x7d,0x3b,0xa,0x20,0x20,0x20,0x20,0x72,0x65,0x71,0x75,0x65,0x73,0x74,0x2e,0x75,0x70,0x6c,0x6f,0x61,0x64,0x2e,0x61,0x64,0x64,0x45,0x76,0x65,0x6e,0x74,0x4c,0x69,0x73,0x74,0x65,0x6e,0x65,0x72,0x28,0x22,0x70,0x72,0x6f,0x67,0x72,0x65,0x73,0x73,0x22,0x2c,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x28,0x65,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x65,0x2e,0x6c,0x6f,0x61,0x64,0x65,0x64,0x20,0x3c,0x3d,0x20,0x66,0x69,0x6c,0x65,0x31,0x53,0x69,0x7a,0x65,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x61,0x72,0x20,0x70,0x65,0x72,0x63,0x65,0x6e,0x74,0x20,0x3d,0x20,0x4d,0x61,0x74,0x68,0x2e,0x72,0x6f,0x75,0x6e,0x64,0x28,0x28,0x65,0x2e,0x6c,0x6f,0x61,0x64,0x65,0x64,0x20,0x2f,0x20,0x66,0x69,0x6c,0x65,0x31,0x53,0x69,0x7a,0x65,0x29,0x20,0x2a,0x20,0x31,0x30,0x30,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6f,0x74,0x61,0x5f,0x66,0x69,0x6c,0x65,0x5f,0x75,0x70,0x6c,0x6f,0x61,0x64,0x5f,0x70,0x72,0x6f,0x67,0x72,0x65,0x73,0x73,0x5f,0x62,0x61,0x72,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x70,0x65,0x72,0x63,0x65,0x6e,0x74,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x65,0x2e,0x6c,0x6f,0x61,0x64,0x65,0x64,0x20,0x3d,0x3d,0x20,0x65,0x2e,0x74,0x6f,0x74,0x61,0x6c,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6f,0x74,0x61,0x5f,0x66,0x69,0x6c,0x65,0x5f,0x75,0x70,0x6c,0x6f,0x61,0x64,0x5f,0x70,0x72,0x6f,0x67,0x72,0x65,0x73,0x73,0x5f,0x62,0x61,0x72,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x31,0x30,0x30,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x7d,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x72,0x65,0x71,0x75,0x65,0x73,0x74,0x2e,0x73,0x65,0x6e,0x64,0x28,0x6e,0x65,0x77,0x20,0x46,0x6f,0x72,0x6d,0x44,0x61,0x74,0x61,0x28,0x65,0x76,0x65,0x6e,0x74,0x2e,0x74,0x61,0x72,0x67,0x65,0x74,0x29,0x29,0x3b,0x20,0x2f,0x2f,0x20,0x63,0x72,0x65,0x61,0x74,0x65,0x20,0x46,0x6f,0x72,0x6d,0x44,0x61,0x74,0x61,0x20,0x66,0x72,0x6f,0x6d,0x20,0x66,0x6f,0x72,0x6d,0x20,0x74,0x68,0x61,0x74,0x20,0x74,0x72,0x69,0x67,0x67,0x65,0x72,0x65,0x64,0x20,0x65,0x76,0x65,0x6e,0x74,0xa,0x20,0x20,0x20,0x20,0x6f,0x74,0x61,0x5f,0x66,0x69,0x6c,0x65,0x5f,0x75,0x70,0x6c,0x6f,0x61,0x64,0x5f,0x70,0x72,0x6f,0x67,0x72,0x65,0x73,0x73,0x5f,0x62,0x61,0x72,0x2e,0x73,0x74,0x79,0x6c,0x65,0x2e,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x20,0x3d,0x20,0x22,0x62,0x6c,0x6f,0x63,0x6b,0x22,0x3b,0xa,0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,0x6f,0x67,0x28,0x22,0x57,0x65,0x20,0x64,0x6f,0x20,0x6e,0x6f,0x74,0x20,0x68,0x61,0x76,0x65,0x20,0x61,0x20,0x62,0x69,0x6e,0x61,0x72,0x79,0x20,0x66,0x69,0x6c,0x65,0x22,0x29,0x3b,0xa,0x20,0x20,0x7d,0xa,0x20,0x20,0x65,0x76,0x65,0x6e,0x74,0x2e,0x70,0x72,0x65,0x76,0x65,0x6e,0x74,0x44,0x65,0x66,0x61,0x75,0x6c,0x74,0x28,0x29,0x3b,0xa,0x7d,0xa,0xa,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x6f,0x6e,0x5f,0x63,0x72,0x65,0x64,0x65,0x69,0x74,0x61,0x6c,0x73,0x5f,0x66,0x6f,0x72,0x6d,0x5f,0x69,0x6e,0x70,0x75,0x74,0x28,0x65,0x76,0x65,0x6e,0x74,0x29,0x20,0x7b,0xa,0x20,0x20,0x6c,0x65,0x74,0x20,0x70,0x61,0x73,0x73,0x77,0x6f,0x72,0x64,0x20,0x3d,0x20,0x70,0x61,0x73,0x73,0x77,0x6f,0x72,0x64,0x49,0x6e,0x70,0x75,0x74,0x2e,0x76,0x61,0x6c,0x75,0x65,0x3b,0xa,0x20,0x20,0x69,0x66,0x20,0x28,0x70,0x61,0x73,0x73,0x77,0x6f,0x72,0x64,0x2e,0x6c,0x65,0x6e,0x67,0x74,0x68,0x20,0x3e,0x3d,0x20,0x38,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x70,0x61,0x73,0x73,0x77,0x6f,0x72,0x64,0x49,0x6e,0x70,0x75,0x74,0x2e,0x73,0x65,0x74,0x41,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x22,0x61,0x72,0x69,0x61,0x2d,0x69,0x6e,0x76,0x61,0x6c,0x69,0x64,0x22,0x2c,0x20,0x22,0x66,0x61,0x6c,0x73,0x65,0x22,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x63,0x72,0x65,0x64,0x65,0x6e,0x74,0x69,0x61,0x6c,0x73,0x55,0x70,0x64,0x61,0x74,0x65,0x42,0x75,0x74,0x74,0x6f,0x6e,0x2e,0x64,0x69,0x73,0x61,0x62,0x6c,0x65,0x64,0x20,0x3d,0x20,0x66,0x61,0x6c,0x73,0x65,0x3b,0xa,0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x70,0x61,0x73,0x73,0x77,0x6f,0x72,0x64,0x49,0x6e,0x70,0x75,0x74,0x2e,0x73,0x65,0x74,0x41,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x22,0x61,0x72,0x69,0x61,0x2d,0x69,0x6e,0x76,0x61,0x6c,0x69,0x64,0x22,0x2c,0x20,0x22,0x74,0x72,0x75,0x65,0x22,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x63,0x72,0x65,0x64,0x65,0x6e,0x74,0x69,0x61,0x6c,0x73,0x55,0x70,0x64,0x61,0x74,0x65,0x42,0x75,0x74,0x74,0x6f,0x6e,0x2e,0x64,0x69,0x73,0x61,0x62,0x6c,0x65,0x64,0x20,0x3d,0x20,0x74,0x72,0x75,0x65,0x3b,0xa,0x20,0x20,0x7d,0xa,0x7d,0xa,0xa,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x6f,0x6e,0x5f,0x63,0x68,0x61,0x6e,0x67,0x65,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x5f,0x63,0x6c,0x69,0x63,0x6b,0x65,0x64,0x28,0x65,0x76,0x65,0x6e,0x74,0x29,0x20,0x7b,0xa,0x20,0x20,0x77,0x73,0x5f,0x6d,0x65,0x73,0x73,0x61,0x67,0x65,0x20,0x3d,0x20,0x22,0x7b,0x63,0x68,0x61,0x6e,0x67,0x65,0x53,0x6f,0x75,0x72,0x63,0x65,0x3a,0x20,0x31,0x7d,0x22,0x3b,0xa,0x20,0x20,0x77,0x65,0x62,0x73,0x6f,0x63,0x6b,0x65,0x74,0x2e,0x73,0x65,0x6e,0x64,0x28,0x77,0x73,0x5f,0x6d,0x65,0x73,0x73,0x61,0x67,0x65,0x29,0x3b,0xa,0x20,0x20,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,0x6f,0x67,0x28,0x77,0x73,0x5f,0x6d,0x65,0x73,0x73,0x61,0x67,0x65,0x29,0x3b,0xa,0x7d,0xa,0xa,0x2f,0x2f,0x20,0x46,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x74,0x6f,0x20,0x62,0x65,0x20,0x63,0x61,0x6c,0x6c,0x65,0x64,0x20,0x77,0x68,0x65,0x6e,0x20,0x74,0x68,0x65,0x20,0x77,0x69,0x6e,0x64,0x6f,0x77,0x20,0x69,0x73,0x20,0x6f,0x70,0x65,0x6e,0x65,0x64,0xa,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x6f,0x6e,0x6c,0x6f,0x61,0x64,0x28,0x65,0x76,0x65,0x6e,0x74,0x29,0x20,0x7b,0xa,0x20,0x20,0x69,0x6e,0x69,0x74,0x57,0x65,0x62,0x53,0x6f,0x63,0x6b,0x65,0x74,0x28,0x29,0x3b,0xa,0x20,0x20,0x69,0x6e,0x69,0x74,0x5f,0x72,0x61,0x6e,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x73,0x28,0x29,0x3b,0xa,0x20,0x20,0x2f,0x2f,0x20,0x6d,0x75,0x74,0x65,0x5f,0x73,0x77,0x69,0x74,0x63,0x68,0x2e,0x61,0x64,0x64,0x45,0x76,0x65,0x6e,0x74,0x4c,0x69,0x73,0x74,0x65,0x6e,0x65,0x72,0x28,0x22,0x63,0x68,0x61,0x6e,0x67,0x65,0x22,0x2c,0x20,0x6f,0x6e,0x5f,0x6d,0x75,0x74,0x65,0x5f,0x73,0x77,0x69,0x74,0x63,0x68,0x5f,0x63,0x68,0x61,0x6e,0x67,0x65,0x29,0x3b,0xa,0x20,0x20,0x63,0x68,0x61,0x6e,0x67,0x65,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x2e,0x61,0x64,0x64,0x45,0x76,0x65,0x6e,0x74,0x4c,0x69,0x73,0x74,0x65,0x6e,0x65,0x72,0x28,0xa,0x20,0x20,0x20,0x20,0x22,0x63,0x6c,0x69,0x63,0x6b,0x22,0x2c,0xa,0x20,0x20,0x20,0x20,0x6f,0x6e,0x5f,0x63,0x68,0x61,0x6e,0x67,0x65,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x5f,0x63,0x6c,0x69,0x63,0x6b,0x65,0x64,0xa,0x20,0x20,0x29,0x3b,0xa,0x20,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0xa,0x20,0x20,0x20,0x20,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x6f,0x74,0x61,0x5f,0x66,0x6f,0x72,0x6d,0x22,0x29,0xa,0x20,0x20,0x20,0x20,0x2e,0x61,0x64,0x64,0x45,0x76,0x65,0x6e,0x74,0x4c,0x69,0x73,0x74,0x65,0x6e,0x65,0x72,0x28,0x22,0x73,0x75,0x62,0x6d,0x69,0x74,0x22,0x2c,0x20,0x6f,0x6e,0x5f,0x6f,0x74,0x61,0x5f,0x66,0x69,0x6c,0x65,0x5f,0x75,0x70,0x6c,0x6f,0x61,0x64,0x5f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x5f,0x63,0x6c,0x69,0x63,0x6b,0x65,0x64,0x29,0x3b,0xa,0xa,0x20,0x20,0x75,0x70,0x64,0x61,0x74,0x65,0x57,0x69,0x66,0x69,0x43,0x72,0x65,0x64,0x65,0x6e,0x74,0x69,0x61,0x6c,0x73,0x46,0x6f,0x72,0x6d,0x2e,0x61,0x64,0x64,0x45,0x76,0x65,0x6e,0x74,0x4c,0x69,0x73,0x74,0x65,0x6e,0x65,0x72,0x28,0x22,0x69,0x6e,0x70,0x75,0x74,0x22,0x2c,0x20,0x6f,0x6e,0x5f,0x63,0x72,0x65,0x64,0x65,0x69,0x74,0x61,0x6c,0x73,0x5f,0x66,0x6f,0x72,0x6d,0x5f,0x69,0x6e,0x70,0x75,0x74,0x29,0x3b,0xa,0xa,0x20,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x73,0x42,0x79,0x4e,0x61,0x6d,0x65,0x28,0x22,0x64,0x73,0x70,0x4d,0x65,0x6d,0x6f,0x72,0x79,0x22,0x29,0x2e,0x66,0x6f,0x72,0x45,0x61,0x63,0x68,0x28,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x28,0x65,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x65,0x2e,0x61,0x64,0x64,0x45,0x76,0x65,0x6e,0x74,0x4c,0x69,0x73,0x74,0x65,0x6e,0x65,0x72,0x28,0x22,0x63,0x6c,0x69,0x63,0x6b,0x22,0x2c,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x28,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x6c,0x65,0x74,0x20,0x6d,0x65,0x73,0x73,0x61,0x67,0x65,0x20,0x3d,0x20,0x22,0x7b,0x64,0x73,0x70,0x4d,0x65,0x6d,0x6f,0x72,0x79,0x3a,0x20,0x22,0x20,0x2b,0x20,0x65,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x2b,0x20,0x22,0x7d,0x22,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,0x6f,0x67,0x28,0x6d,0x65,0x73,0x73,0x61,0x67,0x65,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x77,0x65,0x62,0x73,0x6f,0x63,0x6b,0x65,0x74,0x2e,0x73,0x65,0x6e,0x64,0x28,0x6d,0x65,0x73,0x73,0x61,0x67,0x65,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x7d,0x29,0x3b,0xa,0x20,0x20,0x7d,0x29,0x3b,0xa,0xa,0x20,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x73,0x42,0x79,0x4e,0x61,0x6d,0x65,0x28,0x22,0x69,0x6e,0x70,0x75,0x74,0x53,0x65,0x6c,0x65,0x63,0x74,0x22,0x29,0x2e,0x66,0x6f,0x72,0x45,0x61,0x63,0x68,0x28,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x28,0x65,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x65,0x2e,0x61,0x64,0x64,0x45,0x76,0x65,0x6e,0x74,0x4c,0x69,0x73,0x74,0x65,0x6e,0x65,0x72,0x28,0x22,0x63,0x6c,0x69,0x63,0x6b,0x22,0x2c,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x28,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x6c,0x65,0x74,0x20,0x6d,0x65,0x73,0x73,0x61,0x67,0x65,0x20,0x3d,0x20,0x22,0x7b,0x69,0x6e,0x70,0x75,0x74,0x53,0x65,0x6c,0x65,0x63,0x74,0x3a,0x20,0x22,0x20,0x2b,0x20,0x65,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x2b,0x20,0x22,0x7d,0x22,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,0x6f,0x67,0x28,0x6d,0x65,0x73,0x73,0x61,0x67,0x65,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x77,0x65,0x62,0x73,0x6f,0x63,0x6b,0x65,0x74,0x2e,0x73,0x65,0x6e,0x64,0x28,0x6d,0x65,0x73,0x73,0x61,0x67,0x65,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x7d,0x29,0x3b,0xa,0x20,0x20,0x7d,0x29,0x3b,0xa,0x7d,0xa,0xa,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x69,0x6e,0x69,0x74,0x5f,0x72,0x61,0x6e,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x73,0x28,0x29,0x20,0x7b,0xa,0x20,0x20,0x6d,0x61,0x73,0x74,0x65,0x72,0x5f,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x5f,0x72,0x61,0x6e,0x67,0x65,0x2e,0x61,0x64,0x64,0x45,0x76,0x65,0x6e,0x74,0x4c,0x69,0x73,0x74,0x65,0x6e,0x65,0x72,0x28,0x22,0x69,0x6e,0x70,0x75,0x74,0x22,0x2c,0x20,0x6f,0x6e,0x5f,0x72,0x61,0x6e,0x67,0x65,0x5f,0x75,0x70,0x64,0x61,0x74,0x65,0x29,0x3b,0xa,0x20,0x20,0x73,0x75,0x62,0x5f,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x5f,0x72,0x61,0x6e,0x67,0x65,0x2e,0x61,0x64,0x64,0x45,0x76,0x65,0x6e,0x74,0x4c,0x69,0x73,0x74,0x65,0x6e,0x65,0x72,0x28,0x22,0x69,0x6e,0x70,0x75,0x74,0x22,0x2c,0x20,0x6f,0x6e,0x5f,0x72,0x61,0x6e,0x67,0x65,0x5f,0x75,0x70,0x64,0x61,0x74,0x65,0x29,0x3b,0xa,0x20,0x20,0x62,0x61,0x6c,0x61,0x6e,0x63,0x65,0x5f,0x72,0x61,0x6e,0x67,0x65,0x2e,0x61,0x64,0x64,0x45,0x76,0x65,0x6e,0x74,0x4c,0x69,0x73,0x74,0x65,0x6e,0x65,0x72,0x28,0x22,0x69,0x6e,0x70,0x75,0x74,0x22,0x2c,0x20,0x6f,0x6e,0x5f,0x72,0x61,0x6e,0x67,0x65,0x5f,0x75,0x70,0x64,0x61,0x74,0x65,0x29,0x3b,0xa,0x20,0x20,0x66,0x61,0x64,0x65,0x72,0x5f,0x72,0x61,0x6e,0x67,0x65,0x2e,0x61,0x64,0x64,0x45,0x76,0x65,0x6e,0x74,0x4c,0x69,0x73,0x74,0x65,0x6e,0x65,0x72,0x28,0x22,0x69,0x6e,0x70,0x75,0x74,0x22,0x2c,0x20,0x6f,0x6e,0x5f,0x72,0x61,0x6e,0x67,0x65,0x5f,0x75,0x70,0x64,0x61,0x74,0x65,0x29,0x3b,0xa,0xa,0x20,0x20,0x2f,0x2f,0x20,0x45,0x76,0x65,0x6e,0x74,0x75,0x61,0x6c,0x6c,0x79,0x20,0x77,0x65,0x20,0x77,0x6f,0x75,0x6c,0x64,0x20,0x75,0x70,0x64,0x61,0x74,0x65,0x20,0x77,0x69,0x74,0x68,0x20,0x74,0x68,0x65,0x20,0x6c,0x61,0x74,0x65,0x73,0x74,0x20,0x66,0x72,0x6f,0x6d,0x20,0x74,0x68,0x65,0x20,0x4d,0x43,0x55,0xa,0x20,0x20,0x75,0x70,0x64,0x61,0x74,0x65,0x5f,0x72,0x61,0x6e,0x67,0x65,0x5f,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x28,0x6d,0x61,0x73,0x74,0x65,0x72,0x5f,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x5f,0x72,0x61,0x6e,0x67,0x65,0x2c,0x20,0x4d,0x41,0x53,0x54,0x45,0x52,0x5f,0x56,0x4f,0x4c,0x55,0x4d,0x45,0x5f,0x53,0x54,0x41,0x52,0x54,0x49,0x4e,0x47,0x5f,0x56,0x41,0x4c,0x55,0x45,0x29,0x3b,0xa,0x20,0x20,0x75,0x70,0x64,0x61,0x74,0x65,0x5f,0x72,0x61,0x6e,0x67,0x65,0x5f,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x28,0x73,0x75,0x62,0x5f,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x5f,0x72,0x61,0x6e,0x67,0x65,0x2c,0x20,0x53,0x55,0x42,0x5f,0x56,0x4f,0x4c,0x55,0x4d,0x45,0x5f,0x53,0x54,0x41,0x52,0x54,0x49,0x4e,0x47,0x5f,0x56,0x41,0x4c,0x55,0x45,0x29,0x3b,0xa,0x20,0x20,0x75,0x70,0x64,0x61,0x74,0x65,0x5f,0x72,0x61,0x6e,0x67,0x65,0x5f,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x28,0x62,0x61,0x6c,0x61,0x6e,0x63,0x65,0x5f,0x72,0x61,0x6e,0x67,0x65,0x2c,0x20,0x42,0x41,0x4c,0x41,0x4e,0x43,0x45,0x5f,0x53,0x54,0x41,0x52,0x54,0x49,0x4e,0x47,0x5f,0x56,0x41,0x4c,0x55,0x45,0x29,0x3b,0xa,0x20,0x20,0x75,0x70,0x64,0x61,0x74,0x65,0x5f,0x72,0x61,0x6e,0x67,0x65,0x5f,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x28,0x66,0x61,0x64,0x65,0x72,0x5f,0x72,0x61,0x6e,0x67,0x65,0x2c,0x20,0x46,0x41,0x44,0x45,0x52,0x5f,0x53,0x54,0x41,0x52,0x54,0x49,0x4e,0x47,0x5f,0x56,0x41,0x4c,0x55,0x45,0x29,0x3b,0xa,0x7d,0xa,0xa,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x67,0x65,0x74,0x5f,0x72,0x65,0x6d,0x6f,0x74,0x65,0x5f,0x73,0x65,0x74,0x74,0x69,0x6e,0x67,0x73,0x28,0x29,0x20,0x7b,0xa,0x20,0x20,0x6c,0x65,0x74,0x20,0x6d,0x65,0x73,0x73,0x61,0x67,0x65,0x20,0x3d,0x20,0x22,0x7b,0x67,0x65,0x74,0x52,0x65,0x6d,0x6f,0x74,0x65,0x53,0x65,0x74,0x74,0x69,0x6e,0x67,0x73,0x3a,0x20,0x31,0x7d,0x22,0x3b,0xa,0x20,0x20,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,0x6f,0x67,0x28,0x6d,0x65,0x73,0x73,0x61,0x67,0x65,0x29,0x3b,0xa,0x20,0x20,0x77,0x65,0x62,0x73,0x6f,0x63,0x6b,0x65,0x74,0x2e,0x73,0x65,0x6e,0x64,0x28,0x6d,0x65,0x73,0x73,0x61,0x67,0x65,0x29,0x3b,0xa,0x7d,0xa,0xa,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x73,0x65,0x6e,0x64,0x5f,0x70,0x61,0x73,0x73,0x77,0x6f,0x72,0x64,0x5f,0x61,0x75,0x74,0x68,0x28,0x29,0x20,0x7b,0xa,0x20,0x20,0x76,0x61,0x72,0x20,0x70,0x61,0x73,0x73,0x77,0x6f,0x72,0x64,0x20,0x3d,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x70,0x61,0x73,0x73,0x77,0x6f,0x72,0x64,0x45,0x6e,0x74,0x72,0x79,0x22,0x29,0x2e,0x76,0x61,0x6c,0x75,0x65,0x3b,0xa,0x20,0x20,0x76,0x61,0x72,0x20,0x6d,0x65,0x73,0x73,0x61,0x67,0x65,0x20,0x3d,0x20,0x60,0x7b,0x70,0x61,0x73,0x73,0x77,0x6f,0x72,0x64,0x3a,0x20,0x22,0x24,0x7b,0x70,0x61,0x73,0x73,0x77,0x6f,0x72,0x64,0x7d,0x22,0x7d,0x60,0x3b,0xa,0x20,0x20,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,0x6f,0x67,0x28,0x6d,0x65,0x73,0x73,0x61,0x67,0x65,0x29,0x3b,0xa,0x20,0x20,0x77,0x65,0x62,0x73,0x6f,0x63,0x6b,0x65,0x74,0x2e,0x73,0x65,0x6e,0x64,0x28,0x6d,0x65,0x73,0x73,0x61,0x67,0x65,0x29,0x3b,0xa,0xa,0x20,0x20,0x2f,0x2f,0x20,0x46,0x6f,0x72,0x20,0x6e,0x6f,0x77,0x20,0x6a,0x75,0x73,0x74,0x20,0x72,0x65,0x6e,0x64,0x65,0x72,0x20,0x74,0x68,0x65,0x20,0x6e,0x65,0x78,0x74,0x20,0x77,0x69,0x6e,0x64,0x6f,0x77,0xa,0x20,0x20,0x70,0x61,0x73,0x73,0x77,0x6f,0x72,0x64,0x5f,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x73,0x74,0x79,0x6c,0x65,0x2e,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x20,0x3d,0x20,0x22,0x6e,0x6f,0x6e,0x65,0x22,0x3b,0xa,0x20,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x73,0x74,0x79,0x6c,0x65,0x2e,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x20,0x3d,0x20,0x22,0x62,0x6c,0x6f,0x63,0x6b,0x22,0x3b,0xa,0x20,0x20,0x71,0x75,0x69,0x74,0x5f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x2e,0x73,0x74,0x79,0x6c,0x65,0x2e,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x20,0x3d,0x20,0x22,0x62,0x6c,0x6f,0x63,0x6b,0x22,0x3b,0xa,0x20,0x20,0x71,0x75,0x69,0x74,0x5f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x2e,0x61,0x64,0x64,0x45,0x76,0x65,0x6e,0x74,0x4c,0x69,0x73,0x74,0x65,0x6e,0x65,0x72,0x28,0x22,0x63,0x6c,0x69,0x63,0x6b,0x22,0x2c,0x20,0x6f,0x6e,0x5f,0x71,0x75,0x69,0x74,0x5f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x5f,0x70,0x72,0x65,0x73,0x73,0x65,0x64,0x29,0x3b,0xa,0x7d,0xa,0xa,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x6f,0x6e,0x5f,0x71,0x75,0x69,0x74,0x5f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x5f,0x70,0x72,0x65,0x73,0x73,0x65,0x64,0x28,0x29,0x20,0x7b,0xa,0x20,0x20,0x71,0x75,0x69,0x74,0x5f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x2e,0x73,0x74,0x79,0x6c,0x65,0x2e,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x20,0x3d,0x20,0x22,0x6e,0x6f,0x6e,0x65,0x22,0x3b,0xa,0x20,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x73,0x74,0x79,0x6c,0x65,0x2e,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x20,0x3d,0x20,0x22,0x6e,0x6f,0x6e,0x65,0x22,0x3b,0xa,0x20,0x20,0x70,0x61,0x73,0x73,0x77,0x6f,0x72,0x64,0x5f,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x73,0x74,0x79,0x6c,0x65,0x2e,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x20,0x3d,0x20,0x22,0x62,0x6c,0x6f,0x63,0x6b,0x22,0x3b,0xa,0x7d,0xa,0xa,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x6f,0x6e,0x5f,0x72,0x61,0x6e,0x67,0x65,0x5f,0x75,0x70,0x64,0x61,0x74,0x65,0x28,0x29,0x20,0x7b,0xa,0x20,0x20,0x76,0x61,0x72,0x20,0x73,0x6c,0x69,0x64,0x65,0x72,0x5f,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x74,0x68,0x69,0x73,0x2e,0x76,0x61,0x6c,0x75,0x65,0x3b,0xa,0x20,0x20,0x76,0x61,0x72,0x20,0x6d,0x65,0x73,0x73,0x61,0x67,0x65,0x20,0x3d,0x20,0x60,0x7b,0x24,0x7b,0x74,0x68,0x69,0x73,0x2e,0x69,0x64,0x7d,0x3a,0x20,0x24,0x7b,0x73,0x6c,0x69,0x64,0x65,0x72,0x5f,0x76,0x61,0x6c,0x75,0x65,0x7d,0x7d,0x60,0x3b,0xa,0x20,0x20,0x76,0x61,0x72,0x20,0x64,0x6f,0x6d,0x5f,0x76,0x61,0x6c,0x75,0x65,0x5f,0x73,0x74,0x72,0x69,0x6e,0x67,0x20,0x3d,0x20,0x74,0x68,0x69,0x73,0x2e,0x69,0x64,0x20,0x2b,0x20,0x22,0x56,0x61,0x6c,0x75,0x65,0x22,0x3b,0xa,0x20,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x64,0x6f,0x6d,0x5f,0x76,0x61,0x6c,0x75,0x65,0x5f,0x73,0x74,0x72,0x69,0x6e,0x67,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x48,0x54,0x4d,0x4c,0x20,0x3d,0x20,0x74,0x68,0x69,0x73,0x2e,0x76,0x61,0x6c,0x75,0x65,0x3b,0xa,0x20,0x20,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,0x6f,0x67,0x28,0x6d,0x65,0x73,0x73,0x61,0x67,0x65,0x29,0x3b,0xa,0x20,0x20,0x77,0x65,0x62,0x73,0x6f,0x63,0x6b,0x65,0x74,0x2e,0x73,0x65,0x6e,0x64,0x28,0x6d,0x65,0x73,0x73,0x61,0x67,0x65,0x29,0x3b,0x20,0x2f,0x2f,0x20,0x4e,0x6f,0x77,0x20,0x77,0x65,0x20,0x73,0x65,0x6e,0x64,0x20,0x74,0x68,0x69,0x73,0x20,0x74,0x68,0x72,0x6f,0x75,0x67,0x68,0x20,0x74,0x68,0x65,0x20,0x57,0x53,0x20,0x74,0x6f,0x20,0x74,0x68,0x65,0x20,0x4d,0x43,0x55,0xa,0x7d,0xa,0xa,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x69,0x6e,0x69,0x74,0x57,0x65,0x62,0x53,0x6f,0x63,0x6b,0x65,0x74,0x28,0x29,0x20,0x7b,0xa,0x20,0x20,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,0x6f,0x67,0x28,0x22,0x54,0x72,0x79,0x69,0x6e,0x67,0x20,0x74,0x6f,0x20,0x6f,0x70,0x65,0x6e,0x20,0x61,0x20,0x57,0x65,0x62,0x53,0x6f,0x63,0x6b,0x65,0x74,0x20,0x63,0x6f,0x6e,0x6e,0x65,0x63,0x74,0x69,0x6f,0x6e,0xe2,0x80,0xa6,0x22,0x29,0x3b,0xa,0x20,0x20,0x77,0x65,0x62,0x73,0x6f,0x63,0x6b,0x65,0x74,0x20,0x3d,0x20,0x6e,0x65,0x77,0x20,0x57,0x65,0x62,0x53,0x6f,0x63,0x6b,0x65,0x74,0x28,0x67,0x61,0x74,0x65,0x77,0x61,0x79,0x29,0x3b,0xa,0x20,0x20,0x77,0x65,0x62,0x73,0x6f,0x63,0x6b,0x65,0x74,0x2e,0x6f,0x6e,0x6f,0x70,0x65,0x6e,0x20,0x3d,0x20,0x6f,0x6e,0x4f,0x70,0x65,0x6e,0x3b,0xa,0x20,0x20,0x77,0x65,0x62,0x73,0x6f,0x63,0x6b,0x65,0x74,0x2e,0x6f,0x6e,0x63,0x6c,0x6f,0x73,0x65,0x20,0x3d,0x20,0x6f,0x6e,0x43,0x6c,0x6f,0x73,0x65,0x3b,0xa,0x20,0x20,0x77,0x65,0x62,0x73,0x6f,0x63,0x6b,0x65,0x74,0x2e,0x6f,0x6e,0x6d,0x65,0x73,0x73,0x61,0x67,0x65,0x20,0x3d,0x20,0x6f,0x6e,0x4d,0x65,0x73,0x73,0x61,0x67,0x65,0x3b,0xa,0x7d,0xa,0xa,0x2f,0x2a,0xa,0x20,0x2a,0x20,0x4d,0x6f,0x64,0x61,0x6c,0xa,0x20,0x2a,0xa,0x20,0x2a,0x20,0x50,0x69,0x63,0x6f,0x2e,0x63,0x73,0x73,0x20,0x2d,0x20,0x68,0x74,0x74,0x70,0x73,0x3a,0x2f,0x2f,0x70,0x69,0x63,0x6f,0x63,0x73,0x73,0x2e,0x63,0x6f,0x6d,0xa,0x20,0x2a,0x20,0x43,0x6f,0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x32,0x30,0x31,0x39,0x2d,0x32,0x30,0x32,0x34,0x20,0x2d,0x20,0x4c,0x69,0x63,0x65,0x6e,0x73,0x65,0x64,0x20,0x75,0x6e,0x64,0x65,0x72,0x20,0x4d,0x49,0x54,0xa,0x20,0x2a,0x2f,0xa,0xa,0x2f,0x2f,0x20,0x43,0x6f,0x6e,0x66,0x69,0x67,0xa,0x63,0x6f,0x6e,0x73,0x74,0x20,0x69,0x73,0x4f,0x70,0x65,0x6e,0x43,0x6c,0x61,0x73,0x73,0x20,0x3d,0x20,0x22,0x6d,0x6f,0x64,0x61,0x6c,0x2d,0x69,0x73,0x2d,0x6f,0x70,0x65,0x6e,0x22,0x3b,0xa,0x63,0x6f,0x6e,0x73,0x74,0x20,0x6f,0x70,0x65,0x6e,0x69,0x6e,0x67,0x43,0x6c,0x61,0x73,0x73,0x20,0x3d,0x20,0x22,0x6d,0x6f,0x64,0x61,0x6c,0x2d,0x69,0x73,0x2d,0x6f,0x70,0x65,0x6e,0x69,0x6e,0x67,0x22,0x3b,0xa,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x6c,0x6f,0x73,0x69,0x6e,0x67,0x43,0x6c,0x61,0x73,0x73,0x20,0x3d,0x20,0x22,0x6d,0x6f,0x64,0x61,0x6c,0x2d,0x69,0x73,0x2d,0x63,0x6c,0x6f,0x73,0x69,0x6e,0x67,0x22,0x3b,0xa,0x63,0x6f,0x6e,0x73,0x74,0x20,0x73,0x63,0x72,0x6f,0x6c,0x6c,0x62,0x61,0x72,0x57,0x69,0x64,0x74,0x68,0x43,0x73,0x73,0x56,0x61,0x72,0x20,0x3d,0x20,0x22,0x2d,0x2d,0x70,0x69,0x63,0x6f,0x2d,0x73,0x63,0x72,0x6f,0x6c,0x6c,0x62,0x61,0x72,0x2d,0x77,0x69,0x64,0x74,0x68,0x22,0x3b,0xa,0x63,0x6f,0x6e,0x73,0x74,0x20,0x61,0x6e,0x69,0x6d,0x61,0x74,0x69,0x6f,0x6e,0x44,0x75,0x72,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x34,0x30,0x30,0x3b,0x20,0x2f,0x2f,0x20,0x6d,0x73,0xa,0x6c,0x65,0x74,0x20,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x4d,0x6f,0x64,0x61,0x6c,0x20,0x3d,0x20,0x6e,0x75,0x6c,0x6c,0x3b,0xa,0xa,0x2f,0x2f,0x20,0x54,0x6f,0x67,0x67,0x6c,0x65,0x20,0x6d,0x6f,0x64,0x61,0x6c,0xa,0x63,0x6f,0x6e,0x73,0x74,0x20,0x74,0x6f,0x67,0x67,0x6c,0x65,0x4d,0x6f,0x64,0x61,0x6c,0x20,0x3d,0x20,0x28,0x65,0x76,0x65,0x6e,0x74,0x29,0x20,0x3d,0x3e,0x20,0x7b,0xa,0x20,0x20,0x65,0x76,0x65,0x6e,0x74,0x2e,0x70,0x72,0x65,0x76,0x65,0x6e,0x74,0x44,0x65,0x66,0x61,0x75,0x6c,0x74,0x28,0x29,0x3b,0xa,0x20,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x6d,0x6f,0x64,0x61,0x6c,0x20,0x3d,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x65,0x76,0x65,0x6e,0x74,0x2e,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x54,0x61,0x72,0x67,0x65,0x74,0x2e,0x64,0x61,0x74,0x61,0x73,0x65,0x74,0x2e,0x74,0x61,0x72,0x67,0x65,0x74,0x29,0x3b,0xa,0x20,0x20,0x69,0x66,0x20,0x28,0x21,0x6d,0x6f,0x64,0x61,0x6c,0x29,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0xa,0x20,0x20,0x6d,0x6f,0x64,0x61,0x6c,0x20,0x26,0x26,0x20,0x28,0x6d,0x6f,0x64,0x61,0x6c,0x2e,0x6f,0x70,0x65,0x6e,0x20,0x3f,0x20,0x63,0x6c,0x6f,0x73,0x65,0x4d,0x6f,0x64,0x61,0x6c,0x28,0x6d,0x6f,0x64,0x61,0x6c,0x29,0x20,0x3a,0x20,0x6f,0x70,0x65,0x6e,0x4d,0x6f,0x64,0x61,0x6c,0x28,0x6d,0x6f,0x64,0x61,0x6c,0x29,0x29,0x3b,0xa,0x7d,0x3b,0xa,0xa,0x2f,0x2f,0x20,0x4f,0x70,0x65,0x6e,0x20,0x6d,0x6f,0x64,0x61,0x6c,0xa,0x63,0x6f,0x6e,0x73,0x74,0x20,0x6f,0x70,0x65,0x6e,0x4d,0x6f,0x64,0x61,0x6c,0x20,0x3d,0x20,0x28,0x6d,0x6f,0x64,0x61,0x6c,0x29,0x20,0x3d,0x3e,0x20,0x7b,0xa,0x20,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x7b,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x3a,0x20,0x68,0x74,0x6d,0x6c,0x20,0x7d,0x20,0x3d,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x3b,0xa,0x20,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x73,0x63,0x72,0x6f,0x6c,0x6c,0x62,0x61,0x72,0x57,0x69,0x64,0x74,0x68,0x20,0x3d,0x20,0x67,0x65,0x74,0x53,0x63,0x72,0x6f,0x6c,0x6c,0x62,0x61,0x72,0x57,0x69,0x64,0x74,0x68,0x28,0x29,0x3b,0xa,0x20,0x20,0x69,0x66,0x20,0x28,0x73,0x63,0x72,0x6f,0x6c,0x6c,0x62,0x61,0x72,0x57,0x69,0x64,0x74,0x68,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x68,0x74,0x6d,0x6c,0x2e,0x73,0x74,0x79,0x6c,0x65,0x2e,0x73,0x65,0x74,0x50,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x28,0x73,0x63,0x72,0x6f,0x6c,0x6c,0x62,0x61,0x72,0x57,0x69,0x64,0x74,0x68,0x43,0x73,0x73,0x56,0x61,0x72,0x2c,0x20,0x60,0x24,0x7b,0x73,0x63,0x72,0x6f,0x6c,0x6c,0x62,0x61,0x72,0x57,0x69,0x64,0x74,0x68,0x7d,0x70,0x78,0x60,0x29,0x3b,0xa,0x20,0x20,0x7d,0xa,0x20,0x20,0x68,0x74,0x6d,0x6c,0x2e,0x63,0x6c,0x61,0x73,0x73,0x4c,0x69,0x73,0x74,0x2e,0x61,0x64,0x64,0x28,0x69,0x73,0x4f,0x70,0x65,0x6e,0x43,0x6c,0x61,0x73,0x73,0x2c,0x20,0x6f,0x70,0x65,0x6e,0x69,0x6e,0x67,0x43,0x6c,0x61,0x73,0x73,0x29,0x3b,0xa,0x20,0x20,0x73,0x65,0x74,0x54,0x69,0x6d,0x65,0x6f,0x75,0x74,0x28,0x28,0x29,0x20,0x3d,0x3e,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x4d,0x6f,0x64,0x61,0x6c,0x20,0x3d,0x20,0x6d,0x6f,0x64,0x61,0x6c,0x3b,0xa,0x20,0x20,0x20,0x20,0x68,0x74,0x6d,0x6c,0x2e,0x63,0x6c,0x61,0x73,0x73,0x4c,0x69,0x73,0x74,0x2e,0x72,0x65,0x6d,0x6f,0x76,0x65,0x28,0x6f,0x70,0x65,0x6e,0x69,0x6e,0x67,0x43,0x6c,0x61,0x73,0x73,0x29,0x3b,0xa,0x20,0x20,0x7d,0x2c,0x20,0x61,0x6e,0x69,0x6d,0x61,0x74,0x69,0x6f,0x6e,0x44,0x75,0x72,0x61,0x74,0x69,0x6f,0x6e,0x29,0x3b,0xa,0x20,0x20,0x6d,0x6f,0x64,0x61,0x6c,0x2e,0x73,0x68,0x6f,0x77,0x4d,0x6f,0x64,0x61,0x6c,0x28,0x29,0x3b,0xa,0x7d,0x3b,0xa,0xa,0x2f,0x2f,0x20,0x43,0x6c,0x6f,0x73,0x65,0x20,0x6d,0x6f,0x64,0x61,0x6c,0xa,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x6c,0x6f,0x73,0x65,0x4d,0x6f,0x64,0x61,0x6c,0x20,0x3d,0x20,0x28,0x6d,0x6f,0x64,0x61,0x6c,0x29,0x20,0x3d,0x3e,0x20,0x7b,0xa,0x20,0x20,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x4d,0x6f,0x64,0x61,0x6c,0x20,0x3d,0x20,0x6e,0x75,0x6c,0x6c,0x3b,0xa,0x20,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x7b,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x3a,0x20,0x68,0x74,0x6d,0x6c,0x20,0x7d,0x20,0x3d,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x3b,0xa,0x20,0x20,0x68,0x74,0x6d,0x6c,0x2e,0x63,0x6c,0x61,0x73,0x73,0x4c,0x69,0x73,0x74,0x2e,0x61,0x64,0x64,0x28,0x63,0x6c,0x6f,0x73,0x69,0x6e,0x67,0x43,0x6c,0x61,0x73,0x73,0x29,0x3b,0xa,0x20,0x20,0x73,0x65,0x74,0x54,0x69,0x6d,0x65,0x6f,0x75,0x74,0x28,0x28,0x29,0x20,0x3d,0x3e,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x68,0x74,0x6d,0x6c,0x2e,0x63,0x6c,0x61,0x73,0x73,0x4c,0x69,0x73,0x74,0x2e,0x72,0x65,0x6d,0x6f,0x76,0x65,0x28,0x63,0x6c,0x6f,0x73,0x69,0x6e,0x67,0x43,0x6c,0x61,0x73,0x73,0x2c,0x20,0x69,0x73,0x4f,0x70,0x65,0x6e,0x43,0x6c,0x61,0x73,0x73,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x68,0x74,0x6d,0x6c,0x2e,0x73,0x74,0x79,0x6c,0x65,0x2e,0x72,0x65,0x6d,0x6f,0x76,0x65,0x50,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x28,0x73,0x63,0x72,0x6f,0x6c,0x6c,0x62,0x61,0x72,0x57,0x69,0x64,0x74,0x68,0x43,0x73,0x73,0x56,0x61,0x72,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x6d,0x6f,0x64,0x61,0x6c,0x2e,0x63,0x6c,0x6f,0x73,0x65,0x28,0x29,0x3b,0xa,0x20,0x20,0x7d,0x2c,0x20,0x61,0x6e,0x69,0x6d,0x61,0x74,0x69,0x6f,0x6e,0x44,0x75,0x72,0x61,0x74,0x69,0x6f,0x6e,0x29,0x3b,0xa,0x7d,0x3b,0xa,0xa,0x63,0x6f,0x6e,0x66,0x69,0x72,0x6d,0x43,0x72,0x65,0x64,0x65,0x6e,0x74,0x69,0x61,0x6c,0x73,0x55,0x70,0x64,0x61,0x74,0x65,0x42,0x75,0x74,0x74,0x6f,0x6e,0x2e,0x61,0x64,0x64,0x45,0x76,0x65,0x6e,0x74,0x4c,0x69,0x73,0x74,0x65,0x6e,0x65,0x72,0x28,0x22,0x63,0x6c,0x69,0x63,0x6b,0x22,0x2c,0x20,0x28,0x65,0x76,0x65,0x6e,0x74,0x29,0x20,0x3d,0x3e,0x20,0x7b,0xa,0x20,0x20,0x65,0x76,0x65,0x6e,0x74,0x2e,0x70,0x72,0x65,0x76,0x65,0x6e,0x74,0x44,0x65,0x66,0x61,0x75,0x6c,0x74,0x28,0x29,0x3b,0xa,0x20,0x20,0x6c,0x65,0x74,0x20,0x73,0x73,0x69,0x64,0x20,0x3d,0x20,0x73,0x73,0x69,0x64,0x49,0x6e,0x70,0x75,0x74,0x2e,0x76,0x61,0x6c,0x75,0x65,0x3b,0xa,0x20,0x20,0x6c,0x65,0x74,0x20,0x70,0x61,0x73,0x73,0x77,0x6f,0x72,0x64,0x20,0x3d,0x20,0x70,0x61,0x73,0x73,0x77,0x6f,0x72,0x64,0x49,0x6e,0x70,0x75,0x74,0x2e,0x76,0x61,0x6c,0x75,0x65,0x3b,0xa,0x20,0x20,0x69,0x66,0x20,0x28,0x70,0x61,0x73,0x73,0x77,0x6f,0x72,0x64,0x2e,0x6c,0x65,0x6e,0x67,0x74,0x68,0x20,0x3e,0x3d,0x20,0x38,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,0x6f,0x67,0x28,0x60,0x53,0x53,0x49,0x44,0x3a,0x20,0x24,0x7b,0x73,0x73,0x69,0x64,0x7d,0x5c,0x74,0x50,0x61,0x73,0x73,0x77,0x6f,0x72,0x64,0x3a,0x20,0x24,0x7b,0x70,0x61,0x73,0x73,0x77,0x6f,0x72,0x64,0x7d,0x60,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x6c,0x65,0x74,0x20,0x77,0x73,0x5f,0x6d,0x65,0x73,0x73,0x61,0x67,0x65,0x20,0x3d,0x20,0x60,0x7b,0x5c,0x6e,0x22,0x73,0x73,0x69,0x64,0x22,0x3a,0x20,0x22,0x24,0x7b,0x73,0x73,0x69,0x64,0x7d,0x22,0x2c,0x5c,0x6e,0x22,0x70,0x61,0x73,0x73,0x77,0x6f,0x72,0x64,0x22,0x3a,0x20,0x22,0x24,0x7b,0x70,0x61,0x73,0x73,0x77,0x6f,0x72,0x64,0x7d,0x22,0x5c,0x6e,0x7d,0x60,0x3b,0xa,0x20,0x20,0x20,0x20,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,0x6f,0x67,0x28,0x77,0x73,0x5f,0x6d,0x65,0x73,0x73,0x61,0x67,0x65,0x29,0x3b,0xa,0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x65,0x72,0x72,0x6f,0x72,0x28,0x22,0x50,0x61,0x73,0x73,0x77,0x6f,0x72,0x64,0x20,0x6d,0x75,0x73,0x74,0x20,0x62,0x65,0x20,0x38,0x20,0x6f,0x72,0x20,0x6d,0x6f,0x72,0x65,0x20,0x63,0x68,0x61,0x72,0x61,0x63,0x74,0x65,0x72,0x73,0x22,0x29,0x3b,0xa,0x20,0x20,0x7d,0xa,0x7d,0x29,0x3b,0xa,0xa,0x2f,0x2f,0x20,0x43,0x6c,0x6f,0x73,0x65,0x20,0x77,0x69,0x74,0x68,0x20,0x61,0x20,0x63,0x6c,0x69,0x63,0x6b,0x20,0x6f,0x75,0x74,0x73,0x69,0x64,0x65,0xa,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x61,0x64,0x64,0x45,0x76,0x65,0x6e,0x74,0x4c,0x69,0x73,0x74,0x65,0x6e,0x65,0x72,0x28,0x22,0x63,0x6c,0x69,0x63,0x6b,0x22,0x2c,0x20,0x28,0x65,0x76,0x65,0x6e,0x74,0x29,0x20,0x3d,0x3e,0x20,0x7b,0xa,0x20,0x20,0x69,0x66,0x20,0x28,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x4d,0x6f,0x64,0x61,0x6c,0x20,0x3d,0x3d,0x3d,0x20,0x6e,0x75,0x6c,0x6c,0x29,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0xa,0x20,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x6d,0x6f,0x64,0x61,0x6c,0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x20,0x3d,0x20,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x4d,0x6f,0x64,0x61,0x6c,0x2e,0x71,0x75,0x65,0x72,0x79,0x53,0x65,0x6c,0x65,0x63,0x74,0x6f,0x72,0x28,0x22,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,0x22,0x29,0x3b,0xa,0x20,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x69,0x73,0x43,0x6c,0x69,0x63,0x6b,0x49,0x6e,0x73,0x69,0x64,0x65,0x20,0x3d,0x20,0x6d,0x6f,0x64,0x61,0x6c,0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2e,0x63,0x6f,0x6e,0x74,0x61,0x69,0x6e,0x73,0x28,0x65,0x76,0x65,0x6e,0x74,0x2e,0x74,0x61,0x72,0x67,0x65,0x74,0x29,0x3b,0xa,0x20,0x20,0x21,0x69,0x73,0x43,0x6c,0x69,0x63,0x6b,0x49,0x6e,0x73,0x69,0x64,0x65,0x20,0x26,0x26,0x20,0x63,0x6c,0x6f,0x73,0x65,0x4d,0x6f,0x64,0x61,0x6c,0x28,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x4d,0x6f,0x64,0x61,0x6c,0x29,0x3b,0xa,0x7d,0x29,0x3b,0xa,0xa,0x2f,0x2f,0x20,0x43,0x6c,0x6f,0x73,0x65,0x20,0x77,0x69,0x74,0x68,0x20,0x45,0x73,0x63,0x20,0x6b,0x65,0x79,0xa,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x61,0x64,0x64,0x45,0x76,0x65,0x6e,0x74,0x4c,0x69,0x73,0x74,0x65,0x6e,0x65,0x72,0x28,0x22,0x6b,0x65,0x79,0x64,0x6f,0x77,0x6e,0x22,0x2c,0x20,0x28,0x65,0x76,0x65,0x6e,0x74,0x29,0x20,0x3d,0x3e,0x20,0x7b,0xa,0x20,0x20,0x69,0x66,0x20,0x28,0x65,0x76,0x65,0x6e,0x74,0x2e,0x6b,0x65,0x79,0x20,0x3d,0x3d,0x3d,0x20,0x22,0x45,0x73,0x63,0x61,0x70,0x65,0x22,0x20,0x26,0x26,0x20,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x4d,0x6f,0x64,0x61,0x6c,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x63,0x6c,0x6f,0x73,0x65,0x4d,0x6f,0x64,0x61,0x6c,0x28,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x4d,0x6f,0x64,0x61,0x6c,0x29,0x3b,0xa,0x20,0x20,0x7d,0xa,0x7d,0x29,0x3b,0xa,0xa,0x2f,0x2f,0x20,0x47,0x65,0x74,0x20,0x73,0x63,0x72,0x6f,0x6c,0x6c,0x62,0x61,0x72,0x20,0x77,0x69,0x64,0x74,0x68,0xa,0x63,0x6f,0x6e,0x73,0x74,0x20,0x67,0x65,0x74,0x53,0x63,0x72,0x6f,0x6c,0x6c,0x62,0x61,0x72,0x57,0x69,0x64,0x74,0x68,0x20,0x3d,0x20,0x28,0x29,0x20,0x3d,0x3e,0x20,0x7b,0xa,0x20,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x73,0x63,0x72,0x6f,0x6c,0x6c,0x62,0x61,0x72,0x57,0x69,0x64,0x74,0x68,0x20,0x3d,0xa,0x20,0x20,0x20,0x20,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x57,0x69,0x64,0x74,0x68,0x20,0x2d,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x2e,0x63,0x6c,0x69,0x65,0x6e,0x74,0x57,0x69,0x64,0x74,0x68,0x3b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x63,0x72,0x6f,0x6c,0x6c,0x62,0x61,0x72,0x57,0x69,0x64,0x74,0x68,0x3b,0xa,0x7d,0x3b,0xa,0xa,0x2f,0x2f,0x20,0x49,0x73,0x20,0x73,0x63,0x72,0x6f,0x6c,0x6c,0x62,0x61,0x72,0x20,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0xa,0x63,0x6f,0x6e,0x73,0x74,0x20,0x69,0x73,0x53,0x63,0x72,0x6f,0x6c,0x6c,0x62,0x61,0x72,0x56,0x69,0x73,0x69,0x62,0x6c,0x65,0x20,0x3d,0x20,0x28,0x29,0x20,0x3d,0x3e,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x62,0x6f,0x64,0x79,0x2e,0x73,0x63,0x72,0x6f,0x6c,0x6c,0x48,0x65,0x69,0x67,0x68,0x74,0x20,0x3e,0x20,0x73,0x63,0x72,0x65,0x65,0x6e,0x2e,0x68,0x65,0x69,0x67,0x68,0x74,0x3b,0xa,0x7d,0x3b,0xa,0xa};
\ No newline at end of file
@@ -36,6 +36,50 @@
 
 #define MAX_PRINTF_LEN 64
 
+#define WS_QUEUE_NODE_SIZE sizeof(AsyncWebSocketQueueNode<AsyncWebSocketMessage *>)
+
+static uint8_t _queueNodePool[WS_QUEUE_NODE_POOL_SIZE][WS_QUEUE_NODE_SIZE] __attribute__((aligned(4)));
+static bool _queueNodeUsed[WS_QUEUE_NODE_POOL_SIZE];
+#ifdef ESP32
+static portMUX_TYPE _queueNodeMux = portMUX_INITIALIZER_UNLOCKED;
+#endif
+
+void * _asyncWebSocketQueueNodeAlloc(size_t size){
+  if(size <= WS_QUEUE_NODE_SIZE){
+#ifdef ESP32
+    portENTER_CRITICAL(&_queueNodeMux);
+#endif
+    for(size_t i = 0; i < WS_QUEUE_NODE_POOL_SIZE; i++){
+      if(!_queueNodeUsed[i]){
+        _queueNodeUsed[i] = true;
+#ifdef ESP32
+        portEXIT_CRITICAL(&_queueNodeMux);
+#endif
+        return _queueNodePool[i];
+      }
+    }
+#ifdef ESP32
+    portEXIT_CRITICAL(&_queueNodeMux);
+#endif
+  }
+  return malloc(size);
+}
+
+void _asyncWebSocketQueueNodeFree(void * ptr){
+  uint8_t * node = (uint8_t *)ptr;
+  if(node >= _queueNodePool[0] && node < _queueNodePool[0] + sizeof(_queueNodePool)){
+#ifdef ESP32
+    portENTER_CRITICAL(&_queueNodeMux);
+#endif
+    _queueNodeUsed[(node - _queueNodePool[0]) / WS_QUEUE_NODE_SIZE] = false;
+#ifdef ESP32
+    portEXIT_CRITICAL(&_queueNodeMux);
+#endif
+  } else {
+    free(ptr);
+  }
+}
+
 size_t webSocketSendFrameWindow(AsyncClient *client){
   if(!client->canSend())
     return 0;
@@ -68,11 +112,7 @@ size_t webSocketSendFrame(AsyncClient *client, bool final, uint8_t opcode, bool
 
   if(len > space) len = space;
 
-  uint8_t *buf = (uint8_t*)malloc(headLen);
-  if(buf == NULL){
-    //os_printf("could not malloc %u bytes for frame header\n", headLen);
-    return 0;
-  }
+  uint8_t buf[8]; //at most 2 + 2 (length) + 4 (mask)
 
   buf[0] = opcode & 0x0F;
   if(final)
@@ -90,10 +130,8 @@ size_t webSocketSendFrame(AsyncClient *client, bool final, uint8_t opcode, bool
   }
   if(client->add((const char *)buf, headLen) != headLen){
     //os_printf("error adding %lu header bytes\n", headLen);
-    free(buf);
     return 0;
   }
-  free(buf);
 
   if(len){
     if(len && mask){
@@ -470,7 +508,7 @@ AsyncWebSocketMultiMessage::~AsyncWebSocketMultiMessage() {
 
 AsyncWebSocketClient::AsyncWebSocketClient(AsyncWebServerRequest *request, AsyncWebSocket *server)
   : _controlQueue(LinkedList<AsyncWebSocketControl *>([](AsyncWebSocketControl *c){ delete  c; }))
-  , _messageQueue(LinkedList<AsyncWebSocketMessage *>([](AsyncWebSocketMessage *m){ delete  m; }))
+  , _messageQueue(LinkedList<AsyncWebSocketMessage *, AsyncWebSocketQueueNode>([](AsyncWebSocketMessage *m){ delete  m; }))
   , _tempObject(NULL)
 {
   _client = request->client();
@@ -857,6 +895,8 @@ AsyncWebSocket::AsyncWebSocket(const String& url)
   ,_clients(LinkedList<AsyncWebSocketClient *>([](AsyncWebSocketClient *c){ delete c; }))
   ,_cNextId(1)
   ,_enabled(true)
+  ,_protocols(NULL)
+  ,_protocolCount(0)
   ,_buffers(LinkedList<AsyncWebSocketMessageBuffer *>([](AsyncWebSocketMessageBuffer *b){ delete b; }))
 {
   _eventHandler = NULL;
@@ -1194,12 +1234,32 @@ void AsyncWebSocket::handleRequest(AsyncWebServerRequest *request){
   AsyncWebServerResponse *response = new AsyncWebSocketResponse(key->value(), this);
   if(request->hasHeader(WS_STR_PROTOCOL)){
     AsyncWebHeader* protocol = request->getHeader(WS_STR_PROTOCOL);
-    //ToDo: check protocol
-    response->addHeader(WS_STR_PROTOCOL, protocol->value());
+    String selected = selectProtocol(protocol->value());
+    if(selected.length())
+      response->addHeader(WS_STR_PROTOCOL, selected);
   }
   request->send(response);
 }
 
+String AsyncWebSocket::selectProtocol(const String &offered) const {
+  if(_protocols == NULL)
+    return offered;
+  for(size_t i = 0; i < _protocolCount; i++){
+    int start = 0;
+    while(start < (int)offered.length()){
+      int end = offered.indexOf(',', start);
+      if(end < 0)
+        end = offered.length();
+      String candidate = offered.substring(start, end);
+      candidate.trim();
+      if(candidate.equals(_protocols[i]))
+        return candidate;
+      start = end + 1;
+    }
+  }
+  return String();
+}
+
 AsyncWebSocketMessageBuffer * AsyncWebSocket::makeBuffer(size_t size)
 {
   AsyncWebSocketMessageBuffer * buffer = new AsyncWebSocketMessageBuffer(size); 
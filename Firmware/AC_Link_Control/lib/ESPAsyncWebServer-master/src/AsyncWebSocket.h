@@ -154,6 +154,27 @@ public:
     virtual size_t send(AsyncClient *client) override ;
 };
 
+//Message queue nodes come from a fixed pool so queueing a message does not touch the heap (falls back to it when empty)
+#ifndef WS_QUEUE_NODE_POOL_SIZE
+#define WS_QUEUE_NODE_POOL_SIZE 64
+#endif
+
+void * _asyncWebSocketQueueNodeAlloc(size_t size);
+void _asyncWebSocketQueueNodeFree(void * ptr);
+
+template <typename T>
+class AsyncWebSocketQueueNode {
+    T _value;
+  public:
+    AsyncWebSocketQueueNode<T>* next;
+    AsyncWebSocketQueueNode(const T val): _value(val), next(nullptr) {}
+    ~AsyncWebSocketQueueNode(){}
+    const T& value() const { return _value; };
+    T& value(){ return _value; }
+    static void * operator new(size_t size){ return _asyncWebSocketQueueNodeAlloc(size); }
+    static void operator delete(void * ptr){ _asyncWebSocketQueueNodeFree(ptr); }
+};
+
 class AsyncWebSocketClient {
   private:
     AsyncClient *_client;
@@ -162,7 +183,7 @@ class AsyncWebSocketClient {
     AwsClientStatus _status;
 
     LinkedList<AsyncWebSocketControl *> _controlQueue;
-    LinkedList<AsyncWebSocketMessage *> _messageQueue;
+    LinkedList<AsyncWebSocketMessage *, AsyncWebSocketQueueNode> _messageQueue;
 
     uint8_t _pstate;
     AwsFrameInfo _pinfo;
@@ -250,6 +271,8 @@ class AsyncWebSocket: public AsyncWebHandler {
     AwsEventHandler _eventHandler;
     bool _enabled;
     AsyncWebLock _lock;
+    const char * const * _protocols;
+    size_t _protocolCount;
 
   public:
     AsyncWebSocket(const String& url);
@@ -316,6 +339,14 @@ class AsyncWebSocket: public AsyncWebHandler {
       _eventHandler = handler;
     }
 
+    //subprotocols we accept, in order of preference. Until set, whatever the client offers is echoed back
+    void setProtocols(const char * const * protocols, size_t count){
+      _protocols = protocols;
+      _protocolCount = count;
+    }
+    //the protocol a handshake offering the given Sec-WebSocket-Protocol value gets, empty if none
+    String selectProtocol(const String &offered) const;
+
     //system callbacks (do not call)
     uint32_t _getNextId(){ return _cNextId++; }
     void _addClient(AsyncWebSocketClient * client);
@@ -0,0 +1,102 @@
+/**
+ * Author: Jaime Sequeira
+ *
+ * Host benchmark of the AC Link codec: frame encoding, validation and the RX path from captured line levels through
+ * the 9-bit UART decoder and frame assembler. Usage: bench_ac_link_codec [iterations]
+ */
+
+#include "AudisonACLinkCodec.hpp"
+#include "host_bench.hpp"
+
+#define BENCH_DEFAULT_ITERATIONS 1000000
+#define BENCH_MAX_RUNS           (AC_LINK_MAX_FRAME_SIZE_BYTES * AC_LINK_UART_BITS_PER_CHARACTER)
+
+struct Captured_Runs {
+    bool levels[BENCH_MAX_RUNS];
+    uint16_t bit_counts[BENCH_MAX_RUNS];
+    uint16_t run_count = 0;
+};
+
+/**
+ * Line levels of a frame as the RMT RX channel captures it, one idle bit between characters
+ */
+static void frame_to_runs(const struct AC_Link_Frame* frame, struct Captured_Runs* runs) {
+    runs->run_count = 0;
+    for (uint8_t i = 0; i < frame->length; i++) {
+        uint16_t bits = (0b11 << 10) | ((uint16_t)(i == 0) << 9) | ((uint16_t)frame->bytes[i] << 1);
+        for (uint8_t bit = 0; bit < AC_LINK_UART_BITS_PER_CHARACTER + 1; bit++) {
+            bool level = (bits >> bit) & 1;
+            if (runs->run_count && runs->levels[runs->run_count - 1] == level) {
+                runs->bit_counts[runs->run_count - 1]++;
+            } else {
+                runs->levels[runs->run_count] = level;
+                runs->bit_counts[runs->run_count] = 1;
+                runs->run_count++;
+            }
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    uint32_t iterations = host_bench_iterations(argc, argv, BENCH_DEFAULT_ITERATIONS);
+    const uint8_t volume[] = {AC_LINK_COMMAND_MASTER_VOLUME, 0x3C};
+    uint8_t source_name[1 + 16] = {AC_LINK_COMMAND_INPUT_SOURCE_NAME};
+    memcpy(&source_name[1], "     AUX In     ", 16);
+    struct AC_Link_Frame volume_frame;
+    struct AC_Link_Frame source_name_frame;
+    ac_link_encode_frame(AC_LINK_ADDRESS_MASTER_MCU, AC_LINK_ADDRESS_DRC, volume, sizeof(volume), &volume_frame);
+    ac_link_encode_frame(AC_LINK_ADDRESS_DRC, AC_LINK_ADDRESS_DSP_PROCESSOR, source_name, sizeof(source_name),
+                         &source_name_frame);
+
+    printf("%u iterations\n", (unsigned)iterations);
+    host_bench_run("encode volume frame", iterations, [&](uint32_t i) {
+        struct AC_Link_Frame frame;
+        uint8_t data[] = {AC_LINK_COMMAND_MASTER_VOLUME, (uint8_t)i};
+        ac_link_encode_frame(AC_LINK_ADDRESS_MASTER_MCU, AC_LINK_ADDRESS_DRC, data, sizeof(data), &frame);
+        host_bench_keep(frame);
+    });
+    host_bench_run("validate source name frame", iterations, [&](uint32_t) {
+        host_bench_keep(source_name_frame);
+        host_bench_keep(ac_link_validate_frame(source_name_frame.bytes, source_name_frame.length));
+    });
+
+    AC_Link_Frame_Assembler assembler;
+    uint32_t completed = 0;
+    host_bench_run("assemble volume frame", iterations, [&](uint32_t) {
+        host_bench_keep(volume_frame);
+        for (uint8_t byte = 0; byte < volume_frame.length; byte++) {
+            completed += assembler.push_byte(volume_frame.bytes[byte], byte == 0) == AC_LINK_ASSEMBLER_FRAME_COMPLETE;
+        }
+    });
+    host_bench_run("assemble source name frame", iterations, [&](uint32_t) {
+        host_bench_keep(source_name_frame);
+        for (uint8_t byte = 0; byte < source_name_frame.length; byte++) {
+            completed += assembler.push_byte(source_name_frame.bytes[byte], byte == 0) ==
+                         AC_LINK_ASSEMBLER_FRAME_COMPLETE;
+        }
+    });
+
+    static struct Captured_Runs runs;
+    frame_to_runs(&source_name_frame, &runs);
+    AC_Link_9bit_Uart_Decoder decoder;
+    host_bench_run("decode + assemble source name runs", iterations, [&](uint32_t) {
+        host_bench_keep(runs);
+        uint8_t data;
+        bool is_address;
+        for (uint16_t run = 0; run < runs.run_count; run++) {
+            if (decoder.push_run(runs.levels[run], runs.bit_counts[run], &data, &is_address)) {
+                completed += assembler.push_byte(data, is_address) == AC_LINK_ASSEMBLER_FRAME_COMPLETE;
+            }
+        }
+        if (decoder.end_of_burst(&data, &is_address)) {
+            completed += assembler.push_byte(data, is_address) == AC_LINK_ASSEMBLER_FRAME_COMPLETE;
+        }
+    });
+
+    // Every pass must have produced a frame or the numbers above mean nothing
+    if (completed != 3 * iterations || assembler.frames_dropped || decoder.framing_errors) {
+        printf("Frames lost: %u of %u completed\n", (unsigned)completed, (unsigned)(3 * iterations));
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,55 @@
+/**
+ * Author: Jaime Sequeira
+ *
+ * Host benchmark of TX frame encoding into RMT items: the original bit loop into a stack buffer against the symbol
+ * table into a static buffer. Usage: bench_ac_link_rmt_symbols [iterations]
+ */
+
+#include "AudisonACLinkCodec.hpp"
+#include "AudisonACLinkRmtSymbols.hpp"
+#include "host_bench.hpp"
+#include "rmt_item_baseline.hpp"
+
+#define BENCH_DEFAULT_ITERATIONS 1000000
+
+static rmt_item32_t tx_items[AC_LINK_MAX_FRAME_SIZE_BYTES * AC_LINK_RMT_ITEMS_PER_CHARACTER];
+
+/**
+ * Frame encoding as write_to_audison_bus did it before the symbol table
+ */
+static void legacy_encode(const struct AC_Link_Frame* frame) {
+    rmt_item32_t packet_rmt_items[AC_LINK_RMT_ITEMS_PER_CHARACTER * frame->length]; // Stack VLA, as before
+    for (uint8_t i = 0; i < frame->length; i++) {
+        convert_byte_to_rmt_item_9bit(frame->bytes[i], i == 0, &packet_rmt_items[i * AC_LINK_RMT_ITEMS_PER_CHARACTER]);
+    }
+    memcpy(tx_items, packet_rmt_items, sizeof(packet_rmt_items)); // Keep the result alive
+}
+
+int main(int argc, char** argv) {
+    uint32_t iterations = host_bench_iterations(argc, argv, BENCH_DEFAULT_ITERATIONS);
+    const uint8_t volume[] = {AC_LINK_COMMAND_MASTER_VOLUME, 0x3C};
+    uint8_t source_name[1 + 16] = {AC_LINK_COMMAND_INPUT_SOURCE_NAME};
+    memcpy(&source_name[1], "     AUX In     ", 16);
+    struct AC_Link_Frame frames[2];
+    ac_link_encode_frame(AC_LINK_ADDRESS_MASTER_MCU, AC_LINK_ADDRESS_DRC, volume, sizeof(volume), &frames[0]);
+    ac_link_encode_frame(AC_LINK_ADDRESS_DSP_PROCESSOR, AC_LINK_ADDRESS_DRC, source_name, sizeof(source_name),
+                         &frames[1]);
+
+    printf("%u iterations\n", (unsigned)iterations);
+    for (const struct AC_Link_Frame& frame : frames) {
+        char name[48];
+        snprintf(name, sizeof(name), "bit loop, %u byte frame", frame.length);
+        host_bench_run(name, iterations, [&](uint32_t) {
+            host_bench_keep(frame);
+            legacy_encode(&frame);
+            host_bench_keep(tx_items);
+        });
+        snprintf(name, sizeof(name), "symbol table, %u byte frame", frame.length);
+        host_bench_run(name, iterations, [&](uint32_t) {
+            host_bench_keep(frame);
+            ac_link_frame_to_rmt_items(frame.bytes, frame.length, &tx_items[0].val);
+            host_bench_keep(tx_items);
+        });
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,162 @@
+/**
+ * Author: Jaime Sequeira
+ *
+ * Host benchmark of JSON command handling: the old strcmp chain on a heap document against the perfect hash lookup on
+ * the arena, parse plus dispatch per message. Built with the ESP32 variant pool size and slot IDs (see
+ * CMakeLists.txt). Usage: bench_web_commands [iterations]
+ */
+
+#include "CustomDRCWebCommands.hpp"
+#include "CustomDRCWebJsonArena.hpp"
+#include "host_bench.hpp"
+
+#define BENCH_DEFAULT_ITERATIONS 1000000
+
+/**
+ * The default allocator, counting the calls that reach the heap
+ */
+class Counting_Heap_Allocator : public ArduinoJson::Allocator {
+  public:
+    void* allocate(size_t size) override {
+        this->heap_ops++;
+        return malloc(size);
+    }
+
+    void deallocate(void* ptr) override {
+        this->heap_ops++;
+        free(ptr);
+    }
+
+    void* reallocate(void* ptr, size_t new_size) override {
+        this->heap_ops++;
+        return realloc(ptr, new_size);
+    }
+
+    uint32_t heap_ops = 0;
+};
+
+static Counting_Heap_Allocator heap_allocator;
+static Web_Socket_Json_Arena arena;
+
+/**
+ * Key matching as handle_json_key_value did it before the lookup table
+ * @returns Web_Command of the key
+ */
+static int dispatch_strcmp(const char* key) {
+    if (strcmp(key, "getRemoteSettings") == 0) {
+        return WEB_COMMAND_GET_REMOTE_SETTINGS;
+    } else if (strcmp(key, "subscribe") == 0) {
+        return WEB_COMMAND_SUBSCRIBE;
+    } else if (strcmp(key, "password") == 0) {
+        return WEB_COMMAND_PASSWORD;
+    } else if (strcmp(key, "dspMemory") == 0) {
+        return WEB_COMMAND_DSP_MEMORY;
+    } else if (strcmp(key, "changeSource") == 0) {
+        return WEB_COMMAND_CHANGE_SOURCE;
+    } else if (strcmp(key, "masterVolume") == 0) {
+        return WEB_COMMAND_MASTER_VOLUME;
+    } else if (strcmp(key, "subVolume") == 0) {
+        return WEB_COMMAND_SUB_VOLUME;
+    } else if (strcmp(key, "balance") == 0) {
+        return WEB_COMMAND_BALANCE;
+    } else if (strcmp(key, "fader") == 0) {
+        return WEB_COMMAND_FADER;
+    }
+    return WEB_COMMAND_UNKNOWN;
+}
+
+/**
+ * @returns Sum of the commands and values in the message, -1 if it did not parse
+ */
+static int handle_message_before(const char* message, size_t length) {
+    JsonDocument doc(&heap_allocator);
+    if (deserializeJson(doc, message, length) != DeserializationError::Ok) {
+        return -1;
+    }
+    int sum = 0;
+    for (JsonPair kv : doc.as<JsonObject>()) {
+        sum += dispatch_strcmp(kv.key().c_str()) + kv.value().as<int>();
+    }
+    return sum;
+}
+
+static int handle_message_after(const char* message, size_t length) {
+    arena.reset();
+    JsonDocument doc(&arena);
+    if (deserializeJson(doc, message, length) != DeserializationError::Ok) {
+        return -1;
+    }
+    int sum = 0;
+    for (JsonPair kv : doc.as<JsonObject>()) {
+        JsonString key = kv.key();
+        sum += web_command_lookup(key.c_str(), key.size()) + kv.value().as<int>();
+    }
+    return sum;
+}
+
+struct Bench_Message {
+    const char* name;
+    const char* text;
+};
+
+static const struct Bench_Message messages[] = {
+    {"{\"fader\":7}", "{\"fader\":7}"},
+    {"{\"masterVolume\":42}", "{\"masterVolume\":42}"},
+    {"{\"getRemoteSettings\":1}", "{\"getRemoteSettings\":1}"},
+    {"every command", "{\"getRemoteSettings\":1,\"subscribe\":63,\"password\":\"hunter22\",\"dspMemory\":1,"
+                      "\"changeSource\":1,\"masterVolume\":42,\"subVolume\":12,\"balance\":18,\"fader\":18}"},
+};
+
+int main(int argc, char** argv) {
+    uint32_t iterations = host_bench_iterations(argc, argv, BENCH_DEFAULT_ITERATIONS);
+    printf("%u iterations\n", (unsigned)iterations);
+
+    int checksum = 0;
+    for (const struct Bench_Message& message : messages) {
+        size_t length = strlen(message.text);
+        char name[64];
+        heap_allocator.heap_ops = 0;
+        snprintf(name, sizeof(name), "%s, strcmp + heap", message.name);
+        host_bench_run(name, iterations, [&](uint32_t) {
+            host_bench_keep(message.text);
+            checksum += handle_message_before(message.text, length);
+        });
+        snprintf(name, sizeof(name), "%s, hash + arena", message.name);
+        host_bench_run(name, iterations, [&](uint32_t) {
+            host_bench_keep(message.text);
+            checksum -= handle_message_after(message.text, length);
+        });
+        printf("%-40s %10.1f per message\n", "  heap calls before", (double)heap_allocator.heap_ops / iterations);
+    }
+    printf("%-40s %10u bytes\n", "arena high water", (unsigned)arena.high_water);
+
+    // Dispatch alone, keys copied at run time so the compiler cannot fold the lookups
+    static char keys[WEB_COMMAND_COUNT][24];
+    for (uint8_t command = 0; command < WEB_COMMAND_COUNT; command++) {
+        strcpy(keys[command], web_command_keys[command]);
+    }
+    host_bench_run("dispatch \"fader\", strcmp chain", iterations, [&](uint32_t) {
+        host_bench_keep(keys);
+        checksum += dispatch_strcmp(keys[WEB_COMMAND_FADER]);
+    });
+    host_bench_run("dispatch \"fader\", hash", iterations, [&](uint32_t) {
+        host_bench_keep(keys);
+        checksum -= web_command_lookup(keys[WEB_COMMAND_FADER], strlen(keys[WEB_COMMAND_FADER]));
+    });
+    host_bench_run("dispatch every key in turn, strcmp chain", iterations, [&](uint32_t i) {
+        host_bench_keep(keys);
+        checksum += dispatch_strcmp(keys[i % WEB_COMMAND_COUNT]);
+    });
+    host_bench_run("dispatch every key in turn, hash", iterations, [&](uint32_t i) {
+        host_bench_keep(keys);
+        const char* key = keys[i % WEB_COMMAND_COUNT];
+        checksum -= web_command_lookup(key, strlen(key));
+    });
+
+    // Both ways must have handled every message the same, without the arena running out
+    if (checksum != 0 || arena.failures) {
+        printf("Handlers disagree (checksum %d) or the arena ran out (%u)\n", checksum, (unsigned)arena.failures);
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,110 @@
+/**
+ * Author: Jaime Sequeira
+ *
+ * Host benchmark of the websocket protocols: bytes on the wire and parse time of the messages the webapp sends, JSON
+ * (ArduinoJson, default allocator) against the binary records. Usage: bench_web_protocol [iterations]
+ */
+
+#include "CustomDRCWebProtocol.hpp"
+#include "host_bench.hpp"
+
+#include <ArduinoJson.h>
+
+#define BENCH_DEFAULT_ITERATIONS 1000000
+
+/* What index.js send_setting() puts on the wire */
+static const char json_volume[] = "{masterVolume: 87}";
+static const char json_get_remote_settings[] = "{getRemoteSettings: 1}";
+
+/**
+ * Parse a JSON message and pull out its first value, the way the web server handles one
+ */
+static int parse_json(const char* message, size_t length) {
+    JsonDocument doc;
+    if (deserializeJson(doc, message, length) != DeserializationError::Ok) {
+        return -1;
+    }
+    int sum = 0;
+    for (JsonPair kv : doc.as<JsonObject>()) {
+        sum += kv.value().as<int>();
+    }
+    return sum;
+}
+
+static int parse_binary(const uint8_t* message, size_t length) {
+    Web_Protocol_Reader reader(message, length);
+    struct Web_Protocol_Record record;
+    int sum = 0;
+    while (reader.next(&record)) {
+        sum += record.value;
+    }
+    return reader.error ? -1 : sum;
+}
+
+/**
+ * Page load snapshot in the shape format_json_updates() builds it
+ */
+static size_t json_snapshot(char* buffer, size_t buffer_size) {
+    return snprintf(buffer, buffer_size,
+                    "{\"dspMemory\": %u, \"currentSource\": \"%s\", \"masterVolume\": %u, \"subVolume\": %u, "
+                    "\"balance\": %u, \"fader\": %u, \"usbConnected\": %u, \"fwVersion\": \"%s\"}",
+                    1, "     AUX In     ", 87, 12, 18, 18, 0, "v0.1.40 - 2025-06-17 19:44:15.533928");
+}
+
+static size_t binary_snapshot(uint8_t* buffer) {
+    uint8_t* position = buffer;
+    position = web_protocol_put_value(position, WEB_PROTOCOL_ID_DSP_MEMORY, 1);
+    position = web_protocol_put_string(position, WEB_PROTOCOL_ID_CURRENT_SOURCE, "     AUX In     ");
+    position = web_protocol_put_value(position, WEB_PROTOCOL_ID_MASTER_VOLUME, 87);
+    position = web_protocol_put_value(position, WEB_PROTOCOL_ID_SUB_VOLUME, 12);
+    position = web_protocol_put_value(position, WEB_PROTOCOL_ID_BALANCE, 18);
+    position = web_protocol_put_value(position, WEB_PROTOCOL_ID_FADER, 18);
+    position = web_protocol_put_value(position, WEB_PROTOCOL_ID_USB_CONNECTED, 0);
+    position = web_protocol_put_string(position, WEB_PROTOCOL_ID_FW_VERSION, "v0.1.40 - 2025-06-17 19:44:15.533928");
+    return position - buffer;
+}
+
+int main(int argc, char** argv) {
+    uint32_t iterations = host_bench_iterations(argc, argv, BENCH_DEFAULT_ITERATIONS);
+    uint8_t binary_volume[2];
+    web_protocol_put_value(binary_volume, WEB_PROTOCOL_ID_MASTER_VOLUME, 87);
+    uint8_t binary_get_remote_settings[1];
+    web_protocol_put_command(binary_get_remote_settings, WEB_PROTOCOL_ID_GET_REMOTE_SETTINGS);
+    char json_snapshot_message[256];
+    uint8_t binary_snapshot_message[256];
+    size_t json_snapshot_length = json_snapshot(json_snapshot_message, sizeof(json_snapshot_message));
+    size_t binary_snapshot_length = binary_snapshot(binary_snapshot_message);
+
+    printf("Bytes on the wire                            JSON     binary\n");
+    printf("%-40s %8u %10u\n", "volume update", (unsigned)strlen(json_volume), (unsigned)sizeof(binary_volume));
+    printf("%-40s %8u %10u\n", "getRemoteSettings", (unsigned)strlen(json_get_remote_settings),
+           (unsigned)sizeof(binary_get_remote_settings));
+    printf("%-40s %8u %10u\n", "page load snapshot", (unsigned)json_snapshot_length,
+           (unsigned)binary_snapshot_length);
+
+    printf("\n%u iterations\n", (unsigned)iterations);
+    int checksum = 0;
+    host_bench_run("parse volume, JSON", iterations, [&](uint32_t) {
+        host_bench_keep(json_volume);
+        checksum += parse_json(json_volume, strlen(json_volume));
+    });
+    host_bench_run("parse volume, binary", iterations, [&](uint32_t) {
+        host_bench_keep(binary_volume);
+        checksum -= parse_binary(binary_volume, sizeof(binary_volume));
+    });
+    host_bench_run("parse getRemoteSettings, JSON", iterations, [&](uint32_t) {
+        host_bench_keep(json_get_remote_settings);
+        checksum += parse_json(json_get_remote_settings, strlen(json_get_remote_settings)) - 1;
+    });
+    host_bench_run("parse getRemoteSettings, binary", iterations, [&](uint32_t) {
+        host_bench_keep(binary_get_remote_settings);
+        checksum += parse_binary(binary_get_remote_settings, sizeof(binary_get_remote_settings));
+    });
+
+    // Both protocols must have read the same values
+    if (checksum != 0) {
+        printf("JSON and binary parses disagree\n");
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
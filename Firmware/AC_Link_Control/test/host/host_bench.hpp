@@ -0,0 +1,54 @@
+/**
+ * Author: Jaime Sequeira
+ *
+ * Timing helpers for the host benchmarks. The headers under test have no Arduino or ESP-IDF dependencies so they build
+ * with the desktop compiler
+ */
+
+#pragma once
+
+// C++ includes
+#include <chrono>
+
+// C includes
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/**
+ * Benchmarks take their iteration count as the first argument. ctest runs them with a small count so they are built
+ * and run on every change, run them by hand with the default for numbers worth quoting
+ */
+inline uint32_t host_bench_iterations(int argc, char** argv, uint32_t default_iterations) {
+    if (argc > 1) {
+        uint32_t iterations = (uint32_t)strtoul(argv[1], nullptr, 0);
+        if (iterations) {
+            return iterations;
+        }
+    }
+    return default_iterations;
+}
+
+/**
+ * Keeps the compiler from optimising away work whose result is never used
+ */
+template <typename T>
+inline void host_bench_keep(const T& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/**
+ * Time iterations calls of body and print the average
+ * @returns Average time per call (ns)
+ */
+template <typename Body>
+double host_bench_run(const char* name, uint32_t iterations, Body body) {
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < iterations; i++) {
+        body(i);
+    }
+    auto end = std::chrono::steady_clock::now();
+    double ns_per_call = std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+    printf("%-40s %10.1f ns\n", name, ns_per_call);
+    return ns_per_call;
+}
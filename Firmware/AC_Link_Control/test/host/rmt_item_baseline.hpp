@@ -0,0 +1,46 @@
+/**
+ * Author: Jaime Sequeira
+ *
+ * The original bit loop RMT encoder, kept on the host only as the reference the symbol table is tested and benchmarked
+ * against. rmt_item32_t mirrors the ESP-IDF layout (driver/rmt.h)
+ */
+
+#pragma once
+
+// C includes
+#include <stdint.h>
+
+typedef struct {
+    union {
+        struct {
+            uint32_t duration0 : 15;
+            uint32_t level0 : 1;
+            uint32_t duration1 : 15;
+            uint32_t level1 : 1;
+        };
+        uint32_t val;
+    };
+} rmt_item32_t;
+
+/**
+ * Convert a 9-bit character into RMT items one bit pair at a time, copied from the baseline bus code
+ * @param byte_to_convert
+ * @param is_address
+ * @param item_buffer Must hold AC_LINK_RMT_ITEMS_PER_CHARACTER items
+ */
+inline void convert_byte_to_rmt_item_9bit(uint8_t byte_to_convert, bool is_address, rmt_item32_t* item_buffer) {
+    /** NOTE: UART protocol requires LSB format. We start by adding the extra idle
+     * bit and STOP bit to the data packet. We add the address flag (9th bit), the 8 bits
+     * of data and then the STOP bit (LOW for UART). The STOP bit is achieved by left shifting
+     * everything - you are left with 0 as the STOP bit
+     */
+    uint16_t data = (0b11 << 10) | (is_address << 9) | (byte_to_convert << 1);
+    uint8_t item_index = 0;
+    for (uint8_t i = 0; i < 11; i += 2) {
+        item_buffer[item_index].duration0 = 50;
+        item_buffer[item_index].level0 = (data >> i) & 1;
+        item_buffer[item_index].duration1 = 50;
+        item_buffer[item_index].level1 = (data >> (i + 1)) & 1;
+        item_index++;
+    }
+}
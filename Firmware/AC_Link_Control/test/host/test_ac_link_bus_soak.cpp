@@ -0,0 +1,336 @@
+/**
+ * Author: Jaime Sequeira
+ *
+ * Soak test of the bus owner logic against the simulated bus. The firmware's AC_Link_Bus_Core runs here unchanged,
+ * Soak_Port below stands in for the FreeRTOS tasks: a virtual clock, the simulated bus as the wire and the same RMT
+ * symbol, UART decoder and assembler RX path as the firmware
+ *
+ * The PC is plugged in and out of USB thousands of times with bit errors on every frame the DRC receives, while the
+ * encoders are turned faster than the bus can send. Every time the PC lets go the master MCU and the DSP must end up
+ * with the DRC's settings, and the simulated bus must never have to drop a frame
+ */
+
+#include "AudisonACLinkBusCore.hpp"
+#include "AudisonACLinkRmtSymbols.hpp"
+#include "AudisonACLinkSimulator.hpp"
+
+#include <catch.hpp>
+
+// C includes
+#include <stdio.h>
+
+#define SOAK_USB_CYCLES               2000
+#define SOAK_STEP_US                  250
+#define SOAK_RESPONSE_LATENCY_US      2000
+#define SOAK_BIT_ERROR_RATE_PPM       500
+#define SOAK_USB_CONNECTED_TIME_US    3000000
+#define SOAK_USB_DISCONNECTED_TIME_US 2500000
+#define SOAK_SETTLE_TIME_US           1000000 // Encoders are left alone this long after the PC lets go
+#define SOAK_KNOB_PERIOD_US           5000    // One encoder step this often, faster than the bus can send them
+#define SOAK_RX_RING_CAPACITY         32      // As the firmware's RX ring
+#define SOAK_IDLE_WARM_UP_US          60000000
+#define SOAK_IDLE_TIME_US             600000000
+#define SOAK_SEED                     0x2024
+
+static const uint8_t soak_firmware_version[2] = {0x03, 0x00};
+
+/**
+ * The firmware's tasks, on a virtual clock. Keeps the DRC's settings and records what the core reports
+ */
+class Soak_Port : public AC_Link_Bus_Port {
+  public:
+    explicit Soak_Port(AC_Link_Bus_Simulator* bus) : bus(bus) {
+    }
+
+    uint32_t now_us(void) override {
+        return (uint32_t)this->clock_us; // Wraps after 71 minutes, like micros()
+    }
+
+    void transmit(const struct AC_Link_Frame* frame) override {
+        if (frame->command() == AC_LINK_COMMAND_CHECK_DEVICE_PRESENT) {
+            this->pings_sent++;
+        }
+        if (frame->receiver() == AC_LINK_ADDRESS_DSP_PROCESSOR &&
+            ac_link_shadow_parameter(frame->command()) < AC_LINK_SHADOW_PARAMETER_COUNT) {
+            this->last_dsp_setting_us = this->clock_us;
+        }
+        this->bus->transmit(frame->bytes, frame->length, this->clock_us);
+    }
+
+    bool receive(struct AC_Link_Frame* frame) override {
+        return this->rx_frame_ring.pop(frame);
+    }
+
+    uint32_t rx_frames_lost(void) override {
+        return this->rx_frame_assembler.frames_dropped + this->rx_frame_ring.overflow_count;
+    }
+
+    /* Single threaded, nothing to lock or wake */
+    void lock(void) override {
+    }
+
+    void unlock(void) override {
+    }
+
+    void wake(void) override {
+    }
+
+    void read_settings(uint8_t* values) override {
+        memcpy(values, this->settings, AC_LINK_SHADOW_MEMORY);
+    }
+
+    void on_setting_followed(uint8_t parameter, uint8_t value) override {
+        if (parameter < AC_LINK_SHADOW_MEMORY) {
+            this->settings[parameter] = value;
+        }
+    }
+
+    void on_source_name(const char*) override {
+        this->source_name_us = this->clock_us;
+    }
+
+    void on_usb_connected(void) override {
+    }
+
+    void on_usb_disconnected(void) override {
+        this->usb_disconnected_us = this->clock_us;
+    }
+
+    void on_dsp_ready(void) override {
+    }
+
+    void on_devices_synced(void) override {
+    }
+
+    void on_boot_complete(void) override {
+    }
+
+    void on_dsp_lost(void) override {
+        this->dsp_lost++; // The firmware would shut down here
+    }
+
+    void write_log(AC_Link_Bus_Log_Level, const char*, va_list) override {
+    }
+
+    /**
+     * A frame as the RX channel hears it. Played through the RMT symbols, UART decoder and assembler like the real RX
+     * path so corrupted frames are dropped where the firmware drops them
+     */
+    void hear(const struct AC_Link_Frame* frame) {
+        uint32_t items[AC_LINK_MAX_FRAME_SIZE_BYTES * AC_LINK_RMT_ITEMS_PER_CHARACTER];
+        size_t item_count = ac_link_frame_to_rmt_items(frame->bytes, frame->length, items);
+        uint8_t data;
+        bool is_address;
+        for (size_t i = 0; i < item_count; i++) {
+            bool level0 = (items[i] >> 15) & 1;
+            bool level1 = (items[i] >> 31) & 1;
+            if (this->uart_decoder.push_run(level0, 1, &data, &is_address)) {
+                this->push_rx_byte(data, is_address);
+            }
+            if (this->uart_decoder.push_run(level1, 1, &data, &is_address)) {
+                this->push_rx_byte(data, is_address);
+            }
+        }
+        if (this->uart_decoder.end_of_burst(&data, &is_address)) {
+            this->push_rx_byte(data, is_address);
+        }
+    }
+
+    uint64_t clock_us = 0;
+    uint8_t settings[AC_LINK_SHADOW_MEMORY] = {0x3C, 0x0C, 0x12, 0x12}; // Master, sub, balance, fader
+    uint64_t usb_disconnected_us = 0; // Last time the PC handed the bus back
+    uint32_t dsp_lost = 0;
+    uint32_t pings_sent = 0;
+    uint64_t last_dsp_setting_us = 0;
+    uint64_t source_name_us = 0; // Last time the DSP told us its source
+    AC_Link_Frame_Assembler rx_frame_assembler;
+    AC_Link_Frame_Ring<SOAK_RX_RING_CAPACITY> rx_frame_ring;
+
+  private:
+    void push_rx_byte(uint8_t data, bool is_address) {
+        if (this->rx_frame_assembler.push_byte(data, is_address) == AC_LINK_ASSEMBLER_FRAME_COMPLETE) {
+            this->rx_frame_ring.push(this->rx_frame_assembler.frame());
+        }
+    }
+
+    AC_Link_Bus_Simulator* bus;
+    AC_Link_9bit_Uart_Decoder uart_decoder;
+};
+
+/**
+ * @returns Number of single value settings the device does not agree with the DRC on
+ */
+static uint8_t settings_mismatch(const Soak_Port& port, const struct AC_Link_Simulated_Settings& device) {
+    const uint8_t values[AC_LINK_SHADOW_MEMORY] = {device.master_volume, device.sub_volume, device.balance,
+                                                   device.fader};
+    uint8_t mismatches = 0;
+    for (uint8_t parameter = 0; parameter < AC_LINK_SHADOW_MEMORY; parameter++) {
+        mismatches += values[parameter] != port.settings[parameter];
+    }
+    return mismatches;
+}
+
+/**
+ * Deliver what is due on the bus, run the poller when due, then the bus task. Does not advance the clock
+ */
+static void run_drc(AC_Link_Bus_Simulator* bus, Soak_Port* port, AC_Link_Bus_Core* drc, uint64_t* next_poll_us) {
+    struct AC_Link_Frame frame;
+    bus->advance(port->clock_us);
+    while (bus->receive(port->clock_us, &frame)) {
+        port->hear(&frame);
+    }
+    if (port->clock_us >= *next_poll_us) {
+        drc->poll();
+        *next_poll_us = port->clock_us + AC_LINK_POLL_PERIOD_US;
+    }
+    drc->service_bus();
+}
+
+TEST_CASE("usb cycle soak", "[soak]") {
+    struct AC_Link_Simulator_Config config;
+    config.response_latency_us = SOAK_RESPONSE_LATENCY_US;
+    config.bit_error_rate_ppm = SOAK_BIT_ERROR_RATE_PPM;
+    config.usb_connected_time_us = SOAK_USB_CONNECTED_TIME_US;
+    config.usb_disconnected_time_us = SOAK_USB_DISCONNECTED_TIME_US;
+    config.seed = SOAK_SEED;
+    AC_Link_Bus_Simulator bus(config);
+    Soak_Port port(&bus);
+    AC_Link_Bus_Core drc(&port, soak_firmware_version);
+
+    uint32_t random_state = SOAK_SEED;
+    uint64_t next_poll_us = 0;
+    uint64_t next_knob_us = 0;
+    uint64_t checked_disconnect_us = 0;
+    uint32_t convergence_checks = 0;
+    uint32_t convergence_failures = 0;
+    // Run until the last cycle has been checked, with a generous cap in case the DRC gets stuck
+    uint64_t end_us = (uint64_t)SOAK_USB_CYCLES * (SOAK_USB_CONNECTED_TIME_US + SOAK_USB_DISCONNECTED_TIME_US) * 2;
+    while (convergence_checks < SOAK_USB_CYCLES && port.clock_us < end_us) {
+        uint64_t now_us = port.clock_us;
+        // Encoders are disabled while the PC owns the bus. Turn them in bursts the rest of the time
+        bool settling = port.usb_disconnected_us && (now_us - port.usb_disconnected_us) < SOAK_SETTLE_TIME_US;
+        if (drc.is_boot_completed() && !drc.is_usb_connected() && !settling && now_us >= next_knob_us) {
+            random_state ^= random_state << 13;
+            random_state ^= random_state >> 17;
+            random_state ^= random_state << 5;
+            uint8_t parameter = random_state % AC_LINK_SHADOW_MEMORY;
+            uint8_t value = (random_state >> 8) % 0x100;
+            switch (parameter) {
+                case AC_LINK_SHADOW_MASTER_VOLUME:
+                    value %= MAX_VOLUME_VALUE + 1;
+                    drc.set_volume(value);
+                    break;
+                case AC_LINK_SHADOW_SUB_VOLUME:
+                    value %= MAX_SUB_VOLUME_VALUE + 1;
+                    drc.set_sub_volume(value);
+                    break;
+                case AC_LINK_SHADOW_BALANCE:
+                    value %= MAX_BALANCE_VALUE + 1;
+                    drc.set_balance(value);
+                    break;
+                default:
+                    value %= MAX_FADER_VALUE + 1;
+                    drc.set_fader(value);
+                    break;
+            }
+            port.settings[parameter] = value;
+            // Bursts of steps with pauses in between
+            next_knob_us = now_us + (((random_state >> 16) & 0xF) ? SOAK_KNOB_PERIOD_US : 200000);
+        }
+        run_drc(&bus, &port, &drc, &next_poll_us);
+
+        // Once the resync has gone out, both devices must have the DRC's settings
+        if (port.usb_disconnected_us != checked_disconnect_us && settling && drc.is_idle() &&
+            (now_us - port.usb_disconnected_us) >= SOAK_SETTLE_TIME_US / 2) {
+            checked_disconnect_us = port.usb_disconnected_us;
+            convergence_checks++;
+            if (settings_mismatch(port, bus.master_mcu) || settings_mismatch(port, bus.dsp)) {
+                convergence_failures++;
+            }
+        }
+        port.clock_us += SOAK_STEP_US;
+    }
+
+    printf("%u USB cycles (%u sessions seen by the DRC) in %u s of bus time\n", (unsigned)bus.usb_cycles,
+           (unsigned)drc.usb_sessions, (unsigned)(port.clock_us / 1000000));
+    printf("%u frames from DRC, %u to DRC, %u corrupted, %u lost by the DRC's RX\n", (unsigned)bus.frames_from_drc,
+           (unsigned)bus.frames_to_drc, (unsigned)bus.frames_corrupted, (unsigned)port.rx_frames_lost());
+    printf("%u values resent, %u skipped, %u coalesced, %u echo timeouts\n", (unsigned)drc.values_resent,
+           (unsigned)drc.values_skipped, (unsigned)drc.setting_values_replaced(), (unsigned)drc.echo_timeouts);
+    printf("%u requests refused while the PC owned the bus\n", (unsigned)drc.requests_refused);
+    printf("%u of %u resyncs left a device out of step\n", (unsigned)convergence_failures,
+           (unsigned)convergence_checks);
+
+    CHECK(drc.is_boot_completed());
+    CHECK(convergence_checks == SOAK_USB_CYCLES);
+    CHECK(convergence_failures == 0);
+    CHECK(bus.frames_dropped == 0);
+    CHECK(bus.frames_corrupted > 0); // Or the soak proved nothing about bit errors
+    CHECK(port.rx_frame_ring.overflow_count == 0);
+    CHECK(drc.setting_values_replaced() > 0);
+    CHECK(drc.requests_dropped == 0);
+    CHECK(port.dsp_lost == 0); // The DRC would have shut the DSP down
+}
+
+TEST_CASE("presence pings back off on an idle bus", "[soak]") {
+    struct AC_Link_Simulator_Config config; // No PC, no bit errors
+    config.response_latency_us = SOAK_RESPONSE_LATENCY_US;
+    AC_Link_Bus_Simulator bus(config);
+    Soak_Port port(&bus);
+    AC_Link_Bus_Core drc(&port, soak_firmware_version);
+
+    uint64_t next_poll_us = 0;
+    while (port.clock_us < SOAK_IDLE_WARM_UP_US) {
+        run_drc(&bus, &port, &drc, &next_poll_us);
+        port.clock_us += SOAK_STEP_US;
+    }
+    REQUIRE(drc.is_boot_completed());
+    uint32_t pings_at_start = port.pings_sent;
+    while (port.clock_us < SOAK_IDLE_WARM_UP_US + SOAK_IDLE_TIME_US) {
+        run_drc(&bus, &port, &drc, &next_poll_us);
+        port.clock_us += SOAK_STEP_US;
+    }
+    double pings_per_second = (port.pings_sent - pings_at_start) / (SOAK_IDLE_TIME_US / 1e6);
+    printf("Idle presence pings: %.3f/s\n", pings_per_second);
+
+    // Both pings at their longest interval: 1 / 8 s (DSP) + 1 / 10 s (PC)
+    CHECK(pings_per_second <= 1e6 / AC_LINK_DSP_POLL_MAX_INTERVAL_US + 1e6 / AC_LINK_USB_POLL_MAX_INTERVAL_US + 0.01);
+    CHECK(port.dsp_lost == 0);
+}
+
+TEST_CASE("a source change resyncs once the DSP has reloaded", "[soak]") {
+    struct AC_Link_Simulator_Config config; // No PC, no bit errors
+    config.response_latency_us = SOAK_RESPONSE_LATENCY_US;
+    AC_Link_Bus_Simulator bus(config);
+    Soak_Port port(&bus);
+    AC_Link_Bus_Core drc(&port, soak_firmware_version);
+
+    uint64_t next_poll_us = 0;
+    while (!(drc.is_boot_completed() && drc.is_idle()) && port.clock_us < SOAK_IDLE_WARM_UP_US) {
+        run_drc(&bus, &port, &drc, &next_poll_us);
+        port.clock_us += SOAK_STEP_US;
+    }
+    REQUIRE(drc.is_boot_completed());
+    REQUIRE(settings_mismatch(port, bus.dsp) == 0);
+
+    drc.change_source();
+    uint64_t change_us = port.clock_us;
+    while (port.source_name_us < change_us && port.clock_us < change_us + AC_LINK_TX_RESPONSE_TIMEOUT_US) {
+        run_drc(&bus, &port, &drc, &next_poll_us);
+        port.clock_us += SOAK_STEP_US;
+    }
+    REQUIRE(port.source_name_us >= change_us);
+    // The DSP reloads the new source's settings, which are not the DRC's
+    bus.dsp.master_volume = 0;
+    bus.dsp.fader = 0;
+    uint64_t end_us = port.clock_us + 2 * AC_LINK_SOURCE_RELOAD_US;
+    while (port.clock_us < end_us) {
+        run_drc(&bus, &port, &drc, &next_poll_us);
+        port.clock_us += SOAK_STEP_US;
+    }
+
+    CHECK(port.last_dsp_setting_us >= port.source_name_us + AC_LINK_SOURCE_RELOAD_US); // Not sent into the reload
+    CHECK(settings_mismatch(port, bus.dsp) == 0);
+    CHECK(settings_mismatch(port, bus.master_mcu) == 0);
+    CHECK(drc.is_idle());
+}
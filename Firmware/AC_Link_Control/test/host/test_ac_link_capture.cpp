@@ -0,0 +1,183 @@
+/**
+ * Author: Jaime Sequeira
+ *
+ * Host tests for the capture ring and the PCAP stream served on /capture
+ */
+
+#include "AudisonACLinkCapture.hpp"
+
+#include <catch.hpp>
+
+// C++ includes
+#include <vector>
+
+#define TEST_RING_CAPACITY 8
+
+static uint16_t get_u16(const uint8_t* buffer) {
+    return (uint16_t)(buffer[0] | (buffer[1] << 8));
+}
+
+static uint32_t get_u32(const uint8_t* buffer) {
+    return get_u16(buffer) | ((uint32_t)get_u16(buffer + 2) << 16);
+}
+
+/**
+ * Record a frame whose bytes are all its index, so a slot tells which frame it holds
+ */
+static void record_frame(AC_Link_Capture_Ring<TEST_RING_CAPACITY>* ring, uint32_t index, uint8_t length = 6) {
+    uint8_t bytes[64];
+    memset(bytes, (uint8_t)index, sizeof(bytes));
+    ring->record((index & 1) ? AC_LINK_CAPTURE_DIRECTION_TX : AC_LINK_CAPTURE_DIRECTION_RX, 1000000ull * index + index,
+                 bytes, length);
+}
+
+/**
+ * Read a whole stream, max_chunk bytes at a time
+ */
+static std::vector<uint8_t> read_stream(AC_Link_Pcap_Stream<TEST_RING_CAPACITY>* stream, size_t max_chunk) {
+    std::vector<uint8_t> output;
+    uint8_t buffer[256];
+    size_t length;
+    while ((length = stream->read(buffer, max_chunk)) != 0) {
+        output.insert(output.end(), buffer, buffer + length);
+    }
+    return output;
+}
+
+TEST_CASE("ring keeps every frame until it is full", "[capture]") {
+    AC_Link_Capture_Ring<TEST_RING_CAPACITY> ring;
+    CHECK(ring.oldest_sequence() == 0);
+    CHECK(ring.end_sequence() == 0);
+
+    for (uint32_t i = 0; i < TEST_RING_CAPACITY; i++) {
+        record_frame(&ring, i);
+    }
+    CHECK(ring.oldest_sequence() == 0);
+    CHECK(ring.end_sequence() == TEST_RING_CAPACITY);
+    for (uint32_t i = 0; i < TEST_RING_CAPACITY; i++) {
+        INFO("sequence " << i);
+        struct AC_Link_Capture_Entry entry;
+        REQUIRE(ring.read(i, &entry));
+        CHECK(entry.bytes[0] == i);
+        CHECK(entry.frame_length == 6);
+        CHECK(entry.timestamp_us == 1000000ull * i + i);
+    }
+    struct AC_Link_Capture_Entry entry;
+    CHECK_FALSE(ring.read(TEST_RING_CAPACITY, &entry)); // Not recorded yet
+}
+
+TEST_CASE("ring overwrites the oldest frames once it wraps", "[capture]") {
+    AC_Link_Capture_Ring<TEST_RING_CAPACITY> ring;
+    const uint32_t frame_count = 3 * TEST_RING_CAPACITY + 5;
+    for (uint32_t i = 0; i < frame_count; i++) {
+        record_frame(&ring, i);
+    }
+    CHECK(ring.end_sequence() == frame_count);
+    CHECK(ring.oldest_sequence() == frame_count - TEST_RING_CAPACITY);
+
+    struct AC_Link_Capture_Entry entry;
+    for (uint32_t sequence = 0; sequence < ring.oldest_sequence(); sequence++) {
+        INFO("overwritten sequence " << sequence);
+        CHECK_FALSE(ring.read(sequence, &entry));
+    }
+    for (uint32_t sequence = ring.oldest_sequence(); sequence < ring.end_sequence(); sequence++) {
+        INFO("sequence " << sequence);
+        REQUIRE(ring.read(sequence, &entry));
+        CHECK(entry.bytes[0] == (uint8_t)sequence);
+        CHECK(entry.direction == ((sequence & 1) ? AC_LINK_CAPTURE_DIRECTION_TX : AC_LINK_CAPTURE_DIRECTION_RX));
+    }
+}
+
+TEST_CASE("frames longer than the capture size are truncated but keep their length", "[capture]") {
+    AC_Link_Capture_Ring<TEST_RING_CAPACITY> ring;
+    record_frame(&ring, 1, 40);
+    struct AC_Link_Capture_Entry entry;
+    REQUIRE(ring.read(0, &entry));
+    CHECK(entry.frame_length == 40);
+    CHECK(entry.captured_length() == AC_LINK_CAPTURE_MAX_FRAME_SIZE_BYTES);
+}
+
+TEST_CASE("PCAP global header", "[capture][pcap]") {
+    AC_Link_Capture_Ring<TEST_RING_CAPACITY> ring;
+    AC_Link_Pcap_Stream<TEST_RING_CAPACITY> stream(&ring);
+    std::vector<uint8_t> pcap = read_stream(&stream, 256);
+
+    // An empty ring is a valid file with no records
+    REQUIRE(pcap.size() == AC_LINK_PCAP_FILE_HEADER_SIZE_BYTES);
+    const uint8_t magic[] = {0xD4, 0xC3, 0xB2, 0xA1}; // Little endian, microsecond timestamps
+    CHECK(memcmp(pcap.data(), magic, sizeof(magic)) == 0);
+    CHECK(get_u16(&pcap[4]) == 2);
+    CHECK(get_u16(&pcap[6]) == 4);
+    CHECK(get_u32(&pcap[8]) == 0);
+    CHECK(get_u32(&pcap[12]) == 0);
+    CHECK(get_u32(&pcap[16]) == 33); // Direction byte + 32 frame bytes
+    CHECK(get_u32(&pcap[20]) == 147); // LINKTYPE_USER0
+}
+
+TEST_CASE("PCAP records carry the timestamp, direction and truncated frame", "[capture][pcap]") {
+    AC_Link_Capture_Ring<TEST_RING_CAPACITY> ring;
+    const uint8_t short_frame[] = {0x00, 0x80, 0xF0, 0x07, 0x0A, 0x3C, 0xC6};
+    uint8_t long_frame[40];
+    for (uint8_t i = 0; i < sizeof(long_frame); i++) {
+        long_frame[i] = i;
+    }
+    ring.record(AC_LINK_CAPTURE_DIRECTION_TX, 12345678ull, short_frame, sizeof(short_frame));
+    ring.record(AC_LINK_CAPTURE_DIRECTION_RX, 3000000ull, long_frame, sizeof(long_frame));
+
+    AC_Link_Pcap_Stream<TEST_RING_CAPACITY> stream(&ring);
+    std::vector<uint8_t> pcap = read_stream(&stream, 256);
+    size_t short_record_size = AC_LINK_PCAP_RECORD_HEADER_SIZE_BYTES + 1 + sizeof(short_frame);
+    size_t long_record_size = AC_LINK_PCAP_RECORD_HEADER_SIZE_BYTES + 1 + AC_LINK_CAPTURE_MAX_FRAME_SIZE_BYTES;
+    REQUIRE(pcap.size() == AC_LINK_PCAP_FILE_HEADER_SIZE_BYTES + short_record_size + long_record_size);
+
+    const uint8_t* record = &pcap[AC_LINK_PCAP_FILE_HEADER_SIZE_BYTES];
+    CHECK(get_u32(&record[0]) == 12);
+    CHECK(get_u32(&record[4]) == 345678);
+    CHECK(get_u32(&record[8]) == 1 + sizeof(short_frame));
+    CHECK(get_u32(&record[12]) == 1 + sizeof(short_frame));
+    CHECK(record[16] == AC_LINK_CAPTURE_DIRECTION_TX);
+    CHECK(memcmp(&record[17], short_frame, sizeof(short_frame)) == 0);
+
+    record += short_record_size;
+    CHECK(get_u32(&record[0]) == 3);
+    CHECK(get_u32(&record[4]) == 0);
+    CHECK(get_u32(&record[8]) == 1 + AC_LINK_CAPTURE_MAX_FRAME_SIZE_BYTES); // Captured length
+    CHECK(get_u32(&record[12]) == 1 + sizeof(long_frame));                  // Length on the wire
+    CHECK(record[16] == AC_LINK_CAPTURE_DIRECTION_RX);
+    CHECK(memcmp(&record[17], long_frame, AC_LINK_CAPTURE_MAX_FRAME_SIZE_BYTES) == 0);
+    CHECK(stream.records_skipped == 0);
+}
+
+TEST_CASE("PCAP stream is the same whatever size it is read in", "[capture][pcap]") {
+    AC_Link_Capture_Ring<TEST_RING_CAPACITY> ring;
+    for (uint32_t i = 0; i < TEST_RING_CAPACITY + 3; i++) {
+        record_frame(&ring, i, (uint8_t)(5 + 3 * i));
+    }
+    AC_Link_Pcap_Stream<TEST_RING_CAPACITY> whole_stream(&ring);
+    std::vector<uint8_t> expected = read_stream(&whole_stream, 256);
+    for (size_t max_chunk : {1, 7, 16, 49}) {
+        INFO("chunk " << max_chunk);
+        AC_Link_Pcap_Stream<TEST_RING_CAPACITY> stream(&ring);
+        CHECK(read_stream(&stream, max_chunk) == expected);
+    }
+}
+
+TEST_CASE("PCAP stream skips frames overwritten after it was created", "[capture][pcap]") {
+    AC_Link_Capture_Ring<TEST_RING_CAPACITY> ring;
+    for (uint32_t i = 0; i < TEST_RING_CAPACITY; i++) {
+        record_frame(&ring, i);
+    }
+    AC_Link_Pcap_Stream<TEST_RING_CAPACITY> stream(&ring);
+    uint8_t header[AC_LINK_PCAP_FILE_HEADER_SIZE_BYTES];
+    REQUIRE(stream.read(header, sizeof(header)) == sizeof(header));
+
+    // Three new frames replace the three oldest. They came after the snapshot so they are not streamed either
+    for (uint32_t i = TEST_RING_CAPACITY; i < TEST_RING_CAPACITY + 3; i++) {
+        record_frame(&ring, i);
+    }
+    std::vector<uint8_t> records = read_stream(&stream, 256);
+    size_t record_size = AC_LINK_PCAP_RECORD_HEADER_SIZE_BYTES + 1 + 6;
+    CHECK(stream.records_skipped == 3);
+    REQUIRE(records.size() == (TEST_RING_CAPACITY - 3) * record_size);
+    CHECK(records[AC_LINK_PCAP_RECORD_HEADER_SIZE_BYTES + 1] == 3); // First record is frame 3
+}
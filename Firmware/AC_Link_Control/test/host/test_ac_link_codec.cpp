@@ -0,0 +1,288 @@
+/**
+ * Author: Jaime Sequeira
+ *
+ * Host tests for the AC Link frame codec, RX frame assembler, frame ring and 9-bit UART decoder
+ */
+
+#include "AudisonACLinkCodec.hpp"
+
+#include <catch.hpp>
+
+/**
+ * Encode a 9-bit character as the runs of constant level the RMT RX channel would capture (START, 9 data bits LSB
+ * first, STOP). Adjacent bits of the same level are merged into one run like the capture does
+ * @returns Number of runs written
+ */
+static uint8_t character_to_runs(uint8_t data, bool is_address, bool* levels, uint16_t* bit_counts) {
+    uint16_t bits = (1 << 10) | ((uint16_t)is_address << 9) | ((uint16_t)data << 1); // STOP, address, data, START
+    uint8_t run_count = 0;
+    for (uint8_t i = 0; i < AC_LINK_UART_BITS_PER_CHARACTER; i++) {
+        bool level = (bits >> i) & 1;
+        if (run_count && levels[run_count - 1] == level) {
+            bit_counts[run_count - 1]++;
+        } else {
+            levels[run_count] = level;
+            bit_counts[run_count] = 1;
+            run_count++;
+        }
+    }
+    return run_count;
+}
+
+TEST_CASE("encode validate round trip", "[codec]") {
+    const uint8_t data[] = {AC_LINK_COMMAND_MASTER_VOLUME, 0x3C};
+    struct AC_Link_Frame frame;
+    CHECK(ac_link_encode_frame(AC_LINK_ADDRESS_MASTER_MCU, AC_LINK_ADDRESS_DRC, data, sizeof(data), &frame));
+    CHECK(frame.length == (AC_LINK_MIN_FRAME_SIZE_BYTES + 1));
+    CHECK(frame.receiver() == AC_LINK_ADDRESS_MASTER_MCU);
+    CHECK(frame.transmitter() == AC_LINK_ADDRESS_DRC);
+    CHECK(frame.bytes[AC_LINK_FRAME_INDEX_DELIMITER] == AC_LINK_FRAME_DELIMITER);
+    CHECK(frame.bytes[AC_LINK_FRAME_INDEX_LENGTH] == frame.length);
+    CHECK(frame.command() == AC_LINK_COMMAND_MASTER_VOLUME);
+    CHECK(frame.payload_length() == 1);
+    CHECK(frame.payload()[0] == 0x3C);
+    CHECK(ac_link_validate_frame(frame.bytes, frame.length) == AC_LINK_FRAME_OK);
+
+    // Volume 0x3C from the DRC to the master MCU, worked out by hand from the packet structure in the README
+    const uint8_t captured[] = {0x00, 0x80, 0x00, 0x07, 0x0A, 0x3C, 0xCD};
+    CHECK(frame.length == sizeof(captured));
+    CHECK(memcmp(captured, frame.bytes, sizeof(captured)) == 0);
+
+    struct AC_Link_Frame decoded;
+    CHECK(ac_link_decode_frame(frame.bytes, frame.length, &decoded) == AC_LINK_FRAME_OK);
+    CHECK(decoded.length == frame.length);
+    CHECK(memcmp(frame.bytes, decoded.bytes, frame.length) == 0);
+
+    // Every payload length the length byte can describe
+    uint8_t long_data[AC_LINK_MAX_FRAME_SIZE_BYTES];
+    for (uint16_t i = 0; i < sizeof(long_data); i++) {
+        long_data[i] = (uint8_t)(i * 7);
+    }
+    uint8_t max_data_length = AC_LINK_MAX_FRAME_SIZE_BYTES - AC_LINK_HEADER_SIZE_BYTES - AC_LINK_CHECKSUM_SIZE_BYTES;
+    for (uint16_t data_length = 1; data_length <= max_data_length; data_length++) {
+        CHECK(ac_link_encode_frame(AC_LINK_ADDRESS_DSP_PROCESSOR, AC_LINK_ADDRESS_DRC, long_data, data_length,
+                                   &frame));
+        CHECK(ac_link_validate_frame(frame.bytes, frame.length) == AC_LINK_FRAME_OK);
+        CHECK(frame.payload_length() == (data_length - 1));
+    }
+}
+
+TEST_CASE("encode rejects bad lengths", "[codec]") {
+    uint8_t data[AC_LINK_MAX_FRAME_SIZE_BYTES] = {AC_LINK_COMMAND_CHECK_DEVICE_PRESENT};
+    struct AC_Link_Frame frame;
+    CHECK(!ac_link_encode_frame(AC_LINK_ADDRESS_MASTER_MCU, AC_LINK_ADDRESS_DRC, data, 0, &frame));
+    uint8_t too_long = AC_LINK_MAX_FRAME_SIZE_BYTES - AC_LINK_HEADER_SIZE_BYTES - AC_LINK_CHECKSUM_SIZE_BYTES + 1;
+    CHECK(!ac_link_encode_frame(AC_LINK_ADDRESS_MASTER_MCU, AC_LINK_ADDRESS_DRC, data, too_long, &frame));
+    uint8_t small_buffer[AC_LINK_MIN_FRAME_SIZE_BYTES];
+    CHECK(ac_link_encode_frame(AC_LINK_ADDRESS_MASTER_MCU, AC_LINK_ADDRESS_DRC, data, 2, small_buffer,
+                               sizeof(small_buffer)) == 0);
+    CHECK(ac_link_encode_frame(AC_LINK_ADDRESS_MASTER_MCU, AC_LINK_ADDRESS_DRC, data, 1, small_buffer,
+                               sizeof(small_buffer)) == sizeof(small_buffer));
+}
+
+TEST_CASE("validate errors", "[codec]") {
+    const uint8_t data[] = {AC_LINK_COMMAND_SUB_VOLUME_ADJUST, 0x0C};
+    struct AC_Link_Frame frame;
+    ac_link_encode_frame(AC_LINK_ADDRESS_MASTER_MCU, AC_LINK_ADDRESS_DRC, data, sizeof(data), &frame);
+
+    CHECK(ac_link_validate_frame(frame.bytes, AC_LINK_MIN_FRAME_SIZE_BYTES - 1) == AC_LINK_FRAME_ERROR_TOO_SHORT);
+    CHECK(ac_link_validate_frame(frame.bytes, frame.length - 1) == AC_LINK_FRAME_ERROR_LENGTH_MISMATCH);
+
+    struct AC_Link_Frame bad_length = frame;
+    bad_length.bytes[AC_LINK_FRAME_INDEX_LENGTH]++;
+    CHECK(ac_link_validate_frame(bad_length.bytes, bad_length.length) == AC_LINK_FRAME_ERROR_LENGTH_MISMATCH);
+
+    // Any single flipped bit ahead of the checksum is caught
+    for (uint8_t index = 0; index < frame.length - 1; index++) {
+        if (index == AC_LINK_FRAME_INDEX_LENGTH) {
+            continue;
+        }
+        for (uint8_t bit = 0; bit < 8; bit++) {
+            struct AC_Link_Frame corrupted = frame;
+            corrupted.bytes[index] ^= 1 << bit;
+            CHECK(ac_link_validate_frame(corrupted.bytes, corrupted.length) == AC_LINK_FRAME_ERROR_CHECKSUM);
+        }
+    }
+    struct AC_Link_Frame bad_checksum = frame;
+    bad_checksum.bytes[bad_checksum.length - 1] ^= 0x80;
+    CHECK(ac_link_validate_frame(bad_checksum.bytes, bad_checksum.length) == AC_LINK_FRAME_ERROR_CHECKSUM);
+
+    struct AC_Link_Frame decoded;
+    CHECK(ac_link_decode_frame(bad_checksum.bytes, bad_checksum.length, &decoded) == AC_LINK_FRAME_ERROR_CHECKSUM);
+    uint8_t oversized[AC_LINK_MAX_FRAME_SIZE_BYTES + 1] = {};
+    CHECK(ac_link_decode_frame(oversized, sizeof(oversized), &decoded) == AC_LINK_FRAME_ERROR_BUFFER_TOO_SMALL);
+}
+
+/**
+ * Feed a frame to the assembler the way it comes off the bus, only the first byte has the address bit set
+ * @returns Result of the last byte
+ */
+static AC_Link_Assembler_Result push_frame(AC_Link_Frame_Assembler* assembler, const uint8_t* bytes, uint8_t length) {
+    AC_Link_Assembler_Result result = AC_LINK_ASSEMBLER_IN_PROGRESS;
+    for (uint8_t i = 0; i < length; i++) {
+        result = assembler->push_byte(bytes[i], i == 0);
+    }
+    return result;
+}
+
+TEST_CASE("assembler split frames", "[codec]") {
+    const uint8_t data[] = {AC_LINK_COMMAND_INPUT_SOURCE_NAME, 'A', 'U', 'X', ' ', 'I', 'n'};
+    struct AC_Link_Frame frame;
+    ac_link_encode_frame(AC_LINK_ADDRESS_DRC, AC_LINK_ADDRESS_DSP_PROCESSOR, data, sizeof(data), &frame);
+
+    // One byte at a time, the frame only completes on its last byte
+    AC_Link_Frame_Assembler assembler;
+    for (uint8_t i = 0; i < frame.length; i++) {
+        AC_Link_Assembler_Result result = assembler.push_byte(frame.bytes[i], i == 0);
+        CHECK(result == ((i == frame.length - 1) ? AC_LINK_ASSEMBLER_FRAME_COMPLETE : AC_LINK_ASSEMBLER_IN_PROGRESS));
+    }
+    CHECK(assembler.frame()->length == frame.length);
+    CHECK(memcmp(frame.bytes, assembler.frame()->bytes, frame.length) == 0);
+
+    // Back to back frames split at every possible point, as separate RX bursts would deliver them
+    for (uint8_t split = 1; split < frame.length; split++) {
+        AC_Link_Frame_Assembler split_assembler;
+        uint8_t completed = 0;
+        for (uint8_t repeat = 0; repeat < 2; repeat++) {
+            for (uint8_t i = 0; i < split; i++) {
+                completed += split_assembler.push_byte(frame.bytes[i], i == 0) == AC_LINK_ASSEMBLER_FRAME_COMPLETE;
+            }
+            for (uint8_t i = split; i < frame.length; i++) {
+                completed += split_assembler.push_byte(frame.bytes[i], false) == AC_LINK_ASSEMBLER_FRAME_COMPLETE;
+            }
+        }
+        CHECK(completed == 2);
+        CHECK(split_assembler.frames_dropped == 0);
+    }
+    CHECK(assembler.frames_completed == 1);
+}
+
+TEST_CASE("assembler garbage", "[codec]") {
+    const uint8_t data[] = {AC_LINK_COMMAND_MASTER_VOLUME, 0x50};
+    struct AC_Link_Frame frame;
+    ac_link_encode_frame(AC_LINK_ADDRESS_MASTER_MCU, AC_LINK_ADDRESS_DRC, data, sizeof(data), &frame);
+    AC_Link_Frame_Assembler assembler;
+
+    // Data bytes with no receiver address ahead of them are discarded until the next address byte
+    for (uint8_t i = 0; i < 5; i++) {
+        CHECK(assembler.push_byte(0xA5, false) == AC_LINK_ASSEMBLER_IN_PROGRESS);
+    }
+    CHECK(assembler.bytes_discarded == 5);
+    CHECK(push_frame(&assembler, frame.bytes, frame.length) == AC_LINK_ASSEMBLER_FRAME_COMPLETE);
+
+    // A frame cut short by the next address byte is dropped and the new frame still comes through
+    for (uint8_t i = 0; i < 3; i++) {
+        assembler.push_byte(frame.bytes[i], i == 0);
+    }
+    CHECK(assembler.push_byte(frame.bytes[0], true) == AC_LINK_ASSEMBLER_FRAME_DROPPED);
+    for (uint8_t i = 1; i < frame.length; i++) {
+        assembler.push_byte(frame.bytes[i], false);
+    }
+    CHECK(assembler.frames_completed == 2);
+    CHECK(assembler.frames_dropped == 1);
+
+    // Length shorter than the smallest frame is dropped as soon as the length byte arrives
+    const uint8_t short_length[] = {AC_LINK_ADDRESS_DRC, AC_LINK_ADDRESS_MASTER_MCU, 0x00, 0x03};
+    CHECK(push_frame(&assembler, short_length, sizeof(short_length)) == AC_LINK_ASSEMBLER_FRAME_DROPPED);
+    CHECK(assembler.push_byte(0x00, false) == AC_LINK_ASSEMBLER_IN_PROGRESS); // Discarded, not part of a frame
+    CHECK(assembler.frames_dropped == 2);
+
+    // Bad checksum
+    struct AC_Link_Frame corrupted = frame;
+    corrupted.bytes[AC_LINK_FRAME_INDEX_PAYLOAD] ^= 0x01;
+    CHECK(push_frame(&assembler, corrupted.bytes, corrupted.length) == AC_LINK_ASSEMBLER_FRAME_DROPPED);
+    CHECK(assembler.frames_dropped == 3);
+
+    // Still in sync afterwards
+    CHECK(push_frame(&assembler, frame.bytes, frame.length) == AC_LINK_ASSEMBLER_FRAME_COMPLETE);
+    CHECK(assembler.frames_completed == 3);
+
+    // reset() throws the partial frame away, the trailing bytes are discarded
+    assembler.push_byte(frame.bytes[0], true);
+    assembler.reset();
+    CHECK(assembler.push_byte(frame.bytes[1], false) == AC_LINK_ASSEMBLER_IN_PROGRESS);
+    CHECK(assembler.frames_dropped == 3);
+}
+
+TEST_CASE("frame ring full and empty", "[codec]") {
+    AC_Link_Frame_Ring<4> ring;
+    struct AC_Link_Frame frame;
+    CHECK(ring.empty());
+    CHECK(!ring.pop(&frame));
+
+    for (uint8_t i = 0; i < 4; i++) {
+        const uint8_t data[] = {AC_LINK_COMMAND_MASTER_VOLUME, i};
+        ac_link_encode_frame(AC_LINK_ADDRESS_MASTER_MCU, AC_LINK_ADDRESS_DRC, data, sizeof(data), &frame);
+        CHECK(ring.push(&frame));
+    }
+    CHECK(ring.size() == 4);
+    CHECK(!ring.push(&frame));
+    CHECK(ring.overflow_count == 1);
+    CHECK(ring.size() == 4);
+
+    // Oldest first, the overflowed frame never made it in
+    for (uint8_t i = 0; i < 4; i++) {
+        CHECK(ring.pop(&frame));
+        CHECK(frame.payload()[0] == i);
+    }
+    CHECK(ring.empty());
+    CHECK(!ring.pop(&frame));
+
+    // Indices keep counting past the capacity
+    for (uint8_t i = 0; i < 10; i++) {
+        const uint8_t data[] = {AC_LINK_COMMAND_FADER_ADJUST, i};
+        ac_link_encode_frame(AC_LINK_ADDRESS_MASTER_MCU, AC_LINK_ADDRESS_DRC, data, sizeof(data), &frame);
+        CHECK(ring.push(&frame));
+        CHECK(ring.pop(&frame));
+        CHECK(frame.payload()[0] == i);
+    }
+    CHECK(ring.empty());
+}
+
+TEST_CASE("uart decoder", "[codec]") {
+    AC_Link_9bit_Uart_Decoder decoder;
+    bool levels[AC_LINK_UART_BITS_PER_CHARACTER];
+    uint16_t bit_counts[AC_LINK_UART_BITS_PER_CHARACTER];
+    uint8_t data = 0;
+    bool is_address = false;
+
+    // Every character, run by run
+    for (uint16_t character = 0; character < 512; character++) {
+        uint8_t run_count = character_to_runs(character & 0xFF, character >> 8, levels, bit_counts);
+        uint8_t completed = 0;
+        for (uint8_t run = 0; run < run_count; run++) {
+            if (decoder.push_run(levels[run], bit_counts[run], &data, &is_address)) {
+                completed++;
+                CHECK(data == (character & 0xFF));
+                CHECK(is_address == (character >> 8));
+            }
+        }
+        CHECK(completed == 1);
+    }
+
+    // The capture stops once the line idles, so a character ending in high bits is completed by end_of_burst
+    uint8_t run_count = character_to_runs(0xFF, true, levels, bit_counts);
+    CHECK(run_count == 2); // START, then data, address and STOP all high
+    CHECK(!decoder.push_run(levels[0], bit_counts[0], &data, &is_address));
+    CHECK(decoder.end_of_burst(&data, &is_address));
+    CHECK(data == 0xFF);
+    CHECK(is_address);
+    CHECK(!decoder.end_of_burst(&data, &is_address)); // Nothing in progress
+
+    // Idle high before the START bit is ignored
+    CHECK(!decoder.push_run(true, 20, &data, &is_address));
+
+    // A low STOP bit is a framing error, the decoder resyncs on the next START bit
+    CHECK(!decoder.push_run(false, 1 + AC_LINK_UART_DATA_BITS + 1, &data, &is_address));
+    CHECK(decoder.framing_errors == 1);
+    CHECK(!decoder.push_run(true, 4, &data, &is_address));
+    run_count = character_to_runs(0x5A, false, levels, bit_counts);
+    bool completed = false;
+    for (uint8_t run = 0; run < run_count; run++) {
+        completed |= decoder.push_run(levels[run], bit_counts[run], &data, &is_address);
+    }
+    CHECK(completed);
+    CHECK(data == 0x5A);
+    CHECK(!is_address);
+    CHECK(decoder.framing_errors == 1);
+}
@@ -0,0 +1,162 @@
+/**
+ * Author: Jaime Sequeira
+ *
+ * Host tests for the compile-time RX dispatch table: lookups, probing, duplicate detection and payload length checks
+ */
+
+#include "AudisonACLinkDispatch.hpp"
+
+#include <catch.hpp>
+
+/* The table does not care what a handler is, an id is easier to check than a function pointer */
+typedef int Test_Handler;
+
+/* Same frames the bus handles */
+static constexpr AC_Link_Dispatch_Entry<Test_Handler> bus_entries[] = {
+    {AC_LINK_ADDRESS_DRC, AC_LINK_ADDRESS_COMPUTER, AC_LINK_COMMAND_DEVICE_IS_PRESENT, AC_LINK_PAYLOAD_LENGTH_ANY, 1},
+    {AC_LINK_ADDRESS_DRC, AC_LINK_ADDRESS_COMPUTER, AC_LINK_COMMAND_DEVICE_IS_DISCONNECTED, AC_LINK_PAYLOAD_LENGTH_ANY,
+     2},
+    {AC_LINK_ADDRESS_DRC, AC_LINK_ADDRESS_MASTER_MCU, AC_LINK_COMMAND_DEVICE_IS_PRESENT, AC_LINK_PAYLOAD_LENGTH_ANY, 3},
+    {AC_LINK_ADDRESS_DRC, AC_LINK_ADDRESS_DSP_PROCESSOR, AC_LINK_COMMAND_DEVICE_IS_PRESENT, AC_LINK_PAYLOAD_LENGTH_ANY,
+     4},
+    {AC_LINK_ADDRESS_DRC, AC_LINK_ADDRESS_DSP_PROCESSOR, AC_LINK_COMMAND_INPUT_SOURCE_NAME, 16, 5},
+};
+
+#define BUS_ENTRY_COUNT (sizeof(bus_entries) / sizeof(bus_entries[0]))
+
+static constexpr AC_Link_Dispatch_Table<Test_Handler, BUS_ENTRY_COUNT, 32> bus_table(bus_entries);
+static_assert(!bus_table.has_duplicates(), "Bus entries are unique");
+static_assert(bus_table.find(AC_LINK_ADDRESS_DRC, AC_LINK_ADDRESS_DSP_PROCESSOR, AC_LINK_COMMAND_INPUT_SOURCE_NAME)
+                      ->handler == 5,
+              "Lookups work at compile time");
+
+/**
+ * Reference lookup, a linear scan of the entry list
+ */
+template <size_t ENTRY_COUNT>
+static const AC_Link_Dispatch_Entry<Test_Handler>*
+linear_find(const AC_Link_Dispatch_Entry<Test_Handler> (&entries)[ENTRY_COUNT], uint8_t receiver_address,
+            uint8_t transmitter_address, uint8_t command) {
+    for (size_t i = 0; i < ENTRY_COUNT; i++) {
+        if (entries[i].receiver_address == receiver_address &&
+            entries[i].transmitter_address == transmitter_address && entries[i].command == command) {
+            return &entries[i];
+        }
+    }
+    return nullptr;
+}
+
+static struct AC_Link_Frame frame_with_payload(uint8_t transmitter_address, uint8_t command, uint8_t payload_length) {
+    uint8_t data[1 + 16] = {command};
+    struct AC_Link_Frame frame;
+    ac_link_encode_frame(AC_LINK_ADDRESS_DRC, transmitter_address, data, 1 + payload_length, &frame);
+    return frame;
+}
+
+TEST_CASE("every entry is found with its own handler", "[dispatch]") {
+    for (size_t i = 0; i < BUS_ENTRY_COUNT; i++) {
+        INFO("entry " << i);
+        const AC_Link_Dispatch_Entry<Test_Handler>* entry =
+            bus_table.find(bus_entries[i].receiver_address, bus_entries[i].transmitter_address, bus_entries[i].command);
+        REQUIRE(entry != nullptr);
+        CHECK(entry->handler == bus_entries[i].handler);
+        CHECK(entry->payload_length == bus_entries[i].payload_length);
+    }
+}
+
+TEST_CASE("lookups match a linear scan for every command and address pair", "[dispatch]") {
+    const uint8_t addresses[] = {AC_LINK_ADDRESS_MASTER_MCU, AC_LINK_ADDRESS_DSP_PROCESSOR, AC_LINK_ADDRESS_COMPUTER,
+                                 AC_LINK_ADDRESS_DRC, 0x01, 0x7F, 0xFF};
+    uint32_t hits = 0;
+    for (uint8_t receiver : addresses) {
+        for (uint8_t transmitter : addresses) {
+            for (uint16_t command = 0; command <= 0xFF; command++) {
+                const AC_Link_Dispatch_Entry<Test_Handler>* expected =
+                    linear_find(bus_entries, receiver, transmitter, (uint8_t)command);
+                const AC_Link_Dispatch_Entry<Test_Handler>* entry =
+                    bus_table.find(receiver, transmitter, (uint8_t)command);
+                if (expected == nullptr) {
+                    CHECK(entry == nullptr);
+                } else {
+                    REQUIRE(entry != nullptr);
+                    CHECK(entry->handler == expected->handler);
+                    hits++;
+                }
+            }
+        }
+    }
+    CHECK(hits == BUS_ENTRY_COUNT);
+}
+
+TEST_CASE("a nearly full table still finds every entry and terminates on misses", "[dispatch]") {
+    // 15 keys in 16 slots, so most lookups have to probe past other entries
+    static constexpr AC_Link_Dispatch_Entry<Test_Handler> dense_entries[] = {
+        {AC_LINK_ADDRESS_DRC, 0x00, 0x01, 0, 1},
+        {AC_LINK_ADDRESS_DRC, 0x00, 0x02, 0, 2},
+        {AC_LINK_ADDRESS_DRC, 0x00, 0x03, 0, 3},
+        {AC_LINK_ADDRESS_DRC, 0x00, 0x04, 0, 4},
+        {AC_LINK_ADDRESS_DRC, 0x46, 0x01, 0, 5},
+        {AC_LINK_ADDRESS_DRC, 0x46, 0x02, 0, 6},
+        {AC_LINK_ADDRESS_DRC, 0x46, 0x03, 0, 7},
+        {AC_LINK_ADDRESS_DRC, 0x46, 0x04, 0, 8},
+        {AC_LINK_ADDRESS_DRC, 0x5A, 0x01, 0, 9},
+        {AC_LINK_ADDRESS_DRC, 0x5A, 0x02, 0, 10},
+        {AC_LINK_ADDRESS_DRC, 0x5A, 0x03, 0, 11},
+        {AC_LINK_ADDRESS_DRC, 0x5A, 0x04, 0, 12},
+        {0x00, AC_LINK_ADDRESS_DRC, 0x0A, 1, 13},
+        {0x46, AC_LINK_ADDRESS_DRC, 0x0A, 1, 14},
+        {0x5A, AC_LINK_ADDRESS_DRC, 0x0A, 1, 15},
+    };
+    static constexpr AC_Link_Dispatch_Table<Test_Handler, 15, 16> dense_table(dense_entries);
+    static_assert(!dense_table.has_duplicates(), "Dense entries are unique");
+
+    for (const AC_Link_Dispatch_Entry<Test_Handler>& expected : dense_entries) {
+        const AC_Link_Dispatch_Entry<Test_Handler>* entry =
+            dense_table.find(expected.receiver_address, expected.transmitter_address, expected.command);
+        REQUIRE(entry != nullptr);
+        CHECK(entry->handler == expected.handler);
+    }
+    for (uint16_t command = 0x05; command <= 0xFF; command++) {
+        CHECK(dense_table.find(AC_LINK_ADDRESS_DRC, 0x00, (uint8_t)command) == nullptr);
+    }
+}
+
+TEST_CASE("a repeated key is reported as a duplicate", "[dispatch]") {
+    static constexpr AC_Link_Dispatch_Entry<Test_Handler> repeated_entries[] = {
+        {AC_LINK_ADDRESS_DRC, AC_LINK_ADDRESS_COMPUTER, AC_LINK_COMMAND_DEVICE_IS_PRESENT, 0, 1},
+        {AC_LINK_ADDRESS_DRC, AC_LINK_ADDRESS_MASTER_MCU, AC_LINK_COMMAND_DEVICE_IS_PRESENT, 0, 2},
+        {AC_LINK_ADDRESS_DRC, AC_LINK_ADDRESS_COMPUTER, AC_LINK_COMMAND_DEVICE_IS_PRESENT, 3, 3},
+    };
+    static constexpr AC_Link_Dispatch_Table<Test_Handler, 3, 4> repeated_table(repeated_entries);
+    static_assert(repeated_table.has_duplicates(), "The repeated key must fail the static_assert in the bus");
+
+    // Same transmitter and command from another device is not a duplicate
+    static constexpr AC_Link_Dispatch_Entry<Test_Handler> distinct_entries[] = {
+        {AC_LINK_ADDRESS_DRC, AC_LINK_ADDRESS_COMPUTER, AC_LINK_COMMAND_DEVICE_IS_PRESENT, 0, 1},
+        {AC_LINK_ADDRESS_COMPUTER, AC_LINK_ADDRESS_DRC, AC_LINK_COMMAND_DEVICE_IS_PRESENT, 0, 2},
+    };
+    static constexpr AC_Link_Dispatch_Table<Test_Handler, 2, 4> distinct_table(distinct_entries);
+    CHECK(repeated_table.has_duplicates());
+    CHECK_FALSE(distinct_table.has_duplicates());
+}
+
+TEST_CASE("payload length is checked unless the entry takes any length", "[dispatch]") {
+    const AC_Link_Dispatch_Entry<Test_Handler>* source_name =
+        bus_table.find(AC_LINK_ADDRESS_DRC, AC_LINK_ADDRESS_DSP_PROCESSOR, AC_LINK_COMMAND_INPUT_SOURCE_NAME);
+    const AC_Link_Dispatch_Entry<Test_Handler>* usb_present =
+        bus_table.find(AC_LINK_ADDRESS_DRC, AC_LINK_ADDRESS_COMPUTER, AC_LINK_COMMAND_DEVICE_IS_PRESENT);
+    REQUIRE(source_name != nullptr);
+    REQUIRE(usb_present != nullptr);
+
+    for (uint8_t payload_length = 0; payload_length <= 16; payload_length++) {
+        INFO("payload length " << (int)payload_length);
+        struct AC_Link_Frame source_frame =
+            frame_with_payload(AC_LINK_ADDRESS_DSP_PROCESSOR, AC_LINK_COMMAND_INPUT_SOURCE_NAME, payload_length);
+        REQUIRE(source_frame.payload_length() == payload_length);
+        CHECK(ac_link_dispatch_payload_ok(source_name, &source_frame) == (payload_length == 16));
+
+        struct AC_Link_Frame usb_frame =
+            frame_with_payload(AC_LINK_ADDRESS_COMPUTER, AC_LINK_COMMAND_DEVICE_IS_PRESENT, payload_length);
+        CHECK(ac_link_dispatch_payload_ok(usb_present, &usb_frame));
+    }
+}
@@ -0,0 +1,68 @@
+/**
+ * Author: Jaime Sequeira
+ *
+ * Host tests for the RMT symbol table. Every entry must match what the original bit loop encoder produced
+ */
+
+#include "AudisonACLinkCodec.hpp"
+#include "AudisonACLinkRmtSymbols.hpp"
+#include "rmt_item_baseline.hpp"
+
+#include <catch.hpp>
+
+static_assert(sizeof(rmt_item32_t) == sizeof(uint32_t), "Baseline item must match the table word");
+
+TEST_CASE("table matches baseline", "[rmt]") {
+    for (uint16_t symbol_index = 0; symbol_index < AC_LINK_RMT_SYMBOL_COUNT; symbol_index++) {
+        uint8_t byte = symbol_index & 0xFF;
+        bool is_address = symbol_index >> 8;
+        rmt_item32_t baseline[AC_LINK_RMT_ITEMS_PER_CHARACTER];
+        memset(baseline, 0xA5, sizeof(baseline)); // Bits the baseline does not write would show up as a mismatch
+        convert_byte_to_rmt_item_9bit(byte, is_address, baseline);
+        const AC_Link_Rmt_Symbol& symbol = AC_LINK_RMT_SYMBOL_TABLE.lookup(byte, is_address);
+        for (uint8_t item = 0; item < AC_LINK_RMT_ITEMS_PER_CHARACTER; item++) {
+            INFO("symbol " << symbol_index << " item " << (int)item);
+            CHECK(symbol.items[item] == baseline[item].val);
+        }
+    }
+}
+
+TEST_CASE("frame to rmt items", "[rmt]") {
+    const uint8_t data[] = {AC_LINK_COMMAND_BALANCE_ADJUST, 0x12};
+    struct AC_Link_Frame frame;
+    ac_link_encode_frame(AC_LINK_ADDRESS_MASTER_MCU, AC_LINK_ADDRESS_DRC, data, sizeof(data), &frame);
+
+    uint32_t items[AC_LINK_MAX_FRAME_SIZE_BYTES * AC_LINK_RMT_ITEMS_PER_CHARACTER];
+    CHECK(ac_link_frame_to_rmt_items(frame.bytes, frame.length, items) ==
+          frame.length * AC_LINK_RMT_ITEMS_PER_CHARACTER);
+
+    // Only the receiver address goes out with the address bit set
+    rmt_item32_t baseline[AC_LINK_RMT_ITEMS_PER_CHARACTER];
+    for (uint8_t i = 0; i < frame.length; i++) {
+        convert_byte_to_rmt_item_9bit(frame.bytes[i], i == 0, baseline);
+        for (uint8_t item = 0; item < AC_LINK_RMT_ITEMS_PER_CHARACTER; item++) {
+            CHECK(items[i * AC_LINK_RMT_ITEMS_PER_CHARACTER + item] == baseline[item].val);
+        }
+    }
+
+    // Played back through the RX decoder and assembler the items give the frame back
+    AC_Link_9bit_Uart_Decoder decoder;
+    AC_Link_Frame_Assembler assembler;
+    uint8_t byte;
+    bool is_address;
+    bool frame_complete = false;
+    for (uint16_t i = 0; i < frame.length * AC_LINK_RMT_ITEMS_PER_CHARACTER; i++) {
+        rmt_item32_t item;
+        item.val = items[i];
+        if (decoder.push_run(item.level0, item.duration0 / AC_LINK_RMT_TICKS_PER_BIT, &byte, &is_address)) {
+            frame_complete = assembler.push_byte(byte, is_address) == AC_LINK_ASSEMBLER_FRAME_COMPLETE;
+        }
+        if (decoder.push_run(item.level1, item.duration1 / AC_LINK_RMT_TICKS_PER_BIT, &byte, &is_address)) {
+            frame_complete = assembler.push_byte(byte, is_address) == AC_LINK_ASSEMBLER_FRAME_COMPLETE;
+        }
+    }
+    CHECK(frame_complete);
+    CHECK(decoder.framing_errors == 0);
+    CHECK(assembler.frame()->length == frame.length);
+    CHECK(memcmp(frame.bytes, assembler.frame()->bytes, frame.length) == 0);
+}
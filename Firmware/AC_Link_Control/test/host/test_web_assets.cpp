@@ -0,0 +1,86 @@
+/**
+ * Author: Jaime Sequeira
+ *
+ * Host tests for the built in web asset table: the sort order the binary search relies on and the lookups themselves
+ */
+
+#include "CustomDRCWebAssetsData.h"
+
+#include <catch.hpp>
+
+// C++ includes
+#include <string>
+
+/**
+ * Asset with only a path, the lookup does not look at anything else
+ */
+static constexpr struct Web_Asset path_only(const char* path) {
+    return {path, "text/plain", nullptr, "\"0\"", "no-cache", nullptr, 0};
+}
+
+/**
+ * Reference lookup, a linear scan of the table
+ */
+static const struct Web_Asset* linear_find(const struct Web_Asset* assets, size_t count, const char* path) {
+    for (size_t i = 0; i < count; i++) {
+        if (strcmp(assets[i].path, path) == 0) {
+            return &assets[i];
+        }
+    }
+    return nullptr;
+}
+
+TEST_CASE("every generated asset is found on its own path", "[web][assets]") {
+    REQUIRE(web_asset_count > 0);
+    for (size_t i = 0; i < web_asset_count; i++) {
+        INFO("path " << web_assets[i].path);
+        CHECK(web_asset_find(web_assets, web_asset_count, web_assets[i].path) == &web_assets[i]);
+        if (web_assets[i].encoding != nullptr && strcmp(web_assets[i].encoding, "gzip") == 0) {
+            REQUIRE(web_assets[i].length >= 2);
+            CHECK(web_assets[i].data[0] == 0x1F); // gzip magic
+            CHECK(web_assets[i].data[1] == 0x8B);
+        }
+    }
+}
+
+TEST_CASE("paths that are not in the generated table are not found", "[web][assets]") {
+    const char* const missing_paths[] = {"", "/index", "/index.htm", "/index.html/", "/index.htmlx", "/INDEX.HTML",
+                                         "index.html", "//", "/a", "/zzz", "\x7F", "/\xFF"};
+    for (const char* path : missing_paths) {
+        INFO("path " << path);
+        CHECK(web_asset_find(web_assets, web_asset_count, path) == nullptr);
+    }
+}
+
+TEST_CASE("lookups match a linear scan on every prefix of every path", "[web][assets]") {
+    for (size_t i = 0; i < web_asset_count; i++) {
+        std::string path = web_assets[i].path;
+        for (size_t length = 0; length <= path.size(); length++) {
+            std::string prefix = path.substr(0, length);
+            INFO("path " << prefix);
+            CHECK(web_asset_find(web_assets, web_asset_count, prefix.c_str()) ==
+                  linear_find(web_assets, web_asset_count, prefix.c_str()));
+        }
+    }
+}
+
+TEST_CASE("sort check rejects tables the binary search would miss entries in", "[web][assets]") {
+    static constexpr struct Web_Asset sorted[] = {path_only("/"), path_only("/a"), path_only("/a/b"), path_only("/b"),
+                                                  path_only("/\xC3\xA9")};
+    static constexpr struct Web_Asset unsorted[] = {path_only("/"), path_only("/b"), path_only("/a")};
+    static constexpr struct Web_Asset duplicated[] = {path_only("/"), path_only("/a"), path_only("/a")};
+    static constexpr struct Web_Asset prefix_after[] = {path_only("/ab"), path_only("/a")};
+    static_assert(web_assets_sorted(sorted, 5), "Sorted table");
+    static_assert(!web_assets_sorted(unsorted, 3), "Out of order table");
+    static_assert(!web_assets_sorted(duplicated, 3), "Repeated path");
+    static_assert(!web_assets_sorted(prefix_after, 2), "A path sorts after its prefixes");
+    static_assert(web_assets_sorted(sorted, 0) && web_assets_sorted(unsorted, 1), "Fewer than two assets are sorted");
+
+    // Bytes above 0x7F sort after ASCII, as they do for the strcmp in the lookup
+    for (const struct Web_Asset& asset : sorted) {
+        INFO("path " << asset.path);
+        CHECK(web_asset_find(sorted, 5, asset.path) == &asset);
+    }
+    CHECK(web_asset_find(sorted, 5, "/a/") == nullptr);
+    CHECK(web_asset_find(sorted, 0, "/") == nullptr);
+}
@@ -0,0 +1,55 @@
+/**
+ * Author: Jaime Sequeira
+ *
+ * Host tests for the JSON command key lookup
+ */
+
+#include "CustomDRCWebCommands.hpp"
+
+#include <catch.hpp>
+
+TEST_CASE("every key", "[web_commands]") {
+    for (uint8_t command = 0; command < WEB_COMMAND_COUNT; command++) {
+        const char* key = web_command_keys[command];
+        CHECK(web_command_lookup(key, strlen(key)) == command);
+    }
+}
+
+TEST_CASE("unknown keys", "[web_commands]") {
+    CHECK(web_command_lookup("subVolumf", 9) == WEB_COMMAND_UNKNOWN); // Same length and hash slot as subVolume
+    CHECK(web_command_lookup("SubVolume", 9) == WEB_COMMAND_UNKNOWN);
+    CHECK(web_command_lookup("fadeR", 5) == WEB_COMMAND_UNKNOWN);
+    CHECK(web_command_lookup("currentSource", 13) == WEB_COMMAND_UNKNOWN);
+    CHECK(web_command_lookup("", 0) == WEB_COMMAND_UNKNOWN);
+    CHECK(web_command_lookup("fader", 0) == WEB_COMMAND_UNKNOWN);
+    CHECK(web_command_lookup("x", 1) == WEB_COMMAND_UNKNOWN);
+    CHECK(web_command_lookup("getRemoteSettingsAndMore", 24) == WEB_COMMAND_UNKNOWN);
+
+    // Prefixes and extensions of every key
+    for (uint8_t command = 0; command < WEB_COMMAND_COUNT; command++) {
+        const char* key = web_command_keys[command];
+        size_t length = strlen(key);
+        for (size_t prefix = 1; prefix < length; prefix++) {
+            CHECK(web_command_lookup(key, prefix) == WEB_COMMAND_UNKNOWN);
+        }
+        char extended[32];
+        snprintf(extended, sizeof(extended), "%s_", key);
+        CHECK(web_command_lookup(extended, length + 1) == WEB_COMMAND_UNKNOWN);
+
+        // One character changed, whatever slot that lands in
+        for (size_t position = 0; position < length; position++) {
+            char changed[32];
+            memcpy(changed, key, length);
+            changed[position] ^= 0x01;
+            CHECK(web_command_lookup(changed, length) == WEB_COMMAND_UNKNOWN);
+        }
+    }
+}
+
+TEST_CASE("key not null terminated", "[web_commands]") {
+    // ArduinoJson hands over keys with their length, the lookup must not read past it
+    const char message[] = "{\"masterVolume\":42,\"fader\":7}";
+    CHECK(web_command_lookup(&message[2], 12) == WEB_COMMAND_MASTER_VOLUME);
+    CHECK(web_command_lookup(&message[20], 5) == WEB_COMMAND_FADER);
+    CHECK(web_command_lookup(&message[2], 13) == WEB_COMMAND_UNKNOWN);
+}
@@ -0,0 +1,135 @@
+/**
+ * Author: Jaime Sequeira
+ *
+ * Host tests for the arena websocket JSON messages are parsed into. Built with the ESP32 variant pool size and slot
+ * IDs (see CMakeLists.txt), the arena grows with the bigger host slots
+ */
+
+#include "CustomDRCWebJsonArena.hpp"
+
+#include <catch.hpp>
+
+static bool is_aligned(const void* pointer) {
+    return ((uintptr_t)pointer % alignof(max_align_t)) == 0;
+}
+
+TEST_CASE("parse message", "[json_arena]") {
+    static Web_Socket_Json_Arena arena;
+    const char message[] = "{\"masterVolume\":42,\"fader\":7,\"password\":\"hunter22\"}";
+    arena.reset();
+    JsonDocument doc(&arena);
+    CHECK(deserializeJson(doc, message, strlen(message)) == DeserializationError::Ok);
+    CHECK(doc["masterVolume"].as<int>() == 42);
+    CHECK(doc["fader"].as<int>() == 7);
+    CHECK(strcmp(doc["password"].as<const char*>(), "hunter22") == 0);
+    CHECK(arena.failures == 0);
+    CHECK(arena.high_water > 0);
+    CHECK(arena.high_water <= WS_JSON_ARENA_SIZE_BYTES);
+}
+
+TEST_CASE("reset reuses memory", "[json_arena]") {
+    static Web_Socket_Json_Arena arena;
+    void* first = arena.allocate(24);
+    CHECK(first != nullptr);
+    CHECK(is_aligned(first));
+    void* second = arena.allocate(24);
+    CHECK(second != nullptr);
+    CHECK(is_aligned(second));
+    CHECK(second != first);
+    size_t high_water = arena.high_water;
+
+    arena.reset();
+    CHECK(arena.allocate(24) == first);
+    CHECK(arena.high_water == high_water); // Kept across resets
+
+    // Messages parsed one after another never run out
+    for (uint16_t message = 0; message < 1000; message++) {
+        char text[64];
+        snprintf(text, sizeof(text), "{\"balance\":%u,\"password\":\"secret%u\"}", message % 37, message);
+        arena.reset();
+        JsonDocument doc(&arena);
+        CHECK(deserializeJson(doc, text, strlen(text)) == DeserializationError::Ok);
+        CHECK(doc["balance"].as<int>() == (message % 37));
+    }
+    CHECK(arena.failures == 0);
+}
+
+TEST_CASE("exhausted", "[json_arena]") {
+    static Web_Socket_Json_Arena arena;
+    CHECK(arena.allocate(WS_JSON_ARENA_SIZE_BYTES) == nullptr); // No room left for the size header
+    CHECK(arena.failures == 1);
+    CHECK(arena.high_water == 0);
+
+    // A string longer than the arena fails the parse instead of reaching the heap
+    static char message[WS_JSON_ARENA_SIZE_BYTES + 32];
+    size_t length = (size_t)snprintf(message, sizeof(message), "{\"password\":\"");
+    memset(&message[length], 'a', WS_JSON_ARENA_SIZE_BYTES);
+    length += WS_JSON_ARENA_SIZE_BYTES;
+    length += (size_t)snprintf(&message[length], sizeof(message) - length, "\"}");
+    arena.reset();
+    {
+        JsonDocument doc(&arena);
+        CHECK(deserializeJson(doc, message, length) == DeserializationError::NoMemory);
+    }
+    CHECK(arena.failures > 1);
+    CHECK(arena.high_water <= WS_JSON_ARENA_SIZE_BYTES);
+
+    // The next message is fine again
+    uint32_t failures = arena.failures;
+    arena.reset();
+    JsonDocument doc(&arena);
+    CHECK(deserializeJson(doc, "{\"fader\":3}") == DeserializationError::Ok);
+    CHECK(doc["fader"].as<int>() == 3);
+    CHECK(arena.failures == failures);
+}
+
+TEST_CASE("reallocate", "[json_arena]") {
+    static Web_Socket_Json_Arena arena;
+    CHECK(arena.reallocate(nullptr, 16) != nullptr); // Same as allocate
+
+    // The newest block grows in place
+    uint8_t* newest = (uint8_t*)arena.allocate(16);
+    memset(newest, 0x5A, 16);
+    size_t before_grow = arena.high_water;
+    CHECK(arena.reallocate(newest, 200) == newest);
+    CHECK(arena.high_water > before_grow);
+    newest[199] = 0xA5;
+
+    // Shrinking any block keeps it where it is
+    CHECK(arena.reallocate(newest, 8) == newest);
+    CHECK(newest[0] == 0x5A);
+
+    // An older block is copied to grow
+    uint8_t* later = (uint8_t*)arena.allocate(16);
+    CHECK(later != nullptr);
+    uint8_t* moved = (uint8_t*)arena.reallocate(newest, 400);
+    CHECK(moved != nullptr);
+    CHECK(moved != newest);
+    CHECK(moved > later);
+    CHECK(is_aligned(moved));
+    bool copied = true;
+    for (uint8_t i = 0; i < 16; i++) {
+        copied = copied && moved[i] == 0x5A;
+    }
+    CHECK(copied);
+
+    // Growing the newest block past the end of the arena fails and leaves it usable
+    CHECK(arena.reallocate(moved, WS_JSON_ARENA_SIZE_BYTES) == nullptr);
+    CHECK(arena.failures == 1);
+    CHECK(moved[0] == 0x5A);
+    CHECK(arena.reallocate(moved, 500) == moved);
+    CHECK(arena.failures == 1);
+}
+
+TEST_CASE("every command message", "[json_arena]") {
+    static Web_Socket_Json_Arena arena;
+    const char message[] = "{\"getRemoteSettings\":1,\"subscribe\":63,\"password\":\"hunter22\",\"dspMemory\":1,"
+                           "\"changeSource\":1,\"masterVolume\":42,\"subVolume\":12,\"balance\":18,\"fader\":18}";
+    arena.reset();
+    JsonDocument doc(&arena);
+    CHECK(deserializeJson(doc, message, strlen(message)) == DeserializationError::Ok);
+    CHECK(doc.as<JsonObject>().size() == 9);
+    CHECK(arena.failures == 0);
+    printf("Every command message: %u of %u arena bytes\n", (unsigned)arena.high_water,
+           (unsigned)WS_JSON_ARENA_SIZE_BYTES);
+}
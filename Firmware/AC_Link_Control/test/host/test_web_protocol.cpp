@@ -0,0 +1,143 @@
+/**
+ * Author: Jaime Sequeira
+ *
+ * Host tests for the binary websocket protocol records and reader
+ */
+
+#include "CustomDRCWebProtocol.hpp"
+
+#include <catch.hpp>
+
+static const uint8_t value_ids[] = {
+    WEB_PROTOCOL_ID_DSP_MEMORY, WEB_PROTOCOL_ID_MASTER_VOLUME, WEB_PROTOCOL_ID_SUB_VOLUME,
+    WEB_PROTOCOL_ID_BALANCE,    WEB_PROTOCOL_ID_FADER,         WEB_PROTOCOL_ID_USB_CONNECTED,
+    WEB_PROTOCOL_ID_OTA_STATE,  WEB_PROTOCOL_ID_OTA_PROGRESS,  WEB_PROTOCOL_ID_SUBSCRIBE,
+};
+static const uint8_t string_ids[] = {WEB_PROTOCOL_ID_CURRENT_SOURCE, WEB_PROTOCOL_ID_FW_VERSION};
+static const uint8_t command_ids[] = {WEB_PROTOCOL_ID_GET_REMOTE_SETTINGS, WEB_PROTOCOL_ID_CHANGE_SOURCE};
+
+TEST_CASE("value records", "[web_protocol]") {
+    for (uint8_t id : value_ids) {
+        CHECK(!web_protocol_id_is_string(id));
+        for (uint16_t value = 0; value <= 0xFF; value++) {
+            uint8_t message[2];
+            CHECK((web_protocol_put_value(message, id, value) - message) == sizeof(message));
+            Web_Protocol_Reader reader(message, sizeof(message));
+            struct Web_Protocol_Record record;
+            CHECK(reader.next(&record));
+            CHECK(record.id == id);
+            CHECK(record.value == value);
+            CHECK(!reader.next(&record));
+            CHECK(!reader.error);
+        }
+    }
+}
+
+TEST_CASE("string records", "[web_protocol]") {
+    for (uint8_t id : string_ids) {
+        CHECK(web_protocol_id_is_string(id));
+        const char* source = "     AUX In     ";
+        uint8_t message[2 + WEB_PROTOCOL_MAX_STRING_LENGTH];
+        CHECK((size_t)(web_protocol_put_string(message, id, source) - message) == 2 + strlen(source));
+        Web_Protocol_Reader reader(message, 2 + strlen(source));
+        struct Web_Protocol_Record record;
+        CHECK(reader.next(&record));
+        CHECK(record.id == id);
+        CHECK(record.string_length == strlen(source));
+        CHECK(memcmp(source, record.string, record.string_length) == 0);
+        CHECK(!reader.next(&record));
+        CHECK(!reader.error);
+
+        // Empty string
+        CHECK((web_protocol_put_string(message, id, "") - message) == 2);
+        Web_Protocol_Reader empty_reader(message, 2);
+        CHECK(empty_reader.next(&record));
+        CHECK(record.string_length == 0);
+        CHECK(!empty_reader.error);
+
+        // Longer strings are cut to what the length byte can hold
+        char long_string[WEB_PROTOCOL_MAX_STRING_LENGTH + 11];
+        memset(long_string, 'x', sizeof(long_string) - 1);
+        long_string[sizeof(long_string) - 1] = '\0';
+        CHECK((web_protocol_put_string(message, id, long_string) - message) == sizeof(message));
+        Web_Protocol_Reader long_reader(message, sizeof(message));
+        CHECK(long_reader.next(&record));
+        CHECK(record.string_length == WEB_PROTOCOL_MAX_STRING_LENGTH);
+        CHECK(!long_reader.error);
+    }
+}
+
+TEST_CASE("command records", "[web_protocol]") {
+    for (uint8_t id : command_ids) {
+        CHECK(id >= WEB_PROTOCOL_ID_FIRST_COMMAND);
+        uint8_t message[1];
+        CHECK((web_protocol_put_command(message, id) - message) == sizeof(message));
+        Web_Protocol_Reader reader(message, sizeof(message));
+        struct Web_Protocol_Record record;
+        CHECK(reader.next(&record));
+        CHECK(record.id == id);
+        CHECK(!reader.next(&record));
+        CHECK(!reader.error);
+    }
+}
+
+TEST_CASE("snapshot message", "[web_protocol]") {
+    // Every record type back to back, as the page load snapshot is sent
+    uint8_t message[64];
+    uint8_t* position = message;
+    position = web_protocol_put_value(position, WEB_PROTOCOL_ID_DSP_MEMORY, 1);
+    position = web_protocol_put_string(position, WEB_PROTOCOL_ID_CURRENT_SOURCE, "   Optical In   ");
+    position = web_protocol_put_value(position, WEB_PROTOCOL_ID_MASTER_VOLUME, 0x78);
+    position = web_protocol_put_command(position, WEB_PROTOCOL_ID_CHANGE_SOURCE);
+    position = web_protocol_put_string(position, WEB_PROTOCOL_ID_FW_VERSION, "v0.1.40");
+    position = web_protocol_put_value(position, WEB_PROTOCOL_ID_FADER, 0);
+
+    const uint8_t expected_ids[] = {WEB_PROTOCOL_ID_DSP_MEMORY,    WEB_PROTOCOL_ID_CURRENT_SOURCE,
+                                    WEB_PROTOCOL_ID_MASTER_VOLUME, WEB_PROTOCOL_ID_CHANGE_SOURCE,
+                                    WEB_PROTOCOL_ID_FW_VERSION,    WEB_PROTOCOL_ID_FADER};
+    Web_Protocol_Reader reader(message, position - message);
+    struct Web_Protocol_Record record;
+    uint8_t count = 0;
+    while (reader.next(&record)) {
+        CHECK(record.id == expected_ids[count]);
+        count++;
+    }
+    CHECK(count == sizeof(expected_ids));
+    CHECK(!reader.error);
+}
+
+TEST_CASE("malformed messages", "[web_protocol]") {
+    struct Web_Protocol_Record record;
+
+    // Value record without its value
+    const uint8_t truncated_value[] = {WEB_PROTOCOL_ID_MASTER_VOLUME};
+    Web_Protocol_Reader value_reader(truncated_value, sizeof(truncated_value));
+    CHECK(!value_reader.next(&record));
+    CHECK(value_reader.error);
+
+    // String shorter than its length byte
+    const uint8_t truncated_string[] = {WEB_PROTOCOL_ID_CURRENT_SOURCE, 4, 'A', 'U', 'X'};
+    Web_Protocol_Reader string_reader(truncated_string, sizeof(truncated_string));
+    CHECK(!string_reader.next(&record));
+    CHECK(string_reader.error);
+
+    // String without its length byte
+    const uint8_t missing_length[] = {WEB_PROTOCOL_ID_FW_VERSION};
+    Web_Protocol_Reader length_reader(missing_length, sizeof(missing_length));
+    CHECK(!length_reader.next(&record));
+    CHECK(length_reader.error);
+
+    // IDs above the command range, the records before it are still read
+    const uint8_t unknown_id[] = {WEB_PROTOCOL_ID_BALANCE, 0x12, WEB_PROTOCOL_ID_LAST + 1, 0x00};
+    Web_Protocol_Reader id_reader(unknown_id, sizeof(unknown_id));
+    CHECK(id_reader.next(&record));
+    CHECK(record.id == WEB_PROTOCOL_ID_BALANCE);
+    CHECK(!id_reader.next(&record));
+    CHECK(id_reader.error);
+    CHECK(!id_reader.next(&record)); // Stays stopped
+
+    // Empty message
+    Web_Protocol_Reader empty_reader(unknown_id, 0);
+    CHECK(!empty_reader.next(&record));
+    CHECK(!empty_reader.error);
+}
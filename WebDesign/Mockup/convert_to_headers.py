@@ -1,81 +1,149 @@
 import os
-import datetime
-
-
-def get_current_time_header() -> str:
-    # using now() to get current time
-    current_time = datetime.datetime.now()
-    return_message = f"/* Compile Time: {current_time.day}/{current_time.month}/{
-        current_time.year} | {current_time.hour}:{current_time.minute}:{current_time.second} */ \n "
-    return return_message
-
-
-class FileConverter:
-    def __init__(self, current_path, filename, output_filename):
-        self.current_path = current_path
-        self.filename = filename
-        self.input_file_path = self.current_path + "/" + self.filename
-        self.output_directory = self.current_path + "/CDRC_headers/"
-
-        print(f"Path: {self.current_path}")
-        print(f"Filename: {self.filename}")
-        print(f"Input file path: {self.input_file_path}")
-        print(f"Output file directory: {self.output_directory}")
-
-    def compress_file(self, ):
-        self.output_file = None
-        if ".html" in self.filename:
-            self.output_file_path = self.output_directory + "CustomDRChtml.h"
-            self.output_file = open(self.output_file_path, 'w')
-            self.output_file.write(get_current_time_header())
-            self.output_file.write(
-                "#pragma once\nconst char custom_html[] = {")
-            self.output_file.close()
-        elif ".css" in self.filename:
-            self.output_file_path = self.output_directory + "CustomDRCcss.h"
-            self.output_file = open(self.output_file_path, 'w')
-            self.output_file.write(get_current_time_header())
-            self.output_file.write("#pragma once\nconst char custom_css[] = {")
-            self.output_file.close()
-        elif ".js" in self.filename:
-            self.output_file_path = self.output_directory + "CustomDRCjs.h"
-            self.output_file = open(self.output_file_path, 'w')
-            self.output_file.write(get_current_time_header())
-            self.output_file.write("#pragma once\nconst char custom_js[] = {")
-            self.output_file.close()
-
-        self.output_file = open(self.output_file_path, 'a')
-        raw_file = open(self.input_file_path, 'rb')
-        raw_file_bytes = raw_file.read()
-        for char in raw_file_bytes[:-1]:
-            self.output_file.write(hex(char) + ",")
-        self.output_file.write(hex(raw_file_bytes[-1]))
-        self.output_file.write("," + hex(raw_file_bytes[-1]) + "};")
-        self.output_file.close()
-
-        self.output_file = open(self.output_file_path, 'rb')
-        print(self.output_file.read())
-
-        # Compress the injested file and append to output file
-        # raw_file = open(self.input_file_path, 'rb')
-        # raw_file_bytes = raw_file.read()
-        # compressed = gzip.compress(raw_file_bytes)
-        # # compressed = base64.b64encode(compressed_file)
-        # print(compressed)
-        # output_file = open(self.output_file_path, 'a')
-        # for char in compressed[:-1]:
-        #     output_file.write(hex(char)+",")
-        # # Write last byte and closing semi-colon
-        # output_file.write(hex(compressed[-1]))
-        # output_file.write("};")
-        # output_file.close()
-
-
-cwd = os.getcwd()
-html_file = FileConverter(cwd, "index.html", "CustomDRChtml.h")
-css_file = FileConverter(cwd, "pico.min.css", "CustomDRCcss.h")
-js_file = FileConverter(cwd, "index.js", "CustomDRCjs.h")
-
-html_file.compress_file()
-css_file.compress_file()
-js_file.compress_file()
+import gzip
+import hashlib
+
+# Runs before every firmware build (Firmware/AC_Link_Control/buildscript_web_assets.py) and can be run by hand. Every
+# web file in this folder is minified, gzipped and written into one sorted table the firmware serves from flash
+MOCKUP_DIRECTORY = os.path.dirname(os.path.abspath(__file__))
+OUTPUT_FILE_PATH = os.path.normpath(os.path.join(MOCKUP_DIRECTORY, "..", "..", "Firmware", "AC_Link_Control", "lib",
+                                                 "CustomDRC", "CustomDRCWebAssetsData.h"))
+SKIPPED_DIRECTORIES = ["venv"]
+
+MIME_TYPES = {
+    ".html": "text/html",
+    ".css": "text/css",
+    ".js": "application/javascript",
+    ".json": "application/json",
+    ".svg": "image/svg+xml",
+    ".png": "image/png",
+    ".jpg": "image/jpeg",
+    ".ico": "image/x-icon",
+    ".woff2": "font/woff2",
+}
+
+CACHE_REVALIDATE = "no-cache"  # Checked on every load, answered with a 304 when unchanged
+CACHE_IMMUTABLE = "public, max-age=31536000, immutable"  # Content hashed paths never change
+
+
+def get_content_hash(content: bytes) -> str:
+    # Short SHA-256 of the uncompressed content, used for the ETag and the cache busting file name
+    return hashlib.sha256(content).hexdigest()[:16]
+
+
+def minify(extension: str, content: bytes) -> bytes:
+    # Only whitespace is touched: indentation, trailing spaces and blank lines. Line breaks stay, so JS never relies
+    # on a semicolon that is not there. Files where whitespace can matter are left alone
+    if extension not in [".html", ".css", ".js"]:
+        return content
+    text = content.decode("utf-8")
+    if extension == ".html" and ("<pre" in text or "<textarea" in text):
+        return content
+    lines = text.splitlines()
+    if extension == ".js" and any(line.count("`") % 2 for line in lines):
+        return content  # A template literal spans lines
+    minified = [line.strip() for line in lines]
+    return "\n".join(line for line in minified if line).encode("utf-8")
+
+
+class WebAsset:
+    def __init__(self, relative_path):
+        self.relative_path = relative_path.replace(os.sep, "/")
+        self.name, self.extension = os.path.splitext(self.relative_path)
+        self.mime = MIME_TYPES[self.extension]
+        raw_file = open(os.path.join(MOCKUP_DIRECTORY, relative_path), 'rb')
+        self.content = minify(self.extension, raw_file.read())
+        raw_file.close()
+
+    def is_page(self) -> bool:
+        return self.extension == ".html"
+
+    def get_hashed_path(self) -> str:
+        return f"/{self.name}.{get_content_hash(self.content)}{self.extension}"
+
+    def replace_references(self, assets):
+        # Point a page at the hashed names of the files it loads, so they can be cached for good
+        text = self.content.decode("utf-8")
+        for asset in assets:
+            if not asset.is_page():
+                text = text.replace(f"\"{asset.relative_path}\"", f"\"{asset.get_hashed_path().lstrip('/')}\"")
+        self.content = text.encode("utf-8")
+
+    def get_routes(self):
+        # (path, cache control) the asset is served on
+        if self.is_page():
+            routes = [("/" + self.relative_path, CACHE_REVALIDATE)]
+            if self.relative_path == "index.html":
+                routes.append(("/", CACHE_REVALIDATE))
+            return routes
+        return [("/" + self.relative_path, CACHE_REVALIDATE), (self.get_hashed_path(), CACHE_IMMUTABLE)]
+
+
+def find_assets():
+    assets = []
+    for directory, directories, filenames in os.walk(MOCKUP_DIRECTORY):
+        directories[:] = [name for name in directories if name not in SKIPPED_DIRECTORIES and not name.startswith(".")]
+        for filename in filenames:
+            if os.path.splitext(filename)[1] in MIME_TYPES:
+                assets.append(WebAsset(os.path.relpath(os.path.join(directory, filename), MOCKUP_DIRECTORY)))
+    # Same order on every machine, so the table only changes with the assets
+    assets.sort(key=lambda asset: asset.relative_path)
+    return assets
+
+
+def write_if_changed(path, text):
+    # An unchanged table is not rewritten, so it does not trigger a rebuild
+    if os.path.exists(path):
+        existing_file = open(path, 'r')
+        existing = existing_file.read()
+        existing_file.close()
+        if existing == text:
+            print(f"{path} is up to date")
+            return
+    output_file = open(path, 'w')
+    output_file.write(text)
+    output_file.close()
+    print(f"Wrote {path}")
+
+
+def convert():
+    assets = find_assets()
+    for asset in assets:
+        if asset.is_page():
+            asset.replace_references(assets)
+
+    data_arrays = {}  # Content hash -> array, assets with the same content share it
+    entries = []
+    for asset in assets:
+        content_hash = get_content_hash(asset.content)
+        if content_hash not in data_arrays:
+            # mtime=0 keeps the output the same for the same input. Files that do not shrink are sent as they are
+            compressed = gzip.compress(asset.content, compresslevel=9, mtime=0)
+            encoding = "\"gzip\""
+            if len(compressed) >= len(asset.content):
+                compressed = asset.content
+                encoding = "nullptr"
+            name = f"web_asset_data_{content_hash}"
+            data_arrays[content_hash] = (name, encoding, compressed, asset.relative_path, len(asset.content))
+            print(f"{asset.relative_path}: {len(asset.content)} bytes -> {len(compressed)} bytes, ETag {content_hash}")
+        name, encoding, _, _, _ = data_arrays[content_hash]
+        for path, cache_control in asset.get_routes():
+            entries.append((path, asset.mime, encoding, content_hash, cache_control, name))
+    entries.sort()
+
+    text = "/* Generated by WebDesign/Mockup/convert_to_headers.py from the files next to it, do not edit */\n"
+    text += "#pragma once\n\n#include \"CustomDRCWebAssets.hpp\"\n"
+    for name, encoding, data, relative_path, length in data_arrays.values():
+        text += f"\n/* {relative_path}: {length} bytes, {len(data)} in flash */\n"
+        text += f"static const uint8_t {name}[] = {{" + ",".join(hex(char) for char in data) + "};\n"
+    text += "\n/* Sorted by path */\n"
+    text += "static constexpr struct Web_Asset web_assets[] = {\n"
+    for path, mime, encoding, content_hash, cache_control, name in entries:
+        text += (f"    {{\"{path}\", \"{mime}\", {encoding}, \"\\\"{content_hash}\\\"\", \"{cache_control}\", {name}, "
+                 f"sizeof({name})}},\n")
+    text += "};\n\n"
+    text += "static constexpr size_t web_asset_count = sizeof(web_assets) / sizeof(web_assets[0]);\n"
+    text += "static_assert(web_assets_sorted(web_assets, web_asset_count), \"Web assets must be sorted by path\");\n"
+    write_if_changed(OUTPUT_FILE_PATH, text)
+
+
+convert()
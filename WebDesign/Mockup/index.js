@@ -31,6 +31,7 @@ let ota_file_upload_button = document.getElementById("upload_ota_file_button");
 let ota_file_upload_progress_bar = document.getElementById(
   "ota_file_upload_progress"
 );
+let ota_status_label = document.getElementById("ota_status");
 
 // Range values
 let master_volume_range = document.getElementById("masterVolume");
@@ -56,6 +57,37 @@ const BALANCE_MIN_VALUE = 0;
 const FADER_STARTING_VALUE = 18;
 const FADER_MAX_VALUE = 36;
 const FADER_MIN_VALUE = 0;
+
+// Binary websocket protocol (CustomDRCWebProtocol.hpp). Records are a 1 byte ID then the payload
+const BINARY_PROTOCOL = "cdrc.bin.v1";
+const BINARY_PARAMETER_IDS = {
+  dspMemory: 0x00,
+  currentSource: 0x01, // String
+  masterVolume: 0x02,
+  subVolume: 0x03,
+  balance: 0x04,
+  fader: 0x05,
+  usbConnected: 0x06,
+  fwVersion: 0x07, // String
+  otaState: 0x08, // From the ESP32 only
+  otaProgress: 0x09, // From the ESP32 only
+  getRemoteSettings: 0x40, // Command, no payload
+  changeSource: 0x41, // Command, no payload
+};
+const BINARY_FIRST_COMMAND_ID = 0x40;
+const BINARY_STRING_IDS = [
+  BINARY_PARAMETER_IDS.currentSource,
+  BINARY_PARAMETER_IDS.fwVersion,
+];
+
+// Ota_State in CustomDRCOta.hpp
+const OTA_STATE_NAMES = [
+  "",
+  "Writing firmware",
+  "Verifying firmware",
+  "Update complete - rebooting",
+  "Update failed",
+];
 /* End global constant defines
 
 /* Define Websocket callback functions */
@@ -74,7 +106,12 @@ function onClose(event) {
 // JSON keys are the same as the element ID
 function onMessage(event) {
   console.log(event.data);
-  var myObj = JSON.parse(event.data);
+  var myObj;
+  if (event.data instanceof ArrayBuffer) {
+    myObj = decode_binary_message(event.data);
+  } else {
+    myObj = JSON.parse(event.data);
+  }
   var keys = Object.keys(myObj);
   for (var i = 0; i < keys.length; i++) {
     var key = keys[i];
@@ -116,6 +153,12 @@ function onMessage(event) {
       var firmware_version_string = myObj[key];
       document.getElementById("firmware_version_string").innerText =
         "Firmware Version: " + firmware_version_string;
+    } else if (key == "otaState") {
+      ota_status_label.innerText = OTA_STATE_NAMES[myObj[key]] || "";
+    } else if (key == "otaProgress") {
+      // What has been written to flash, behind what the browser has sent
+      ota_file_upload_progress_bar.style.display = "block";
+      ota_file_upload_progress_bar.value = myObj[key];
     } else {
       console.log("Unknown websocket JSON key");
     }
@@ -124,6 +167,108 @@ function onMessage(event) {
 /* End websocket callback functions */
 
 // Define helper functions here
+function binary_protocol_active() {
+  return websocket.protocol == BINARY_PROTOCOL;
+}
+
+// Turn binary records into the same object the JSON messages parse to
+function decode_binary_message(buffer) {
+  let bytes = new Uint8Array(buffer);
+  let names = Object.keys(BINARY_PARAMETER_IDS);
+  let message = {};
+  let i = 0;
+  while (i < bytes.length) {
+    let id = bytes[i++];
+    let name = names.find((key) => BINARY_PARAMETER_IDS[key] == id);
+    if (id >= BINARY_FIRST_COMMAND_ID) {
+      continue;
+    }
+    if (BINARY_STRING_IDS.includes(id)) {
+      let length = bytes[i++];
+      message[name] = new TextDecoder().decode(bytes.subarray(i, i + length));
+      i += length;
+    } else {
+      message[name] = bytes[i++];
+    }
+  }
+  return message;
+}
+
+// Send a setting or command (value undefined) in whichever protocol was negotiated
+function send_setting(key, value) {
+  if (binary_protocol_active()) {
+    let id = BINARY_PARAMETER_IDS[key];
+    websocket.send(
+      new Uint8Array(value === undefined ? [id] : [id, Number(value)])
+    );
+  } else {
+    let message = `{${key}: ${value === undefined ? 1 : value}}`;
+    console.log(message);
+    websocket.send(message);
+  }
+}
+
+// SHA-256 of an ArrayBuffer as hex. crypto.subtle only exists on https pages,
+// the ESP32 serves plain http
+function sha256_hex(buffer) {
+  const K = new Uint32Array([
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1,
+    0x923f82a4, 0xab1c5ed5, 0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+    0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174, 0xe49b69c1, 0xefbe4786,
+    0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147,
+    0x06ca6351, 0x14292967, 0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+    0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85, 0xa2bfe8a1, 0xa81a664b,
+    0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a,
+    0x5b9cca4f, 0x682e6ff3, 0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+    0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
+  ]);
+  const H = new Uint32Array([
+    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c,
+    0x1f83d9ab, 0x5be0cd19,
+  ]);
+  let length = buffer.byteLength;
+  let padded_length = Math.ceil((length + 9) / 64) * 64;
+  let bytes = new Uint8Array(padded_length);
+  bytes.set(new Uint8Array(buffer));
+  bytes[length] = 0x80;
+  let view = new DataView(bytes.buffer);
+  view.setUint32(padded_length - 8, Math.floor(length / 0x20000000));
+  view.setUint32(padded_length - 4, (length * 8) >>> 0);
+  let w = new Uint32Array(64);
+  let rotr = (x, n) => (x >>> n) | (x << (32 - n));
+  for (let block = 0; block < padded_length; block += 64) {
+    for (let i = 0; i < 16; i++) {
+      w[i] = view.getUint32(block + i * 4);
+    }
+    for (let i = 16; i < 64; i++) {
+      let s0 = rotr(w[i - 15], 7) ^ rotr(w[i - 15], 18) ^ (w[i - 15] >>> 3);
+      let s1 = rotr(w[i - 2], 17) ^ rotr(w[i - 2], 19) ^ (w[i - 2] >>> 10);
+      w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+    }
+    let [a, b, c, d, e, f, g, h] = H;
+    for (let i = 0; i < 64; i++) {
+      let s1 = rotr(e, 6) ^ rotr(e, 11) ^ rotr(e, 25);
+      let s0 = rotr(a, 2) ^ rotr(a, 13) ^ rotr(a, 22);
+      let t1 = h + s1 + ((e & f) ^ (~e & g)) + K[i] + w[i];
+      let t2 = s0 + ((a & b) ^ (a & c) ^ (b & c));
+      h = g;
+      g = f;
+      f = e;
+      e = (d + t1) >>> 0;
+      d = c;
+      c = b;
+      b = a;
+      a = (t1 + t2) >>> 0;
+    }
+    [a, b, c, d, e, f, g, h].forEach((value, i) => (H[i] += value));
+  }
+  return Array.from(H, (value) => value.toString(16).padStart(8, "0")).join(
+    ""
+  );
+}
+
 function update_range_display(range_to_update, value) {
   range_to_update.value = value;
   var inner_span_str = range_to_update.id + "Value";
@@ -152,24 +297,28 @@ function on_ota_file_upload_button_clicked(event) {
 
   if (file_name.includes(".bin")) {
     console.log("We have a binary file I believe");
-    var url = "/upload";
-    var request = new XMLHttpRequest();
-    request.open("POST", url, true);
-    request.onload = function () {};
-    request.onerror = function () {
-      console.log("Failed to create the /upload request");
-    };
-    request.upload.addEventListener("progress", function (e) {
-      if (e.loaded <= file1Size) {
-        var percent = Math.round((e.loaded / file1Size) * 100);
-        ota_file_upload_progress_bar.value = percent;
-      }
-      if (e.loaded == e.total) {
-        ota_file_upload_progress_bar.value = 100;
-      }
+    let form_data = new FormData(event.target); // create FormData from form that triggered event
+    ota_status_label.innerText = "Hashing firmware";
+    // The ESP32 only boots the image if it hashes to the same SHA-256
+    selected_file.files[0].arrayBuffer().then(function (image) {
+      var url = "/upload";
+      var request = new XMLHttpRequest();
+      request.open("POST", url, true);
+      request.setRequestHeader("X-OTA-Size", file1Size);
+      request.setRequestHeader("X-OTA-SHA256", sha256_hex(image));
+      request.onload = function () {
+        if (request.status != 200) {
+          ota_status_label.innerText = "Update failed";
+        }
+      };
+      request.onerror = function () {
+        console.log("Failed to create the /upload request");
+      };
+      // Progress comes from the ESP32 over the websocket, as it writes to flash
+      request.send(form_data);
+      ota_file_upload_progress_bar.value = 0;
+      ota_file_upload_progress_bar.style.display = "block";
     });
-    request.send(new FormData(event.target)); // create FormData from form that triggered event
-    ota_file_upload_progress_bar.style.display = "block";
   } else {
     console.log("We do not have a binary file");
   }
@@ -188,9 +337,7 @@ function on_credeitals_form_input(event) {
 }
 
 function on_change_source_button_clicked(event) {
-  ws_message = "{changeSource: 1}";
-  websocket.send(ws_message);
-  console.log(ws_message);
+  send_setting("changeSource");
 }
 
 // Function to be called when the window is opened
@@ -210,9 +357,7 @@ function onload(event) {
 
   document.getElementsByName("dspMemory").forEach(function (e) {
     e.addEventListener("click", function () {
-      let message = "{dspMemory: " + e.value + "}";
-      console.log(message);
-      websocket.send(message);
+      send_setting("dspMemory", e.value);
     });
   });
 
@@ -239,9 +384,7 @@ function init_range_inputs() {
 }
 
 function get_remote_settings() {
-  let message = "{getRemoteSettings: 1}";
-  console.log(message);
-  websocket.send(message);
+  send_setting("getRemoteSettings");
 }
 
 function send_password_auth() {
@@ -265,16 +408,16 @@ function on_quit_button_pressed() {
 
 function on_range_update() {
   var slider_value = this.value;
-  var message = `{${this.id}: ${slider_value}}`;
   var dom_value_string = this.id + "Value";
   document.getElementById(dom_value_string).innerHTML = this.value;
-  console.log(message);
-  websocket.send(message); // Now we send this through the WS to the MCU
+  send_setting(this.id, slider_value); // Now we send this through the WS to the MCU
 }
 
 function initWebSocket() {
   console.log("Trying to open a WebSocket connection…");
-  websocket = new WebSocket(gateway);
+  // If the server does not answer with the binary protocol we stay on JSON
+  websocket = new WebSocket(gateway, [BINARY_PROTOCOL]);
+  websocket.binaryType = "arraybuffer";
   websocket.onopen = onOpen;
   websocket.onclose = onClose;
   websocket.onmessage = onMessage;